@@ -95,6 +95,8 @@ void EditorLayer::CreateDefaultScene()
 
 void EditorLayer::OnDetach()
 {
+    // Cached tilemap chunks hold GPU buffers; free them while the device is alive
+    m_TilemapRenderSystem.ReleaseCache();
     m_ActiveScene.reset();
     m_ViewportFramebuffer.reset();
     GG_INFO("EditorLayer detached");
@@ -126,6 +128,10 @@ void EditorLayer::OnRenderOffscreen(GGEngine::Timestep ts)
         }
     }
 
+    // Simulate particle emitters, then index this frame's transforms for culling and picking
+    m_ParticleUpdateSystem.Execute(*m_ActiveScene, ts);
+    m_ActiveScene->OnUpdate(ts);
+
     auto& device = GGEngine::RHIDevice::Get();
     GGEngine::RHICommandBufferHandle cmd = device.GetCurrentCommandBuffer();
 
@@ -142,13 +148,16 @@ void EditorLayer::OnRenderOffscreen(GGEngine::Timestep ts)
     ctx.ViewportHeight = m_ViewportFramebuffer->GetHeight();
     ctx.ExternalCamera = &m_CameraController.GetCamera();
 
-    // Render tilemaps first (background), then sprites (foreground)
+    // Render tilemaps first (background), then sprites, then particles (foreground)
     m_TilemapRenderSystem.SetRenderContext(ctx);
     m_TilemapRenderSystem.Execute(*m_ActiveScene, 0.0f);
 
     m_SpriteRenderSystem.SetRenderContext(ctx);
     m_SpriteRenderSystem.Execute(*m_ActiveScene, 0.0f);
 
+    m_ParticleRenderSystem.SetRenderContext(ctx);
+    m_ParticleRenderSystem.Execute(*m_ActiveScene, 0.0f);
+
     m_ViewportFramebuffer->EndRenderPass(cmd);
 }
 
@@ -602,6 +611,51 @@ void EditorLayer::DrawPropertiesPanel(GGEngine::Timestep ts)
             }
         }
 
+        // ParticleEmitterComponent
+        if (m_ActiveScene->HasComponent<GGEngine::ParticleEmitterComponent>(m_SelectedEntity))
+        {
+            if (ImGui::CollapsingHeader("Particle Emitter", ImGuiTreeNodeFlags_DefaultOpen))
+            {
+                auto* emitter = m_ActiveScene->GetComponent<GGEngine::ParticleEmitterComponent>(m_SelectedEntity);
+
+                ImGui::Checkbox("Emitting", &emitter->Emitting);
+                ImGui::DragFloat("Rate", &emitter->Rate, 1.0f, 0.0f, 100000.0f, "%.0f /s");
+
+                int burstCount = static_cast<int>(emitter->BurstCount);
+                if (ImGui::DragInt("Burst Count", &burstCount, 1.0f, 0, 100000))
+                    emitter->BurstCount = static_cast<uint32_t>(burstCount);
+                ImGui::DragFloat("Burst Interval", &emitter->BurstInterval, 0.05f, 0.0f, 60.0f, "%.2f s");
+
+                ImGui::DragFloat("Direction", &emitter->Direction, 1.0f, -360.0f, 360.0f, "%.1f deg");
+                ImGui::DragFloat("Cone Angle", &emitter->ConeAngle, 1.0f, 0.0f, 360.0f, "%.1f deg");
+                ImGui::DragFloat("Speed", &emitter->Speed, 0.05f, 0.0f, 1000.0f);
+                ImGui::DragFloat("Speed Variation", &emitter->SpeedVariation, 0.05f, 0.0f, 1000.0f);
+
+                ImGui::DragFloat("Lifetime", &emitter->LifeTime, 0.05f, 0.0f, 60.0f, "%.2f s");
+                ImGui::DragFloat("Lifetime Variation", &emitter->LifeTimeVariation, 0.05f, 0.0f, 60.0f, "%.2f s");
+
+                ImGui::ColorEdit4("Color Begin", emitter->ColorBegin);
+                ImGui::ColorEdit4("Color End", emitter->ColorEnd);
+                ImGui::DragFloat("Size Begin", &emitter->SizeBegin, 0.01f, 0.0f, 100.0f);
+                ImGui::DragFloat("Size End", &emitter->SizeEnd, 0.01f, 0.0f, 100.0f);
+                ImGui::DragFloat("Size Variation", &emitter->SizeVariation, 0.01f, 0.0f, 100.0f);
+
+                int maxParticles = static_cast<int>(emitter->MaxParticles);
+                if (ImGui::DragInt("Max Particles", &maxParticles, 10.0f, 0, 1000000))
+                    emitter->MaxParticles = static_cast<uint32_t>(maxParticles);
+
+                ImGui::Text("Live: %u", emitter->Particles.GetActiveCount());
+            }
+        }
+        else
+        {
+            // Add Particle Emitter button
+            if (ImGui::Button("Add Particle Emitter"))
+            {
+                m_ActiveScene->AddComponent<GGEngine::ParticleEmitterComponent>(m_SelectedEntity);
+            }
+        }
+
         ImGui::Separator();
 
         // Delete entity button
@@ -627,6 +681,7 @@ void EditorLayer::DrawPropertiesPanel(GGEngine::Timestep ts)
         ImGui::Text("Renderer2D Stats:");
         ImGui::Text("  Draw Calls: %d", stats.DrawCalls);
         ImGui::Text("  Quads: %d", stats.QuadCount);
+        ImGui::Text("  Visible / Culled: %u / %u", stats.VisibleCount, stats.CulledCount);
         ImGui::Separator();
         if (m_ActiveScene)
         {
@@ -725,6 +780,16 @@ void EditorLayer::OnUpdate(GGEngine::Timestep ts)
         ImGui::Image(
             m_ViewportFramebuffer->GetImGuiTextureID(),
             ImVec2(displayWidth, displayHeight));
+
+        // Click to select what's under the cursor
+        if (ImGui::IsItemHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+        {
+            ImVec2 mouse = ImGui::GetMousePos();
+            ImVec2 imageMin = ImGui::GetItemRectMin();
+            ImVec2 imageSize = ImGui::GetItemRectSize();
+            if (imageSize.x > 0.0f && imageSize.y > 0.0f)
+                PickEntity((mouse.x - imageMin.x) / imageSize.x, (mouse.y - imageMin.y) / imageSize.y);
+        }
     }
 
     ImGui::End();
@@ -777,8 +842,50 @@ void EditorLayer::OnWindowResize(uint32_t width, uint32_t height)
     // so we don't need to update aspect ratio here.
 }
 
+void EditorLayer::PickEntity(float u, float v)
+{
+    if (!m_ActiveScene)
+        return;
+
+    // Viewport position to NDC. The projection already flips Y for Vulkan, so
+    // the top of the viewport (v = 0) is NDC y = -1.
+    const glm::vec4 ndc(u * 2.0f - 1.0f, v * 2.0f - 1.0f, 0.0f, 1.0f);
+    const glm::vec4 world = glm::inverse(m_CameraController.GetCamera().GetViewProjectionMatrix()) * ndc;
+
+    m_PickCandidates.clear();
+    m_ActiveScene->GetSpatialIndex().QueryPoint(world.x / world.w, world.y / world.w, m_PickCandidates);
+
+    // Renderer2D doesn't depth test, so whatever is drawn last is on top:
+    // tilemaps before sprites, each in Scene::Each order (see the render
+    // systems). Entities that draw nothing can't be picked, and clicking
+    // empty space clears the selection.
+    GGEngine::Entity picked = GGEngine::InvalidEntity;
+    if (!m_PickCandidates.empty())
+    {
+        std::sort(m_PickCandidates.begin(), m_PickCandidates.end());
+        auto consider = [&](GGEngine::Entity entity)
+        {
+            if (std::binary_search(m_PickCandidates.begin(), m_PickCandidates.end(), entity))
+                picked = entity;
+        };
+        m_ActiveScene->Each<const GGEngine::TransformComponent, const GGEngine::TilemapComponent>(
+            [&](GGEngine::Entity entity, const GGEngine::TransformComponent&, const GGEngine::TilemapComponent&)
+        {
+            consider(entity);
+        });
+        m_ActiveScene->Each<const GGEngine::TransformComponent, const GGEngine::SpriteRendererComponent>(
+            [&](GGEngine::Entity entity, const GGEngine::TransformComponent&, const GGEngine::SpriteRendererComponent&)
+        {
+            consider(entity);
+        });
+    }
+
+    m_SelectedEntity = picked == GGEngine::InvalidEntity ? GGEngine::InvalidEntityID : m_ActiveScene->GetEntityID(picked);
+}
+
 void EditorLayer::NewScene()
 {
+    m_TilemapRenderSystem.ReleaseCache();
     m_ActiveScene = GGEngine::CreateScope<GGEngine::Scene>("Untitled Scene");
     m_SelectedEntity = GGEngine::InvalidEntityID;
     m_CurrentScenePath.clear();
@@ -790,6 +897,7 @@ void EditorLayer::OpenScene()
     std::string filepath = GGEngine::FileDialogs::OpenFile("*.scene", "Open Scene");
     if (!filepath.empty())
     {
+        m_TilemapRenderSystem.ReleaseCache();
         m_ActiveScene = GGEngine::CreateScope<GGEngine::Scene>();
         GGEngine::SceneSerializer serializer(m_ActiveScene.get());
         if (serializer.Deserialize(filepath))
@@ -10,6 +10,8 @@
 #include "GGEngine/ECS/Entity.h"
 #include "GGEngine/ECS/Systems/SpriteRenderSystem.h"
 #include "GGEngine/ECS/Systems/TilemapRenderSystem.h"
+#include "GGEngine/ECS/Systems/ParticleUpdateSystem.h"
+#include "GGEngine/ECS/Systems/ParticleRenderSystem.h"
 
 class EditorLayer : public GGEngine::Layer
 {
@@ -36,6 +38,9 @@ private:
     void SaveScene();
     void SaveSceneAs();
 
+    // Select the topmost entity at a viewport position (0..1, origin top-left)
+    void PickEntity(float u, float v);
+
     GGEngine::Scope<GGEngine::Framebuffer> m_ViewportFramebuffer;
 
     // Camera system
@@ -44,6 +49,10 @@ private:
     // Render systems
     GGEngine::TilemapRenderSystem m_TilemapRenderSystem;
     GGEngine::SpriteRenderSystem m_SpriteRenderSystem;
+    GGEngine::ParticleRenderSystem m_ParticleRenderSystem;
+
+    // Simulation systems
+    GGEngine::ParticleUpdateSystem m_ParticleUpdateSystem;
 
     // Viewport state
     float m_ViewportWidth = 0.0f;
@@ -60,6 +69,7 @@ private:
 
     // Selection state
     GGEngine::EntityID m_SelectedEntity = GGEngine::InvalidEntityID;
+    std::vector<GGEngine::Entity> m_PickCandidates;   // Reused by PickEntity
 
     // Tilemap editing state
     int32_t m_SelectedAtlasTile = 0;     // Currently selected tile for painting
@@ -1,6 +1,7 @@
 #include "ggpch.h"
 #include "AssetManager.h"
 #include "Texture.h"
+#include "TextureContainer.h"
 #include "Shader.h"
 #include "GGEngine/Core/TaskGraph.h"
 
@@ -81,8 +82,8 @@ namespace GGEngine {
 
         GG_CORE_TRACE("Async texture load started: {} (ID: {})", path, assetId);
 
-        // Submit task to load CPU data on worker thread
-        TaskGraph::Get().CreateTask(
+        // Submit task to load CPU data on worker thread (fire-and-forget, so release the id)
+        TaskID loadTask = TaskGraph::Get().CreateTask(
             "LoadTexture:" + path,
             [this, path, assetId]() -> TaskResult {
                 // Worker thread: Load texture data to CPU
@@ -104,6 +105,7 @@ namespace GGEngine {
                 return TaskResult::Success();
             }
         );
+        TaskGraph::Get().Release(loadTask);
 
         return handle;
     }
@@ -443,9 +445,10 @@ namespace GGEngine {
         std::string ext = changedPath.extension().string();
         std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
 
-        // Supported texture formats
+        // Supported texture formats, and their cooked containers
         bool isTexture = (ext == ".png" || ext == ".jpg" || ext == ".jpeg" ||
-                          ext == ".bmp" || ext == ".tga" || ext == ".gif");
+                          ext == ".bmp" || ext == ".tga" || ext == ".gif" ||
+                          ext == TextureContainerExtension);
 
         // Supported shader formats (compiled SPIR-V)
         bool isShader = (ext == ".spv");
@@ -496,14 +499,19 @@ namespace GGEngine {
                 {
                     Texture* texture = static_cast<Texture*>(asset.get());
                     std::filesystem::path resolvedAssetPath = ResolvePath(texture->GetSourcePath());
+                    std::filesystem::path cookedAssetPath = ResolvePath(GetCookedTexturePath(texture->GetSourcePath()).string());
 
-                    // Compare canonical paths
+                    // Compare canonical paths (a re-cooked container reloads its texture too)
                     try
                     {
                         auto canonicalChanged = std::filesystem::canonical(changedPath);
-                        auto canonicalAsset = std::filesystem::canonical(resolvedAssetPath);
+                        std::error_code error;
+                        bool matches = std::filesystem::exists(resolvedAssetPath, error) &&
+                                       canonicalChanged == std::filesystem::canonical(resolvedAssetPath);
+                        matches = matches || (std::filesystem::exists(cookedAssetPath, error) &&
+                                              canonicalChanged == std::filesystem::canonical(cookedAssetPath));
 
-                        if (canonicalChanged == canonicalAsset)
+                        if (matches)
                         {
                             GG_CORE_INFO("Hot reload triggered for texture: {}", assetPath);
 
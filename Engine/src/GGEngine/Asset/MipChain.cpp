@@ -0,0 +1,140 @@
+#include "ggpch.h"
+#include "MipChain.h"
+#include "GGEngine/Core/Profiler.h"
+#include "GGEngine/Core/SIMD.h"
+#include "GGEngine/Core/TaskGraph.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace GGEngine {
+
+    namespace {
+
+        // Output pixels worth handing to another worker
+        constexpr size_t MinPixelsPerTask = 16384;
+
+        // Source columns/rows feeding output column/row i: 2i and 2i + 1,
+        // except that a 1-wide source feeds both from its only column
+        uint32_t SecondTap(uint32_t i, uint32_t sourceSize)
+        {
+            return sourceSize > 1 ? i * 2 + 1 : 0;
+        }
+
+        void DownsampleRows(const uint8_t* source, uint32_t width, uint32_t height, uint8_t* destination,
+                            size_t firstRow, size_t lastRow)
+        {
+            using namespace Simd;
+
+            const uint32_t outWidth = std::max(width / 2, 1u);
+            const Float4 quarter = Splat(0.25f);
+
+            for (size_t y = firstRow; y < lastRow; y++)
+            {
+                const uint8_t* row0 = source + static_cast<size_t>(y * 2) * width * 4;
+                const uint8_t* row1 = source + static_cast<size_t>(SecondTap(static_cast<uint32_t>(y), height)) * width * 4;
+                uint8_t* out = destination + y * outWidth * 4;
+
+                for (uint32_t x = 0; x < outWidth; x++)
+                {
+                    const size_t left = static_cast<size_t>(x) * 8;
+                    const size_t right = static_cast<size_t>(SecondTap(x, width)) * 4;
+                    const Float4 sum = (LoadBytes(row0 + left) + LoadBytes(row0 + right)) +
+                                       (LoadBytes(row1 + left) + LoadBytes(row1 + right));
+                    StoreBytes(out + x * 4, sum * quarter);
+                }
+            }
+        }
+
+    }
+
+    std::vector<TextureMipLevel> GetMipChainLayout(uint32_t width, uint32_t height)
+    {
+        std::vector<TextureMipLevel> levels;
+        if (width == 0 || height == 0)
+            return levels;
+
+        uint64_t offset = 0;
+        while (true)
+        {
+            TextureMipLevel level;
+            level.width = width;
+            level.height = height;
+            level.offset = offset;
+            level.size = static_cast<uint64_t>(width) * height * 4;
+            levels.push_back(level);
+            offset += level.size;
+
+            if (width == 1 && height == 1)
+                break;
+            width = std::max(width / 2, 1u);
+            height = std::max(height / 2, 1u);
+        }
+        return levels;
+    }
+
+    uint64_t GetMipChainSize(const std::vector<TextureMipLevel>& levels, uint32_t firstLevel)
+    {
+        uint64_t size = 0;
+        for (size_t i = firstLevel; i < levels.size(); i++)
+            size += levels[i].size;
+        return size;
+    }
+
+    void DownsampleRGBA8(const uint8_t* source, uint32_t width, uint32_t height, uint8_t* destination)
+    {
+        const uint32_t outWidth = std::max(width / 2, 1u);
+        const uint32_t outHeight = std::max(height / 2, 1u);
+        const size_t minRows = std::max<size_t>(MinPixelsPerTask / outWidth, 1);
+
+        TaskGraph::Get().ParallelFor(0, outHeight, minRows, [&](size_t firstRow, size_t lastRow)
+        {
+            DownsampleRows(source, width, height, destination, firstRow, lastRow);
+        });
+    }
+
+    void DownsampleRGBA8Scalar(const uint8_t* source, uint32_t width, uint32_t height, uint8_t* destination)
+    {
+        const uint32_t outWidth = std::max(width / 2, 1u);
+        const uint32_t outHeight = std::max(height / 2, 1u);
+
+        for (uint32_t y = 0; y < outHeight; y++)
+        {
+            const uint32_t rows[2] = { y * 2, SecondTap(y, height) };
+            for (uint32_t x = 0; x < outWidth; x++)
+            {
+                const uint32_t columns[2] = { x * 2, SecondTap(x, width) };
+                for (uint32_t channel = 0; channel < 4; channel++)
+                {
+                    uint32_t sum = 0;
+                    for (uint32_t row : rows)
+                    {
+                        for (uint32_t column : columns)
+                            sum += source[(static_cast<size_t>(row) * width + column) * 4 + channel];
+                    }
+                    // Same rounding as the SIMD path: to nearest, ties to even
+                    destination[(static_cast<size_t>(y) * outWidth + x) * 4 + channel] =
+                        static_cast<uint8_t>(std::nearbyint(static_cast<float>(sum) * 0.25f));
+                }
+            }
+        }
+    }
+
+    std::vector<TextureMipLevel> GenerateMipChain(std::vector<uint8_t>& pixels, uint32_t width, uint32_t height)
+    {
+        GG_PROFILE_FUNCTION();
+
+        std::vector<TextureMipLevel> levels = GetMipChainLayout(width, height);
+        if (levels.empty() || pixels.size() < levels[0].size)
+            return {};
+
+        pixels.resize(GetMipChainSize(levels));
+        for (size_t i = 1; i < levels.size(); i++)
+        {
+            const TextureMipLevel& above = levels[i - 1];
+            DownsampleRGBA8(pixels.data() + above.offset, above.width, above.height, pixels.data() + levels[i].offset);
+        }
+        return levels;
+    }
+
+}
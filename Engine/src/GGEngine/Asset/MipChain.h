@@ -0,0 +1,44 @@
+#pragma once
+
+#include "GGEngine/Core/Core.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace GGEngine {
+
+    // One level of a mip chain packed into a single RGBA8 pixel array
+    struct GG_API TextureMipLevel
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint64_t offset = 0;   // Bytes from the start of level 0
+        uint64_t size = 0;     // width * height * 4
+    };
+
+    // Levels of a full chain for a width x height RGBA8 image, level 0 first
+    // and each following level half the size of the one above it (rounded
+    // down, never below 1), down to 1x1. Levels are packed back to back.
+    GG_API std::vector<TextureMipLevel> GetMipChainLayout(uint32_t width, uint32_t height);
+
+    // Bytes of levels [firstLevel, levels.size()) of a packed chain
+    GG_API uint64_t GetMipChainSize(const std::vector<TextureMipLevel>& levels, uint32_t firstLevel = 0);
+
+    // Write the next level of a width x height RGBA8 image to destination,
+    // which must hold max(width / 2, 1) x max(height / 2, 1) pixels. Each
+    // output pixel is the 2x2 box average of the pixels it covers, so the last
+    // row/column of an odd-sized image is dropped.
+    //
+    // Rows are split across TaskGraph workers, and each pixel's four channels
+    // are filtered together in one 4-wide SIMD register (see Core/SIMD.h).
+    // Results match DownsampleRGBA8Scalar exactly.
+    GG_API void DownsampleRGBA8(const uint8_t* source, uint32_t width, uint32_t height, uint8_t* destination);
+
+    // One channel at a time on the calling thread; the reference for the SIMD path
+    GG_API void DownsampleRGBA8Scalar(const uint8_t* source, uint32_t width, uint32_t height, uint8_t* destination);
+
+    // Grow pixels, holding a width x height RGBA8 image, into the packed full
+    // chain GetMipChainLayout describes, and return that layout
+    GG_API std::vector<TextureMipLevel> GenerateMipChain(std::vector<uint8_t>& pixels, uint32_t width, uint32_t height);
+
+}
@@ -2,13 +2,31 @@
 #include "Texture.h"
 #include "GGEngine/Core/Profiler.h"
 #include "AssetManager.h"
+#include "TextureContainer.h"
 #include "GGEngine/RHI/RHIDevice.h"
+#include "GGEngine/Renderer/TextureStreamer.h"
+#include "GGEngine/Renderer/TransferQueue.h"
 
 #include <stb_image.h>
+#include <cmath>
 #include <vector>
 
 namespace GGEngine {
 
+    namespace {
+
+        // Layout of an image without a mip chain
+        std::vector<TextureMipLevel> SingleLevel(uint32_t width, uint32_t height)
+        {
+            TextureMipLevel level;
+            level.width = width;
+            level.height = height;
+            level.size = static_cast<uint64_t>(width) * height * 4;
+            return { level };
+        }
+
+    }
+
     // Static member initialization
     Scope<Texture> Texture::s_FallbackTexture;
 
@@ -57,7 +75,7 @@ namespace GGEngine {
         s_FallbackTexture->m_Path = "__fallback__";
         s_FallbackTexture->SetState(AssetState::Ready);
 
-        s_FallbackTexture->CreateResources(pixels.data());
+        s_FallbackTexture->CreateResources(pixels.data(), SingleLevel(size, size));
 
         GG_CORE_INFO("Fallback texture initialized ({}x{} magenta/black checkerboard)", size, size);
     }
@@ -102,7 +120,7 @@ namespace GGEngine {
         texture->m_MinFilter = minFilter;
         texture->m_MagFilter = magFilter;
 
-        texture->CreateResources(static_cast<const uint8_t*>(data));
+        texture->CreateResources(static_cast<const uint8_t*>(data), SingleLevel(width, height));
 
         GG_CORE_TRACE("Created {}x{} texture from raw pixel data", width, height);
         return texture;
@@ -132,29 +150,77 @@ namespace GGEngine {
         GG_PROFILE_SCOPE("Texture::LoadCPU");
 
         // Resolve path through asset manager
-        auto resolvedPath = AssetManager::Get().ResolvePath(path);
-        std::string pathStr = resolvedPath.string();
+        auto& assetManager = AssetManager::Get();
+        auto resolvedPath = assetManager.ResolvePath(path);
+
+        // Cooked container: mapped as is, no decode or mip generation
+        if (resolvedPath.extension() == TextureContainerExtension)
+        {
+            auto cooked = ReadTextureContainer(resolvedPath);
+            if (cooked.IsErr())
+                return Result<TextureCPUData>::Err("Failed to load texture '" + path + "': " + cooked.Error());
+            cooked.Value().sourcePath = path;
+            return cooked;
+        }
 
-        // Load image using stb_image (thread-safe as long as we don't share file handles)
+        // Prefer the source's cooked form unless the source was edited since it was cooked
+        auto cookedPath = assetManager.ResolvePath(GetCookedTexturePath(path).string());
+        std::error_code error;
+        if (std::filesystem::exists(cookedPath, error))
+        {
+            const bool stale = std::filesystem::exists(resolvedPath, error) &&
+                std::filesystem::last_write_time(cookedPath, error) < std::filesystem::last_write_time(resolvedPath, error);
+            if (!stale)
+            {
+                auto cooked = ReadTextureContainer(cookedPath);
+                if (cooked.IsOk())
+                {
+                    cooked.Value().sourcePath = path;
+                    GG_CORE_TRACE("Texture::LoadCPU mapped cooked texture: {} ({}x{}, {} mips)", path,
+                                  cooked.Value().width, cooked.Value().height, cooked.Value().GetMipCount());
+                    return cooked;
+                }
+                GG_CORE_WARN("Ignoring cooked texture for '{}': {}", path, cooked.Error());
+            }
+        }
+
+        // Uncooked source: decode with stb_image
+        std::vector<char> encoded;
+        {
+            GG_PROFILE_SCOPE("ReadTextureFile");
+            encoded = assetManager.ReadFileRawAbsolute(resolvedPath);
+        }
+        if (encoded.empty())
+            return Result<TextureCPUData>::Err("Failed to load texture '" + path + "': file not found or empty");
+
+        return DecodeCPU(reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size(), path);
+    }
+
+    Result<TextureCPUData> Texture::DecodeCPU(const uint8_t* encoded, size_t size, const std::string& sourcePath)
+    {
+        GG_PROFILE_SCOPE("Texture::DecodeCPU");
+
+        // Decode using stb_image (thread-safe as long as we don't share buffers)
         int width, height, channels;
         stbi_set_flip_vertically_on_load(1);  // Vulkan expects bottom-left origin like OpenGL
 
         unsigned char* pixels;
         {
             GG_PROFILE_SCOPE("stbi_load");
-            pixels = stbi_load(pathStr.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+            pixels = stbi_load_from_memory(encoded, static_cast<int>(size), &width, &height, &channels, STBI_rgb_alpha);
         }
 
         if (!pixels)
         {
             return Result<TextureCPUData>::Err(
-                "Failed to load texture '" + path + "': " + stbi_failure_reason());
+                "Failed to load texture '" + sourcePath + "': " + stbi_failure_reason());
         }
 
         // Copy pixel data to our vector (stbi uses malloc, we need to free it)
         TextureCPUData result;
-        result.sourcePath = path;
+        result.sourcePath = sourcePath;
         uint64_t imageSize = static_cast<uint64_t>(width) * height * 4;
+        result.pixels.reserve(GetMipChainSize(GetMipChainLayout(width, height)));  // Room for the chain below
         result.pixels.resize(imageSize);
         std::memcpy(result.pixels.data(), pixels, imageSize);
         result.width = static_cast<uint32_t>(width);
@@ -163,7 +229,10 @@ namespace GGEngine {
 
         stbi_image_free(pixels);
 
-        GG_CORE_TRACE("Texture::LoadCPU completed: {} ({}x{})", path, result.width, result.height);
+        // Generate the rest of the mip chain here, off the main thread
+        result.mips = GenerateMipChain(result.pixels, result.width, result.height);
+
+        GG_CORE_TRACE("Texture::LoadCPU completed: {} ({}x{}, {} mips)", sourcePath, result.width, result.height, result.GetMipCount());
         return Result<TextureCPUData>::Ok(std::move(result));
     }
 
@@ -179,49 +248,104 @@ namespace GGEngine {
         m_Width = cpuData.width;
         m_Height = cpuData.height;
         m_Channels = cpuData.channels;
-        m_Format = TextureFormat::R8G8B8A8_UNORM;
+        m_Format = cpuData.format;
         m_Path = cpuData.sourcePath;
         m_SourcePath = cpuData.sourcePath;
 
-        CreateResources(cpuData.pixels.data());
+        if (cpuData.mips.empty())
+            cpuData.mips = SingleLevel(cpuData.width, cpuData.height);
 
-        // Clear CPU data to free memory (pixels moved, now release)
-        cpuData.pixels.clear();
-        cpuData.pixels.shrink_to_fit();
+        // With a streamer running, large textures start with only their tail
+        // resident and keep the chain on the CPU to stream the rest in from
+        auto& streamer = TextureStreamer::Get();
+        const uint32_t firstMip = streamer.IsInitialized() ? TextureStreamer::GetTailMip(cpuData.mips) : 0;
+
+        CreateResources(cpuData.GetPixels(), cpuData.mips, firstMip);
+
+        if (firstMip > 0 && m_Handle.IsValid())
+        {
+            m_StreamSource = std::move(cpuData);
+            m_Streamed = true;
+            streamer.Register(*this);
+        }
+        else
+        {
+            // Clear CPU data to free memory (pixels moved, now release).
+            // Queued uploads copied the bytes to staging, so a mapping can go too.
+            cpuData.pixels.clear();
+            cpuData.pixels.shrink_to_fit();
+            cpuData.mappedPixels = nullptr;
+            cpuData.file.reset();
+        }
 
         SetState(AssetState::Ready);
-        GG_CORE_INFO("Texture uploaded to GPU: {} ({}x{})", m_SourcePath, m_Width, m_Height);
+        GG_CORE_INFO("Texture uploaded to GPU: {} ({}x{}, {} mips{})", m_SourcePath, m_Width, m_Height,
+                     m_MipCount, m_Streamed ? ", streamed" : "");
         return Result<void>::Ok();
     }
 
-    void Texture::CreateResources(const uint8_t* pixels)
+    RHITextureHandle Texture::CreateImage(const uint8_t* pixels, const std::vector<TextureMipLevel>& mips,
+                                          uint32_t firstMip) const
     {
         auto& device = RHIDevice::Get();
-        uint64_t imageSize = m_Width * m_Height * 4;
+        const TextureMipLevel& top = mips[firstMip];
+        const uint32_t levelCount = static_cast<uint32_t>(mips.size()) - firstMip;
 
-        // 1. Create texture through RHI device
         RHITextureSpecification textureSpec;
-        textureSpec.width = m_Width;
-        textureSpec.height = m_Height;
+        textureSpec.width = top.width;
+        textureSpec.height = top.height;
         textureSpec.depth = 1;
-        textureSpec.mipLevels = 1;
+        textureSpec.mipLevels = levelCount;
         textureSpec.arrayLayers = 1;
         textureSpec.format = m_Format;
         textureSpec.samples = SampleCount::Count1;
         textureSpec.usage = TextureUsage::Sampled | TextureUsage::TransferDst;
         textureSpec.debugName = m_Path.string();
 
-        m_Handle = device.CreateTexture(textureSpec);
+        RHITextureHandle handle = device.CreateTexture(textureSpec);
+        if (!handle.IsValid())
+            return handle;
+
+        const uint8_t* data = pixels + top.offset;
+        if (levelCount == 1)
+        {
+            // Handles staging, layout transitions internally
+            device.UploadTextureData(handle, data, top.size);
+            return handle;
+        }
+
+        // One staging buffer and one copy per level, recorded with the frame's other uploads
+        std::vector<RHIBufferImageCopy> regions;
+        regions.reserve(levelCount);
+        for (uint32_t i = 0; i < levelCount; i++)
+        {
+            const TextureMipLevel& level = mips[firstMip + i];
+            RHIBufferImageCopy region;
+            region.bufferOffset = level.offset - top.offset;
+            region.imageWidth = level.width;
+            region.imageHeight = level.height;
+            region.mipLevel = i;
+            regions.push_back(region);
+        }
+        TransferQueue::Get().QueueTextureUpload(handle, data, GetMipChainSize(mips, firstMip), std::move(regions));
+        return handle;
+    }
+
+    void Texture::CreateResources(const uint8_t* pixels, const std::vector<TextureMipLevel>& mips, uint32_t firstMip)
+    {
+        auto& device = RHIDevice::Get();
+
+        // 1. Create texture through RHI device and upload pixel data
+        m_Handle = CreateImage(pixels, mips, firstMip);
         if (!m_Handle.IsValid())
         {
             GG_CORE_ERROR("Failed to create texture through RHI!");
             return;
         }
+        m_MipCount = static_cast<uint32_t>(mips.size());
+        m_ResidentMip = firstMip;
 
-        // 2. Upload pixel data (handles staging, layout transitions internally)
-        device.UploadTextureData(m_Handle, pixels, imageSize);
-
-        // 3. Create sampler with configured filtering
+        // 2. Create sampler with configured filtering
         RHISamplerSpecification samplerSpec;
         samplerSpec.minFilter = m_MinFilter;
         samplerSpec.magFilter = m_MagFilter;
@@ -239,15 +363,53 @@ namespace GGEngine {
             return;
         }
 
-        // 4. Register with BindlessTextureManager for bindless rendering
-        // Only register if the manager is initialized (it may not be during fallback texture creation)
+        // 3. Register with BindlessTextureManager for bindless rendering
+        // Only register if the manager is initialized (it may not be during fallback texture creation).
+        // A texture that already has a slot (hot reload) keeps it.
         auto& bindlessManager = BindlessTextureManager::Get();
-        if (bindlessManager.GetMaxTextures() > 0)
+        if (m_BindlessIndex != InvalidBindlessIndex)
+        {
+            m_BindlessIndex = bindlessManager.RegisterTextureAtIndex(*this, m_BindlessIndex);
+        }
+        else if (bindlessManager.GetMaxTextures() > 0)
         {
             m_BindlessIndex = bindlessManager.RegisterTexture(*this);
         }
     }
 
+    RHITextureHandle Texture::StreamTo(uint32_t residentMip)
+    {
+        const auto& mips = m_StreamSource.mips;
+        RHITextureHandle handle = CreateImage(m_StreamSource.GetPixels(), mips, residentMip);
+        if (!handle.IsValid())
+        {
+            GG_CORE_ERROR("Failed to create streamed texture image: {} (mip {})", m_SourcePath, residentMip);
+            return NullTexture;
+        }
+
+        // Swap images under the same bindless slot so cached indices stay valid
+        RHITextureHandle old = m_Handle;
+        m_Handle = handle;
+        m_ResidentMip = residentMip;
+        if (m_BindlessIndex != InvalidBindlessIndex)
+            BindlessTextureManager::Get().RegisterTextureAtIndex(*this, m_BindlessIndex);
+        return old;
+    }
+
+    void Texture::RequestMip(float texelsPerPixel)
+    {
+        // Coarsest level that still has at least one texel per pixel
+        uint32_t mip = 0;
+        if (texelsPerPixel > 1.0f)
+            mip = static_cast<uint32_t>(std::min(std::log2(texelsPerPixel), static_cast<float>(m_MipCount - 1)));
+
+        // Keep the finest level requested this frame
+        uint32_t current = m_RequestedMip.load(std::memory_order_relaxed);
+        while (mip < current && !m_RequestedMip.compare_exchange_weak(current, mip, std::memory_order_relaxed))
+        {
+        }
+    }
+
 #ifndef GG_DIST
     Result<void> Texture::Reload()
     {
@@ -258,10 +420,8 @@ namespace GGEngine {
             return Result<void>::Err("Cannot reload texture without source path");
         }
 
-        // Save the bindless index before unloading
+        // The bindless index survives so the new image reuses the same slot
         BindlessTextureIndex savedIndex = m_BindlessIndex;
-        Filter savedMinFilter = m_MinFilter;
-        Filter savedMagFilter = m_MagFilter;
 
         GG_CORE_INFO("Hot reloading texture: {} (bindless index: {})", m_SourcePath, savedIndex);
 
@@ -269,6 +429,13 @@ namespace GGEngine {
 
         // Destroy GPU resources WITHOUT unregistering from bindless manager
         // (we want to reuse the same slot)
+        if (m_Streamed)
+        {
+            TextureStreamer::Get().Unregister(*this);
+            m_StreamSource = TextureCPUData();
+            m_Streamed = false;
+        }
+
         if (m_SamplerHandle.IsValid())
         {
             RHIDevice::Get().DestroySampler(m_SamplerHandle);
@@ -288,74 +455,20 @@ namespace GGEngine {
             SetError(cpuDataResult.Error());
             return Result<void>::Err("Hot reload failed: " + cpuDataResult.Error());
         }
-        auto cpuData = std::move(cpuDataResult).Value();
 
-        // Store dimensions and path
-        m_Width = cpuData.width;
-        m_Height = cpuData.height;
-        m_Channels = cpuData.channels;
-        m_MinFilter = savedMinFilter;
-        m_MagFilter = savedMagFilter;
-
-        // Create new GPU resources
-        auto& device = RHIDevice::Get();
-        uint64_t imageSize = m_Width * m_Height * 4;
+        // Create new GPU resources, re-registering at the same bindless index
+        // (filters are kept from before)
+        auto uploadResult = UploadGPU(std::move(cpuDataResult).Value());
+        if (uploadResult.IsErr())
+            return uploadResult;
+        if (!m_Handle.IsValid() || !m_SamplerHandle.IsValid())
+            return Result<void>::Err("Failed to create GPU resources during reload");
 
-        RHITextureSpecification textureSpec;
-        textureSpec.width = m_Width;
-        textureSpec.height = m_Height;
-        textureSpec.depth = 1;
-        textureSpec.mipLevels = 1;
-        textureSpec.arrayLayers = 1;
-        textureSpec.format = m_Format;
-        textureSpec.samples = SampleCount::Count1;
-        textureSpec.usage = TextureUsage::Sampled | TextureUsage::TransferDst;
-        textureSpec.debugName = m_Path.string();
-
-        m_Handle = device.CreateTexture(textureSpec);
-        if (!m_Handle.IsValid())
+        if (savedIndex != InvalidBindlessIndex && m_BindlessIndex != savedIndex)
         {
-            return Result<void>::Err("Failed to create texture during reload");
+            GG_CORE_WARN("Bindless index changed during hot reload: {} -> {}", savedIndex, m_BindlessIndex);
         }
 
-        device.UploadTextureData(m_Handle, cpuData.pixels.data(), imageSize);
-
-        RHISamplerSpecification samplerSpec;
-        samplerSpec.minFilter = m_MinFilter;
-        samplerSpec.magFilter = m_MagFilter;
-        samplerSpec.mipmapMode = (m_MinFilter == Filter::Nearest) ? MipmapMode::Nearest : MipmapMode::Linear;
-        samplerSpec.addressModeU = AddressMode::Repeat;
-        samplerSpec.addressModeV = AddressMode::Repeat;
-        samplerSpec.addressModeW = AddressMode::Repeat;
-
-        m_SamplerHandle = device.CreateSampler(samplerSpec);
-        if (!m_SamplerHandle.IsValid())
-        {
-            device.DestroyTexture(m_Handle);
-            m_Handle = NullTexture;
-            return Result<void>::Err("Failed to create sampler during reload");
-        }
-
-        // Re-register at the same bindless index to preserve shader references
-        if (savedIndex != InvalidBindlessIndex)
-        {
-            m_BindlessIndex = BindlessTextureManager::Get().RegisterTextureAtIndex(*this, savedIndex);
-            if (m_BindlessIndex != savedIndex)
-            {
-                GG_CORE_WARN("Bindless index changed during hot reload: {} -> {}", savedIndex, m_BindlessIndex);
-            }
-        }
-        else
-        {
-            // Texture wasn't registered before, register now
-            auto& bindlessManager = BindlessTextureManager::Get();
-            if (bindlessManager.GetMaxTextures() > 0)
-            {
-                m_BindlessIndex = bindlessManager.RegisterTexture(*this);
-            }
-        }
-
-        SetState(AssetState::Ready);
         GG_CORE_INFO("Hot reload complete: {} ({}x{}, bindless: {})", m_SourcePath, m_Width, m_Height, m_BindlessIndex);
         return Result<void>::Ok();
     }
@@ -363,6 +476,13 @@ namespace GGEngine {
 
     void Texture::Unload()
     {
+        if (m_Streamed)
+        {
+            TextureStreamer::Get().Unregister(*this);
+            m_StreamSource = TextureCPUData();
+            m_Streamed = false;
+        }
+
         // Unregister from BindlessTextureManager first
         if (m_BindlessIndex != InvalidBindlessIndex)
         {
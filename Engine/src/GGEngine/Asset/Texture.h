@@ -2,12 +2,14 @@
 
 #include "Asset.h"
 #include "AssetManager.h"
+#include "MipChain.h"
 #include "GGEngine/Core/Core.h"
 #include "GGEngine/Core/Result.h"
 #include "GGEngine/RHI/RHITypes.h"
 #include "GGEngine/RHI/RHIEnums.h"
 #include "GGEngine/Renderer/BindlessTextureManager.h"
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -18,16 +20,27 @@ namespace GGEngine {
     template<>
     constexpr AssetType GetAssetType<Texture>() { return AssetType::Texture; }
 
+    class MappedFile;
+
     // CPU-side loaded texture data (for async loading)
     struct GG_API TextureCPUData
     {
-        std::vector<uint8_t> pixels;
+        std::vector<uint8_t> pixels;            // Level 0, then the rest of the chain if any
+        std::vector<TextureMipLevel> mips;      // Layout of pixels; empty = level 0 only
         uint32_t width = 0;
         uint32_t height = 0;
         uint32_t channels = 4;
+        TextureFormat format = TextureFormat::R8G8B8A8_UNORM;
         std::string sourcePath;
 
-        bool IsValid() const { return !pixels.empty() && width > 0 && height > 0; }
+        // Cooked containers (see TextureContainer.h) leave pixels empty and
+        // point into the mapped file instead, which file keeps alive
+        Ref<MappedFile> file;
+        const uint8_t* mappedPixels = nullptr;
+
+        const uint8_t* GetPixels() const { return mappedPixels ? mappedPixels : pixels.data(); }
+        bool IsValid() const { return (!pixels.empty() || mappedPixels) && width > 0 && height > 0; }
+        uint32_t GetMipCount() const { return mips.empty() ? 1 : static_cast<uint32_t>(mips.size()); }
     };
 
     // Texture specification for creation
@@ -73,9 +86,15 @@ namespace GGEngine {
         // ================================================================
 
         // Load image file to CPU memory (thread-safe, can run on worker thread)
-        // Returns TextureCPUData with pixel data, or error on failure
+        // Returns TextureCPUData with the full mip chain (see MipChain.h), or error on failure.
+        // A cooked container next to the source (path + ".ggtex", no older than
+        // the source) is mapped instead of decoding; otherwise falls back to stb_image.
         static Result<TextureCPUData> LoadCPU(const std::string& path);
 
+        // Decode an encoded image (PNG, JPG, BMP, TGA) held in memory and build its
+        // mip chain, as LoadCPU does for uncooked sources (thread-safe)
+        static Result<TextureCPUData> DecodeCPU(const uint8_t* encoded, size_t size, const std::string& sourcePath);
+
         // Upload CPU data to GPU and create resources (must run on main thread)
         // Takes ownership of cpuData pixels
         Result<void> UploadGPU(TextureCPUData&& cpuData);
@@ -103,6 +122,7 @@ namespace GGEngine {
         uint32_t GetHeight() const { return m_Height; }
         uint32_t GetChannels() const { return m_Channels; }
         TextureFormat GetFormat() const { return m_Format; }
+        uint32_t GetMipCount() const { return m_MipCount; }
 
         // RHI handles for backend-agnostic usage
         RHITextureHandle GetHandle() const { return m_Handle; }
@@ -111,8 +131,45 @@ namespace GGEngine {
         // Bindless texture index for shader access
         BindlessTextureIndex GetBindlessIndex() const { return m_BindlessIndex; }
 
+        // ================================================================
+        // Streaming (see TextureStreamer)
+        // ================================================================
+
+        // Whether TextureStreamer decides which of this texture's mip levels are resident
+        bool IsStreamed() const { return m_Streamed; }
+
+        // Finest mip level on the GPU (the image holds levels [resident, mip count))
+        uint32_t GetResidentMip() const { return m_ResidentMip; }
+
+        // Report a draw this frame at texelsPerPixel texels per screen pixel
+        // along its most minified axis (0 if unknown, which asks for level 0).
+        // Thread-safe and cheap enough to call per sprite; no-op unless streamed.
+        void ReportUsage(float texelsPerPixel)
+        {
+            if (m_Streamed)
+                RequestMip(texelsPerPixel);
+        }
+
     private:
-        void CreateResources(const uint8_t* pixels);
+        friend class TextureStreamer;
+
+        static constexpr uint32_t NoMipRequest = UINT32_MAX;
+
+        // Create the image, sampler and bindless slot for levels [firstMip, mips.size()) of pixels
+        void CreateResources(const uint8_t* pixels, const std::vector<TextureMipLevel>& mips, uint32_t firstMip = 0);
+
+        // Image holding levels [firstMip, mips.size()) of pixels. A single level
+        // uploads immediately; chains go through TransferQueue and reach the GPU
+        // ahead of the next frame's draws.
+        RHITextureHandle CreateImage(const uint8_t* pixels, const std::vector<TextureMipLevel>& mips,
+                                     uint32_t firstMip) const;
+
+        // Replace the image with one holding levels [residentMip, mip count) of
+        // the stream source, keeping the bindless slot. Returns the old image,
+        // which the caller destroys once no frame in flight uses it.
+        RHITextureHandle StreamTo(uint32_t residentMip);
+
+        void RequestMip(float texelsPerPixel);
 
         uint32_t m_Width = 0;
         uint32_t m_Height = 0;
@@ -133,6 +190,13 @@ namespace GGEngine {
         // Source path for hot reload
         std::string m_SourcePath;
 
+        // Streaming: the full chain stays on the CPU while streamed
+        TextureCPUData m_StreamSource;
+        std::atomic<uint32_t> m_RequestedMip{ NoMipRequest };  // Finest level reported since the last TextureStreamer::Update
+        uint32_t m_MipCount = 1;
+        uint32_t m_ResidentMip = 0;
+        bool m_Streamed = false;
+
         // Fallback texture (owned directly, not through AssetManager)
         static Scope<Texture> s_FallbackTexture;
     };
@@ -0,0 +1,228 @@
+#include "ggpch.h"
+#include "TextureContainer.h"
+#include "AssetManager.h"
+#include "GGEngine/Core/Profiler.h"
+#include "GGEngine/Utils/MappedFile.h"
+
+#include <fstream>
+
+namespace GGEngine {
+
+    namespace {
+
+        uint64_t AlignUp(uint64_t value, uint64_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        Result<void> ValidateHeader(const TextureContainerHeader& header, const std::string& name)
+        {
+            if (header.magic != TextureContainerMagic)
+                return Result<void>::Err("'" + name + "' is not a texture container");
+            if (header.version != TextureContainerVersion)
+                return Result<void>::Err("'" + name + "' has unsupported container version " + std::to_string(header.version));
+            if (header.width == 0 || header.height == 0 || header.mipCount == 0 || header.mipCount > 32)
+                return Result<void>::Err("'" + name + "' has an invalid size or mip count");
+            if (header.format == static_cast<uint32_t>(TextureFormat::Undefined) ||
+                header.format > static_cast<uint32_t>(TextureFormat::BC7_SRGB))
+                return Result<void>::Err("'" + name + "' has an unknown texture format");
+            return Result<void>::Ok();
+        }
+
+        // Levels must be packed back to back from the payload start (as CreateImage
+        // uploads them) and match their dimensions. Block-compressed formats have
+        // no texel size to check that against, so they are rejected until the
+        // loader knows their block layout.
+        Result<void> ValidateLevels(const TextureContainerHeader& header, const TextureMipLevel* levels,
+                                    const std::string& name)
+        {
+            const uint32_t texelSize = GetTexelSize(static_cast<TextureFormat>(header.format));
+            if (texelSize == 0)
+                return Result<void>::Err("'" + name + "' has a texture format the loader cannot validate");
+
+            uint64_t offset = 0;
+            for (uint32_t i = 0; i < header.mipCount; i++)
+            {
+                const TextureMipLevel& level = levels[i];
+                const bool sizeMatches = level.size == static_cast<uint64_t>(level.width) * level.height * texelSize;
+                if (level.width == 0 || level.height == 0 || level.size == 0 || !sizeMatches ||
+                    level.offset != offset || level.size > header.payloadSize - offset)
+                {
+                    return Result<void>::Err("'" + name + "' has a corrupt mip table (level " + std::to_string(i) + ")");
+                }
+                offset += level.size;
+            }
+
+            if (levels[0].width != header.width || levels[0].height != header.height)
+                return Result<void>::Err("'" + name + "' level 0 does not match the texture size");
+            return Result<void>::Ok();
+        }
+
+    }
+
+    std::filesystem::path GetCookedTexturePath(const std::filesystem::path& source)
+    {
+        std::filesystem::path cooked = source;
+        cooked += TextureContainerExtension;
+        return cooked;
+    }
+
+    uint64_t HashTextureSource(const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    Result<void> WriteTextureContainer(const std::filesystem::path& path, const TextureCPUData& data,
+                                       uint64_t contentHash)
+    {
+        GG_PROFILE_FUNCTION();
+
+        if (!data.IsValid())
+            return Result<void>::Err("Invalid texture data for '" + path.string() + "'");
+
+        std::vector<TextureMipLevel> levels = data.mips;
+        if (levels.empty())
+        {
+            TextureMipLevel level;
+            level.width = data.width;
+            level.height = data.height;
+            level.size = static_cast<uint64_t>(data.width) * data.height * GetTexelSize(data.format);
+            levels.push_back(level);
+        }
+
+        TextureContainerHeader header;
+        header.width = data.width;
+        header.height = data.height;
+        header.format = static_cast<uint32_t>(data.format);
+        header.mipCount = static_cast<uint32_t>(levels.size());
+        header.contentHash = contentHash;
+        header.payloadOffset = AlignUp(sizeof(header) + levels.size() * sizeof(TextureMipLevel), TextureContainerAlignment);
+        header.payloadSize = GetMipChainSize(levels);
+
+        std::filesystem::path temporary = path;
+        temporary += ".tmp";
+        std::error_code error;
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+                return Result<void>::Err("Failed to create '" + temporary.string() + "'");
+
+            const char padding[TextureContainerAlignment] = {};
+            const uint64_t tableEnd = sizeof(header) + levels.size() * sizeof(TextureMipLevel);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(levels.data()), levels.size() * sizeof(TextureMipLevel));
+            file.write(padding, static_cast<std::streamsize>(header.payloadOffset - tableEnd));
+            file.write(reinterpret_cast<const char*>(data.GetPixels()), static_cast<std::streamsize>(header.payloadSize));
+
+            // Closed before checking, so a failed flush counts and the file can be removed
+            file.close();
+            if (!file)
+            {
+                std::filesystem::remove(temporary, error);
+                return Result<void>::Err("Failed to write '" + temporary.string() + "'");
+            }
+        }
+
+        std::filesystem::rename(temporary, path, error);
+        if (error)
+        {
+            std::filesystem::remove(temporary, error);
+            return Result<void>::Err("Failed to replace '" + path.string() + "'");
+        }
+        return Result<void>::Ok();
+    }
+
+    Result<TextureContainerHeader> ReadTextureContainerHeader(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+            return Result<TextureContainerHeader>::Err("Failed to open '" + path.string() + "'");
+
+        TextureContainerHeader header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+            return Result<TextureContainerHeader>::Err("'" + path.string() + "' is truncated");
+
+        auto valid = ValidateHeader(header, path.string());
+        if (valid.IsErr())
+            return Result<TextureContainerHeader>::Err(valid.Error());
+        return Result<TextureContainerHeader>::Ok(header);
+    }
+
+    Result<TextureCPUData> ReadTextureContainer(const std::filesystem::path& path)
+    {
+        GG_PROFILE_FUNCTION();
+
+        const std::string name = path.string();
+        auto file = CreateRef<MappedFile>();
+        auto opened = file->Open(path);
+        if (opened.IsErr())
+            return Result<TextureCPUData>::Err(opened.Error());
+
+        const uint64_t fileSize = file->GetSize();
+        if (fileSize < sizeof(TextureContainerHeader))
+            return Result<TextureCPUData>::Err("'" + name + "' is truncated");
+
+        TextureContainerHeader header;
+        std::memcpy(&header, file->GetData(), sizeof(header));
+        auto valid = ValidateHeader(header, name);
+        if (valid.IsErr())
+            return Result<TextureCPUData>::Err(valid.Error());
+
+        const uint64_t tableEnd = sizeof(header) + static_cast<uint64_t>(header.mipCount) * sizeof(TextureMipLevel);
+        if (header.payloadOffset < tableEnd || header.payloadOffset > fileSize ||
+            header.payloadSize > fileSize - header.payloadOffset)
+        {
+            return Result<TextureCPUData>::Err("'" + name + "' is truncated");
+        }
+
+        TextureCPUData result;
+        result.mips.resize(header.mipCount);
+        std::memcpy(result.mips.data(), file->GetData() + sizeof(header), header.mipCount * sizeof(TextureMipLevel));
+        valid = ValidateLevels(header, result.mips.data(), name);
+        if (valid.IsErr())
+            return Result<TextureCPUData>::Err(valid.Error());
+
+        result.width = header.width;
+        result.height = header.height;
+        result.format = static_cast<TextureFormat>(header.format);
+        result.channels = 4;
+        result.mappedPixels = file->GetData() + header.payloadOffset;
+        result.file = std::move(file);
+        return Result<TextureCPUData>::Ok(std::move(result));
+    }
+
+    Result<bool> CookTexture(const std::filesystem::path& source, const std::filesystem::path& destination, bool force)
+    {
+        GG_PROFILE_FUNCTION();
+
+        std::vector<char> encoded = AssetManager::Get().ReadFileRawAbsolute(source);
+        if (encoded.empty())
+            return Result<bool>::Err("Failed to read '" + source.string() + "'");
+        const uint64_t hash = HashTextureSource(encoded.data(), encoded.size());
+
+        if (!force)
+        {
+            auto existing = ReadTextureContainerHeader(destination);
+            if (existing.IsOk() && existing.Value().contentHash == hash)
+                return Result<bool>::Ok(false);
+        }
+
+        auto decoded = Texture::DecodeCPU(reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size(),
+                                          source.string());
+        if (decoded.IsErr())
+            return Result<bool>::Err(decoded.Error());
+
+        auto written = WriteTextureContainer(destination, decoded.Value(), hash);
+        if (written.IsErr())
+            return Result<bool>::Err(written.Error());
+        return Result<bool>::Ok(true);
+    }
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Texture.h"
+#include "GGEngine/Core/Core.h"
+#include "GGEngine/Core/Result.h"
+
+#include <cstdint>
+#include <filesystem>
+
+namespace GGEngine {
+
+    // =============================================================================
+    // Cooked texture container (.ggtex)
+    // =============================================================================
+    // A texture as the GPU takes it, written ahead of time by the cook step
+    // (CookTexture, driven by the TextureCooker tool) so loading skips image
+    // decoding and mip generation. Little endian:
+    //
+    //   TextureContainerHeader
+    //   TextureMipLevel[mipCount]       offsets relative to the payload
+    //   payload at payloadOffset        levels back to back, level 0 first
+    //
+    // Levels are stored bottom row first like Texture::LoadCPU decodes them.
+    // The cooker writes R8G8B8A8_UNORM. The format field leaves room for
+    // block-compressed payloads (BC/ASTC), but ReadTextureContainer rejects
+    // them until it can validate their level sizes.
+
+    constexpr uint32_t TextureContainerMagic = 0x58544747;      // "GGTX"
+    constexpr uint32_t TextureContainerVersion = 1;
+    constexpr uint64_t TextureContainerAlignment = 16;          // Of the payload within the file
+    constexpr const char* TextureContainerExtension = ".ggtex";
+
+    struct TextureContainerHeader
+    {
+        uint32_t magic = TextureContainerMagic;
+        uint32_t version = TextureContainerVersion;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t format = 0;            // TextureFormat
+        uint32_t mipCount = 0;
+        uint64_t contentHash = 0;       // Of the source image file, see HashTextureSource
+        uint64_t payloadOffset = 0;     // From the start of the file
+        uint64_t payloadSize = 0;
+    };
+    static_assert(sizeof(TextureContainerHeader) == 48, "TextureContainerHeader layout is part of the file format");
+    static_assert(sizeof(TextureMipLevel) == 24, "TextureMipLevel layout is part of the file format");
+
+    // Where the cooked form of a source image lives: alongside it with the
+    // extension appended (sprites.png -> sprites.png.ggtex)
+    GG_API std::filesystem::path GetCookedTexturePath(const std::filesystem::path& source);
+
+    // 64-bit FNV-1a of a source image file's bytes
+    GG_API uint64_t HashTextureSource(const void* data, size_t size);
+
+    // Write data's levels to path (through a temporary file, so a loader never
+    // sees a partial container)
+    GG_API Result<void> WriteTextureContainer(const std::filesystem::path& path, const TextureCPUData& data,
+                                              uint64_t contentHash);
+
+    // Read and validate only the header
+    GG_API Result<TextureContainerHeader> ReadTextureContainerHeader(const std::filesystem::path& path);
+
+    // Map a container and describe its levels without decoding or copying them:
+    // pixels stays empty, mappedPixels points at level 0 inside the mapping and
+    // file keeps the mapping alive for as long as the data is.
+    GG_API Result<TextureCPUData> ReadTextureContainer(const std::filesystem::path& path);
+
+    // Decode source the way Texture::LoadCPU does, build its mip chain and
+    // write it to destination. Returns false without decoding or touching
+    // destination when it already holds a cook of identical source bytes
+    // (unless force is set).
+    GG_API Result<bool> CookTexture(const std::filesystem::path& source, const std::filesystem::path& destination,
+                                    bool force = false);
+
+}
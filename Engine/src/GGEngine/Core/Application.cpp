@@ -16,6 +16,7 @@
 #include "GGEngine/Renderer/InstancedRenderer2D.h"
 #include "GGEngine/Renderer/BindlessTextureManager.h"
 #include "GGEngine/Renderer/TransferQueue.h"
+#include "GGEngine/Renderer/TextureStreamer.h"
 #include "GGEngine/Renderer/ThreadedCommandBuffer.h"
 #include "GGEngine/Core/Profiler.h"
 #include "GGEngine/Core/TaskGraph.h"
@@ -47,6 +48,9 @@ namespace GGEngine {
         // Initialize bindless texture manager (requires RHI device to be ready)
         BindlessTextureManager::Get().Init();
 
+        // Initialize texture streaming before any texture loads, so large ones stream
+        TextureStreamer::Get().Init();
+
         // Initialize asset libraries (requires RHI device to be ready)
         ShaderLibrary::Get().Init();
         TextureLibrary::Get().Init();
@@ -90,6 +94,9 @@ namespace GGEngine {
         ShaderLibrary::Get().Shutdown();
         AssetManager::Get().Shutdown();
 
+        // Shutdown texture streamer after textures have unregistered (frees retired images)
+        TextureStreamer::Get().Shutdown();
+
         // Shutdown bindless texture manager before RHI
         BindlessTextureManager::Get().Shutdown();
 
@@ -175,6 +182,9 @@ namespace GGEngine {
             AssetManager::Get().Update();
             TaskGraph::Get().ProcessCompletedCallbacks();
 
+            // Stream texture mips in/out from last frame's usage (uploads go out with the flush below)
+            TextureStreamer::Get().Update(RHIDevice::Get().GetCurrentFrameIndex());
+
             // Flush pending GPU uploads before rendering
             TransferQueue::Get().FlushUploads(RHIDevice::Get().GetCurrentCommandBuffer());
 
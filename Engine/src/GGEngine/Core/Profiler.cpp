@@ -1,18 +1,29 @@
 #include "ggpch.h"
 #include "Profiler.h"
 
+#include <mutex>
+
 namespace GGEngine {
 
+    namespace {
+
+        // Scopes also end on TaskGraph workers (e.g. systems the scheduler runs in parallel)
+        std::mutex s_ResultsMutex;
+
+    }
+
     std::vector<FrameProfileResult> Profiler::s_Results;
 
     void Profiler::BeginFrame()
     {
+        std::lock_guard<std::mutex> lock(s_ResultsMutex);
         s_Results.clear();
         s_Results.reserve(64);
     }
 
     void Profiler::SubmitResult(const FrameProfileResult& result)
     {
+        std::lock_guard<std::mutex> lock(s_ResultsMutex);
         s_Results.push_back(result);
     }
 
@@ -0,0 +1,125 @@
+#include "ggpch.h"
+#include "RandomStream.h"
+#include "SIMD.h"
+
+namespace GGEngine {
+
+    namespace {
+
+        // SplitMix64: spreads consecutive or low-entropy seeds over the whole state
+        uint64_t SplitMix64(uint64_t& state)
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        inline uint32_t RotateLeft(uint32_t value, int bits)
+        {
+            return (value << bits) | (value >> (32 - bits));
+        }
+
+    }
+
+    void RandomStream::Seed(uint64_t seed)
+    {
+        uint64_t mix = seed;
+        for (uint32_t lane = 0; lane < Lanes; lane++)
+        {
+            const uint64_t low = SplitMix64(mix);
+            const uint64_t high = SplitMix64(mix);
+            m_State[0][lane] = static_cast<uint32_t>(low);
+            m_State[1][lane] = static_cast<uint32_t>(low >> 32);
+            m_State[2][lane] = static_cast<uint32_t>(high);
+            m_State[3][lane] = static_cast<uint32_t>(high >> 32);
+
+            // xoshiro never leaves the all-zero state
+            if ((low | high) == 0)
+                m_State[0][lane] = 1;
+        }
+        m_Lane = 0;
+    }
+
+    uint32_t RandomStream::NextUInt()
+    {
+        const uint32_t lane = m_Lane;
+        m_Lane = (m_Lane + 1) % Lanes;
+
+        uint32_t& s0 = m_State[0][lane];
+        uint32_t& s1 = m_State[1][lane];
+        uint32_t& s2 = m_State[2][lane];
+        uint32_t& s3 = m_State[3][lane];
+
+        const uint32_t result = s0 + s3;
+        const uint32_t t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = RotateLeft(s3, 11);
+        return result;
+    }
+
+    uint64_t RandomStream::NextUInt64()
+    {
+        const uint64_t high = NextUInt();
+        return (high << 32) | NextUInt();
+    }
+
+    void RandomStream::Fill(float* out, size_t count, float min, float max)
+    {
+        using namespace Simd;
+
+        const float range = max - min;
+
+        // Scalar until the next call would use lane 0 again
+        size_t i = 0;
+        for (; i < count && m_Lane != 0; i++)
+            out[i] = NextFloat(min, max);
+
+        if (i + Lanes <= count)
+        {
+            Int4 s0 = LoadInt(m_State[0]);
+            Int4 s1 = LoadInt(m_State[1]);
+            Int4 s2 = LoadInt(m_State[2]);
+            Int4 s3 = LoadInt(m_State[3]);
+
+            const Float4 offset = Splat(min);
+            const Float4 scale = Splat(range);
+            const Float4 unit = Splat(1.0f / 16777216.0f);
+
+            for (; i + Lanes <= count; i += Lanes)
+            {
+                const Int4 result = s0 + s3;
+                const Int4 t = ShiftLeft<9>(s1);
+                s2 = s2 ^ s0;
+                s3 = s3 ^ s1;
+                s1 = s1 ^ s2;
+                s0 = s0 ^ s3;
+                s2 = s2 ^ t;
+                s3 = ShiftLeft<11>(s3) | ShiftRight<21>(s3);
+
+                // Top 24 bits fit a float exactly, as in NextFloat
+                const Float4 value = ToFloat(ShiftRight<8>(result)) * unit;
+                Store(out + i, offset + scale * value);
+            }
+
+            StoreInt(m_State[0], s0);
+            StoreInt(m_State[1], s1);
+            StoreInt(m_State[2], s2);
+            StoreInt(m_State[3], s3);
+        }
+
+        for (; i < count; i++)
+            out[i] = NextFloat(min, max);
+    }
+
+    uint64_t RandomStream::DeriveSeed(uint64_t seed, uint64_t index)
+    {
+        uint64_t state = seed ^ (index * 0xD1B54A32D192ED03ull);
+        return SplitMix64(state);
+    }
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "GGEngine/Core/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GGEngine {
+
+    // Fast pseudo-random generator: four interleaved xoshiro128+ lanes.
+    //
+    // Scalar calls take the lanes in turn and Fill advances all four at once
+    // with SIMD (see Core/SIMD.h); both give the same sequence, so mixing
+    // them is deterministic. The same seed always reproduces the same
+    // sequence on every platform and SIMD backend.
+    //
+    // Not thread-safe: give each thread or each simulation (e.g. a particle
+    // pool) its own stream. Not suitable for cryptography.
+    class GG_API RandomStream
+    {
+    public:
+        explicit RandomStream(uint64_t seed = 0) { Seed(seed); }
+
+        void Seed(uint64_t seed);
+
+        uint32_t NextUInt();
+        uint64_t NextUInt64();
+
+        // Uniform in [0, 1), from the top 24 bits of NextUInt
+        float NextFloat() { return static_cast<float>(NextUInt() >> 8) * (1.0f / 16777216.0f); }
+
+        // Uniform in [min, max)
+        float NextFloat(float min, float max) { return min + (max - min) * NextFloat(); }
+
+        // Same values as count NextFloat calls, four at a time
+        void Fill(float* out, size_t count) { Fill(out, count, 0.0f, 1.0f); }
+        void Fill(float* out, size_t count, float min, float max);
+
+        // Seed for the index-th independent stream derived from seed, e.g. one
+        // per thread or per emitter
+        static uint64_t DeriveSeed(uint64_t seed, uint64_t index);
+
+    private:
+        static constexpr uint32_t Lanes = 4;
+
+        // [word][lane], so each state word of all lanes is one SIMD register
+        uint32_t m_State[4][Lanes];
+        uint32_t m_Lane = 0;   // Lane the next scalar call uses
+    };
+
+}
@@ -0,0 +1,494 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// 4-wide float SIMD used by hot CPU loops (e.g. Renderer2D vertex generation).
+// SSE2 is part of x86-64 and NEON of AArch64, so neither needs extra compiler
+// flags or runtime dispatch. Anything else, or defining GG_SIMD_DISABLE, gets a
+// plain array fallback with the same results.
+#if !defined(GG_SIMD_DISABLE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define GG_SIMD_SSE2 1
+    #include <emmintrin.h>
+#elif !defined(GG_SIMD_DISABLE) && (defined(__ARM_NEON) || defined(_M_ARM64))
+    #define GG_SIMD_NEON 1
+    #include <arm_neon.h>
+#else
+    #define GG_SIMD_SCALAR 1
+#endif
+
+namespace GGEngine {
+
+    namespace Simd {
+
+#if defined(GG_SIMD_SSE2)
+        struct Float4 { __m128 V; };
+        struct Int4 { __m128i V; };
+#elif defined(GG_SIMD_NEON)
+        struct Float4 { float32x4_t V; };
+        struct Int4 { int32x4_t V; };
+#else
+        struct Float4 { float V[4]; };
+        struct Int4 { int32_t V[4]; };
+#endif
+
+        // Name of the compiled-in backend, for logs and benchmark output
+        inline const char* GetBackendName()
+        {
+#if defined(GG_SIMD_SSE2)
+            return "SSE2";
+#elif defined(GG_SIMD_NEON)
+            return "NEON";
+#else
+            return "Scalar";
+#endif
+        }
+
+        // =====================================================================
+        // Load / store (unaligned)
+        // =====================================================================
+
+        inline Float4 Splat(float value)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_set1_ps(value) };
+#elif defined(GG_SIMD_NEON)
+            return { vdupq_n_f32(value) };
+#else
+            return { { value, value, value, value } };
+#endif
+        }
+
+        inline Float4 Set(float x, float y, float z, float w)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_setr_ps(x, y, z, w) };
+#elif defined(GG_SIMD_NEON)
+            const float values[4] = { x, y, z, w };
+            return { vld1q_f32(values) };
+#else
+            return { { x, y, z, w } };
+#endif
+        }
+
+        inline Float4 Load(const float* source)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_loadu_ps(source) };
+#elif defined(GG_SIMD_NEON)
+            return { vld1q_f32(source) };
+#else
+            Float4 result;
+            std::memcpy(result.V, source, sizeof(result.V));
+            return result;
+#endif
+        }
+
+        inline void Store(float* destination, Float4 value)
+        {
+#if defined(GG_SIMD_SSE2)
+            _mm_storeu_ps(destination, value.V);
+#elif defined(GG_SIMD_NEON)
+            vst1q_f32(destination, value.V);
+#else
+            std::memcpy(destination, value.V, sizeof(value.V));
+#endif
+        }
+
+        // =====================================================================
+        // Arithmetic
+        // =====================================================================
+
+        inline Float4 operator+(Float4 a, Float4 b)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_add_ps(a.V, b.V) };
+#elif defined(GG_SIMD_NEON)
+            return { vaddq_f32(a.V, b.V) };
+#else
+            return { { a.V[0] + b.V[0], a.V[1] + b.V[1], a.V[2] + b.V[2], a.V[3] + b.V[3] } };
+#endif
+        }
+
+        inline Float4 operator-(Float4 a, Float4 b)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_sub_ps(a.V, b.V) };
+#elif defined(GG_SIMD_NEON)
+            return { vsubq_f32(a.V, b.V) };
+#else
+            return { { a.V[0] - b.V[0], a.V[1] - b.V[1], a.V[2] - b.V[2], a.V[3] - b.V[3] } };
+#endif
+        }
+
+        inline Float4 operator*(Float4 a, Float4 b)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_mul_ps(a.V, b.V) };
+#elif defined(GG_SIMD_NEON)
+            return { vmulq_f32(a.V, b.V) };
+#else
+            return { { a.V[0] * b.V[0], a.V[1] * b.V[1], a.V[2] * b.V[2], a.V[3] * b.V[3] } };
+#endif
+        }
+
+        // =====================================================================
+        // Integer lanes
+        // =====================================================================
+
+        // Round to nearest (ties to even)
+        inline Int4 RoundToInt(Float4 value)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_cvtps_epi32(value.V) };
+#elif defined(GG_SIMD_NEON)
+            return { vcvtnq_s32_f32(value.V) };
+#else
+            Int4 result;
+            for (int i = 0; i < 4; i++)
+                result.V[i] = static_cast<int32_t>(std::nearbyint(value.V[i]));
+            return result;
+#endif
+        }
+
+        inline Float4 ToFloat(Int4 value)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_cvtepi32_ps(value.V) };
+#elif defined(GG_SIMD_NEON)
+            return { vcvtq_f32_s32(value.V) };
+#else
+            return { { static_cast<float>(value.V[0]), static_cast<float>(value.V[1]),
+                       static_cast<float>(value.V[2]), static_cast<float>(value.V[3]) } };
+#endif
+        }
+
+        inline Int4 SplatInt(int32_t value)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_set1_epi32(value) };
+#elif defined(GG_SIMD_NEON)
+            return { vdupq_n_s32(value) };
+#else
+            return { { value, value, value, value } };
+#endif
+        }
+
+        // Wraps on overflow in every backend
+        inline Int4 operator+(Int4 a, Int4 b)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_add_epi32(a.V, b.V) };
+#elif defined(GG_SIMD_NEON)
+            return { vaddq_s32(a.V, b.V) };
+#else
+            Int4 result;
+            for (int i = 0; i < 4; i++)
+                result.V[i] = static_cast<int32_t>(static_cast<uint32_t>(a.V[i]) + static_cast<uint32_t>(b.V[i]));
+            return result;
+#endif
+        }
+
+        inline Int4 operator&(Int4 a, Int4 b)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_and_si128(a.V, b.V) };
+#elif defined(GG_SIMD_NEON)
+            return { vandq_s32(a.V, b.V) };
+#else
+            return { { a.V[0] & b.V[0], a.V[1] & b.V[1], a.V[2] & b.V[2], a.V[3] & b.V[3] } };
+#endif
+        }
+
+        inline Int4 operator|(Int4 a, Int4 b)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_or_si128(a.V, b.V) };
+#elif defined(GG_SIMD_NEON)
+            return { vorrq_s32(a.V, b.V) };
+#else
+            return { { a.V[0] | b.V[0], a.V[1] | b.V[1], a.V[2] | b.V[2], a.V[3] | b.V[3] } };
+#endif
+        }
+
+        inline Int4 operator^(Int4 a, Int4 b)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_xor_si128(a.V, b.V) };
+#elif defined(GG_SIMD_NEON)
+            return { veorq_s32(a.V, b.V) };
+#else
+            return { { a.V[0] ^ b.V[0], a.V[1] ^ b.V[1], a.V[2] ^ b.V[2], a.V[3] ^ b.V[3] } };
+#endif
+        }
+
+        inline Int4 LoadInt(const uint32_t* source)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)) };
+#elif defined(GG_SIMD_NEON)
+            return { vreinterpretq_s32_u32(vld1q_u32(source)) };
+#else
+            Int4 result;
+            std::memcpy(result.V, source, sizeof(result.V));
+            return result;
+#endif
+        }
+
+        inline void StoreInt(uint32_t* destination, Int4 value)
+        {
+#if defined(GG_SIMD_SSE2)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value.V);
+#elif defined(GG_SIMD_NEON)
+            vst1q_u32(destination, vreinterpretq_u32_s32(value.V));
+#else
+            std::memcpy(destination, value.V, sizeof(value.V));
+#endif
+        }
+
+        // All bits set in lanes where a == b
+        inline Int4 Equal(Int4 a, Int4 b)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_cmpeq_epi32(a.V, b.V) };
+#elif defined(GG_SIMD_NEON)
+            return { vreinterpretq_s32_u32(vceqq_s32(a.V, b.V)) };
+#else
+            Int4 result;
+            for (int i = 0; i < 4; i++)
+                result.V[i] = a.V[i] == b.V[i] ? -1 : 0;
+            return result;
+#endif
+        }
+
+        // All bits set in lanes where a <= b (false for NaN)
+        inline Int4 LessEqual(Float4 a, Float4 b)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_castps_si128(_mm_cmple_ps(a.V, b.V)) };
+#elif defined(GG_SIMD_NEON)
+            return { vreinterpretq_s32_u32(vcleq_f32(a.V, b.V)) };
+#else
+            Int4 result;
+            for (int i = 0; i < 4; i++)
+                result.V[i] = a.V[i] <= b.V[i] ? -1 : 0;
+            return result;
+#endif
+        }
+
+        // Bit i set where lane i of a comparison mask is set
+        inline int MoveMask(Int4 mask)
+        {
+#if defined(GG_SIMD_SSE2)
+            return _mm_movemask_ps(_mm_castsi128_ps(mask.V));
+#elif defined(GG_SIMD_NEON)
+            const uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_s32(mask.V), 31);
+            return static_cast<int>(vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) |
+                                    (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3));
+#else
+            int result = 0;
+            for (int i = 0; i < 4; i++)
+                result |= (mask.V[i] < 0 ? 1 : 0) << i;
+            return result;
+#endif
+        }
+
+        template<int Bits>
+        inline Int4 ShiftLeft(Int4 value)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_slli_epi32(value.V, Bits) };
+#elif defined(GG_SIMD_NEON)
+            return { vshlq_n_s32(value.V, Bits) };
+#else
+            Int4 result;
+            for (int i = 0; i < 4; i++)
+                result.V[i] = static_cast<int32_t>(static_cast<uint32_t>(value.V[i]) << Bits);
+            return result;
+#endif
+        }
+
+        // Logical (zero-filling) shift
+        template<int Bits>
+        inline Int4 ShiftRight(Int4 value)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_srli_epi32(value.V, Bits) };
+#elif defined(GG_SIMD_NEON)
+            return { vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(value.V), Bits)) };
+#else
+            Int4 result;
+            for (int i = 0; i < 4; i++)
+                result.V[i] = static_cast<int32_t>(static_cast<uint32_t>(value.V[i]) >> Bits);
+            return result;
+#endif
+        }
+
+        // =====================================================================
+        // Bytes (e.g. RGBA8 pixels)
+        // =====================================================================
+
+        // Four unsigned bytes to lanes 0..255
+        inline Float4 LoadBytes(const uint8_t* source)
+        {
+#if defined(GG_SIMD_SSE2)
+            int32_t packed;
+            std::memcpy(&packed, source, sizeof(packed));
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i words = _mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero);
+            return { _mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero)) };
+#elif defined(GG_SIMD_NEON)
+            uint32_t packed;
+            std::memcpy(&packed, source, sizeof(packed));
+            const uint16x8_t words = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(packed)));
+            return { vcvtq_f32_u32(vmovl_u16(vget_low_u16(words))) };
+#else
+            Float4 result;
+            for (int i = 0; i < 4; i++)
+                result.V[i] = static_cast<float>(source[i]);
+            return result;
+#endif
+        }
+
+        // Lanes rounded to nearest (ties to even) and clamped to 0..255
+        inline void StoreBytes(uint8_t* destination, Float4 value)
+        {
+#if defined(GG_SIMD_SSE2)
+            const __m128i words = _mm_packs_epi32(_mm_cvtps_epi32(value.V), _mm_setzero_si128());
+            const int32_t packed = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+            std::memcpy(destination, &packed, sizeof(packed));
+#elif defined(GG_SIMD_NEON)
+            const uint16x4_t words = vqmovun_s32(vcvtnq_s32_f32(value.V));
+            const uint32_t packed = vget_lane_u32(vreinterpret_u32_u8(vqmovn_u16(vcombine_u16(words, words))), 0);
+            std::memcpy(destination, &packed, sizeof(packed));
+#else
+            for (int i = 0; i < 4; i++)
+            {
+                const float clamped = value.V[i] < 0.0f ? 0.0f : (value.V[i] > 255.0f ? 255.0f : value.V[i]);
+                destination[i] = static_cast<uint8_t>(std::nearbyint(clamped));
+            }
+#endif
+        }
+
+        // =====================================================================
+        // Bitwise float helpers
+        // =====================================================================
+
+        // Flip the float bits where bits is set (e.g. a sign mask)
+        inline Float4 FlipBits(Float4 value, Int4 bits)
+        {
+#if defined(GG_SIMD_SSE2)
+            return { _mm_xor_ps(value.V, _mm_castsi128_ps(bits.V)) };
+#elif defined(GG_SIMD_NEON)
+            return { vreinterpretq_f32_s32(veorq_s32(vreinterpretq_s32_f32(value.V), bits.V)) };
+#else
+            Float4 result;
+            for (int i = 0; i < 4; i++)
+            {
+                uint32_t raw;
+                std::memcpy(&raw, &value.V[i], sizeof(raw));
+                raw ^= static_cast<uint32_t>(bits.V[i]);
+                std::memcpy(&result.V[i], &raw, sizeof(raw));
+            }
+            return result;
+#endif
+        }
+
+        // Per lane: mask ? a : b (mask lanes all ones or all zeros)
+        inline Float4 Select(Int4 mask, Float4 a, Float4 b)
+        {
+#if defined(GG_SIMD_SSE2)
+            const __m128 m = _mm_castsi128_ps(mask.V);
+            return { _mm_or_ps(_mm_and_ps(m, a.V), _mm_andnot_ps(m, b.V)) };
+#elif defined(GG_SIMD_NEON)
+            return { vbslq_f32(vreinterpretq_u32_s32(mask.V), a.V, b.V) };
+#else
+            Float4 result;
+            for (int i = 0; i < 4; i++)
+                result.V[i] = mask.V[i] ? a.V[i] : b.V[i];
+            return result;
+#endif
+        }
+
+        // =====================================================================
+        // Shuffles
+        // =====================================================================
+
+        // Rows become columns: a = (a0 a1 a2 a3), ... -> a = (a0 b0 c0 d0), ...
+        inline void Transpose(Float4& a, Float4& b, Float4& c, Float4& d)
+        {
+#if defined(GG_SIMD_SSE2)
+            _MM_TRANSPOSE4_PS(a.V, b.V, c.V, d.V);
+#elif defined(GG_SIMD_NEON)
+            const float32x4x2_t ab = vtrnq_f32(a.V, b.V);
+            const float32x4x2_t cd = vtrnq_f32(c.V, d.V);
+            a.V = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+            b.V = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+            c.V = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+            d.V = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+#else
+            Float4 rows[4] = { a, b, c, d };
+            for (int i = 0; i < 4; i++)
+            {
+                a.V[i] = rows[i].V[0];
+                b.V[i] = rows[i].V[1];
+                c.V[i] = rows[i].V[2];
+                d.V[i] = rows[i].V[3];
+            }
+#endif
+        }
+
+        // Split 8 interleaved pairs: (x0 y0 x1 y1), (x2 y2 x3 y3) -> (x0..x3), (y0..y3)
+        inline void Deinterleave(Float4 low, Float4 high, Float4& evens, Float4& odds)
+        {
+#if defined(GG_SIMD_SSE2)
+            evens.V = _mm_shuffle_ps(low.V, high.V, _MM_SHUFFLE(2, 0, 2, 0));
+            odds.V = _mm_shuffle_ps(low.V, high.V, _MM_SHUFFLE(3, 1, 3, 1));
+#elif defined(GG_SIMD_NEON)
+            const float32x4x2_t split = vuzpq_f32(low.V, high.V);
+            evens.V = split.val[0];
+            odds.V = split.val[1];
+#else
+            evens = { { low.V[0], low.V[2], high.V[0], high.V[2] } };
+            odds = { { low.V[1], low.V[3], high.V[1], high.V[3] } };
+#endif
+        }
+
+        // =====================================================================
+        // Math
+        // =====================================================================
+
+        // Sine and cosine of each lane. Reduced by multiples of pi/2 and
+        // evaluated with the Cephes single-precision polynomials: a few ulp of
+        // std::sin/std::cos for |angle| up to a few thousand radians.
+        inline void SinCos(Float4 angle, Float4& outSin, Float4& outCos)
+        {
+            const Int4 quadrant = RoundToInt(angle * Splat(0.636619772367581343f));  // 2 / pi
+            const Float4 q = ToFloat(quadrant);
+
+            // angle - q * pi/2 in three parts so the reduction stays exact
+            Float4 r = angle - q * Splat(1.5703125f);
+            r = r - q * Splat(4.837512969970703125e-4f);
+            r = r - q * Splat(7.549789948768648e-8f);
+            const Float4 r2 = r * r;
+
+            const Float4 sinR = r + r * r2 * (Splat(-1.6666654611e-1f) +
+                r2 * (Splat(8.3321608736e-3f) + r2 * Splat(-1.9515295891e-4f)));
+            const Float4 cosR = Splat(1.0f) - Splat(0.5f) * r2 + r2 * r2 * (Splat(4.166664568298827e-2f) +
+                r2 * (Splat(-1.388731625493765e-3f) + r2 * Splat(2.443315711809948e-5f)));
+
+            // Odd quadrants swap sine and cosine; bit 1 of the quadrant (of
+            // quadrant + 1 for cosine) gives the sign
+            const Int4 one = SplatInt(1);
+            const Int4 swap = Equal(quadrant & one, one);
+            const Int4 sinSign = ShiftLeft<30>(quadrant & SplatInt(2));
+            const Int4 cosSign = ShiftLeft<30>((quadrant + one) & SplatInt(2));
+
+            outSin = FlipBits(Select(swap, cosR, sinR), sinSign);
+            outCos = FlipBits(Select(swap, sinR, cosR), cosSign);
+        }
+
+    }
+
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "TaskGraph.h"
+
+// C++20 coroutine front end for TaskGraph::Suspend. Only available when the
+// including translation unit is compiled with coroutine support.
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace GGEngine {
+
+    // =============================================================================
+    // Task Coroutine
+    // =============================================================================
+    // Return type for coroutine task bodies. Each co_await on a task suspends
+    // the coroutine and gives its worker back; it resumes (possibly on another
+    // worker) once the awaited task has finished. co_return the TaskResult:
+    //
+    //   TaskCoroutine LoadLevel(std::string path)
+    //   {
+    //       TaskID file = TaskGraph::Get().CreateTask("ReadFile", ...);
+    //       const TaskResult& data = co_await AwaitTask(file);
+    //       ...
+    //       co_return TaskResult::Success();
+    //   }
+    //
+    //   TaskID id = CreateCoroutineTask("LoadLevel", LoadLevel("levels/01.json"));
+    //
+    // The returned id works with Wait, Then and GetResult like any other task.
+    // As with dependencies, if an awaited task fails or is cancelled the
+    // coroutine is not resumed and its task fails. Awaiting an invalid or
+    // already released id fails the task too, since there is no result to resume with.
+    class TaskCoroutine
+    {
+    public:
+        struct promise_type
+        {
+            TaskResult Result;
+            TaskID Awaiting;
+
+            TaskCoroutine get_return_object()
+            {
+                return TaskCoroutine(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            // Starts when the task first runs, not when the coroutine is called
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+
+            void return_value(TaskResult result) { Result = std::move(result); }
+
+            void unhandled_exception()
+            {
+                try
+                {
+                    throw;
+                }
+                catch (const std::exception& e)
+                {
+                    Result.SetError(std::string("Exception: ") + e.what());
+                }
+                catch (...)
+                {
+                    Result.SetError("Unknown exception");
+                }
+            }
+        };
+
+        TaskCoroutine(TaskCoroutine&& other) noexcept : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+
+        TaskCoroutine& operator=(TaskCoroutine&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_Handle)
+                    m_Handle.destroy();
+                m_Handle = std::exchange(other.m_Handle, nullptr);
+            }
+            return *this;
+        }
+
+        TaskCoroutine(const TaskCoroutine&) = delete;
+        TaskCoroutine& operator=(const TaskCoroutine&) = delete;
+
+        ~TaskCoroutine()
+        {
+            if (m_Handle)
+                m_Handle.destroy();
+        }
+
+        // Run until the next co_await or co_return. Call from the task's work function.
+        TaskResult operator()()
+        {
+            m_Handle.resume();
+            if (m_Handle.done())
+                return std::move(m_Handle.promise().Result);
+
+            TaskID awaited = std::exchange(m_Handle.promise().Awaiting, TaskID{});
+            if (!TaskGraph::Get().IsAlive(awaited))
+                return TaskResult::Failure("Awaited task is invalid or was released");
+            return TaskGraph::Get().Suspend({ awaited });
+        }
+
+    private:
+        explicit TaskCoroutine(std::coroutine_handle<promise_type> handle) : m_Handle(handle) {}
+
+        std::coroutine_handle<promise_type> m_Handle;
+    };
+
+    // Awaitable for another task; co_await yields that task's result
+    class TaskAwaiter
+    {
+    public:
+        explicit TaskAwaiter(TaskID task) : m_Task(task) {}
+
+        // A failed task still suspends, so Suspend fails the awaiting task
+        bool await_ready() const { return TaskGraph::Get().GetState(m_Task) == TaskState::Completed; }
+
+        void await_suspend(std::coroutine_handle<TaskCoroutine::promise_type> handle) const
+        {
+            handle.promise().Awaiting = m_Task;
+        }
+
+        // After a suspension the awaiting task keeps the result alive until it finishes
+        const TaskResult& await_resume() const { return TaskGraph::Get().GetResult(m_Task); }
+
+    private:
+        TaskID m_Task;
+    };
+
+    inline TaskAwaiter AwaitTask(TaskID task) { return TaskAwaiter(task); }
+
+    // Schedule a coroutine as a task. The name is not copied (see CreateTask).
+    inline TaskID CreateCoroutineTask(const char* name,
+                                      TaskCoroutine coroutine,
+                                      TaskDependencies dependencies = {},
+                                      JobPriority priority = JobPriority::Normal)
+    {
+        return TaskGraph::Get().CreateTask(name, std::move(coroutine), dependencies, priority);
+    }
+
+}
+
+#endif
@@ -3,6 +3,62 @@
 
 namespace GGEngine {
 
+    namespace {
+
+        // Index of the calling thread in TaskGraph::m_Workers, -1 for non-worker threads
+        thread_local int t_WorkerIndex = -1;
+
+        // Task whose work function is running on this thread (for Suspend)
+        thread_local TaskID t_CurrentTask;
+
+        // Victim selection seed for non-worker threads stealing from inside Wait()
+        thread_local uint32_t t_StealSeed = 0x9E3779B9u;
+
+        // Failed find attempts (yielding between them) before an idle worker sleeps
+        constexpr uint32_t IdleSpinCount = 64;
+
+        // Injected tasks a worker moves into its own deque at once, so the rest
+        // of a burst from the main thread can be stolen without the inject lock
+        constexpr size_t InjectBatchSize = 32;
+
+        // ParallelFor splits ranges into about this many chunks per thread
+        constexpr size_t ChunksPerThread = 4;
+
+        // Shared state of one ParallelFor call, on the caller's stack
+        struct ParallelRange
+        {
+            void (*Invoke)(void* context, size_t chunk, size_t begin, size_t end);
+            void* Context;
+            size_t Begin;
+            size_t End;
+            size_t Grain;
+            size_t ChunkCount;
+            std::atomic<size_t> NextChunk{0};
+            std::atomic<size_t> HelpersDone{0};     // Helpers that ran and no longer touch the range
+
+            // Claim and run chunks until none are left
+            void Drain()
+            {
+                for (size_t chunk = NextChunk.fetch_add(1, std::memory_order_relaxed); chunk < ChunkCount;
+                     chunk = NextChunk.fetch_add(1, std::memory_order_relaxed))
+                {
+                    const size_t chunkBegin = Begin + chunk * Grain;
+                    Invoke(Context, chunk, chunkBegin, std::min(End, chunkBegin + Grain));
+                }
+            }
+        };
+
+        uint32_t NextRandom(uint32_t& state)
+        {
+            // xorshift32
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+    }
+
     // Static empty result for invalid queries
     const TaskResult TaskGraph::s_EmptyResult;
 
@@ -12,6 +68,13 @@ namespace GGEngine {
         return instance;
     }
 
+    TaskGraph::~TaskGraph()
+    {
+        // Join workers left running at exit (std::thread terminates if destroyed joinable)
+        Shutdown();
+        FreeTaskPages();
+    }
+
     void TaskGraph::Init(uint32_t numWorkers)
     {
         if (m_Initialized)
@@ -32,14 +95,17 @@ namespace GGEngine {
             workerCount = std::max(1u, std::thread::hardware_concurrency() - 1);
         }
 
-        // Reserve some initial capacity for tasks
-        m_Tasks.reserve(256);
-
-        // Create worker threads
+        // Every worker's deques must exist before any thread can steal from them
         m_Workers.reserve(workerCount);
         for (uint32_t i = 0; i < workerCount; i++)
         {
-            m_Workers.emplace_back(&TaskGraph::WorkerLoop, this);
+            m_Workers.push_back(std::make_unique<Worker>());
+            m_Workers.back()->StealSeed = (i + 1) * 2654435761u;
+        }
+
+        for (uint32_t i = 0; i < workerCount; i++)
+        {
+            m_Workers[i]->Thread = std::thread(&TaskGraph::WorkerLoop, this, i);
         }
 
         m_Initialized = true;
@@ -53,56 +119,81 @@ namespace GGEngine {
 
         GG_CORE_TRACE("TaskGraph shutting down...");
 
-        // Signal shutdown
-        {
-            std::lock_guard<std::mutex> lock(m_ReadyMutex);
-            m_Shutdown = true;
-        }
-        m_ReadyCondition.notify_all();
-
-        // Also wake any tasks waiting
+        // Signal shutdown - workers drain the ready queues, then exit
+        m_Shutdown = true;
         {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
-            for (auto& taskPtr : m_Tasks)
-            {
-                if (taskPtr)
-                {
-                    taskPtr->WaitCondition.notify_all();
-                }
-            }
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            m_WakeEpoch++;
         }
+        // Also wakes threads sleeping in Wait()
+        m_SleepCondition.notify_all();
 
         // Wait for all workers to finish
         for (auto& worker : m_Workers)
         {
-            if (worker.joinable())
-                worker.join();
+            if (worker->Thread.joinable())
+                worker->Thread.join();
         }
         m_Workers.clear();
 
         // Process any remaining callbacks
         ProcessCompletedCallbacks();
 
-        // Clear task storage
+        // Clear injection queues
         {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
-            m_Tasks.clear();
-            while (!m_FreeIndices.empty())
-                m_FreeIndices.pop();
+            std::lock_guard<std::mutex> lock(m_InjectMutex);
+            for (auto& queue : m_InjectQueues)
+                queue.Clear();
+            m_InjectCount = 0;
         }
 
-        // Clear ready queue
-        {
-            std::lock_guard<std::mutex> lock(m_ReadyMutex);
-            while (!m_ReadyQueue.empty())
-                m_ReadyQueue.pop();
-        }
+        // Clear task storage
+        FreeTaskPages();
 
         m_Initialized = false;
         GG_CORE_TRACE("TaskGraph shutdown complete");
     }
 
     TaskID TaskGraph::CreateTask(const TaskSpec& spec)
+    {
+        return CreateTaskInternal(spec.Name.c_str(), true, TaskFunction(spec.Work),
+                                  TaskDependencies(spec.Dependencies), spec.Priority,
+                                  spec.OnComplete ? &spec.OnComplete : nullptr);
+    }
+
+    TaskID TaskGraph::CreateTask(const std::string& name,
+                                  std::function<TaskResult()> work,
+                                  JobPriority priority)
+    {
+        return CreateTaskInternal(name.c_str(), true, TaskFunction(std::move(work)),
+                                  TaskDependencies{}, priority, nullptr);
+    }
+
+    TaskID TaskGraph::CreateTask(const std::string& name,
+                                  std::function<TaskResult()> work,
+                                  std::vector<TaskID> dependencies,
+                                  JobPriority priority)
+    {
+        return CreateTaskInternal(name.c_str(), true, TaskFunction(std::move(work)),
+                                  TaskDependencies(dependencies), priority, nullptr);
+    }
+
+    TaskID TaskGraph::Then(TaskID predecessor,
+                           const std::string& name,
+                           std::function<void()> continuation,
+                           JobPriority priority)
+    {
+        TaskFunction work([continuation = std::move(continuation)]() -> TaskResult {
+            continuation();
+            return TaskResult::Success();
+        });
+        return CreateTaskInternal(name.c_str(), true, std::move(work),
+                                  TaskDependencies(&predecessor, 1), priority, nullptr);
+    }
+
+    TaskID TaskGraph::CreateTaskInternal(const char* name, bool copyName, TaskFunction work,
+                                         TaskDependencies dependencies, JobPriority priority,
+                                         const std::function<void(TaskID, const TaskResult&)>* onComplete)
     {
         if (!m_Initialized)
         {
@@ -110,164 +201,209 @@ namespace GGEngine {
             return TaskID{};
         }
 
-        if (!spec.Work)
+        if (!work)
         {
             GG_CORE_WARN("TaskGraph::CreateTask called with null work function");
             return TaskID{};
         }
 
-        TaskID id;
+        TaskID id = AllocateTask();
+        if (!id.IsValid())
+            return id;
 
+        TaskData& task = GetSlot(id.Index);
+        task.Work = std::move(work);
+        task.IsEvent = false;
+        if (onComplete)
+            task.OnComplete = *onComplete;
+        if (copyName)
+        {
+            task.OwnedName.assign(name);
+            task.Name = task.OwnedName.c_str();
+        }
+        else
         {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
+            task.Name = name ? name : "";
+        }
+        task.Priority = priority;
 
-            // Get or create a slot
-            if (!m_FreeIndices.empty())
-            {
-                id.Index = m_FreeIndices.front();
-                m_FreeIndices.pop();
-                id.Generation = m_Tasks[id.Index]->Generation + 1;
-                // Reset the task data
-                m_Tasks[id.Index] = std::make_unique<TaskData>();
-                m_Tasks[id.Index]->Generation = id.Generation;
-            }
-            else
-            {
-                id.Index = static_cast<uint32_t>(m_Tasks.size());
-                id.Generation = 1;
-                m_Tasks.emplace_back(std::make_unique<TaskData>());
-                m_Tasks.back()->Generation = id.Generation;
-            }
+        // Hold one extra count while registering, so a dependency that completes
+        // concurrently can't make the task ready before registration is done
+        task.UnmetDependencies.store(1, std::memory_order_relaxed);
+        task.State.store(TaskState::Pending, std::memory_order_relaxed);
+        m_PendingCount.fetch_add(1, std::memory_order_relaxed);
 
-            TaskData& task = *m_Tasks[id.Index];
-            task.Spec = spec;
+        bool dependencyFailed = false;
+        if (dependencies.size() > 0)
+        {
+            // A dependency failing mid-registration abandons this task; holding our own
+            // lock makes that wait until the dependency list below is complete
+            std::lock_guard<std::mutex> registration(task.DependentsMutex);
 
-            // Count unmet dependencies (only valid ones)
-            uint32_t unmetDeps = 0;
-            for (const TaskID& depId : spec.Dependencies)
+            for (const TaskID& depId : dependencies)
             {
-                if (IsValidTaskInternal(depId))
+                // Invalid and released-and-recycled ids are skipped
+                if (!TryRetain(depId))
+                    continue;
+
+                if (!RegisterDependency(id, task, depId))
                 {
-                    TaskData* depTask = GetTaskDataInternal(depId);
-                    if (depTask)
-                    {
-                        TaskState depState = depTask->State.load(std::memory_order_acquire);
-                        if (depState == TaskState::Completed)
-                        {
-                            // Already done, don't count
-                        }
-                        else if (depState == TaskState::Failed || depState == TaskState::Cancelled)
-                        {
-                            // Dependency failed - mark this task as failed too
-                            task.State = TaskState::Failed;
-                            task.Result.SetError("Dependency task failed or was cancelled");
-                            return id;
-                        }
-                        else
-                        {
-                            // Dependency is pending/ready/running - register as dependent
-                            depTask->Dependents.push_back(id);
-                            unmetDeps++;
-                        }
-                    }
+                    dependencyFailed = true;
+                    break;
                 }
             }
-
-            task.UnmetDependencies = unmetDeps;
-
-            if (unmetDeps == 0)
-            {
-                // No dependencies or all completed - mark as ready
-                task.State = TaskState::Ready;
-                m_ReadyCount.fetch_add(1, std::memory_order_relaxed);
-            }
-            else
-            {
-                task.State = TaskState::Pending;
-                m_PendingCount.fetch_add(1, std::memory_order_relaxed);
-            }
         }
 
-        // If ready, add to ready queue
-        TaskState state;
+        if (dependencyFailed)
         {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
-            state = m_Tasks[id.Index]->State.load(std::memory_order_acquire);
+            // Dependency failed - mark this task as failed too
+            Abandon(id, TaskState::Failed, "Dependency task failed or was cancelled");
+            return id;
         }
 
-        if (state == TaskState::Ready)
+        // Release the registration count; queues the task if every dependency is done
+        TryMakeReady(id);
+        return id;
+    }
+
+    TaskID TaskGraph::CreateEvent(const char* name)
+    {
+        if (!m_Initialized)
         {
-            std::lock_guard<std::mutex> lock(m_ReadyMutex);
-            m_ReadyQueue.push(id);
-            m_ReadyCondition.notify_one();
+            GG_CORE_ERROR("TaskGraph::CreateEvent called before Init()");
+            return TaskID{};
         }
 
+        TaskID id = AllocateTask();
+        if (!id.IsValid())
+            return id;
+
+        // The registration count is never released, so nothing but Signal can
+        // make the event ready
+        TaskData& task = GetSlot(id.Index);
+        task.Name = name ? name : "";
+        task.IsEvent = true;
+        task.UnmetDependencies.store(1, std::memory_order_relaxed);
+        task.State.store(TaskState::Pending, std::memory_order_release);
+        m_PendingCount.fetch_add(1, std::memory_order_relaxed);
         return id;
     }
 
-    TaskID TaskGraph::CreateTask(const std::string& name,
-                                  std::function<TaskResult()> work,
-                                  JobPriority priority)
+    void TaskGraph::Signal(TaskID event)
     {
-        TaskSpec spec;
-        spec.Name = name;
-        spec.Work = std::move(work);
-        spec.Priority = priority;
-        return CreateTask(spec);
-    }
+        TaskData* data = GetTaskData(event);
+        if (!data || !data->IsEvent)
+            return;
 
-    TaskID TaskGraph::CreateTask(const std::string& name,
-                                  std::function<TaskResult()> work,
-                                  std::vector<TaskID> dependencies,
-                                  JobPriority priority)
-    {
-        TaskSpec spec;
-        spec.Name = name;
-        spec.Work = std::move(work);
-        spec.Dependencies = std::move(dependencies);
-        spec.Priority = priority;
-        return CreateTask(spec);
+        // Claiming settles races with Cancel and repeated signals
+        if (data->Claimed.exchange(true, std::memory_order_acq_rel))
+            return;
+
+        m_PendingCount.fetch_sub(1, std::memory_order_relaxed);
+        OnTaskCompleted(event, *data, TaskResult{});
     }
 
-    TaskID TaskGraph::Then(TaskID predecessor,
-                           const std::string& name,
-                           std::function<void()> continuation,
-                           JobPriority priority)
+    bool TaskGraph::Wait(TaskID task)
     {
-        TaskSpec spec;
-        spec.Name = name;
-        spec.Dependencies = { predecessor };
-        spec.Priority = priority;
-        spec.Work = [continuation = std::move(continuation)]() -> TaskResult {
-            continuation();
-            return TaskResult::Success();
+        TaskData* data = GetTaskData(task);
+        if (!data) return false;
+
+        // A recycled slot counts as finished; its id is stale
+        auto isFinished = [data, task]() {
+            if (data->Generation.load(std::memory_order_acquire) != task.Generation)
+                return true;
+            TaskState state = data->State.load(std::memory_order_seq_cst);
+            return state == TaskState::Completed ||
+                   state == TaskState::Failed ||
+                   state == TaskState::Cancelled;
         };
-        return CreateTask(spec);
+
+        // Announce ourselves before the first state check, so whoever finishes
+        // the task either sees us and wakes the sleep channel, or we see it done
+        data->Waiters.fetch_add(1, std::memory_order_seq_cst);
+
+        // Run other ready tasks until ours is done, sleeping like an idle worker
+        // when there are none. New work or the task finishing wakes us.
+        const int workerIndex = t_WorkerIndex;
+        uint32_t idleSpins = 0;
+        while (!isFinished() && !m_Shutdown.load(std::memory_order_acquire))
+        {
+            TaskID taskId;
+            if (FindWork(workerIndex, taskId))
+            {
+                idleSpins = 0;
+                Execute(taskId);
+                continue;
+            }
+
+            if (++idleSpins < IdleSpinCount)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            idleSpins = 0;
+
+            // Same handshake as WorkerLoop, with our task finishing as one more wake reason
+            uint64_t epoch;
+            {
+                std::lock_guard<std::mutex> lock(m_SleepMutex);
+                epoch = m_WakeEpoch;
+            }
+            m_SleepingCount.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (isFinished())
+            {
+                m_SleepingCount.fetch_sub(1, std::memory_order_relaxed);
+                break;
+            }
+            if (FindWork(workerIndex, taskId))
+            {
+                m_SleepingCount.fetch_sub(1, std::memory_order_relaxed);
+                Execute(taskId);
+                continue;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(m_SleepMutex);
+                m_SleepCondition.wait(lock, [this, epoch]() {
+                    return m_WakeEpoch != epoch || m_Shutdown.load(std::memory_order_relaxed);
+                });
+            }
+            m_SleepingCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        data->Waiters.fetch_sub(1, std::memory_order_relaxed);
+
+        if (data->Generation.load(std::memory_order_acquire) != task.Generation)
+            return false;
+        return data->State.load(std::memory_order_acquire) == TaskState::Completed;
     }
 
-    bool TaskGraph::Wait(TaskID task)
+    TaskResult TaskGraph::Suspend(TaskDependencies awaited)
     {
-        if (!IsValidTask(task))
-            return false;
+        TaskData* data = GetTaskData(t_CurrentTask);
+        if (!data)
+        {
+            GG_CORE_ERROR("TaskGraph::Suspend called outside a running task");
+            return TaskResult::Failure("Suspend called outside a running task");
+        }
 
-        TaskData* data = nullptr;
+        // Only the running task touches Awaiting; Execute registers it on return
+        for (const TaskID& depId : awaited)
         {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
-            data = GetTaskDataInternal(task);
-            if (!data) return false;
+            if (TryRetain(depId))
+                data->Awaiting.push_back(depId);
         }
 
-        std::unique_lock<std::mutex> waitLock(data->WaitMutex);
-        data->WaitCondition.wait(waitLock, [this, task, data]() {
-            TaskState state = data->State.load(std::memory_order_acquire);
-            return state == TaskState::Completed ||
-                   state == TaskState::Failed ||
-                   state == TaskState::Cancelled ||
-                   m_Shutdown;
-        });
+        TaskResult result;
+        result.m_Suspended = true;
+        return result;
+    }
 
-        TaskState finalState = data->State.load(std::memory_order_acquire);
-        return finalState == TaskState::Completed;
+    TaskID TaskGraph::GetCurrentTask() const
+    {
+        return t_CurrentTask;
     }
 
     void TaskGraph::WaitAll(const std::vector<TaskID>& tasks)
@@ -289,69 +425,36 @@ namespace GGEngine {
         return state == TaskState::Failed || state == TaskState::Cancelled;
     }
 
+    bool TaskGraph::IsAlive(TaskID task) const
+    {
+        return GetTaskData(task) != nullptr;
+    }
+
     TaskState TaskGraph::GetState(TaskID task) const
     {
-        std::lock_guard<std::mutex> lock(m_TaskMutex);
-        const TaskData* data = GetTaskDataInternal(task);
+        const TaskData* data = GetTaskData(task);
         if (!data) return TaskState::Failed;
         return data->State.load(std::memory_order_acquire);
     }
 
     const TaskResult& TaskGraph::GetResult(TaskID task) const
     {
-        std::lock_guard<std::mutex> lock(m_TaskMutex);
-        const TaskData* data = GetTaskDataInternal(task);
+        const TaskData* data = GetTaskData(task);
         if (!data) return s_EmptyResult;
         return data->Result;
     }
 
     void TaskGraph::Cancel(TaskID task)
     {
-        if (!IsValidTask(task))
-            return;
-
-        std::vector<TaskID> toCancelDependents;
-
-        {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
-            TaskData* data = GetTaskDataInternal(task);
-            if (!data) return;
-
-            TaskState state = data->State.load(std::memory_order_acquire);
-
-            // Can only cancel pending or ready tasks
-            if (state != TaskState::Pending && state != TaskState::Ready)
-                return;
-
-            // Update stats
-            if (state == TaskState::Pending)
-                m_PendingCount.fetch_sub(1, std::memory_order_relaxed);
-            else if (state == TaskState::Ready)
-                m_ReadyCount.fetch_sub(1, std::memory_order_relaxed);
-
-            data->State.store(TaskState::Cancelled, std::memory_order_release);
-            data->Result.SetError("Task was cancelled");
-
-            // Copy dependents for cascade cancellation
-            toCancelDependents = data->Dependents;
-        }
-
-        // Wake any waiters
-        {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
-            TaskData* data = GetTaskDataInternal(task);
-            if (data)
-            {
-                std::lock_guard<std::mutex> waitLock(data->WaitMutex);
-                data->WaitCondition.notify_all();
-            }
-        }
+        // Can only cancel pending or ready tasks - running/finished ones are already claimed.
+        // Dependents are cancelled too.
+        Abandon(task, TaskState::Cancelled, "Task was cancelled");
+    }
 
-        // Cascade cancel to dependents
-        for (const TaskID& depId : toCancelDependents)
-        {
-            Cancel(depId);
-        }
+    void TaskGraph::Release(TaskID task)
+    {
+        if (GetTaskData(task))
+            ReleaseTask(task.Index);
     }
 
     void TaskGraph::ProcessCompletedCallbacks()
@@ -375,258 +478,661 @@ namespace GGEngine {
         }
     }
 
-    void TaskGraph::WorkerLoop()
+    // =========================================================================
+    // Data parallelism
+    // =========================================================================
+
+    size_t TaskGraph::GetParallelGrain(size_t count, size_t minGrain) const
     {
-        while (true)
+        const size_t threads = static_cast<size_t>(GetWorkerCount()) + 1;
+        return std::max<size_t>({ 1, minGrain, count / (threads * ChunksPerThread) });
+    }
+
+    void TaskGraph::RunParallel(size_t begin, size_t end, size_t grain, RangeFn invoke, void* context)
+    {
+        ParallelRange range;
+        range.Invoke = invoke;
+        range.Context = context;
+        range.Begin = begin;
+        range.End = end;
+        range.Grain = grain;
+        range.ChunkCount = (end - begin + grain - 1) / grain;
+
+        if (range.ChunkCount <= 1 || !m_Initialized || m_Workers.empty())
         {
-            TaskID taskId;
+            range.Drain();
+            return;
+        }
 
-            // Wait for a ready task
-            {
-                std::unique_lock<std::mutex> lock(m_ReadyMutex);
-                m_ReadyCondition.wait(lock, [this]() {
-                    return m_Shutdown || !m_ReadyQueue.empty();
-                });
+        // One helper per worker that could usefully join in. Helpers pull chunks
+        // from the shared counter, so a helper that starts late just finds none.
+        const size_t helperCount = std::min<size_t>(m_Workers.size(), range.ChunkCount - 1);
+        TaskID helpers[64];
+        std::vector<TaskID> overflow;
+        TaskID* helperIds = helpers;
+        if (helperCount > std::size(helpers))
+        {
+            overflow.resize(helperCount);
+            helperIds = overflow.data();
+        }
+
+        ParallelRange* shared = &range;
+        for (size_t i = 0; i < helperCount; i++)
+        {
+            helperIds[i] = CreateTask("ParallelFor", [shared]() -> TaskResult {
+                shared->Drain();
+                shared->HelpersDone.fetch_add(1, std::memory_order_release);
+                return TaskResult::Success();
+            }, JobPriority::High);
+        }
 
-                if (m_Shutdown && m_ReadyQueue.empty())
-                    return;
+        // Work alongside the helpers instead of blocking
+        range.Drain();
 
-                taskId = m_ReadyQueue.top();
-                m_ReadyQueue.pop();
+        // Every chunk is claimed. Retire helpers that never started (they would
+        // touch `range` after we return) and wait for the ones still running.
+        size_t started = 0;
+        for (size_t i = 0; i < helperCount; i++)
+        {
+            if (!Abandon(helperIds[i], TaskState::Cancelled, "Not needed"))
+            {
+                started++;
+                Wait(helperIds[i]);
             }
+            Release(helperIds[i]);
+        }
 
-            m_ReadyCount.fetch_sub(1, std::memory_order_relaxed);
-            m_RunningCount.fetch_add(1, std::memory_order_relaxed);
+        // Wait gives up once shutdown starts, while draining workers may still
+        // be running helpers, so also wait for every started one to let go
+        while (range.HelpersDone.load(std::memory_order_acquire) < started)
+            std::this_thread::yield();
+    }
 
-            // Get task data and mark as running
-            TaskSpec spec;
+    // =========================================================================
+    // Scheduling
+    // =========================================================================
+
+    void TaskGraph::WorkerLoop(uint32_t index)
+    {
+        const int workerIndex = static_cast<int>(index);
+        t_WorkerIndex = workerIndex;
+        uint32_t idleSpins = 0;
+
+        while (true)
+        {
+            TaskID taskId;
+            if (FindWork(workerIndex, taskId))
             {
-                std::lock_guard<std::mutex> lock(m_TaskMutex);
-                TaskData* data = GetTaskDataInternal(taskId);
-                if (!data || data->State.load(std::memory_order_acquire) != TaskState::Ready)
-                {
-                    m_RunningCount.fetch_sub(1, std::memory_order_relaxed);
-                    continue;
-                }
+                idleSpins = 0;
+                Execute(taskId);
+                continue;
+            }
+
+            // Queues drained - finish shutting down
+            if (m_Shutdown.load(std::memory_order_acquire))
+                break;
 
-                data->State.store(TaskState::Running, std::memory_order_release);
-                spec = data->Spec;  // Copy spec since we'll release the lock
+            if (++idleSpins < IdleSpinCount)
+            {
+                std::this_thread::yield();
+                continue;
             }
+            idleSpins = 0;
 
-            // Execute the task
-            TaskResult result;
-            try
+            // Announce we're going to sleep, then look once more. Schedule()
+            // publishes work before checking m_SleepingCount, so either we see
+            // the work here or the scheduler sees us and bumps the epoch.
+            uint64_t epoch;
             {
-                if (spec.Work)
-                {
-                    result = spec.Work();
-                }
+                std::lock_guard<std::mutex> lock(m_SleepMutex);
+                epoch = m_WakeEpoch;
             }
-            catch (const std::exception& e)
+            m_SleepingCount.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (FindWork(workerIndex, taskId))
             {
-                result.SetError(std::string("Exception: ") + e.what());
+                m_SleepingCount.fetch_sub(1, std::memory_order_relaxed);
+                Execute(taskId);
+                continue;
             }
-            catch (...)
+
             {
-                result.SetError("Unknown exception");
+                std::unique_lock<std::mutex> lock(m_SleepMutex);
+                m_SleepCondition.wait(lock, [this, epoch]() {
+                    return m_WakeEpoch != epoch || m_Shutdown.load(std::memory_order_relaxed);
+                });
             }
+            m_SleepingCount.fetch_sub(1, std::memory_order_relaxed);
+        }
 
-            m_RunningCount.fetch_sub(1, std::memory_order_relaxed);
+        t_WorkerIndex = -1;
+    }
 
-            // Complete the task
-            OnTaskCompleted(taskId, std::move(result));
+    bool TaskGraph::FindWork(int workerIndex, TaskID& outTask)
+    {
+        // Own deques first, newest task first - its data is most likely still in cache
+        if (workerIndex >= 0)
+        {
+            Worker& self = *m_Workers[workerIndex];
+            for (size_t level = PriorityCount; level-- > 0;)
+            {
+                if (self.Queues[level].Pop(outTask))
+                    return true;
+            }
         }
+
+        // Then work from other threads, highest priority first
+        for (size_t level = PriorityCount; level-- > 0;)
+        {
+            if (PopInjected(workerIndex, level, outTask))
+                return true;
+            if (StealWork(workerIndex, level, outTask))
+                return true;
+        }
+
+        return false;
     }
 
-    void TaskGraph::OnTaskCompleted(TaskID id, TaskResult result)
+    bool TaskGraph::PopInjected(int workerIndex, size_t level, TaskID& outTask)
     {
-        std::vector<TaskID> dependentsToCheck;
-        std::function<void(TaskID, const TaskResult&)> callback;
-        bool failed = result.HasError();
+        if (m_InjectCount.load(std::memory_order_acquire) == 0)
+            return false;
 
+        size_t moved = 0;
         {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
-            TaskData* data = GetTaskDataInternal(id);
-            if (!data) return;
+            std::lock_guard<std::mutex> lock(m_InjectMutex);
+            InjectQueue& queue = m_InjectQueues[level];
+            if (queue.Count == 0)
+                return false;
 
-            data->Result = std::move(result);
-            data->State.store(failed ? TaskState::Failed : TaskState::Completed, std::memory_order_release);
+            outTask = queue.Pop();
 
-            // Copy data we need after releasing lock
-            dependentsToCheck = data->Dependents;
-            callback = data->Spec.OnComplete;
-
-            // Wake any waiters
+            // Only workers have a deque to take a batch into
+            if (workerIndex >= 0)
             {
-                std::lock_guard<std::mutex> waitLock(data->WaitMutex);
-                data->WaitCondition.notify_all();
+                WorkStealingDeque<TaskID>& local = m_Workers[workerIndex]->Queues[level];
+                moved = std::min(queue.Count, InjectBatchSize);
+                for (size_t i = 0; i < moved; i++)
+                    local.Push(queue.Pop());
             }
+
+            m_InjectCount.fetch_sub(moved + 1, std::memory_order_release);
         }
 
-        // Queue callback for main thread if provided
-        if (callback)
+        // Others can now steal the batch
+        if (moved > 0)
+            WakeWorker();
+        return true;
+    }
+
+    bool TaskGraph::StealWork(int workerIndex, size_t level, TaskID& outTask)
+    {
+        const uint32_t workerCount = static_cast<uint32_t>(m_Workers.size());
+        if (workerCount < (workerIndex >= 0 ? 2u : 1u))
+            return false;
+
+        // Random starting victim spreads thieves across workers
+        uint32_t& seed = workerIndex >= 0 ? m_Workers[workerIndex]->StealSeed : t_StealSeed;
+        const uint32_t start = NextRandom(seed) % workerCount;
+        for (uint32_t i = 0; i < workerCount; i++)
         {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
-            TaskData* data = GetTaskDataInternal(id);
-            if (data)
-            {
-                std::lock_guard<std::mutex> cbLock(m_CallbackMutex);
-                m_CompletedCallbacks.push({id, data->Result, callback});
-            }
+            uint32_t victim = (start + i) % workerCount;
+            if (static_cast<int>(victim) == workerIndex)
+                continue;
+
+            if (m_Workers[victim]->Queues[level].Steal(outTask))
+                return true;
         }
+        return false;
+    }
+
+    void TaskGraph::Schedule(TaskID id, JobPriority priority)
+    {
+        const size_t level = static_cast<size_t>(priority);
+        GG_CORE_ASSERT(level < PriorityCount, "Invalid task priority");
 
-        // Handle dependents
-        if (failed)
+        if (t_WorkerIndex >= 0)
         {
-            // Propagate failure
-            for (const TaskID& depId : dependentsToCheck)
-            {
-                PropagateFailure(depId, "Dependency failed");
-            }
+            // Workers push to their own deque without locking
+            m_Workers[t_WorkerIndex]->Queues[level].Push(id);
         }
         else
         {
-            // Check if dependents can now run
-            for (const TaskID& depId : dependentsToCheck)
-            {
-                TryMakeReady(depId);
-            }
+            std::lock_guard<std::mutex> lock(m_InjectMutex);
+            m_InjectQueues[level].Push(id);
+            m_InjectCount.fetch_add(1, std::memory_order_release);
+        }
+
+        WakeWorker();
+    }
+
+    void TaskGraph::WakeWorker()
+    {
+        // Pairs with the fence in WorkerLoop: the work we just queued is visible
+        // to a worker that registered as sleeping after this point
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_SleepingCount.load(std::memory_order_relaxed) == 0)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            m_WakeEpoch++;
         }
+        m_SleepCondition.notify_one();
     }
 
-    void TaskGraph::PropagateFailure(TaskID id, const std::string& error)
+    void TaskGraph::WakeWaiters(TaskData& data)
     {
-        std::vector<TaskID> dependentsToFail;
+        // Pairs with the Waiters increment in Wait: a waiter we miss here sees the
+        // final state before it sleeps
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (data.Waiters.load(std::memory_order_relaxed) == 0)
+            return;
 
+        // Waiters share the sleep channel with idle workers, so wake them all
         {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
-            TaskData* data = GetTaskDataInternal(id);
-            if (!data) return;
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            m_WakeEpoch++;
+        }
+        m_SleepCondition.notify_all();
+    }
 
-            TaskState state = data->State.load(std::memory_order_acquire);
-            if (state != TaskState::Pending && state != TaskState::Ready)
-                return;
+    void TaskGraph::Execute(TaskID id)
+    {
+        // The queue entry holds the task's unfinished reference, so the slot is live
+        TaskData* data = GetTaskData(id);
+        if (!data)
+            return;
 
-            // Update stats
-            if (state == TaskState::Pending)
-                m_PendingCount.fetch_sub(1, std::memory_order_relaxed);
-            else if (state == TaskState::Ready)
-                m_ReadyCount.fetch_sub(1, std::memory_order_relaxed);
+        // Cancelled or failed while queued - the entry is stale
+        if (data->Claimed.exchange(true, std::memory_order_acq_rel))
+        {
+            ReleaseTask(id.Index);
+            return;
+        }
 
-            data->State.store(TaskState::Failed, std::memory_order_release);
-            data->Result.SetError(error);
+        data->State.store(TaskState::Running, std::memory_order_release);
+        m_ReadyCount.fetch_sub(1, std::memory_order_relaxed);
+        m_RunningCount.fetch_add(1, std::memory_order_relaxed);
 
-            dependentsToFail = data->Dependents;
+        // Only the claimant touches the work, so run it in place. Save the current
+        // task - a Wait() inside the work may run other tasks on this thread.
+        const TaskID previousTask = t_CurrentTask;
+        t_CurrentTask = id;
 
-            // Wake any waiters
-            {
-                std::lock_guard<std::mutex> waitLock(data->WaitMutex);
-                data->WaitCondition.notify_all();
-            }
+        TaskResult result;
+        try
+        {
+            result = data->Work();
+        }
+        catch (const std::exception& e)
+        {
+            result.SetError(std::string("Exception: ") + e.what());
+        }
+        catch (...)
+        {
+            result.SetError("Unknown exception");
+        }
+
+        t_CurrentTask = previousTask;
+        m_RunningCount.fetch_sub(1, std::memory_order_relaxed);
+
+        if (result.IsSuspended())
+        {
+            Resuspend(id, *data);
+            return;
+        }
+
+        // Awaited tasks from a Suspend whose result was discarded
+        for (const TaskID& depId : data->Awaiting)
+            ReleaseTask(depId.Index);
+        data->Awaiting.clear();
+
+        // Drop captures now rather than when the slot is recycled
+        data->Work.Reset();
+
+        // Complete the task
+        OnTaskCompleted(id, *data, std::move(result));
+    }
+
+    // =========================================================================
+    // Dependency resolution
+    // =========================================================================
+
+    void TaskGraph::OnTaskCompleted(TaskID id, TaskData& data, TaskResult result)
+    {
+        bool failed = result.HasError();
+        data.Result = std::move(result);
+
+        // Dependents can't change once the task is final, so no copy is needed below
+        {
+            std::lock_guard<std::mutex> lock(data.DependentsMutex);
+            data.State.store(failed ? TaskState::Failed : TaskState::Completed, std::memory_order_release);
+        }
+
+        // Wake any waiters
+        WakeWaiters(data);
+
+        // Queue callback for main thread if provided
+        if (data.OnComplete)
+        {
+            std::lock_guard<std::mutex> cbLock(m_CallbackMutex);
+            m_CompletedCallbacks.push({id, data.Result, data.OnComplete});
         }
 
-        // Cascade failure
-        for (const TaskID& depId : dependentsToFail)
+        // Handle dependents: propagate failure, or check if they can now run
+        for (const TaskID& depId : data.Dependents)
         {
-            PropagateFailure(depId, "Dependency failed");
+            if (failed)
+                Abandon(depId, TaskState::Failed, "Dependency failed");
+            else
+                TryMakeReady(depId);
         }
+
+        ReleaseEdges(data);
+        ReleaseTask(id.Index);
     }
 
     void TaskGraph::TryMakeReady(TaskID id)
     {
-        bool shouldQueue = false;
+        TaskData* data = GetTaskData(id);
+        if (!data) return;
+
+        if (data->UnmetDependencies.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        // Last dependency resolved. Loses only if the task was cancelled/failed meanwhile.
+        TaskState expected = TaskState::Pending;
+        if (!data->State.compare_exchange_strong(expected, TaskState::Ready, std::memory_order_acq_rel))
+            return;
+
+        m_PendingCount.fetch_sub(1, std::memory_order_relaxed);
+        m_ReadyCount.fetch_add(1, std::memory_order_relaxed);
+        Schedule(id, data->Priority);
+    }
+
+    bool TaskGraph::RegisterDependency(TaskID id, TaskData& task, TaskID depId)
+    {
+        // Referenced until the task finishes, so it can read the result
+        if (task.DependencyCount < InlineDependencyCount)
+            task.Dependencies[task.DependencyCount++] = depId;
+        else
+            task.ExtraDependencies.push_back(depId);
 
+        // The dependency's lock orders this against it entering a final state
+        TaskData& depTask = GetSlot(depId.Index);
+        std::lock_guard<std::mutex> lock(depTask.DependentsMutex);
+        TaskState depState = depTask.State.load(std::memory_order_acquire);
+        if (depState == TaskState::Completed)
         {
-            std::lock_guard<std::mutex> lock(m_TaskMutex);
-            TaskData* data = GetTaskDataInternal(id);
-            if (!data) return;
+            // Already done, don't count
+            return true;
+        }
+        if (depState == TaskState::Failed || depState == TaskState::Cancelled)
+            return false;
+
+        // Dependency is pending/ready/running - register as dependent.
+        // Its dependents list holds a reference to us until it finishes.
+        task.UnmetDependencies.fetch_add(1, std::memory_order_relaxed);
+        task.RefCount.fetch_add(1, std::memory_order_relaxed);
+        depTask.Dependents.push_back(id);
+        return true;
+    }
+
+    void TaskGraph::Resuspend(TaskID id, TaskData& data)
+    {
+        // Registration hold, as in CreateTask
+        data.UnmetDependencies.store(1, std::memory_order_relaxed);
+        m_PendingCount.fetch_add(1, std::memory_order_relaxed);
 
-            TaskState state = data->State.load(std::memory_order_acquire);
-            if (state != TaskState::Pending)
-                return;
+        bool dependencyFailed = false;
+        {
+            std::lock_guard<std::mutex> registration(data.DependentsMutex);
+            data.State.store(TaskState::Pending, std::memory_order_release);
 
-            uint32_t remaining = data->UnmetDependencies.fetch_sub(1, std::memory_order_acq_rel);
-            if (remaining == 1)  // Was 1, now 0
+            for (const TaskID& depId : data.Awaiting)
             {
-                data->State.store(TaskState::Ready, std::memory_order_release);
-                m_PendingCount.fetch_sub(1, std::memory_order_relaxed);
-                m_ReadyCount.fetch_add(1, std::memory_order_relaxed);
-                shouldQueue = true;
+                if (dependencyFailed)
+                {
+                    // Still recorded so ReleaseEdges drops the reference
+                    if (data.DependencyCount < InlineDependencyCount)
+                        data.Dependencies[data.DependencyCount++] = depId;
+                    else
+                        data.ExtraDependencies.push_back(depId);
+                }
+                else if (!RegisterDependency(id, data, depId))
+                {
+                    dependencyFailed = true;
+                }
             }
+            data.Awaiting.clear();
+
+            // Cancel/failure propagation may claim the task from here on; it
+            // waits for this lock, so it sees every registered dependency
+            data.Claimed.store(false, std::memory_order_release);
         }
 
-        if (shouldQueue)
+        if (dependencyFailed)
         {
-            std::lock_guard<std::mutex> lock(m_ReadyMutex);
-            m_ReadyQueue.push(id);
-            m_ReadyCondition.notify_one();
+            Abandon(id, TaskState::Failed, "Awaited task failed or was cancelled");
+            return;
         }
+
+        // Release the registration count; re-queues the task if everything is done
+        TryMakeReady(id);
     }
 
-    bool TaskGraph::IsValidTask(TaskID id) const
+    bool TaskGraph::Abandon(TaskID id, TaskState finalState, const std::string& error)
     {
-        if (!id.IsValid()) return false;
+        TaskData* data = GetTaskData(id);
+        if (!data || data->Claimed.exchange(true, std::memory_order_acq_rel))
+            return false;
 
-        std::lock_guard<std::mutex> lock(m_TaskMutex);
-        return IsValidTaskInternal(id);
+        data->Result.SetError(error);
+
+        TaskState previous;
+        {
+            std::lock_guard<std::mutex> lock(data->DependentsMutex);
+            previous = data->State.exchange(finalState, std::memory_order_acq_rel);
+        }
+
+        // Update stats (a queued entry for a Ready task is skipped by Execute)
+        if (previous == TaskState::Pending)
+            m_PendingCount.fetch_sub(1, std::memory_order_relaxed);
+        else if (previous == TaskState::Ready)
+            m_ReadyCount.fetch_sub(1, std::memory_order_relaxed);
+
+        // Wake any waiters
+        WakeWaiters(*data);
+
+        // Cascade: dependents of a cancelled task are cancelled, of a failed one fail
+        const char* cascadeError = finalState == TaskState::Cancelled ? "Task was cancelled" : "Dependency failed";
+        for (const TaskID& depId : data->Dependents)
+        {
+            Abandon(depId, finalState, cascadeError);
+        }
+
+        ReleaseEdges(*data);
+
+        // A queued task's entry still holds the unfinished reference; Execute drops it
+        if (previous != TaskState::Ready)
+            ReleaseTask(id.Index);
+        return true;
     }
 
-    bool TaskGraph::IsValidTaskInternal(TaskID id) const
+    void TaskGraph::ReleaseEdges(TaskData& data)
     {
-        if (!id.IsValid()) return false;
-        if (id.Index >= m_Tasks.size()) return false;
-        if (!m_Tasks[id.Index]) return false;
-        return m_Tasks[id.Index]->Generation == id.Generation;
+        for (const TaskID& depId : data.Dependents)
+            ReleaseTask(depId.Index);
+        data.Dependents.clear();
+
+        for (uint32_t i = 0; i < data.DependencyCount; i++)
+            ReleaseTask(data.Dependencies[i].Index);
+        for (const TaskID& depId : data.ExtraDependencies)
+            ReleaseTask(depId.Index);
+        data.DependencyCount = 0;
+        data.ExtraDependencies.clear();
     }
 
-    TaskGraph::TaskData* TaskGraph::GetTaskData(TaskID id)
+    // =========================================================================
+    // Task storage
+    // =========================================================================
+
+    bool TaskGraph::TryRetain(TaskID id)
     {
-        std::lock_guard<std::mutex> lock(m_TaskMutex);
-        return GetTaskDataInternal(id);
+        TaskData* data = GetTaskData(id);
+        if (!data) return false;
+
+        // Never resurrect a slot whose last reference is already gone
+        uint32_t refs = data->RefCount.load(std::memory_order_relaxed);
+        do
+        {
+            if (refs == 0)
+                return false;
+        } while (!data->RefCount.compare_exchange_weak(refs, refs + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+        // The slot may have been recycled and reused between the lookup and the increment
+        if (data->Generation.load(std::memory_order_acquire) != id.Generation)
+        {
+            ReleaseTask(id.Index);
+            return false;
+        }
+        return true;
     }
 
-    const TaskGraph::TaskData* TaskGraph::GetTaskData(TaskID id) const
+    void TaskGraph::ReleaseTask(uint32_t index)
     {
-        std::lock_guard<std::mutex> lock(m_TaskMutex);
-        return GetTaskDataInternal(id);
+        TaskData& task = GetSlot(index);
+        if (task.RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            RecycleTask(index, task);
     }
 
-    TaskGraph::TaskData* TaskGraph::GetTaskDataInternal(TaskID id)
+    TaskID TaskGraph::AllocateTask()
     {
-        if (!id.IsValid()) return nullptr;
-        if (id.Index >= m_Tasks.size()) return nullptr;
-        if (!m_Tasks[id.Index]) return nullptr;
-        if (m_Tasks[id.Index]->Generation != id.Generation) return nullptr;
-        return m_Tasks[id.Index].get();
+        // Reuse a recycled slot if there is one
+        uint32_t index = InvalidTaskIndex;
+        uint64_t head = m_FreeTasks.load(std::memory_order_acquire);
+        while (static_cast<uint32_t>(head) != InvalidTaskIndex)
+        {
+            const uint32_t top = static_cast<uint32_t>(head);
+            const uint64_t next = (((head >> 32) + 1) << 32) | GetSlot(top).NextFree.load(std::memory_order_relaxed);
+            if (m_FreeTasks.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                index = top;
+                break;
+            }
+        }
+
+        if (index == InvalidTaskIndex)
+        {
+            index = m_NextTaskIndex.fetch_add(1, std::memory_order_relaxed);
+            const uint32_t pageIndex = index >> TaskPageShift;
+            if (pageIndex >= MaxTaskPages)
+            {
+                GG_CORE_ERROR("TaskGraph task storage exhausted ({} live tasks)", MaxTaskPages * TaskPageSize);
+                return TaskID{};
+            }
+
+            TaskData* page = m_TaskPages[pageIndex].load(std::memory_order_acquire);
+            if (!page)
+            {
+                std::lock_guard<std::mutex> lock(m_TaskMutex);
+                page = m_TaskPages[pageIndex].load(std::memory_order_relaxed);
+                if (!page)
+                {
+                    page = new TaskData[TaskPageSize];
+                    m_TaskPages[pageIndex].store(page, std::memory_order_release);
+                }
+            }
+
+            page[index & (TaskPageSize - 1)].Generation.store(1, std::memory_order_relaxed);
+        }
+
+        // The creator's handle plus the unfinished reference
+        TaskData& task = GetSlot(index);
+        task.Claimed.store(false, std::memory_order_relaxed);
+        task.State.store(TaskState::Pending, std::memory_order_relaxed);
+        task.RefCount.store(2, std::memory_order_release);
+        return TaskID{ index, task.Generation.load(std::memory_order_relaxed) };
     }
 
-    const TaskGraph::TaskData* TaskGraph::GetTaskDataInternal(TaskID id) const
+    void TaskGraph::RecycleTask(uint32_t index, TaskData& task)
     {
-        if (!id.IsValid()) return nullptr;
-        if (id.Index >= m_Tasks.size()) return nullptr;
-        if (!m_Tasks[id.Index]) return nullptr;
-        if (m_Tasks[id.Index]->Generation != id.Generation) return nullptr;
-        return m_Tasks[id.Index].get();
+        // Stale ids stop resolving before anything is reset
+        task.Generation.fetch_add(1, std::memory_order_acq_rel);
+
+        task.Work.Reset();
+        task.OnComplete = nullptr;
+        task.Result.Reset();
+        task.Name = "";
+
+        uint64_t head = m_FreeTasks.load(std::memory_order_relaxed);
+        uint64_t next;
+        do
+        {
+            task.NextFree.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            next = (((head >> 32) + 1) << 32) | index;
+        } while (!m_FreeTasks.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
     }
 
-    bool TaskGraph::TaskPriorityComparator::operator()(const TaskID& a, const TaskID& b) const
+    void TaskGraph::FreeTaskPages()
     {
-        if (!Graph) return false;
+        std::lock_guard<std::mutex> lock(m_TaskMutex);
+        for (auto& page : m_TaskPages)
+        {
+            delete[] page.exchange(nullptr, std::memory_order_relaxed);
+        }
+        m_NextTaskIndex = 0;
+        m_FreeTasks = InvalidTaskIndex;
+    }
 
-        // We need to access task data, but we're called from within locked context
-        // so we can't take the lock again. Access directly.
-        if (a.Index >= Graph->m_Tasks.size() || b.Index >= Graph->m_Tasks.size())
-            return false;
+    TaskGraph::TaskData& TaskGraph::GetSlot(uint32_t index) const
+    {
+        return m_TaskPages[index >> TaskPageShift].load(std::memory_order_acquire)[index & (TaskPageSize - 1)];
+    }
+
+    TaskGraph::TaskData* TaskGraph::GetTaskData(TaskID id) const
+    {
+        if (!id.IsValid()) return nullptr;
 
-        const auto& taskAPtr = Graph->m_Tasks[a.Index];
-        const auto& taskBPtr = Graph->m_Tasks[b.Index];
+        const uint32_t pageIndex = id.Index >> TaskPageShift;
+        if (pageIndex >= MaxTaskPages) return nullptr;
 
-        if (!taskAPtr || !taskBPtr)
-            return false;
+        TaskData* page = m_TaskPages[pageIndex].load(std::memory_order_acquire);
+        if (!page) return nullptr;
 
-        // Lower value means lower priority in priority_queue (max-heap)
-        // So we want higher priority to return false (be at top)
-        return static_cast<uint8_t>(taskAPtr->Spec.Priority) < static_cast<uint8_t>(taskBPtr->Spec.Priority);
+        TaskData& task = page[id.Index & (TaskPageSize - 1)];
+        if (task.Generation.load(std::memory_order_acquire) != id.Generation) return nullptr;
+        return &task;
+    }
+
+    // =========================================================================
+    // Injection queue
+    // =========================================================================
+
+    void TaskGraph::InjectQueue::Push(TaskID id)
+    {
+        if (Count == Items.size())
+        {
+            // Unroll the ring into a buffer twice the size
+            std::vector<TaskID> grown(std::max<size_t>(64, Items.size() * 2));
+            for (size_t i = 0; i < Count; i++)
+                grown[i] = Items[(Head + i) % Items.size()];
+            Items.swap(grown);
+            Head = 0;
+        }
+
+        Items[(Head + Count) % Items.size()] = id;
+        Count++;
+    }
+
+    TaskID TaskGraph::InjectQueue::Pop()
+    {
+        TaskID id = Items[Head];
+        Head = (Head + 1) % Items.size();
+        Count--;
+        return id;
     }
 
 }
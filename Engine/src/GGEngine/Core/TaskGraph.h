@@ -1,16 +1,24 @@
 #pragma once
 
 #include "Core.h"
+#include "WorkStealingDeque.h"
 
 #include <functional>
 #include <queue>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
 #include <atomic>
 #include <any>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
 #include <string>
 #include <vector>
+#include <type_traits>
+#include <utility>
 #include <unordered_map>
 
 namespace GGEngine {
@@ -71,6 +79,29 @@ namespace GGEngine {
         }
     };
 
+    // =============================================================================
+    // Task Dependencies
+    // =============================================================================
+    // Non-owning list of dependencies for the allocation-free CreateTask overloads.
+    // Built from a braced list, or explicitly from a vector/array; only read
+    // while CreateTask runs.
+    class TaskDependencies
+    {
+    public:
+        TaskDependencies() = default;
+        TaskDependencies(std::initializer_list<TaskID> list) : m_Data(std::data(list)), m_Size(list.size()) {}
+        TaskDependencies(const TaskID* data, size_t size) : m_Data(data), m_Size(size) {}
+        explicit TaskDependencies(const std::vector<TaskID>& list) : m_Data(list.data()), m_Size(list.size()) {}
+
+        const TaskID* begin() const { return m_Data; }
+        const TaskID* end() const { return m_Data + m_Size; }
+        size_t size() const { return m_Size; }
+
+    private:
+        const TaskID* m_Data = nullptr;
+        size_t m_Size = 0;
+    };
+
     // =============================================================================
     // Task Result
     // =============================================================================
@@ -109,12 +140,24 @@ namespace GGEngine {
         bool HasError() const { return !m_Error.empty(); }
         const std::string& GetError() const { return m_Error; }
 
+        // True for the marker returned by TaskGraph::Suspend
+        bool IsSuspended() const { return m_Suspended; }
+
         void SetError(std::string error)
         {
             m_Error = std::move(error);
             m_HasValue = false;
         }
 
+        // Clear value and error (keeps the error string's buffer for reuse)
+        void Reset()
+        {
+            m_Value.reset();
+            m_Error.clear();
+            m_HasValue = false;
+            m_Suspended = false;
+        }
+
         // Create a successful empty result
         static TaskResult Success() { return TaskResult{}; }
 
@@ -127,9 +170,139 @@ namespace GGEngine {
         }
 
     private:
+        friend class TaskGraph;
+
         std::any m_Value;
         std::string m_Error;
         bool m_HasValue = false;
+        bool m_Suspended = false;
+    };
+
+    // =============================================================================
+    // Task Function
+    // =============================================================================
+    // Move-only TaskResult() callable with inline storage. Callables whose
+    // captures fit in InlineSize bytes (and move without throwing) are stored
+    // in place, so creating a task never touches the heap; larger ones fall
+    // back to a heap copy. std::function also fits, which is how TaskSpec
+    // work functions are stored.
+    //
+    class TaskFunction
+    {
+    public:
+        static constexpr size_t InlineSize = 48;
+
+        template<typename Fn>
+        static constexpr bool FitsInline =
+            sizeof(Fn) <= InlineSize &&
+            alignof(Fn) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible_v<Fn>;
+
+        TaskFunction() = default;
+
+        template<typename Fn, typename F = std::decay_t<Fn>,
+                 typename = std::enable_if_t<!std::is_same_v<F, TaskFunction>>>
+        TaskFunction(Fn&& fn)
+        {
+            // Empty std::function / null function pointer stays empty
+            if constexpr (std::is_constructible_v<bool, const F&>)
+            {
+                if (!static_cast<bool>(fn))
+                    return;
+            }
+
+            if constexpr (FitsInline<F>)
+            {
+                new (m_Storage) F(std::forward<Fn>(fn));
+                m_Ops = &InlineOps<F>::Table;
+            }
+            else
+            {
+                *reinterpret_cast<F**>(m_Storage) = new F(std::forward<Fn>(fn));
+                m_Ops = &HeapOps<F>::Table;
+            }
+        }
+
+        TaskFunction(TaskFunction&& other) noexcept
+        {
+            MoveFrom(other);
+        }
+
+        TaskFunction& operator=(TaskFunction&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                MoveFrom(other);
+            }
+            return *this;
+        }
+
+        TaskFunction(const TaskFunction&) = delete;
+        TaskFunction& operator=(const TaskFunction&) = delete;
+
+        ~TaskFunction() { Reset(); }
+
+        // Destroy the stored callable (and its captures)
+        void Reset()
+        {
+            if (m_Ops)
+            {
+                m_Ops->Destroy(m_Storage);
+                m_Ops = nullptr;
+            }
+        }
+
+        explicit operator bool() const { return m_Ops != nullptr; }
+
+        // True if the callable lives in the inline buffer
+        bool IsInline() const { return m_Ops && m_Ops->Inline; }
+
+        TaskResult operator()() { return m_Ops->Invoke(m_Storage); }
+
+    private:
+        struct Ops
+        {
+            TaskResult (*Invoke)(void* storage);
+            void (*Move)(void* dst, void* src);     // Move-construct dst, destroy src
+            void (*Destroy)(void* storage);
+            bool Inline;
+        };
+
+        template<typename F>
+        struct InlineOps
+        {
+            static TaskResult Invoke(void* storage) { return (*static_cast<F*>(storage))(); }
+            static void Move(void* dst, void* src)
+            {
+                new (dst) F(std::move(*static_cast<F*>(src)));
+                static_cast<F*>(src)->~F();
+            }
+            static void Destroy(void* storage) { static_cast<F*>(storage)->~F(); }
+            static constexpr Ops Table = { &Invoke, &Move, &Destroy, true };
+        };
+
+        template<typename F>
+        struct HeapOps
+        {
+            static TaskResult Invoke(void* storage) { return (**static_cast<F**>(storage))(); }
+            static void Move(void* dst, void* src) { *static_cast<F**>(dst) = *static_cast<F**>(src); }
+            static void Destroy(void* storage) { delete *static_cast<F**>(storage); }
+            static constexpr Ops Table = { &Invoke, &Move, &Destroy, false };
+        };
+
+        void MoveFrom(TaskFunction& other)
+        {
+            if (other.m_Ops)
+            {
+                other.m_Ops->Move(m_Storage, other.m_Storage);
+                m_Ops = other.m_Ops;
+                other.m_Ops = nullptr;
+            }
+        }
+
+        alignas(std::max_align_t) unsigned char m_Storage[InlineSize];
+        const Ops* m_Ops = nullptr;
     };
 
     // =============================================================================
@@ -150,6 +323,21 @@ namespace GGEngine {
     // =============================================================================
     // Advanced job system with task dependencies, results, and error propagation.
     // Tasks can depend on other tasks and pass results between them.
+    //
+    // Scheduling is work-stealing: each worker owns one Chase-Lev deque per
+    // priority and runs its own newest task first, stealing the oldest task of
+    // another worker when it runs dry. Higher priorities are always checked
+    // first, but ordering across workers is best-effort, not a global heap.
+    // Dependency counts are atomic; completing a task only locks that task.
+    // Threads blocked in Wait() help by running ready tasks until theirs is done.
+    // A running task can return Suspend(...) to give its worker back and be run
+    // again once the tasks it awaits finish (see TaskCoroutine.h for co_await).
+    //
+    // Task slots are pooled. A slot is recycled once the task has finished,
+    // every task depending on it has finished, and its creator has called
+    // Release() on the id. Ids that are never released keep their slot (and
+    // result) until Shutdown. After Release the id may go stale at any time;
+    // stale ids behave like invalid ones.
     class GG_API TaskGraph
     {
     public:
@@ -205,6 +393,28 @@ namespace GGEngine {
             return CreateTask(spec);
         }
 
+        // Allocation-free creation. work is stored inline when its captures fit in
+        // TaskFunction::InlineSize bytes, dependencies are copied into the task's
+        // slot, and the name is not copied - pass a string literal or other
+        // storage that outlives the task. With pooled slots (see Release), steady-
+        // state creation touches the heap only for oversized captures.
+        template<typename Fn, typename = std::enable_if_t<std::is_invocable_r_v<TaskResult, std::decay_t<Fn>&>>>
+        TaskID CreateTask(const char* name,
+                          Fn&& work,
+                          JobPriority priority = JobPriority::Normal)
+        {
+            return CreateTaskInternal(name, false, TaskFunction(std::forward<Fn>(work)), TaskDependencies{}, priority, nullptr);
+        }
+
+        template<typename Fn, typename = std::enable_if_t<std::is_invocable_r_v<TaskResult, std::decay_t<Fn>&>>>
+        TaskID CreateTask(const char* name,
+                          Fn&& work,
+                          TaskDependencies dependencies,
+                          JobPriority priority = JobPriority::Normal)
+        {
+            return CreateTaskInternal(name, false, TaskFunction(std::forward<Fn>(work)), dependencies, priority, nullptr);
+        }
+
         // Chain a continuation task that receives the result of a predecessor
         template<typename TIn, typename TOut>
         TaskID Then(TaskID predecessor,
@@ -243,11 +453,89 @@ namespace GGEngine {
                     std::function<void()> continuation,
                     JobPriority priority = JobPriority::Normal);
 
+        // Create an event: a task with no work that stays Pending until Signal()
+        // completes it. Wait on it, depend on it or await it like any task - e.g.
+        // to mark the end of work whose task structure isn't known up front.
+        // The name is not copied (see CreateTask).
+        TaskID CreateEvent(const char* name);
+
+        // Complete an event, releasing its waiters and dependents. Call at most
+        // once; no effect on cancelled events or ids that aren't events.
+        void Signal(TaskID event);
+
+        // -------------------------------------------------------------------------
+        // Data Parallelism
+        // -------------------------------------------------------------------------
+
+        // Invoke fn(chunkBegin, chunkEnd) over [begin, end) split into chunks.
+        // Idle workers and the calling thread claim chunks dynamically; the caller
+        // returns once every chunk has run. minGrain is the smallest chunk worth
+        // scheduling - larger ranges get larger chunks, a few per thread, so
+        // uneven chunk costs still balance. Runs inline if the range fits one
+        // chunk or the graph isn't initialized. fn runs concurrently and must not throw.
+        template<typename Fn>
+        void ParallelFor(size_t begin, size_t end, size_t minGrain, Fn&& fn)
+        {
+            if (begin >= end) return;
+
+            auto* context = const_cast<std::remove_const_t<std::remove_reference_t<Fn>>*>(&fn);
+            RunParallel(begin, end, GetParallelGrain(end - begin, minGrain),
+                [](void* ctx, size_t, size_t chunkBegin, size_t chunkEnd) {
+                    (*static_cast<decltype(context)>(ctx))(chunkBegin, chunkEnd);
+                }, context);
+        }
+
+        // Reduce [begin, end): map(chunkBegin, chunkEnd) -> T runs per chunk in
+        // parallel, then the chunk results are folded in range order on the
+        // calling thread with combine(T, T) -> T, which must be associative.
+        template<typename T, typename Map, typename Combine>
+        T ParallelReduce(size_t begin, size_t end, size_t minGrain, T identity, Map&& map, Combine&& combine)
+        {
+            if (begin >= end) return identity;
+
+            const size_t grain = GetParallelGrain(end - begin, minGrain);
+            std::vector<T> partials((end - begin + grain - 1) / grain, identity);
+
+            auto body = [&partials, &map](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+                partials[chunk] = map(chunkBegin, chunkEnd);
+            };
+            RunParallel(begin, end, grain,
+                [](void* ctx, size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+                    (*static_cast<decltype(body)*>(ctx))(chunk, chunkBegin, chunkEnd);
+                }, &body);
+
+            T result = std::move(identity);
+            for (T& partial : partials)
+                result = combine(std::move(result), std::move(partial));
+            return result;
+        }
+
+        // Chunk size ParallelFor/ParallelReduce use for count items
+        size_t GetParallelGrain(size_t count, size_t minGrain) const;
+
+        // -------------------------------------------------------------------------
+        // Suspension
+        // -------------------------------------------------------------------------
+
+        // Call from inside a running task and return the result from its work
+        // function: the task goes back to Pending, freeing its worker, and its work
+        // function is invoked again once every awaited task has finished (so it
+        // must track its own progress, e.g. a step counter in a mutable lambda).
+        // Awaited results stay readable until the task finishes. If an awaited
+        // task fails or is cancelled, this task fails like any dependent would.
+        // With nothing valid to await, the task is simply re-queued.
+        TaskResult Suspend(TaskDependencies awaited);
+
+        // The task running on the calling thread, or an invalid id
+        TaskID GetCurrentTask() const;
+
         // -------------------------------------------------------------------------
         // Task Queries
         // -------------------------------------------------------------------------
 
-        // Wait for a task to complete (blocking)
+        // Wait for a task to complete. The calling thread (main or worker) runs
+        // other ready tasks meanwhile, so waiting inside a task doesn't tie up a
+        // worker. Never wait on a task that depends on the calling task.
         // Returns false if task was cancelled or doesn't exist
         bool Wait(TaskID task);
 
@@ -260,6 +548,9 @@ namespace GGEngine {
         // Check if task failed
         bool IsFailed(TaskID task) const;
 
+        // Check if task still exists (false once released, or for an invalid id)
+        bool IsAlive(TaskID task) const;
+
         // Get task state
         TaskState GetState(TaskID task) const;
 
@@ -275,6 +566,11 @@ namespace GGEngine {
         // Also cancels all tasks that depend on this one
         void Cancel(TaskID task);
 
+        // Drop the creator's reference to a task. It still runs; its slot is
+        // recycled once it and its dependents have finished. Don't use the id
+        // afterwards (including as a dependency - a stale id is ignored).
+        void Release(TaskID task);
+
         // -------------------------------------------------------------------------
         // Main Thread Processing
         // -------------------------------------------------------------------------
@@ -293,24 +589,61 @@ namespace GGEngine {
         size_t GetRunningTaskCount() const { return m_RunningCount.load(std::memory_order_relaxed); }
 
     private:
-        TaskGraph() : m_ReadyQueue(TaskPriorityComparator(this)) {}
-        ~TaskGraph() = default;
+        TaskGraph() = default;
+        ~TaskGraph();
         TaskGraph(const TaskGraph&) = delete;
         TaskGraph& operator=(const TaskGraph&) = delete;
 
-        // Internal task data
+        static constexpr size_t PriorityCount = 3;
+
+        static constexpr uint32_t InvalidTaskIndex = UINT32_MAX;
+        static constexpr size_t InlineDependencyCount = 4;
+
+        // Internal task data. Slots are pooled - every field is reinitialized on reuse,
+        // and containers keep their capacity so steady-state reuse doesn't allocate.
         struct TaskData
         {
-            TaskSpec Spec;
+            TaskFunction Work;
+            std::function<void(TaskID, const TaskResult&)> OnComplete;     // Main thread callback
+            const char* Name = "";                                          // Debug name
+            std::string OwnedName;                                          // Name storage for std::string names
+            JobPriority Priority = JobPriority::Normal;
+            bool IsEvent = false;                                           // Completed by Signal(), never run
+
             std::atomic<TaskState> State{TaskState::Pending};
             TaskResult Result;
             std::atomic<uint32_t> UnmetDependencies{0};
-            std::vector<TaskID> Dependents;  // Tasks waiting on this one
-            uint32_t Generation = 0;
-
-            // For wait support
-            mutable std::mutex WaitMutex;
-            mutable std::condition_variable WaitCondition;
+            std::atomic<uint32_t> Generation{0};
+
+            // Slot references: the creator's handle, one while the task is unfinished
+            // (held by its queue entry once Ready), one per dependent edge in either
+            // direction. The slot is recycled when this drops to zero.
+            std::atomic<uint32_t> RefCount{0};
+            std::atomic<uint32_t> NextFree{InvalidTaskIndex};
+
+            // Set once by whoever moves the task past Ready: the worker that runs it,
+            // or Cancel/failure propagation. Only the claimant may write Result.
+            std::atomic<bool> Claimed{false};
+
+            // Tasks this one waits on, referenced until it finishes so it can read
+            // their results: Dependencies[0, DependencyCount), then ExtraDependencies
+            TaskID Dependencies[InlineDependencyCount];
+            uint32_t DependencyCount = 0;
+            std::vector<TaskID> ExtraDependencies;
+
+            // Tasks passed to Suspend() by the running work function (already
+            // referenced); registered as dependencies once the work returns
+            std::vector<TaskID> Awaiting;
+
+            // Tasks waiting on this one. Guarded by DependentsMutex, which is also
+            // held while the task enters a final state so late registrations see it.
+            // Read-only once the task is final.
+            std::vector<TaskID> Dependents;
+            std::mutex DependentsMutex;
+
+            // Threads blocked in Wait() on this task. Finishing a task with waiters
+            // wakes the sleep channel, where waiting threads sleep alongside workers.
+            std::atomic<uint32_t> Waiters{0};
 
             // Non-copyable due to atomics and mutex
             TaskData() = default;
@@ -321,56 +654,124 @@ namespace GGEngine {
             TaskData& operator=(TaskData&&) = delete;
         };
 
-        // Priority comparator for ready queue
-        struct TaskPriorityComparator
+        // Ready tasks injected from non-worker threads, FIFO. A ring that only
+        // grows, so steady-state pushes don't allocate.
+        struct InjectQueue
+        {
+            std::vector<TaskID> Items;
+            size_t Head = 0;
+            size_t Count = 0;
+
+            void Push(TaskID id);
+            TaskID Pop();
+            void Clear() { Head = 0; Count = 0; }
+        };
+
+        // Per-worker ready queues, one deque per priority level. The owner
+        // pushes/pops at the bottom; idle workers steal from the top.
+        struct alignas(64) Worker
         {
-            TaskPriorityComparator() = default;
-            explicit TaskPriorityComparator(const TaskGraph* graph) : Graph(graph) {}
-            bool operator()(const TaskID& a, const TaskID& b) const;
-            const TaskGraph* Graph = nullptr;
+            std::thread Thread;
+            WorkStealingDeque<TaskID> Queues[PriorityCount];
+            uint32_t StealSeed = 1;
         };
 
+        // Run invoke(context, chunkIndex, chunkBegin, chunkEnd) for every grain-sized
+        // chunk of [begin, end) on the caller plus helper tasks
+        using RangeFn = void (*)(void* context, size_t chunk, size_t begin, size_t end);
+        void RunParallel(size_t begin, size_t end, size_t grain, RangeFn invoke, void* context);
+
+        // Shared by every CreateTask overload. copyName stores a copy of name
+        // instead of the pointer; onComplete may be null.
+        TaskID CreateTaskInternal(const char* name, bool copyName, TaskFunction work, TaskDependencies dependencies,
+                                  JobPriority priority, const std::function<void(TaskID, const TaskResult&)>* onComplete);
+
         // Worker thread function
-        void WorkerLoop();
+        void WorkerLoop(uint32_t index);
 
-        // Called when a task completes - resolves dependencies
-        void OnTaskCompleted(TaskID id, TaskResult result);
+        // Find a ready task: own deques, then the injection queue, then steal.
+        // workerIndex is -1 for non-worker threads helping out in Wait().
+        bool FindWork(int workerIndex, TaskID& outTask);
+        bool PopInjected(int workerIndex, size_t level, TaskID& outTask);
+        bool StealWork(int workerIndex, size_t level, TaskID& outTask);
+
+        // Run a ready task on the calling thread (no-op if it was cancelled/failed while queued)
+        void Execute(TaskID id);
 
-        // Propagate failure to dependent tasks
-        void PropagateFailure(TaskID id, const std::string& error);
+        // Queue a ready task: the calling worker's own deque, or the injection queue
+        void Schedule(TaskID id, JobPriority priority);
 
-        // Move task to ready queue if all dependencies met
+        // Wake one sleeping worker (or waiting thread), if any
+        void WakeWorker();
+
+        // Wake threads sleeping in Wait() on a task that just finished
+        void WakeWaiters(TaskData& data);
+
+        // Called when a task completes - resolves dependencies
+        void OnTaskCompleted(TaskID id, TaskData& data, TaskResult result);
+
+        // Drop one unmet dependency; queue the task when none remain
         void TryMakeReady(TaskID id);
 
-        // Check if a TaskID is valid and matches current generation (takes lock)
-        bool IsValidTask(TaskID id) const;
+        // Record an already-retained dependency and, unless it's done, register as
+        // its dependent. Caller holds task.DependentsMutex. Returns false if the
+        // dependency failed or was cancelled.
+        bool RegisterDependency(TaskID id, TaskData& task, TaskID depId);
+
+        // Put a task that returned Suspend() back to Pending on what it awaits
+        void Resuspend(TaskID id, TaskData& data);
+
+        // Claim a pending/ready task and finish it with finalState without running it,
+        // cascading to its dependents. Returns false if it was already claimed.
+        bool Abandon(TaskID id, TaskState finalState, const std::string& error);
 
-        // Internal version (must be called with m_TaskMutex held)
-        bool IsValidTaskInternal(TaskID id) const;
+        // Release the refs a finished task holds on its dependents and dependencies
+        void ReleaseEdges(TaskData& data);
 
-        // Get task data (takes lock)
-        TaskData* GetTaskData(TaskID id);
-        const TaskData* GetTaskData(TaskID id) const;
+        // Slot reference counting; the last release recycles the slot
+        bool TryRetain(TaskID id);
+        void ReleaseTask(uint32_t index);
 
-        // Internal versions (must be called with m_TaskMutex held)
-        TaskData* GetTaskDataInternal(TaskID id);
-        const TaskData* GetTaskDataInternal(TaskID id) const;
+        // Reserve a task slot: a recycled one, or the next fresh index
+        // (lock-free except when a new page is needed)
+        TaskID AllocateTask();
+        void RecycleTask(uint32_t index, TaskData& task);
+        void FreeTaskPages();
 
-        // Task storage with generation-based recycling
-        // Using unique_ptr because TaskData is non-copyable/non-movable
-        std::vector<std::unique_ptr<TaskData>> m_Tasks;
-        std::queue<uint32_t> m_FreeIndices;
-        mutable std::mutex m_TaskMutex;
+        TaskData& GetSlot(uint32_t index) const;
 
-        // Ready queue (tasks with all dependencies met)
-        std::priority_queue<TaskID, std::vector<TaskID>, TaskPriorityComparator> m_ReadyQueue;
-        mutable std::mutex m_ReadyMutex;
-        std::condition_variable m_ReadyCondition;
+        // Lock-free lookup; nullptr if the id is invalid or stale
+        TaskData* GetTaskData(TaskID id) const;
 
-        // Worker threads
-        std::vector<std::thread> m_Workers;
+        // Task storage: a fixed page table, so lookups never take a lock and
+        // TaskData addresses stay stable while workers hold them
+        static constexpr uint32_t TaskPageShift = 10;
+        static constexpr uint32_t TaskPageSize = 1u << TaskPageShift;
+        static constexpr uint32_t MaxTaskPages = 1u << 14;
+        std::atomic<TaskData*> m_TaskPages[MaxTaskPages] = {};
+        std::atomic<uint32_t> m_NextTaskIndex{0};
+        std::mutex m_TaskMutex;     // Page allocation only
+
+        // Recycled slots: a lock-free stack threaded through TaskData::NextFree.
+        // Low 32 bits are the top index, high 32 bits a tag against ABA.
+        std::atomic<uint64_t> m_FreeTasks{InvalidTaskIndex};
+
+        // Worker threads (the vector is fixed while workers run)
+        std::vector<std::unique_ptr<Worker>> m_Workers;
         std::atomic<bool> m_Shutdown{false};
 
+        // Ready tasks queued from non-worker threads (main thread, loaders).
+        // Workers move a batch into their own deque so the rest can be stolen.
+        InjectQueue m_InjectQueues[PriorityCount];
+        std::mutex m_InjectMutex;
+        std::atomic<size_t> m_InjectCount{0};
+
+        // Idle workers and threads in Wait() sleep here; WakeWorker/WakeWaiters bump the epoch
+        std::mutex m_SleepMutex;
+        std::condition_variable m_SleepCondition;
+        std::atomic<uint32_t> m_SleepingCount{0};
+        uint64_t m_WakeEpoch = 0;
+
         // Completed callbacks for main thread
         struct CompletedCallback
         {
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace GGEngine {
+
+    // =============================================================================
+    // WorkStealingDeque
+    // =============================================================================
+    // Chase-Lev work-stealing deque, using the weak-memory-model formulation of
+    // Le, Pop, Cohen and Zappa Nardelli (PPoPP 2013).
+    //
+    // One owner thread pushes and pops at the bottom (LIFO, cache-warm work);
+    // any other thread may steal from the top (FIFO, oldest work first).
+    // Push/Pop never lock; Steal is lock-free and may fail spuriously when it
+    // loses a race with another thief or the owner.
+    //
+    // The ring grows on demand. Retired rings are kept until the deque is
+    // destroyed because a concurrent thief may still be reading from them.
+    //
+    template<typename T>
+    class WorkStealingDeque
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque elements must be trivially copyable");
+
+    public:
+        explicit WorkStealingDeque(size_t initialCapacity = 256)
+        {
+            size_t capacity = 1;
+            while (capacity < initialCapacity)
+                capacity <<= 1;
+
+            m_Rings.push_back(std::make_unique<Ring>(capacity));
+            m_Ring.store(m_Rings.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        // Owner thread only
+        void Push(const T& item)
+        {
+            int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            int64_t top = m_Top.load(std::memory_order_acquire);
+            Ring* ring = m_Ring.load(std::memory_order_relaxed);
+
+            if (bottom - top > static_cast<int64_t>(ring->Capacity) - 1)
+                ring = Grow(ring, top, bottom);
+
+            ring->Store(bottom, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        // Owner thread only. Returns false if the deque is empty.
+        bool Pop(T& out)
+        {
+            int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+            Ring* ring = m_Ring.load(std::memory_order_relaxed);
+            m_Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_Top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                // Empty
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            out = ring->Load(bottom);
+            if (top != bottom)
+                return true;
+
+            // Last item - race thieves for it
+            bool won = m_Top.compare_exchange_strong(top, top + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+
+        // Any thread. Returns false if the deque is empty or the steal lost a race.
+        bool Steal(T& out)
+        {
+            int64_t top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+                return false;
+
+            Ring* ring = m_Ring.load(std::memory_order_acquire);
+            T item = ring->Load(top);
+            if (!m_Top.compare_exchange_strong(top, top + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+                return false;
+
+            out = item;
+            return true;
+        }
+
+        // Approximate when other threads are pushing/stealing
+        size_t Size() const
+        {
+            int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            int64_t top = m_Top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+        }
+
+        bool Empty() const { return Size() == 0; }
+
+    private:
+        struct Ring
+        {
+            explicit Ring(size_t capacity)
+                : Capacity(capacity), Mask(capacity - 1), Items(new std::atomic<T>[capacity]) {}
+
+            T Load(int64_t index) const { return Items[index & Mask].load(std::memory_order_relaxed); }
+            void Store(int64_t index, const T& item) { Items[index & Mask].store(item, std::memory_order_relaxed); }
+
+            size_t Capacity;
+            int64_t Mask;
+            std::unique_ptr<std::atomic<T>[]> Items;
+        };
+
+        Ring* Grow(Ring* ring, int64_t top, int64_t bottom)
+        {
+            m_Rings.push_back(std::make_unique<Ring>(ring->Capacity * 2));
+            Ring* grown = m_Rings.back().get();
+            for (int64_t i = top; i < bottom; i++)
+                grown->Store(i, ring->Load(i));
+
+            m_Ring.store(grown, std::memory_order_release);
+            return grown;
+        }
+
+        // Top and bottom are hammered by different threads - keep them on separate cache lines
+        alignas(64) std::atomic<int64_t> m_Top{0};
+        alignas(64) std::atomic<int64_t> m_Bottom{0};
+        alignas(64) std::atomic<Ring*> m_Ring{nullptr};
+        std::vector<std::unique_ptr<Ring>> m_Rings;    // Current ring plus retired ones (owner only)
+    };
+
+}
@@ -14,7 +14,7 @@ namespace GGEngine {
 
     struct ProfileResult
     {
-        std::string Name;
+        const char* Name;                   // Not copied until written to a session
         FloatingPointMicroseconds Start;
         std::chrono::microseconds ElapsedTime;
         std::thread::id ThreadID;
@@ -0,0 +1,351 @@
+#include "ggpch.h"
+#include "Archetype.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace GGEngine {
+
+    namespace {
+
+        size_t AlignUp(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        std::byte* AllocateChunk()
+        {
+            return static_cast<std::byte*>(::operator new(Archetype::ChunkBytes, std::align_val_t(Archetype::ChunkAlignment)));
+        }
+
+        void FreeChunk(std::byte* data)
+        {
+            ::operator delete(data, std::align_val_t(Archetype::ChunkAlignment));
+        }
+
+        bool TypeLess(const ComponentTypeInfo* a, const ComponentTypeInfo* b)
+        {
+            return a->Id < b->Id;
+        }
+
+        void DestroyValue(const ComponentTypeInfo& info, void* ptr)
+        {
+            if (!info.Trivial)
+                info.Destroy(ptr);
+        }
+
+        // Move-construct dst from src, then destroy src
+        void Relocate(const ComponentTypeInfo& info, void* dst, void* src)
+        {
+            if (info.Trivial)
+            {
+                std::memcpy(dst, src, info.Size);
+                return;
+            }
+            info.MoveConstruct(dst, src);
+            info.Destroy(src);
+        }
+
+        Archetype* FindEdge(const std::vector<Archetype::Edge>& edges, uint32_t typeId, bool& found)
+        {
+            for (const Archetype::Edge& edge : edges)
+            {
+                if (edge.TypeId == typeId)
+                {
+                    found = true;
+                    return edge.Target;
+                }
+            }
+            found = false;
+            return nullptr;
+        }
+
+    }
+
+    uint32_t GetComponentTypeId(std::type_index type)
+    {
+        // Ids live in the engine module so every DLL/executable agrees on them.
+        // Callers cache the result in ComponentTypeInfo::Of<T>(), so this runs once per type.
+        static std::mutex mutex;
+        static std::unordered_map<std::type_index, uint32_t> ids;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto [it, inserted] = ids.try_emplace(type, static_cast<uint32_t>(ids.size()));
+        return it->second;
+    }
+
+    // =========================================================================
+    // Archetype
+    // =========================================================================
+
+    Archetype::Archetype(std::vector<const ComponentTypeInfo*> types)
+        : m_Types(std::move(types))
+    {
+        GG_CORE_ASSERT(std::is_sorted(m_Types.begin(), m_Types.end(), TypeLess), "Archetype types must be sorted");
+
+        size_t rowBytes = sizeof(Entity);
+        for (const ComponentTypeInfo* info : m_Types)
+        {
+            GG_CORE_ASSERT(info->Alignment <= ChunkAlignment, "Component alignment exceeds chunk alignment");
+            rowBytes += info->Size;
+        }
+
+        // Start from the unpadded estimate and shrink until the aligned columns fit
+        size_t capacity = std::max<size_t>(1, ChunkBytes / rowBytes);
+        m_ColumnOffsets.resize(m_Types.size());
+        for (;;)
+        {
+            size_t offset = capacity * sizeof(Entity);
+            for (size_t i = 0; i < m_Types.size(); i++)
+            {
+                offset = AlignUp(offset, m_Types[i]->Alignment);
+                m_ColumnOffsets[i] = offset;
+                offset += capacity * m_Types[i]->Size;
+            }
+
+            if (offset <= ChunkBytes || capacity == 1)
+            {
+                GG_CORE_ASSERT(offset <= ChunkBytes, "Component set too large for one archetype chunk");
+                break;
+            }
+            capacity--;
+        }
+
+        m_ChunkCapacity = static_cast<uint32_t>(capacity);
+    }
+
+    Archetype::~Archetype()
+    {
+        Clear();
+        for (Chunk& chunk : m_Chunks)
+            FreeChunk(chunk.Data);
+    }
+
+    int Archetype::GetColumn(uint32_t typeId) const
+    {
+        // Archetypes have few components - a linear scan beats binary search here
+        for (size_t i = 0; i < m_Types.size(); i++)
+        {
+            if (m_Types[i]->Id == typeId)
+                return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    uint32_t Archetype::AllocateRow(Entity entity)
+    {
+        const uint32_t row = static_cast<uint32_t>(m_Size);
+        const size_t chunkIndex = row / m_ChunkCapacity;
+
+        if (chunkIndex == m_Chunks.size())
+            m_Chunks.push_back({ AllocateChunk(), 0, std::make_unique<std::atomic<uint32_t>[]>(m_Types.size()) });
+
+        // The caller constructs every column of the new row
+        Chunk& chunk = m_Chunks[chunkIndex];
+        for (size_t column = 0; column < m_Types.size(); column++)
+            MarkChunkChanged(chunkIndex, column);
+        reinterpret_cast<Entity*>(chunk.Data)[chunk.Count] = entity;
+        chunk.Count++;
+        m_Size++;
+        return row;
+    }
+
+    Entity Archetype::RemoveRow(uint32_t row)
+    {
+        for (size_t column = 0; column < m_Types.size(); column++)
+            DestroyValue(*m_Types[column], GetComponent(row, column));
+
+        return ReleaseRow(row);
+    }
+
+    Entity Archetype::ReleaseRow(uint32_t row)
+    {
+        GG_CORE_ASSERT(row < m_Size, "Archetype row out of range");
+
+        const uint32_t last = static_cast<uint32_t>(m_Size - 1);
+        Entity moved = InvalidEntity;
+
+        if (row != last)
+        {
+            MoveRow(row, last);
+            moved = GetEntity(row);
+        }
+
+        m_Chunks[last / m_ChunkCapacity].Count--;
+        m_Size--;
+        ReleaseEmptyChunks();
+        return moved;
+    }
+
+    void Archetype::MoveRow(uint32_t dst, uint32_t src)
+    {
+        for (size_t column = 0; column < m_Types.size(); column++)
+            Relocate(*m_Types[column], GetComponent(dst, column), GetComponent(src, column));
+
+        // The row brings its changes along
+        Chunk& dstChunk = m_Chunks[dst / m_ChunkCapacity];
+        const Chunk& srcChunk = m_Chunks[src / m_ChunkCapacity];
+        for (size_t column = 0; column < m_Types.size(); column++)
+            ChangeTicks::StampNewest(dstChunk.ChangedTicks[column], srcChunk.ChangedTicks[column].load(std::memory_order_relaxed));
+        reinterpret_cast<Entity*>(dstChunk.Data)[dst % m_ChunkCapacity] = GetEntity(src);
+    }
+
+    void Archetype::ReleaseEmptyChunks()
+    {
+        // Keep one spare empty chunk so add/remove at a chunk boundary doesn't thrash the allocator
+        while (m_Chunks.size() >= 2 && m_Chunks.back().Count == 0 && m_Chunks[m_Chunks.size() - 2].Count == 0)
+        {
+            FreeChunk(m_Chunks.back().Data);
+            m_Chunks.pop_back();
+        }
+    }
+
+    void Archetype::Clear()
+    {
+        for (Chunk& chunk : m_Chunks)
+        {
+            for (size_t column = 0; column < m_Types.size(); column++)
+            {
+                if (m_Types[column]->Trivial)
+                    continue;
+
+                std::byte* base = chunk.Data + m_ColumnOffsets[column];
+                for (uint32_t i = 0; i < chunk.Count; i++)
+                    m_Types[column]->Destroy(base + i * m_Types[column]->Size);
+            }
+            chunk.Count = 0;
+        }
+        m_Size = 0;
+        ReleaseEmptyChunks();
+    }
+
+    // =========================================================================
+    // ArchetypeStorage
+    // =========================================================================
+
+    ArchetypeStorage::ArchetypeStorage() = default;
+    ArchetypeStorage::~ArchetypeStorage() = default;
+
+    ArchetypeStorage::Record& ArchetypeStorage::GetRecord(Entity entity)
+    {
+        GG_CORE_ASSERT(entity != InvalidEntity, "Cannot store components for InvalidEntity");
+        if (entity >= m_Records.size())
+            m_Records.resize(static_cast<size_t>(entity) + 1);
+        return m_Records[entity];
+    }
+
+    Archetype* ArchetypeStorage::FindOrCreateArchetype(std::vector<const ComponentTypeInfo*> types)
+    {
+        std::vector<uint32_t> signature;
+        signature.reserve(types.size());
+        for (const ComponentTypeInfo* info : types)
+            signature.push_back(info->Id);
+
+        auto& slot = m_Archetypes[signature];
+        if (!slot)
+            slot = std::make_unique<Archetype>(std::move(types));
+        return slot.get();
+    }
+
+    Archetype* ArchetypeStorage::GetAddTarget(Archetype* source, const ComponentTypeInfo& info)
+    {
+        std::vector<Archetype::Edge>& edges = source ? source->AddEdges : m_RootEdges;
+
+        bool found = false;
+        Archetype* cached = FindEdge(edges, info.Id, found);
+        if (found)
+            return cached;
+
+        std::vector<const ComponentTypeInfo*> types;
+        if (source)
+            types = source->GetTypes();
+        types.insert(std::upper_bound(types.begin(), types.end(), &info, TypeLess), &info);
+
+        Archetype* target = FindOrCreateArchetype(std::move(types));
+        edges.push_back({ info.Id, target });
+        target->RemoveEdges.push_back({ info.Id, source });
+        return target;
+    }
+
+    Archetype* ArchetypeStorage::GetRemoveTarget(Archetype* source, uint32_t typeId)
+    {
+        bool found = false;
+        Archetype* cached = FindEdge(source->RemoveEdges, typeId, found);
+        if (found)
+            return cached;
+
+        std::vector<const ComponentTypeInfo*> types = source->GetTypes();
+        types.erase(types.begin() + source->GetColumn(typeId));
+
+        // Removing the last component leaves the entity without an archetype
+        Archetype* target = types.empty() ? nullptr : FindOrCreateArchetype(std::move(types));
+        source->RemoveEdges.push_back({ typeId, target });
+        if (target)
+            target->AddEdges.push_back({ typeId, source });
+        return target;
+    }
+
+    void ArchetypeStorage::MoveEntity(Entity entity, Record& record, Archetype* target)
+    {
+        Archetype* source = record.Owner;
+        uint32_t targetRow = 0;
+
+        if (target)
+        {
+            targetRow = target->AllocateRow(entity);
+
+            const auto& targetTypes = target->GetTypes();
+            for (size_t column = 0; column < targetTypes.size(); column++)
+            {
+                const ComponentTypeInfo& info = *targetTypes[column];
+                void* dst = target->GetComponent(targetRow, column);
+                int sourceColumn = source ? source->GetColumn(info.Id) : -1;
+
+                if (sourceColumn < 0)
+                    info.Construct(dst);
+                else if (info.Trivial)
+                    std::memcpy(dst, source->GetComponent(record.Row, sourceColumn), info.Size);
+                else
+                    info.MoveConstruct(dst, source->GetComponent(record.Row, sourceColumn));
+            }
+        }
+
+        if (source)
+        {
+            // Moved-from components are still alive, so RemoveRow destroys every column
+            Entity moved = source->RemoveRow(record.Row);
+            OnRowMoved(moved, record.Row);
+        }
+
+        record.Owner = target;
+        record.Row = targetRow;
+    }
+
+    void ArchetypeStorage::OnRowMoved(Entity moved, uint32_t row)
+    {
+        if (moved != InvalidEntity)
+            m_Records[moved].Row = row;
+    }
+
+    void ArchetypeStorage::DestroyEntity(Entity entity)
+    {
+        if (entity >= m_Records.size()) return;
+
+        Record& record = m_Records[entity];
+        if (!record.Owner) return;
+
+        Entity moved = record.Owner->RemoveRow(record.Row);
+        OnRowMoved(moved, record.Row);
+        record = Record{};
+    }
+
+    void ArchetypeStorage::Clear()
+    {
+        for (auto& [signature, archetype] : m_Archetypes)
+            archetype->Clear();
+        m_Records.clear();
+    }
+
+}
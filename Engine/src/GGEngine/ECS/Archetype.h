@@ -0,0 +1,439 @@
+#pragma once
+
+#include "Entity.h"
+#include "ChangeTick.h"
+#include "GGEngine/Core/Core.h"
+
+#include <atomic>
+#include <vector>
+#include <map>
+#include <memory>
+#include <new>
+#include <typeindex>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+namespace GGEngine {
+
+    // Small dense id per component type, shared by every module (see Archetype.cpp)
+    GG_API uint32_t GetComponentTypeId(std::type_index type);
+
+    // =============================================================================
+    // ComponentTypeInfo
+    // =============================================================================
+    // Type-erased lifetime operations for a component type, so archetypes can
+    // construct/move/destroy components stored in raw chunk memory.
+    //
+    struct GG_API ComponentTypeInfo
+    {
+        uint32_t Id;
+        std::type_index Type;
+        size_t Size;
+        size_t Alignment;
+        bool Trivial;       // Trivially copyable and destructible: move = memcpy, destroy = no-op
+
+        void (*Construct)(void* dst);
+        void (*MoveConstruct)(void* dst, void* src);    // src stays alive (moved-from)
+        void (*Destroy)(void* ptr);
+
+        template<typename T>
+        static const ComponentTypeInfo& Of()
+        {
+            static_assert(std::is_default_constructible_v<T>, "Archetype components must be default constructible");
+            static_assert(std::is_move_constructible_v<T>, "Archetype components must be move constructible");
+
+            static const ComponentTypeInfo info{
+                GetComponentTypeId(std::type_index(typeid(T))),
+                std::type_index(typeid(T)),
+                sizeof(T),
+                alignof(T),
+                std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                [](void* dst) { new (dst) T(); },
+                [](void* dst, void* src) { new (dst) T(std::move(*static_cast<T*>(src))); },
+                [](void* ptr) { static_cast<T*>(ptr)->~T(); }
+            };
+            return info;
+        }
+    };
+
+    // =============================================================================
+    // Archetype
+    // =============================================================================
+    // All entities with exactly the same set of components. Rows live in
+    // fixed-size chunks laid out as SoA:
+    //
+    //   [Entity x Capacity][Component0 x Capacity][Component1 x Capacity]...
+    //
+    // Rows are kept dense (swap-with-last on removal), so every chunk but the
+    // last is full and row r lives in chunk r / Capacity.
+    //
+    // Each chunk column keeps the newest change tick (see ChangeTick.h) of
+    // anything written to it: rows entering the chunk stamp every column and
+    // ArchetypeStorage stamps the columns it hands out mutably.
+    //
+    class GG_API Archetype
+    {
+    public:
+        static constexpr size_t ChunkBytes = 16 * 1024;
+        static constexpr size_t ChunkAlignment = 64;
+
+        struct Chunk
+        {
+            std::byte* Data = nullptr;
+            uint32_t Count = 0;
+            std::unique_ptr<std::atomic<uint32_t>[]> ChangedTicks;   // Per column
+        };
+
+        // types must be sorted by Id and unique
+        explicit Archetype(std::vector<const ComponentTypeInfo*> types);
+        ~Archetype();
+
+        Archetype(const Archetype&) = delete;
+        Archetype& operator=(const Archetype&) = delete;
+
+        // Signature
+        const std::vector<const ComponentTypeInfo*>& GetTypes() const { return m_Types; }
+        int GetColumn(uint32_t typeId) const;                     // -1 if absent
+        bool HasType(uint32_t typeId) const { return GetColumn(typeId) >= 0; }
+
+        // Rows
+        size_t Size() const { return m_Size; }
+        uint32_t GetChunkCapacity() const { return m_ChunkCapacity; }
+
+        // Append an uninitialized row for entity (caller constructs every column)
+        uint32_t AllocateRow(Entity entity);
+
+        // Destroy row's components and fill the hole with the last row
+        // Returns the entity that moved into `row`, or InvalidEntity if none did
+        Entity RemoveRow(uint32_t row);
+
+        Entity GetEntity(uint32_t row) const
+        {
+            const Chunk& chunk = m_Chunks[row / m_ChunkCapacity];
+            return reinterpret_cast<const Entity*>(chunk.Data)[row % m_ChunkCapacity];
+        }
+
+        void* GetComponent(uint32_t row, size_t column) const
+        {
+            const Chunk& chunk = m_Chunks[row / m_ChunkCapacity];
+            return chunk.Data + m_ColumnOffsets[column] + (row % m_ChunkCapacity) * m_Types[column]->Size;
+        }
+
+        // Chunk access for query iteration
+        size_t GetChunkCount() const { return m_Chunks.size(); }
+        const Chunk& GetChunk(size_t index) const { return m_Chunks[index]; }
+        const Entity* GetChunkEntities(size_t index) const { return reinterpret_cast<const Entity*>(m_Chunks[index].Data); }
+
+        template<typename T>
+        T* GetChunkColumn(size_t index, size_t column) const
+        {
+            return reinterpret_cast<T*>(m_Chunks[index].Data + m_ColumnOffsets[column]);
+        }
+
+        // Stamp a chunk column changed at the current tick. Safe from several
+        // threads; doesn't change the archetype's structure, hence const.
+        void MarkChunkChanged(size_t index, size_t column) const
+        {
+            ChangeTicks::StampNewest(m_Chunks[index].ChangedTicks[column], ChangeTicks::Current());
+        }
+
+        // Whether anything in the chunk column was stamped after tick `since`
+        bool IsChunkChangedSince(size_t index, size_t column, uint32_t since) const
+        {
+            return ChangeTicks::IsNewer(m_Chunks[index].ChangedTicks[column].load(std::memory_order_relaxed), since);
+        }
+
+        // Destroy every row (keeps one chunk allocated)
+        void Clear();
+
+        // Cached transitions to the archetype with one component added/removed
+        // (few per archetype, so a flat list beats a hash map)
+        struct Edge
+        {
+            uint32_t TypeId;
+            Archetype* Target;
+        };
+        std::vector<Edge> AddEdges;
+        std::vector<Edge> RemoveEdges;
+
+    private:
+        // Fill the hole at row with the last row (components at row already destroyed)
+        Entity ReleaseRow(uint32_t row);
+        void MoveRow(uint32_t dst, uint32_t src);
+        void ReleaseEmptyChunks();
+
+        std::vector<const ComponentTypeInfo*> m_Types;
+        std::vector<size_t> m_ColumnOffsets;
+        uint32_t m_ChunkCapacity = 0;
+
+        std::vector<Chunk> m_Chunks;
+        size_t m_Size = 0;
+    };
+
+    // =============================================================================
+    // ArchetypeStorage
+    // =============================================================================
+    // Archetype/chunk backend for Scene (SceneStorageMode::Archetype).
+    //
+    // Adding or removing a component moves the entity's row to the archetype
+    // for its new signature. Queries match whole archetypes and walk their
+    // chunks linearly, so iteration cost depends on the number of matching
+    // rows, not on how sparse each component type is.
+    //
+    // Pointers returned by Add/Get are invalidated by any structural change
+    // (add/remove/destroy) on an entity that shares or enters the archetype.
+    //
+    // Not thread-safe: structural changes need external synchronization, the
+    // same as direct ComponentStorage calls.
+    //
+    class GG_API ArchetypeStorage
+    {
+    public:
+        ArchetypeStorage();
+        ~ArchetypeStorage();
+
+        ArchetypeStorage(const ArchetypeStorage&) = delete;
+        ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+
+        template<typename T>
+        T& Add(Entity entity);
+
+        template<typename T>
+        T& Add(Entity entity, const T& component);
+
+        template<typename T>
+        void Remove(Entity entity);
+
+        template<typename T>
+        bool Has(Entity entity) const;
+
+        template<typename T>
+        T* Get(Entity entity);
+
+        template<typename T>
+        const T* Get(Entity entity) const;
+
+        // Remove all of entity's components
+        void DestroyEntity(Entity entity);
+
+        // Remove every entity (archetypes and their edges are kept)
+        void Clear();
+
+        // Invoke fn for every entity that has all of T...
+        // fn takes (Entity, T&...) or (T&...); declare T const for read-only access
+        // (const here means "no structural changes", as with ComponentView)
+        template<typename... T, typename Fn>
+        void Each(Fn&& fn) const;
+
+        // Invoke fn once per matching chunk with its row count and column pointers:
+        //   fn(size_t count, const Entity* entities, T*... columns)
+        // Columns of non-const T are stamped changed.
+        template<typename... T, typename Fn>
+        void EachChunk(Fn&& fn) const;
+
+        // EachChunk over only the chunks where one of the T columns changed
+        // after tick `since`
+        template<typename... T, typename Fn>
+        void EachChangedChunk(uint32_t since, Fn&& fn) const;
+
+        // Number of entities matching all of T...
+        template<typename... T>
+        size_t Count() const;
+
+        size_t GetArchetypeCount() const { return m_Archetypes.size(); }
+
+        // Archetype holding entity, or nullptr if it has no components
+        Archetype* GetArchetype(Entity entity) const
+        {
+            return entity < m_Records.size() ? m_Records[entity].Owner : nullptr;
+        }
+
+    private:
+        struct Record
+        {
+            Archetype* Owner = nullptr;
+            uint32_t Row = 0;
+        };
+
+        Record& GetRecord(Entity entity);
+
+        Archetype* FindOrCreateArchetype(std::vector<const ComponentTypeInfo*> types);
+        Archetype* GetAddTarget(Archetype* source, const ComponentTypeInfo& info);
+        Archetype* GetRemoveTarget(Archetype* source, uint32_t typeId);
+
+        // Move entity's row to target; columns missing from the source are default constructed
+        void MoveEntity(Entity entity, Record& record, Archetype* target);
+
+        // Fix up the record of the entity that swap-remove moved into `row`
+        void OnRowMoved(Entity moved, uint32_t row);
+
+        template<typename... T>
+        bool MatchColumns(const Archetype& archetype, int (&columns)[sizeof...(T)]) const;
+
+        template<typename... T, typename Skip, typename Fn>
+        void EachChunkUnless(Skip&& skip, Fn&& fn) const;
+
+        template<typename... T, typename Fn, size_t... I>
+        static void InvokeChunk(Fn& fn, const Archetype& archetype, size_t chunk,
+                                const int (&columns)[sizeof...(T)], std::index_sequence<I...>);
+
+        std::vector<Record> m_Records;      // Indexed by Entity
+        std::map<std::vector<uint32_t>, std::unique_ptr<Archetype>> m_Archetypes;     // Keyed by sorted type ids
+        std::vector<Archetype::Edge> m_RootEdges;                                     // Single-component archetypes
+    };
+
+    // =============================================================================
+    // Template implementations
+    // =============================================================================
+
+    template<typename T>
+    T& ArchetypeStorage::Add(Entity entity)
+    {
+        const ComponentTypeInfo& info = ComponentTypeInfo::Of<T>();
+        Record& record = GetRecord(entity);
+        GG_CORE_ASSERT(!record.Owner || !record.Owner->HasType(info.Id), "Entity already has this component");
+
+        MoveEntity(entity, record, GetAddTarget(record.Owner, info));
+        return *static_cast<T*>(record.Owner->GetComponent(record.Row, record.Owner->GetColumn(info.Id)));
+    }
+
+    template<typename T>
+    T& ArchetypeStorage::Add(Entity entity, const T& component)
+    {
+        T& comp = Add<T>(entity);
+        comp = component;
+        return comp;
+    }
+
+    template<typename T>
+    void ArchetypeStorage::Remove(Entity entity)
+    {
+        if (!Has<T>(entity)) return;
+
+        Record& record = m_Records[entity];
+        MoveEntity(entity, record, GetRemoveTarget(record.Owner, ComponentTypeInfo::Of<T>().Id));
+    }
+
+    template<typename T>
+    bool ArchetypeStorage::Has(Entity entity) const
+    {
+        Archetype* archetype = GetArchetype(entity);
+        return archetype && archetype->HasType(ComponentTypeInfo::Of<T>().Id);
+    }
+
+    template<typename T>
+    T* ArchetypeStorage::Get(Entity entity)
+    {
+        Archetype* archetype = GetArchetype(entity);
+        if (!archetype) return nullptr;
+
+        int column = archetype->GetColumn(ComponentTypeInfo::Of<T>().Id);
+        if (column < 0) return nullptr;
+        const uint32_t row = m_Records[entity].Row;
+        archetype->MarkChunkChanged(row / archetype->GetChunkCapacity(), column);
+        return static_cast<T*>(archetype->GetComponent(row, column));
+    }
+
+    template<typename T>
+    const T* ArchetypeStorage::Get(Entity entity) const
+    {
+        Archetype* archetype = GetArchetype(entity);
+        if (!archetype) return nullptr;
+
+        int column = archetype->GetColumn(ComponentTypeInfo::Of<T>().Id);
+        if (column < 0) return nullptr;
+        return static_cast<const T*>(archetype->GetComponent(m_Records[entity].Row, column));
+    }
+
+    template<typename... T>
+    bool ArchetypeStorage::MatchColumns(const Archetype& archetype, int (&columns)[sizeof...(T)]) const
+    {
+        size_t i = 0;
+        ((columns[i++] = archetype.GetColumn(ComponentTypeInfo::Of<std::remove_const_t<T>>().Id)), ...);
+        for (int column : columns)
+        {
+            if (column < 0) return false;
+        }
+        return true;
+    }
+
+    template<typename... T, typename Fn, size_t... I>
+    void ArchetypeStorage::InvokeChunk(Fn& fn, const Archetype& archetype, size_t chunk,
+                                       const int (&columns)[sizeof...(T)], std::index_sequence<I...>)
+    {
+        ((std::is_const_v<T> ? void() : archetype.MarkChunkChanged(chunk, columns[I])), ...);
+        fn(static_cast<size_t>(archetype.GetChunk(chunk).Count), archetype.GetChunkEntities(chunk),
+           archetype.template GetChunkColumn<T>(chunk, columns[I])...);
+    }
+
+    template<typename... T, typename Skip, typename Fn>
+    void ArchetypeStorage::EachChunkUnless(Skip&& skip, Fn&& fn) const
+    {
+        static_assert(sizeof...(T) > 0, "EachChunk needs at least one component");
+
+        for (auto& [signature, archetype] : m_Archetypes)
+        {
+            int columns[sizeof...(T)];
+            if (archetype->Size() == 0 || !MatchColumns<T...>(*archetype, columns))
+                continue;
+
+            for (size_t c = 0; c < archetype->GetChunkCount(); c++)
+            {
+                const Archetype::Chunk& chunk = archetype->GetChunk(c);
+                if (chunk.Count == 0)
+                    break;
+                if (skip(*archetype, c, columns))
+                    continue;
+
+                InvokeChunk<T...>(fn, *archetype, c, columns, std::index_sequence_for<T...>{});
+            }
+        }
+    }
+
+    template<typename... T, typename Fn>
+    void ArchetypeStorage::EachChunk(Fn&& fn) const
+    {
+        EachChunkUnless<T...>([](const Archetype&, size_t, const int (&)[sizeof...(T)]) { return false; },
+                              std::forward<Fn>(fn));
+    }
+
+    template<typename... T, typename Fn>
+    void ArchetypeStorage::EachChangedChunk(uint32_t since, Fn&& fn) const
+    {
+        EachChunkUnless<T...>([since](const Archetype& archetype, size_t chunk, const int (&columns)[sizeof...(T)])
+        {
+            for (int column : columns)
+            {
+                if (archetype.IsChunkChangedSince(chunk, column, since))
+                    return false;
+            }
+            return true;
+        }, std::forward<Fn>(fn));
+    }
+
+    template<typename... T, typename Fn>
+    void ArchetypeStorage::Each(Fn&& fn) const
+    {
+        EachChunk<T...>([&fn](size_t count, const Entity* entities, T*... columns)
+        {
+            for (size_t row = 0; row < count; row++)
+            {
+                if constexpr (std::is_invocable_v<Fn&, Entity, T&...>)
+                    fn(entities[row], columns[row]...);
+                else
+                    fn(columns[row]...);
+            }
+        });
+    }
+
+    template<typename... T>
+    size_t ArchetypeStorage::Count() const
+    {
+        size_t count = 0;
+        EachChunk<const T...>([&count](size_t rows, const Entity*, const T*...) { count += rows; });
+        return count;
+    }
+
+}
@@ -0,0 +1,9 @@
+#include "ggpch.h"
+#include "ChangeTick.h"
+
+namespace GGEngine {
+
+    // Starts above 0 so that 0 can mean "never ran" - everything is newer
+    std::atomic<uint32_t> ChangeTicks::s_Tick{1};
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "GGEngine/Core/Core.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace GGEngine {
+
+    // =============================================================================
+    // Change Ticks
+    // =============================================================================
+    // A process-wide counter that orders component changes. Storages stamp each
+    // row with the current tick when it is added and whenever it is mutably
+    // accessed; SystemScheduler advances the tick around every system run and
+    // records the tick each system last ran at (ISystem::GetLastRunTick).
+    // "Changed since t" means stamped with a tick newer than t.
+    //
+    // Ticks are 32-bit and compared with wraparound, so a row is only reliably
+    // classified within 2^31 ticks of the query.
+    //
+    class GG_API ChangeTicks
+    {
+    public:
+        // Tick new changes are stamped with
+        static uint32_t Current() { return s_Tick.load(std::memory_order_relaxed); }
+
+        // Start a new tick; returns it. Changes made after this are newer than
+        // anything stamped before.
+        static uint32_t Advance() { return s_Tick.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+        // Whether tick is newer than since (wraparound-safe)
+        static bool IsNewer(uint32_t tick, uint32_t since)
+        {
+            return static_cast<int32_t>(tick - since) > 0;
+        }
+
+        // Raise slot to tick unless it already holds tick or a newer one. For
+        // summaries over many rows (the newest tick in a block or chunk), which
+        // several threads may stamp at once.
+        static void StampNewest(std::atomic<uint32_t>& slot, uint32_t tick)
+        {
+            uint32_t current = slot.load(std::memory_order_relaxed);
+            while (current != tick && IsNewer(tick, current) &&
+                   !slot.compare_exchange_weak(current, tick, std::memory_order_relaxed))
+            {
+            }
+        }
+
+    private:
+        static std::atomic<uint32_t> s_Tick;
+    };
+
+}
@@ -20,7 +20,8 @@ namespace GGEngine {
     GG_COMPONENT(TransformComponent, m_Transforms) \
     GG_COMPONENT(SpriteRendererComponent, m_Sprites) \
     GG_COMPONENT(TilemapComponent, m_Tilemaps) \
-    GG_COMPONENT(CameraComponent, m_Cameras)
+    GG_COMPONENT(CameraComponent, m_Cameras) \
+    GG_COMPONENT(ParticleEmitterComponent, m_ParticleEmitters)
 
 // Macro to declare component storage members in Scene class
 // Usage: GG_DECLARE_COMPONENT_STORAGES
@@ -29,7 +30,8 @@ namespace GGEngine {
     GG_COMPONENT(TransformComponent, m_Transforms) \
     GG_COMPONENT(SpriteRendererComponent, m_Sprites) \
     GG_COMPONENT(TilemapComponent, m_Tilemaps) \
-    GG_COMPONENT(CameraComponent, m_Cameras)
+    GG_COMPONENT(CameraComponent, m_Cameras) \
+    GG_COMPONENT(ParticleEmitterComponent, m_ParticleEmitters)
 
 // Helper macro: Generates storage member declaration
 // ComponentStorage<Type> name;
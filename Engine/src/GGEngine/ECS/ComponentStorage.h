@@ -1,11 +1,16 @@
 #pragma once
 
 #include "Entity.h"
+#include "SparseIndex.h"
+#include "ChangeTick.h"
 #include "GGEngine/Core/Core.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <vector>
-#include <unordered_map>
 #include <shared_mutex>
+#include <utility>
 
 namespace GGEngine {
 
@@ -19,11 +24,51 @@ namespace GGEngine {
         virtual void Remove(Entity entity) = 0;
         virtual bool Has(Entity entity) const = 0;
         virtual size_t Size() const = 0;
+
+        // Change version: bumped by Add/Remove/Clear, by taking a WriteLock, by rows
+        // being marked changed, and by SystemScheduler after a system that declares
+        // Write access to the type runs.
+        // Equal versions mean nothing was recorded as changed in between. Relaxed:
+        // systems that write a type are already ordered before those that read it.
+        uint64_t GetVersion() const { return m_Version.load(std::memory_order_relaxed); }
+        void MarkChanged() { m_Version.fetch_add(1, std::memory_order_relaxed); }
+
+    private:
+        std::atomic<uint64_t> m_Version{0};
+    };
+
+    // Receives membership changes from storages it owns (see ComponentGroup in Group.h)
+    // Hooks run inside Add/Remove/Clear, with the same (lack of) synchronization
+    class GG_API IStorageOwner
+    {
+    public:
+        virtual ~IStorageOwner() = default;
+        virtual void OnComponentAdded(Entity entity) = 0;       // After the component is stored
+        virtual void OnComponentRemoving(Entity entity) = 0;    // Before the component is erased
+        virtual void OnStorageCleared() = 0;
     };
 
     // SoA component storage for a single component type
     // Each component type has its own storage instance
     //
+    // Layout: components live in a dense array (cache-friendly iteration), with a
+    // paged SparseIndex mapping Entity -> dense slot. Get/Has/Add/Remove are a
+    // page lookup plus an array index - no hashing.
+    //
+    // A storage may be owned by a ComponentGroup, which reorders its dense array
+    // on Add/Remove so grouped entities stay packed at the front (see Group.h).
+    // References returned by Add() stay valid; earlier references may not.
+    //
+    // Change detection: every row carries the tick it was added at and the tick
+    // it was last mutably accessed at (see ChangeTick.h). Add, the non-const
+    // Get(), WriteLock::Get/Data, mutable view access and mutable group access
+    // (Data/Each/EachInRange) stamp rows; writes through the plain Data()
+    // pointer must call MarkChanged(entity) themselves. Each block of
+    // ChangeBlockRows rows also keeps its newest changed tick, so scans for
+    // changes can skip blocks nothing touched (IsBlockChangedSince). Stamps are
+    // relaxed atomic stores, so parallel systems fetching the same rows mutably
+    // don't race; read-only code should use the const Get() so it stamps nothing.
+    //
     // Thread Safety:
     // - Use LockRead() for concurrent read-only access from multiple threads
     // - Use LockWrite() for exclusive write access
@@ -46,11 +91,23 @@ namespace GGEngine {
         {
             GG_CORE_ASSERT(!Has(entity), "Entity already has this component");
 
-            size_t index = m_Components.size();
-            m_EntityToIndex[entity] = index;
+            const uint32_t tick = ChangeTicks::Current();
+            m_Sparse.Set(entity, static_cast<uint32_t>(m_Components.size()));
             m_IndexToEntity.push_back(entity);
             m_Components.push_back(T{});
-            return m_Components.back();
+            m_AddedTicks.push_back(tick);
+            m_ChangedTicks.emplace_back(tick);
+            if (m_Components.size() > m_BlockTicks.size() * ChangeBlockRows)
+                m_BlockTicks.emplace_back();
+            StampBlock(m_Components.size() - 1, tick);
+            MarkChanged();
+
+            if (!m_Owner)
+                return m_Components.back();
+
+            // The owning group may move the new component into its packed range
+            m_Owner->OnComponentAdded(entity);
+            return m_Components[m_Sparse.Find(entity)];
         }
 
         // Add component with initial value
@@ -64,47 +121,61 @@ namespace GGEngine {
         // Remove component from entity (O(1) via swap-with-last)
         void Remove(Entity entity) override
         {
-            auto it = m_EntityToIndex.find(entity);
-            if (it == m_EntityToIndex.end()) return;
+            if (m_Owner && Has(entity))
+                m_Owner->OnComponentRemoving(entity);
+
+            uint32_t indexToRemove = m_Sparse.Find(entity);
+            if (indexToRemove == SparseIndex::InvalidSlot) return;
 
-            size_t indexToRemove = it->second;
             size_t lastIndex = m_Components.size() - 1;
 
             // Swap with last element
             if (indexToRemove != lastIndex)
             {
                 m_Components[indexToRemove] = std::move(m_Components[lastIndex]);
+                m_AddedTicks[indexToRemove] = m_AddedTicks[lastIndex];
+                m_ChangedTicks[indexToRemove] = m_ChangedTicks[lastIndex];
+                StampBlock(indexToRemove, m_ChangedTicks[lastIndex].Load());
                 Entity lastEntity = m_IndexToEntity[lastIndex];
                 m_IndexToEntity[indexToRemove] = lastEntity;
-                m_EntityToIndex[lastEntity] = indexToRemove;
+                m_Sparse.Set(lastEntity, indexToRemove);
             }
 
             m_Components.pop_back();
+            m_AddedTicks.pop_back();
+            m_ChangedTicks.pop_back();
             m_IndexToEntity.pop_back();
-            m_EntityToIndex.erase(entity);
+            if (m_Components.size() + ChangeBlockRows <= m_BlockTicks.size() * ChangeBlockRows)
+                m_BlockTicks.pop_back();
+            m_Sparse.Erase(entity);
+            MarkChanged();
         }
 
         // Check if entity has component
         bool Has(Entity entity) const override
         {
-            return m_EntityToIndex.find(entity) != m_EntityToIndex.end();
+            return m_Sparse.Contains(entity);
         }
 
-        // Get component (returns nullptr if not found)
+        // Get component (returns nullptr if not found); marks it changed
         T* Get(Entity entity)
         {
-            auto it = m_EntityToIndex.find(entity);
-            if (it == m_EntityToIndex.end()) return nullptr;
-            return &m_Components[it->second];
+            uint32_t index = m_Sparse.Find(entity);
+            if (index == SparseIndex::InvalidSlot) return nullptr;
+            MarkChangedAt(index);
+            return &m_Components[index];
         }
 
         const T* Get(Entity entity) const
         {
-            auto it = m_EntityToIndex.find(entity);
-            if (it == m_EntityToIndex.end()) return nullptr;
-            return &m_Components[it->second];
+            uint32_t index = m_Sparse.Find(entity);
+            if (index == SparseIndex::InvalidSlot) return nullptr;
+            return &m_Components[index];
         }
 
+        // Dense slot of entity's component, or SparseIndex::InvalidSlot
+        uint32_t IndexOf(Entity entity) const { return m_Sparse.Find(entity); }
+
         // Iteration support
         size_t Size() const override { return m_Components.size(); }
 
@@ -114,12 +185,102 @@ namespace GGEngine {
 
         Entity GetEntity(size_t index) const { return m_IndexToEntity[index]; }
 
+        // Entities parallel to Data() (Entities()[i] owns Data()[i])
+        const Entity* Entities() const { return m_IndexToEntity.data(); }
+
+        // -------------------------------------------------------------------------
+        // Change detection
+        // -------------------------------------------------------------------------
+
+        using IComponentStorage::MarkChanged;
+
+        // Stamp a row changed at the current tick. Safe from several threads,
+        // even for the same row (e.g. parallel systems that fetch it mutably).
+        // Also bumps the storage version (once per tick).
+        void MarkChangedAt(size_t index)
+        {
+            const uint32_t tick = ChangeTicks::Current();
+            m_ChangedTicks[index].Store(tick);
+            StampBlock(index, tick);
+            BumpVersionOnce(tick);
+        }
+
+        // Stamp rows [begin, end) changed at the current tick. Safe from several
+        // threads, like MarkChangedAt.
+        void MarkRangeChanged(size_t begin, size_t end)
+        {
+            if (begin >= end)
+                return;
+            const uint32_t tick = ChangeTicks::Current();
+            for (size_t i = begin; i < end; i++)
+                m_ChangedTicks[i].Store(tick);
+            for (size_t block = begin / ChangeBlockRows; block <= (end - 1) / ChangeBlockRows; block++)
+                ChangeTicks::StampNewest(m_BlockTicks[block].Tick, tick);
+            BumpVersionOnce(tick);
+        }
+
+        void MarkChanged(Entity entity)
+        {
+            uint32_t index = m_Sparse.Find(entity);
+            if (index != SparseIndex::InvalidSlot)
+                MarkChangedAt(index);
+        }
+
+        // Ticks of the row at a dense index
+        uint32_t GetAddedTick(size_t index) const { return m_AddedTicks[index]; }
+        uint32_t GetChangedTick(size_t index) const { return m_ChangedTicks[index].Load(); }
+
+        // Whether the row was added / changed (added counts) after tick `since`
+        bool IsAddedSince(size_t index, uint32_t since) const { return ChangeTicks::IsNewer(m_AddedTicks[index], since); }
+        bool IsChangedSince(size_t index, uint32_t since) const { return ChangeTicks::IsNewer(m_ChangedTicks[index].Load(), since); }
+
+        // Whether any row in [block * ChangeBlockRows, (block + 1) * ChangeBlockRows)
+        // changed after tick `since`; false means every row in it can be skipped
+        static constexpr size_t ChangeBlockRows = 64;
+        size_t GetChangeBlockCount() const { return m_BlockTicks.size(); }
+        bool IsBlockChangedSince(size_t block, uint32_t since) const
+        {
+            return ChangeTicks::IsNewer(m_BlockTicks[block].Load(), since);
+        }
+
+        // Exchange two dense slots, keeping the sparse index in sync
+        void Swap(size_t a, size_t b)
+        {
+            if (a == b) return;
+
+            std::swap(m_Components[a], m_Components[b]);
+            std::swap(m_AddedTicks[a], m_AddedTicks[b]);
+            std::swap(m_ChangedTicks[a], m_ChangedTicks[b]);
+            StampBlock(a, m_ChangedTicks[a].Load());
+            StampBlock(b, m_ChangedTicks[b].Load());
+            std::swap(m_IndexToEntity[a], m_IndexToEntity[b]);
+            m_Sparse.Set(m_IndexToEntity[a], static_cast<uint32_t>(a));
+            m_Sparse.Set(m_IndexToEntity[b], static_cast<uint32_t>(b));
+            MarkChanged();
+        }
+
+        // Group that keeps this storage sorted (nullptr if none)
+        IStorageOwner* GetOwner() const { return m_Owner; }
+
+        void SetOwner(IStorageOwner* owner)
+        {
+            GG_CORE_ASSERT(!owner || !m_Owner, "Component storage is already owned by a group");
+            m_Owner = owner;
+        }
+
         // Clear all components
         void Clear() override
         {
             m_Components.clear();
-            m_EntityToIndex.clear();
+            m_AddedTicks.clear();
+            m_ChangedTicks.clear();
+            m_BlockTicks.clear();
+            m_Sparse.Clear();
             m_IndexToEntity.clear();
+            MarkChanged();
+
+            if (m_Owner)
+                m_Owner->OnStorageCleared();
         }
 
         // =========================================================================
@@ -146,17 +307,8 @@ namespace GGEngine {
             size_t Size() const { return m_Storage.m_Components.size(); }
             Entity GetEntity(size_t index) const { return m_Storage.m_IndexToEntity[index]; }
 
-            const T* Get(Entity entity) const
-            {
-                auto it = m_Storage.m_EntityToIndex.find(entity);
-                if (it == m_Storage.m_EntityToIndex.end()) return nullptr;
-                return &m_Storage.m_Components[it->second];
-            }
-
-            bool Has(Entity entity) const
-            {
-                return m_Storage.m_EntityToIndex.find(entity) != m_Storage.m_EntityToIndex.end();
-            }
+            const T* Get(Entity entity) const { return m_Storage.Get(entity); }
+            bool Has(Entity entity) const { return m_Storage.Has(entity); }
 
         private:
             const ComponentStorage& m_Storage;
@@ -171,6 +323,7 @@ namespace GGEngine {
                 : m_Storage(storage)
                 , m_Lock(storage.m_Mutex)
             {
+                storage.MarkChanged();
             }
 
             // Non-copyable, movable
@@ -179,68 +332,23 @@ namespace GGEngine {
             WriteLock(WriteLock&&) = default;
             WriteLock& operator=(WriteLock&&) = default;
 
-            T* Data() { return m_Storage.m_Components.data(); }
+            // Marks every row changed; use Get() to touch only some
+            T* Data()
+            {
+                m_Storage.MarkRangeChanged(0, m_Storage.m_Components.size());
+                return m_Storage.m_Components.data();
+            }
             const T* Data() const { return m_Storage.m_Components.data(); }
             size_t Size() const { return m_Storage.m_Components.size(); }
             Entity GetEntity(size_t index) const { return m_Storage.m_IndexToEntity[index]; }
 
-            T* Get(Entity entity)
-            {
-                auto it = m_Storage.m_EntityToIndex.find(entity);
-                if (it == m_Storage.m_EntityToIndex.end()) return nullptr;
-                return &m_Storage.m_Components[it->second];
-            }
+            T* Get(Entity entity) { return m_Storage.Get(entity); }
+            bool Has(Entity entity) const { return m_Storage.Has(entity); }
 
-            bool Has(Entity entity) const
-            {
-                return m_Storage.m_EntityToIndex.find(entity) != m_Storage.m_EntityToIndex.end();
-            }
-
-            T& Add(Entity entity)
-            {
-                GG_CORE_ASSERT(!Has(entity), "Entity already has this component");
-
-                size_t index = m_Storage.m_Components.size();
-                m_Storage.m_EntityToIndex[entity] = index;
-                m_Storage.m_IndexToEntity.push_back(entity);
-                m_Storage.m_Components.push_back(T{});
-                return m_Storage.m_Components.back();
-            }
-
-            T& Add(Entity entity, const T& component)
-            {
-                T& comp = Add(entity);
-                comp = component;
-                return comp;
-            }
-
-            void Remove(Entity entity)
-            {
-                auto it = m_Storage.m_EntityToIndex.find(entity);
-                if (it == m_Storage.m_EntityToIndex.end()) return;
-
-                size_t indexToRemove = it->second;
-                size_t lastIndex = m_Storage.m_Components.size() - 1;
-
-                if (indexToRemove != lastIndex)
-                {
-                    m_Storage.m_Components[indexToRemove] = std::move(m_Storage.m_Components[lastIndex]);
-                    Entity lastEntity = m_Storage.m_IndexToEntity[lastIndex];
-                    m_Storage.m_IndexToEntity[indexToRemove] = lastEntity;
-                    m_Storage.m_EntityToIndex[lastEntity] = indexToRemove;
-                }
-
-                m_Storage.m_Components.pop_back();
-                m_Storage.m_IndexToEntity.pop_back();
-                m_Storage.m_EntityToIndex.erase(entity);
-            }
-
-            void Clear()
-            {
-                m_Storage.m_Components.clear();
-                m_Storage.m_EntityToIndex.clear();
-                m_Storage.m_IndexToEntity.clear();
-            }
+            T& Add(Entity entity) { return m_Storage.Add(entity); }
+            T& Add(Entity entity, const T& component) { return m_Storage.Add(entity, component); }
+            void Remove(Entity entity) { m_Storage.Remove(entity); }
+            void Clear() { m_Storage.Clear(); }
 
         private:
             ComponentStorage& m_Storage;
@@ -254,10 +362,45 @@ namespace GGEngine {
         WriteLock LockWrite() { return WriteLock(*this); }
 
     private:
+        void BumpVersionOnce(uint32_t tick)
+        {
+            if (m_LastMarkedTick.load(std::memory_order_relaxed) != tick)
+            {
+                m_LastMarkedTick.store(tick, std::memory_order_relaxed);
+                MarkChanged();
+            }
+        }
+
+        void StampBlock(size_t index, uint32_t tick)
+        {
+            ChangeTicks::StampNewest(m_BlockTicks[index / ChangeBlockRows].Tick, tick);
+        }
+
+        // A tick several threads may stamp at once (rows marked changed from
+        // parallel systems, blocks shared by their rows); copyable so the
+        // vectors can grow
+        struct AtomicTick
+        {
+            std::atomic<uint32_t> Tick{0};
+
+            AtomicTick() = default;
+            explicit AtomicTick(uint32_t tick) : Tick(tick) {}
+            AtomicTick(const AtomicTick& other) : Tick(other.Load()) {}
+            AtomicTick& operator=(const AtomicTick& other) { Store(other.Load()); return *this; }
+
+            uint32_t Load() const { return Tick.load(std::memory_order_relaxed); }
+            void Store(uint32_t tick) { Tick.store(tick, std::memory_order_relaxed); }
+        };
+
         std::vector<T> m_Components;                          // Dense component array
-        std::unordered_map<Entity, size_t> m_EntityToIndex;   // Sparse lookup
+        std::vector<uint32_t> m_AddedTicks;                   // Per row, parallel to m_Components
+        std::vector<AtomicTick> m_ChangedTicks;
+        std::vector<AtomicTick> m_BlockTicks;                 // Newest changed tick of each ChangeBlockRows rows
+        std::atomic<uint32_t> m_LastMarkedTick{0};            // Tick MarkChangedAt last bumped the version at
+        SparseIndex m_Sparse;                                 // Sparse lookup (Entity -> dense slot)
         std::vector<Entity> m_IndexToEntity;                  // Reverse lookup
         mutable std::shared_mutex m_Mutex;                    // Reader-writer lock
+        IStorageOwner* m_Owner = nullptr;                     // Owning group (co-sorts the dense array)
     };
 
 }
@@ -229,6 +229,76 @@ namespace GGEngine {
         }
     };
 
+    // ParticleEmitterComponent serialization
+    // Only the emitter settings are saved; live particles start empty on load
+    template<>
+    struct ComponentSerializer<ParticleEmitterComponent>
+    {
+        static constexpr const char* Name() { return "ParticleEmitterComponent"; }
+
+        static void ToJson(const ParticleEmitterComponent& comp, nlohmann::json& j)
+        {
+            j["Emitting"] = comp.Emitting;
+            j["Rate"] = comp.Rate;
+            j["BurstCount"] = comp.BurstCount;
+            j["BurstInterval"] = comp.BurstInterval;
+            j["Direction"] = comp.Direction;
+            j["ConeAngle"] = comp.ConeAngle;
+            j["Speed"] = comp.Speed;
+            j["SpeedVariation"] = comp.SpeedVariation;
+            j["LifeTime"] = comp.LifeTime;
+            j["LifeTimeVariation"] = comp.LifeTimeVariation;
+            j["ColorBegin"] = { comp.ColorBegin[0], comp.ColorBegin[1], comp.ColorBegin[2], comp.ColorBegin[3] };
+            j["ColorEnd"] = { comp.ColorEnd[0], comp.ColorEnd[1], comp.ColorEnd[2], comp.ColorEnd[3] };
+            j["SizeBegin"] = comp.SizeBegin;
+            j["SizeEnd"] = comp.SizeEnd;
+            j["SizeVariation"] = comp.SizeVariation;
+            j["MaxParticles"] = comp.MaxParticles;
+        }
+
+        static void FromJson(ParticleEmitterComponent& comp, const nlohmann::json& j)
+        {
+            if (j.contains("Emitting"))
+                comp.Emitting = j["Emitting"].get<bool>();
+            if (j.contains("Rate"))
+                comp.Rate = j["Rate"].get<float>();
+            if (j.contains("BurstCount"))
+                comp.BurstCount = j["BurstCount"].get<uint32_t>();
+            if (j.contains("BurstInterval"))
+                comp.BurstInterval = j["BurstInterval"].get<float>();
+            if (j.contains("Direction"))
+                comp.Direction = j["Direction"].get<float>();
+            if (j.contains("ConeAngle"))
+                comp.ConeAngle = j["ConeAngle"].get<float>();
+            if (j.contains("Speed"))
+                comp.Speed = j["Speed"].get<float>();
+            if (j.contains("SpeedVariation"))
+                comp.SpeedVariation = j["SpeedVariation"].get<float>();
+            if (j.contains("LifeTime"))
+                comp.LifeTime = j["LifeTime"].get<float>();
+            if (j.contains("LifeTimeVariation"))
+                comp.LifeTimeVariation = j["LifeTimeVariation"].get<float>();
+            if (j.contains("ColorBegin"))
+            {
+                for (int i = 0; i < 4; i++)
+                    comp.ColorBegin[i] = j["ColorBegin"][i].get<float>();
+            }
+            if (j.contains("ColorEnd"))
+            {
+                for (int i = 0; i < 4; i++)
+                    comp.ColorEnd[i] = j["ColorEnd"][i].get<float>();
+            }
+            if (j.contains("SizeBegin"))
+                comp.SizeBegin = j["SizeBegin"].get<float>();
+            if (j.contains("SizeEnd"))
+                comp.SizeEnd = j["SizeEnd"].get<float>();
+            if (j.contains("SizeVariation"))
+                comp.SizeVariation = j["SizeVariation"].get<float>();
+            if (j.contains("MaxParticles"))
+                comp.MaxParticles = j["MaxParticles"].get<uint32_t>();
+        }
+    };
+
     // Helper to serialize a component if the entity has it
     template<typename T>
     void SerializeComponentIfPresent(const Scene* scene, EntityID entity, nlohmann::json& entityJson)
@@ -5,3 +5,4 @@
 #include "Components/TagComponent.h"
 #include "Components/TilemapComponent.h"
 #include "Components/CameraComponent.h"
+#include "Components/ParticleEmitterComponent.h"
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "GGEngine/ParticleSystem/ParticleSystem.h"
+
+#include <cstdint>
+
+namespace GGEngine {
+
+    // Particle emitter - spawns particles at the entity's transform
+    // Simulated by ParticleUpdateSystem and drawn by ParticleRenderSystem.
+    // Particles live in world space, so moving the emitter leaves them behind.
+    struct ParticleEmitterComponent
+    {
+        // Emission
+        bool Emitting = true;
+        float Rate = 50.0f;                     // Particles per second
+        uint32_t BurstCount = 0;                // Particles per burst (0 = no bursts)
+        float BurstInterval = 1.0f;             // Seconds between bursts
+
+        // Velocity cone, relative to the transform's rotation (degrees)
+        float Direction = 90.0f;                // Cone axis, counter-clockwise from +x
+        float ConeAngle = 30.0f;                // Full cone width
+        float Speed = 2.0f;
+        float SpeedVariation = 0.5f;
+
+        // Lifetime in seconds
+        float LifeTime = 1.0f;
+        float LifeTimeVariation = 0.2f;
+
+        // Over-life curves, linear from begin (birth) to end (death)
+        float ColorBegin[4] = { 1.0f, 0.8f, 0.3f, 1.0f };
+        float ColorEnd[4] = { 1.0f, 0.2f, 0.1f, 0.0f };
+        float SizeBegin = 0.3f;
+        float SizeEnd = 0.0f;
+        float SizeVariation = 0.1f;
+
+        uint32_t MaxParticles = 1000;           // Pool size; oldest slots are reused when full
+
+        // Runtime state (not serialized). The pool is (re)created by
+        // ParticleUpdateSystem when MaxParticles changes, seeded from the entity
+        // (Random::GetStreamSeed).
+        ParticleSystem Particles{ 0 };
+        float SpawnAccumulator = 0.0f;          // Fractional particles owed by Rate
+        float BurstTimer = 0.0f;                // Seconds until the next burst
+    };
+
+}
@@ -9,8 +9,15 @@ namespace GGEngine {
     // Tilemap component - stores a 2D grid of tiles referencing an atlas texture
     // Each tile is a linear index into the atlas: tileIndex = cellY * AtlasColumns + cellX
     // -1 indicates an empty/transparent tile
+    //
+    // Tiles are rendered in ChunkSize x ChunkSize chunks that are only rebuilt
+    // when their version changes, so edit tiles through SetTile (or call
+    // MarkTilesChanged after writing Tiles directly).
     struct TilemapComponent
     {
+        // Tiles per chunk side
+        static constexpr uint32_t ChunkSize = 32;
+
         // Grid dimensions (in tiles)
         uint32_t Width = 10;
         uint32_t Height = 10;
@@ -33,11 +40,16 @@ namespace GGEngine {
         float ZOffset = -0.01f;                 // Render slightly behind entity by default
         float Color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };  // Tint color (RGBA)
 
+        // Per-chunk edit counters, row-major over GetChunksX() x GetChunksY().
+        // Empty until the first edit; a missing entry reads as version 0.
+        std::vector<uint32_t> ChunkVersions;
+
         // Resize tile data when dimensions change, preserving existing data where possible
         void ResizeTiles()
         {
             size_t newSize = static_cast<size_t>(Width) * Height;
             Tiles.resize(newSize, -1);  // Fill new tiles with empty (-1)
+            MarkTilesChanged();
         }
 
         // Get tile at grid position (returns -1 if out of bounds or empty)
@@ -52,6 +64,29 @@ namespace GGEngine {
         {
             if (x >= Width || y >= Height) return;
             Tiles[y * Width + x] = tileIndex;
+
+            const size_t chunk = static_cast<size_t>(y / ChunkSize) * GetChunksX() + x / ChunkSize;
+            if (ChunkVersions.size() != static_cast<size_t>(GetChunksX()) * GetChunksY())
+                ChunkVersions.assign(static_cast<size_t>(GetChunksX()) * GetChunksY(), 0);
+            ChunkVersions[chunk]++;
+        }
+
+        // Chunk grid dimensions
+        uint32_t GetChunksX() const { return (Width + ChunkSize - 1) / ChunkSize; }
+        uint32_t GetChunksY() const { return (Height + ChunkSize - 1) / ChunkSize; }
+
+        uint32_t GetChunkVersion(uint32_t chunkX, uint32_t chunkY) const
+        {
+            const size_t chunk = static_cast<size_t>(chunkY) * GetChunksX() + chunkX;
+            return chunk < ChunkVersions.size() ? ChunkVersions[chunk] : 0;
+        }
+
+        // Invalidate every chunk, e.g. after writing Tiles directly
+        void MarkTilesChanged()
+        {
+            ChunkVersions.resize(static_cast<size_t>(GetChunksX()) * GetChunksY(), 0);
+            for (uint32_t& version : ChunkVersions)
+                version++;
         }
 
         // Convert linear atlas index to cell coordinates
@@ -1,5 +1,6 @@
 #include "ggpch.h"
 #include "GUID.h"
+#include "GGEngine/Core/RandomStream.h"
 
 #include <random>
 #include <sstream>
@@ -7,15 +8,27 @@
 
 namespace GGEngine {
 
-    static std::random_device s_RandomDevice;
-    static std::mt19937_64 s_Engine(s_RandomDevice());
-    static std::uniform_int_distribution<uint64_t> s_Distribution;
+    namespace {
+
+        // Seeded from the OS rather than Random::Init, so a fixed replay seed
+        // never hands out the same GUIDs twice
+        RandomStream& GetGUIDStream()
+        {
+            static thread_local RandomStream t_Stream([]() {
+                std::random_device device;
+                return (static_cast<uint64_t>(device()) << 32) | device();
+            }());
+            return t_Stream;
+        }
+
+    }
 
     GUID GUID::Generate()
     {
+        RandomStream& stream = GetGUIDStream();
         GUID guid;
-        guid.High = s_Distribution(s_Engine);
-        guid.Low = s_Distribution(s_Engine);
+        guid.High = stream.NextUInt64();
+        guid.Low = stream.NextUInt64();
         return guid;
     }
 
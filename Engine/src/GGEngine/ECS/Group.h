@@ -0,0 +1,186 @@
+#pragma once
+
+#include "ComponentStorage.h"
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace GGEngine {
+
+    // =============================================================================
+    // ComponentGroup
+    // =============================================================================
+    // Owns several component storages and keeps their dense arrays co-sorted:
+    // the entities that have every owned component occupy slots [0, Size()) of
+    // each storage, in the same order. Iterating a group is a linear walk over
+    // parallel arrays - no sparse lookups, no skipped rows.
+    //
+    // Membership is maintained eagerly through the storages' owner hooks, so
+    // adding/removing an owned component costs one extra swap per storage.
+    //
+    // A storage can be owned by at most one group. Groups are created through
+    // Scene::Group<A, B, ...>() and live as long as the scene.
+    //
+    // Usage:
+    //   auto& group = scene.Group<TransformComponent, SpriteRendererComponent>();
+    //   const TransformComponent* transforms = group.Data<TransformComponent>();
+    //   const SpriteRendererComponent* sprites = group.Data<SpriteRendererComponent>();
+    //   for (size_t i = 0; i < group.Size(); i++)
+    //       Draw(transforms[i], sprites[i]);
+    //
+    // Like direct storage access, a group takes no locks; adding/removing owned
+    // components while iterating invalidates the iteration.
+    //
+    template<typename... Owned>
+    class ComponentGroup : public IStorageOwner
+    {
+        static_assert(sizeof...(Owned) > 1, "ComponentGroup needs at least two owned components");
+        static_assert((!std::is_const_v<Owned> && ...), "Group components must be non-const");
+
+        using Indices = std::index_sequence_for<Owned...>;
+
+    public:
+        explicit ComponentGroup(ComponentStorage<Owned>&... storages)
+            : m_Storages(&storages...)
+        {
+            (storages.SetOwner(this), ...);
+
+            // Pack entities that already have every owned component
+            auto* first = std::get<0>(m_Storages);
+            for (size_t i = 0; i < first->Size(); i++)
+                OnComponentAdded(first->GetEntity(i));
+        }
+
+        ~ComponentGroup() override
+        {
+            std::apply([](auto*... storages) { (storages->SetOwner(nullptr), ...); }, m_Storages);
+        }
+
+        ComponentGroup(const ComponentGroup&) = delete;
+        ComponentGroup& operator=(const ComponentGroup&) = delete;
+
+        // Number of entities with all owned components
+        size_t Size() const { return m_Size; }
+        bool Empty() const { return m_Size == 0; }
+
+        // Dense component array for T, valid for indices [0, Size()).
+        // Marks every member's T changed (see ChangeTick.h); read through a
+        // const group to leave the ticks alone.
+        template<typename T>
+        T* Data()
+        {
+            auto* storage = std::get<ComponentStorage<T>*>(m_Storages);
+            storage->MarkRangeChanged(0, m_Size);
+            return storage->Data();
+        }
+
+        template<typename T>
+        const T* Data() const { return std::get<ComponentStorage<T>*>(m_Storages)->Data(); }
+
+        // Entities parallel to Data<T>() for every owned T
+        const Entity* Entities() const { return std::get<0>(m_Storages)->Entities(); }
+
+        bool Contains(Entity entity) const
+        {
+            uint32_t slot = std::get<0>(m_Storages)->IndexOf(entity);
+            return slot != SparseIndex::InvalidSlot && slot < m_Size;
+        }
+
+        // Invoke fn for every member. fn takes (Entity, Owned&...) or (Owned&...).
+        // Marks the visited rows of every owned component changed, like mutable
+        // view access; the const overloads pass const references and don't.
+        template<typename Fn>
+        void Each(Fn&& fn)
+        {
+            EachInRange(0, m_Size, std::forward<Fn>(fn));
+        }
+
+        template<typename Fn>
+        void Each(Fn&& fn) const
+        {
+            EachInRange(0, m_Size, std::forward<Fn>(fn));
+        }
+
+        // Invoke fn for members [begin, end) - disjoint ranges may run on different threads
+        template<typename Fn>
+        void EachInRange(size_t begin, size_t end, Fn&& fn)
+        {
+            if (end > m_Size)
+                end = m_Size;
+            std::apply([&](auto*... storages) { (storages->MarkRangeChanged(begin, end), ...); }, m_Storages);
+            EachInRangeImpl<Owned...>(begin, end, fn, Indices{});
+        }
+
+        template<typename Fn>
+        void EachInRange(size_t begin, size_t end, Fn&& fn) const
+        {
+            if (end > m_Size)
+                end = m_Size;
+            EachInRangeImpl<const Owned...>(begin, end, fn, Indices{});
+        }
+
+        // -------------------------------------------------------------------------
+        // IStorageOwner
+        // -------------------------------------------------------------------------
+
+        void OnComponentAdded(Entity entity) override
+        {
+            if (!HasAll(entity, Indices{}))
+                return;
+
+            // Already packed (the constructor walks storages that may contain members)
+            if (std::get<0>(m_Storages)->IndexOf(entity) < m_Size)
+                return;
+
+            MoveTo(entity, m_Size, Indices{});
+            ++m_Size;
+        }
+
+        void OnComponentRemoving(Entity entity) override
+        {
+            if (!Contains(entity))
+                return;
+
+            // Move to the group's tail so the storage's swap-with-last never
+            // pulls a non-member into the packed range
+            --m_Size;
+            MoveTo(entity, m_Size, Indices{});
+        }
+
+        void OnStorageCleared() override { m_Size = 0; }
+
+    private:
+        template<size_t... I>
+        bool HasAll(Entity entity, std::index_sequence<I...>) const
+        {
+            return (std::get<I>(m_Storages)->Has(entity) && ...);
+        }
+
+        template<size_t... I>
+        void MoveTo(Entity entity, size_t slot, std::index_sequence<I...>)
+        {
+            (std::get<I>(m_Storages)->Swap(std::get<I>(m_Storages)->IndexOf(entity), slot), ...);
+        }
+
+        // Components are passed as Access&... (Owned or const Owned)
+        template<typename... Access, typename Fn, size_t... I>
+        void EachInRangeImpl(size_t begin, size_t end, Fn& fn, std::index_sequence<I...>) const
+        {
+            const Entity* entities = Entities();
+            auto data = std::make_tuple(static_cast<Access*>(std::get<I>(m_Storages)->Data())...);
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                if constexpr (std::is_invocable_v<Fn&, Entity, Access&...>)
+                    fn(entities[i], std::get<I>(data)[i]...);
+                else
+                    fn(std::get<I>(data)[i]...);
+            }
+        }
+
+        std::tuple<ComponentStorage<Owned>*...> m_Storages;
+        size_t m_Size = 0;
+    };
+
+}
@@ -1,13 +1,16 @@
 #include "ggpch.h"
 #include "Scene.h"
 #include "GGEngine/Renderer/SceneCamera.h"
+#include "GGEngine/Core/Math.h"
+#include "GGEngine/Core/Profiler.h"
 
 #include <algorithm>
 
 namespace GGEngine {
 
-    Scene::Scene(const std::string& name)
+    Scene::Scene(const std::string& name, SceneStorageMode storageMode)
         : m_Name(name)
+        , m_StorageMode(storageMode)
     {
     }
 
@@ -35,17 +38,27 @@ namespace GGEngine {
         return { index, generation };
     }
 
+    void Scene::ReportSparseSetOnly(const char* function) const
+    {
+        // Logged as well as asserted: in release the caller would otherwise
+        // quietly iterate an empty storage and draw or update nothing
+        GG_CORE_ERROR("Scene '{}': {} needs a SparseSet scene; archetype scenes are read through Scene::Each or GetArchetypes", m_Name, function);
+        GG_CORE_ASSERT(false, "SparseSet-only Scene call on an archetype scene");
+    }
+
     EntityID Scene::CreateEntity(const std::string& name)
     {
         auto [index, generation] = AllocateEntitySlot();
 
+        EntityID entity{ index, generation };
+
         // Add required TagComponent with auto-generated GUID
         TagComponent tag(name);
-        GetStorage<TagComponent>().Add(index, tag);
+        AddComponent<TagComponent>(entity, tag);
         m_GUIDToEntity[tag.ID] = index;
 
         // Add default TransformComponent
-        GetStorage<TransformComponent>().Add(index);
+        AddComponent<TransformComponent>(entity);
 
         GG_CORE_TRACE("Created entity '{}' (index={}, gen={})", name, index, generation);
         return EntityID{ index, generation };
@@ -59,11 +72,13 @@ namespace GGEngine {
         TagComponent tag;
         tag.Name = name;
         tag.ID = guid;
-        GetStorage<TagComponent>().Add(index, tag);
+
+        EntityID entity{ index, generation };
+        AddComponent<TagComponent>(entity, tag);
         m_GUIDToEntity[tag.ID] = index;
 
         // Add default TransformComponent
-        GetStorage<TransformComponent>().Add(index);
+        AddComponent<TransformComponent>(entity);
 
         GG_CORE_TRACE("Created entity '{}' with GUID (index={}, gen={})", name, index, generation);
         return EntityID{ index, generation };
@@ -77,6 +92,14 @@ namespace GGEngine {
         m_FreeList.clear();
         m_GUIDToEntity.clear();
 
+        m_Archetypes.Clear();
+
+        {
+            std::lock_guard<std::mutex> lock(m_SpatialMutex);
+            m_SpatialIndex.Clear();
+            m_SpatialIndexed = false;
+        }
+
         // Clear all registered component storages (thread-safe)
         {
             std::shared_lock<std::shared_mutex> lock(m_RegistryMutex);
@@ -96,13 +119,18 @@ namespace GGEngine {
         Entity index = entity.Index;
 
         // Remove from GUID lookup
-        if (auto* tag = GetStorage<TagComponent>().Get(index))
+        if (auto* tag = GetComponent<TagComponent>(entity))
         {
             m_GUIDToEntity.erase(tag->ID);
         }
 
-        // Remove all components from all registered storages (thread-safe)
+        if (m_StorageMode == SceneStorageMode::Archetype)
         {
+            m_Archetypes.DestroyEntity(index);
+        }
+        else
+        {
+            // Remove all components from all registered storages (thread-safe)
             std::shared_lock<std::shared_mutex> lock(m_RegistryMutex);
             for (auto& [typeIndex, storage] : m_ComponentRegistry)
             {
@@ -110,6 +138,8 @@ namespace GGEngine {
             }
         }
 
+        RemoveFromSpatialIndex(index);
+
         // Remove from active entities list using swap-and-pop (O(1) removal instead of O(n))
         auto it = std::find(m_Entities.begin(), m_Entities.end(), index);
         if (it != m_Entities.end())
@@ -132,6 +162,37 @@ namespace GGEngine {
         return m_Generations[entity.Index] == entity.Generation;
     }
 
+    size_t Scene::GetComponentCount(std::type_index type) const
+    {
+        if (m_StorageMode == SceneStorageMode::Archetype)
+            return 0;
+
+        std::shared_lock<std::shared_mutex> lock(m_RegistryMutex);
+        auto it = m_ComponentRegistry.find(type);
+        return it != m_ComponentRegistry.end() ? it->second->Size() : 0;
+    }
+
+    uint64_t Scene::GetComponentVersion(std::type_index type) const
+    {
+        if (m_StorageMode == SceneStorageMode::Archetype)
+            return 0;
+
+        std::shared_lock<std::shared_mutex> lock(m_RegistryMutex);
+        auto it = m_ComponentRegistry.find(type);
+        return it != m_ComponentRegistry.end() ? it->second->GetVersion() : 0;
+    }
+
+    void Scene::MarkComponentChanged(std::type_index type)
+    {
+        if (m_StorageMode == SceneStorageMode::Archetype)
+            return;
+
+        std::shared_lock<std::shared_mutex> lock(m_RegistryMutex);
+        auto it = m_ComponentRegistry.find(type);
+        if (it != m_ComponentRegistry.end())
+            it->second->MarkChanged();
+    }
+
     EntityID Scene::GetEntityID(Entity index) const
     {
         if (index >= m_Generations.size()) return InvalidEntityID;
@@ -140,6 +201,20 @@ namespace GGEngine {
 
     EntityID Scene::FindEntityByName(const std::string& name) const
     {
+        if (m_StorageMode == SceneStorageMode::Archetype)
+        {
+            Entity found = InvalidEntity;
+            m_Archetypes.EachChunk<const TagComponent>([&](size_t count, const Entity* entities, const TagComponent* tags)
+            {
+                for (size_t i = 0; i < count && found == InvalidEntity; i++)
+                {
+                    if (tags[i].Name == name)
+                        found = entities[i];
+                }
+            });
+            return found != InvalidEntity ? EntityID{ found, m_Generations[found] } : InvalidEntityID;
+        }
+
         auto& tags = GetStorage<TagComponent>();
         for (size_t i = 0; i < tags.Size(); i++)
         {
@@ -166,34 +241,136 @@ namespace GGEngine {
     void Scene::OnUpdate(Timestep ts)
     {
         // Reserved for future systems (physics, scripting, etc.)
+
+        UpdateSpatialIndex();
     }
 
-    EntityID Scene::GetPrimaryCameraEntity()
+    namespace {
+
+        Bounds2D GetTransformBounds(const TransformComponent& transform)
+        {
+            return Bounds2D::FromQuad(transform.Position[0], transform.Position[1],
+                                      transform.Scale[0], transform.Scale[1],
+                                      Math::ToRadians(transform.Rotation));
+        }
+
+    }
+
+    bool Scene::IsSpatialIndexCurrent() const
     {
-        auto& cameras = GetStorage<CameraComponent>();
-        for (size_t i = 0; i < cameras.Size(); i++)
+        if (!m_SpatialIndexed || m_StorageMode == SceneStorageMode::Archetype)
+            return m_SpatialIndexed;
+        return GetOrCreateStorage<TransformComponent>().GetVersion() == m_SpatialVersion;
+    }
+
+    void Scene::UpdateSpatialIndex()
+    {
+        GG_PROFILE_FUNCTION();
+
+        std::lock_guard<std::mutex> lock(m_SpatialMutex);
+
+        if (m_StorageMode == SceneStorageMode::Archetype)
         {
-            if (cameras.Data()[i].Primary)
+            // Rows stamped after this tick are picked up by the next pass
+            const uint32_t since = m_SpatialTick;
+            m_SpatialTick = ChangeTicks::Current();
+            ChangeTicks::Advance();
+
+            // Only chunks whose transform column changed; rows entering a chunk stamp it
+            auto indexChunk = [&](size_t count, const Entity* entities, const TransformComponent* transforms)
             {
-                Entity entity = cameras.GetEntity(i);
-                return EntityID{ entity, m_Generations[entity] };
+                for (size_t row = 0; row < count; row++)
+                    m_SpatialIndex.Update(entities[row], GetTransformBounds(transforms[row]));
+            };
+            if (m_SpatialIndexed)
+                m_Archetypes.EachChangedChunk<const TransformComponent>(since, indexChunk);
+            else
+                m_Archetypes.EachChunk<const TransformComponent>(indexChunk);
+
+            // Then drop entities that lost their transform
+            if (m_SpatialIndex.Size() != m_Archetypes.Count<TransformComponent>())
+            {
+                m_SpatialIndex.RemoveUnless([&](Entity entity) {
+                    return m_Archetypes.Has<TransformComponent>(entity);
+                });
             }
+            m_SpatialIndexed = true;
+            return;
         }
-        return InvalidEntityID;
+
+        const auto& storage = GetOrCreateStorage<TransformComponent>();
+
+        // No writes, adds or removes since the last pass
+        const uint64_t version = storage.GetVersion();
+        if (m_SpatialIndexed && version == m_SpatialVersion)
+            return;
+
+        // Rows stamped after this tick are picked up by the next pass
+        const uint32_t since = m_SpatialTick;
+        m_SpatialTick = ChangeTicks::Current();
+        ChangeTicks::Advance();
+
+        // Adds stamp the changed tick too, so new transforms are caught here.
+        // Blocks without a newer stamp are skipped whole, so a pass costs
+        // about what moved rather than the scene's size.
+        using Storage = ComponentStorage<TransformComponent>;
+        const TransformComponent* transforms = storage.Data();
+        const Entity* entities = storage.Entities();
+        for (size_t block = 0; block < storage.GetChangeBlockCount(); block++)
+        {
+            if (m_SpatialIndexed && !storage.IsBlockChangedSince(block, since))
+                continue;
+
+            const size_t end = std::min(storage.Size(), (block + 1) * Storage::ChangeBlockRows);
+            for (size_t i = block * Storage::ChangeBlockRows; i < end; i++)
+            {
+                if (m_SpatialIndexed && !storage.IsChangedSince(i, since))
+                    continue;
+                m_SpatialIndex.Update(entities[i], GetTransformBounds(transforms[i]));
+            }
+        }
+
+        // Removals through Scene are unlinked as they happen; this catches ones
+        // made on the storage directly
+        if (m_SpatialIndex.Size() != storage.Size())
+        {
+            m_SpatialIndex.RemoveUnless([&](Entity entity) { return storage.Has(entity); });
+        }
+
+        m_SpatialVersion = version;
+        m_SpatialIndexed = true;
+    }
+
+    void Scene::RemoveFromSpatialIndex(Entity entity)
+    {
+        std::lock_guard<std::mutex> lock(m_SpatialMutex);
+        m_SpatialIndex.Remove(entity);
+    }
+
+    EntityID Scene::GetPrimaryCameraEntity()
+    {
+        Entity primary = InvalidEntity;
+        Each<const CameraComponent>([&](Entity entity, const CameraComponent& camera)
+        {
+            if (camera.Primary && primary == InvalidEntity)
+                primary = entity;
+        });
+
+        if (primary == InvalidEntity)
+            return InvalidEntityID;
+        return EntityID{ primary, m_Generations[primary] };
     }
 
     void Scene::OnViewportResize(uint32_t width, uint32_t height)
     {
         // Update all cameras that don't have fixed aspect ratio
-        auto& cameras = GetStorage<CameraComponent>();
-        for (size_t i = 0; i < cameras.Size(); i++)
+        Each<CameraComponent>([width, height](CameraComponent& cameraComp)
         {
-            CameraComponent& cameraComp = cameras.Data()[i];
             if (!cameraComp.FixedAspectRatio)
             {
                 cameraComp.Camera.SetViewportSize(width, height);
             }
-        }
+        });
     }
 
 }
@@ -3,6 +3,10 @@
 #include "Entity.h"
 #include "GUID.h"
 #include "ComponentStorage.h"
+#include "View.h"
+#include "Group.h"
+#include "Archetype.h"
+#include "SpatialIndex.h"
 #include "Components.h"
 #include "GGEngine/Core/Core.h"
 #include "GGEngine/Core/Timestep.h"
@@ -14,14 +18,22 @@
 #include <unordered_map>
 #include <typeindex>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 
 namespace GGEngine {
 
+    // How a scene stores its components (fixed for the scene's lifetime)
+    enum class SceneStorageMode : uint8_t
+    {
+        SparseSet,  // One ComponentStorage<T> per type; supports GetStorage/View/Group
+        Archetype   // Entities grouped by component set in SoA chunks (see Archetype.h)
+    };
+
     class GG_API Scene
     {
     public:
-        Scene(const std::string& name = "Untitled Scene");
+        Scene(const std::string& name = "Untitled Scene", SceneStorageMode storageMode = SceneStorageMode::SparseSet);
         ~Scene() = default;
 
         // Entity lifecycle
@@ -37,6 +49,7 @@ namespace GGEngine {
         EntityID GetEntityID(Entity index) const;
 
         // Component access (templated for type safety)
+        // In SparseSet scenes the non-const GetComponent marks the component changed
         template<typename T>
         T& AddComponent(EntityID entity);
 
@@ -62,6 +75,24 @@ namespace GGEngine {
         // Scene-wide operations
         void OnUpdate(Timestep ts);
 
+        // Spatial index over TransformComponent bounds (position, scale and rotation),
+        // as of the last UpdateSpatialIndex. OnUpdate runs that once per frame, so
+        // systems (render systems included) only ever read the index.
+        const SpatialIndex& GetSpatialIndex() const { return m_SpatialIndex; }
+
+        // Whether no transform was added, removed or written since the last
+        // UpdateSpatialIndex. Only SparseSet scenes can tell; archetype scenes
+        // report whether the index was ever built.
+        bool IsSpatialIndexCurrent() const;
+
+        // Bring the spatial index up to date. Only transforms whose change tick
+        // moved are re-indexed (see ChangeTick.h): SparseSet scenes check the
+        // rows of changed blocks, archetype scenes every row of changed chunks. So
+        // writes through raw pointers kept from an earlier access must stamp the
+        // row (ComponentStorage::MarkChanged(entity)) or fetch it mutably again.
+        // Don't call while systems run.
+        void UpdateSpatialIndex();
+
         // Viewport resize (updates camera aspect ratios)
         void OnViewportResize(uint32_t width, uint32_t height);
 
@@ -72,22 +103,72 @@ namespace GGEngine {
         const std::vector<Entity>& GetAllEntities() const { return m_Entities; }
         size_t GetEntityCount() const { return m_Entities.size(); }
 
+        // Size of the sparse-set storage for a component type (0 if it has none
+        // yet, or in an archetype scene). Safe to call while systems run.
+        size_t GetComponentCount(std::type_index type) const;
+
+        // Change version of a component type's storage (see IComponentStorage::GetVersion).
+        // Always 0 in an archetype scene, which doesn't track changes.
+        uint64_t GetComponentVersion(std::type_index type) const;
+
+        // Record a change made without a WriteLock, e.g. through GetComponent
+        void MarkComponentChanged(std::type_index type);
+
         // Scene metadata
         const std::string& GetName() const { return m_Name; }
         void SetName(const std::string& name) { m_Name = name; }
 
+        SceneStorageMode GetStorageMode() const { return m_StorageMode; }
+
+        // Invoke fn for every entity that has all of T... - works in both storage modes
+        // fn takes (Entity, T&...) or (T&...); declare T const for read-only access
+        template<typename... T, typename Fn>
+        void Each(Fn&& fn);
+
+        // Archetype backend (only populated in SceneStorageMode::Archetype)
+        ArchetypeStorage& GetArchetypes() { return m_Archetypes; }
+        const ArchetypeStorage& GetArchetypes() const { return m_Archetypes; }
+
         // Get storage for component type (for bulk iteration in systems)
+        // SparseSet scenes only - archetype scenes have no per-type storage, so
+        // there this (like View and Group) logs an error and hands back an empty
+        // storage that none of the scene's components are in
         template<typename T>
         ComponentStorage<T>& GetStorage();
 
         template<typename T>
         const ComponentStorage<T>& GetStorage() const;
 
+        // Multi-component view over entities that have all of Included...
+        // The smallest storage drives iteration (see View.h)
+        template<typename... Included>
+        ComponentView<Exclude<>, Included...> View();
+
+        // Same, skipping entities that have any of Excluded...
+        //   scene.View<TransformComponent>(Exclude<CameraComponent>{})
+        template<typename... Included, typename... Excluded>
+        ComponentView<Exclude<Excluded...>, Included...> View(Exclude<Excluded...>);
+
+        // Co-sorted group over Owned... (created and packed on first call, see Group.h)
+        // Each storage can belong to only one group. Creating a group swaps rows
+        // of every owned storage, so do it at setup (e.g. ISystem::OnRegister),
+        // never while systems are running; look existing groups up with FindGroup.
+        template<typename... Owned>
+        ComponentGroup<Owned...>& Group();
+
+        // Existing group over Owned..., or nullptr if none was created
+        template<typename... Owned>
+        ComponentGroup<Owned...>* FindGroup();
+
     private:
         // Allocate or reuse an entity slot, returns (index, generation)
         std::pair<Entity, uint32_t> AllocateEntitySlot();
 
+        // Log (and assert) a SparseSet-only call made on an archetype scene
+        void ReportSparseSetOnly(const char* function) const;
+
         std::string m_Name;
+        SceneStorageMode m_StorageMode;
 
         // Entity management
         std::vector<Entity> m_Entities;              // All active entity indices
@@ -101,9 +182,26 @@ namespace GGEngine {
         // Allows custom components without modifying engine code
         mutable std::unordered_map<std::type_index, std::unique_ptr<IComponentStorage>> m_ComponentRegistry;
 
+        // Archetype-mode component storage (unused in SparseSet mode)
+        ArchetypeStorage m_Archetypes;
+
         // Mutex protecting m_ComponentRegistry for thread-safe access during parallel system execution
         mutable std::shared_mutex m_RegistryMutex;
 
+        // Groups hold raw storage pointers, so they are declared after the registry
+        // (members are destroyed in reverse order, so groups go before the storages)
+        std::unordered_map<std::type_index, std::unique_ptr<IStorageOwner>> m_Groups;
+        std::shared_mutex m_GroupMutex;
+
+        // Spatial index state (see GetSpatialIndex)
+        SpatialIndex m_SpatialIndex;
+        uint32_t m_SpatialTick = 0;         // Rows stamped after this are re-indexed
+        uint64_t m_SpatialVersion = 0;      // Transform storage version last indexed
+        bool m_SpatialIndexed = false;      // False until the first full pass
+        std::mutex m_SpatialMutex;
+
+        void RemoveFromSpatialIndex(Entity entity);
+
         // Helper to get or create storage for a component type
         template<typename T>
         ComponentStorage<T>& GetOrCreateStorage() const;
@@ -150,19 +248,74 @@ namespace GGEngine {
     template<typename T>
     ComponentStorage<T>& Scene::GetStorage()
     {
+        if (m_StorageMode != SceneStorageMode::SparseSet)
+            ReportSparseSetOnly("GetStorage");
         return GetOrCreateStorage<T>();
     }
 
     template<typename T>
     const ComponentStorage<T>& Scene::GetStorage() const
     {
+        if (m_StorageMode != SceneStorageMode::SparseSet)
+            ReportSparseSetOnly("GetStorage");
         return GetOrCreateStorage<T>();
     }
 
+    template<typename... T, typename Fn>
+    void Scene::Each(Fn&& fn)
+    {
+        if (m_StorageMode == SceneStorageMode::Archetype)
+            m_Archetypes.Each<T...>(std::forward<Fn>(fn));
+        else
+            View<T...>().Each(std::forward<Fn>(fn));
+    }
+
+    template<typename... Included>
+    ComponentView<Exclude<>, Included...> Scene::View()
+    {
+        return ComponentView<Exclude<>, Included...>(
+            GetStorage<std::remove_const_t<Included>>()...);
+    }
+
+    template<typename... Included, typename... Excluded>
+    ComponentView<Exclude<Excluded...>, Included...> Scene::View(Exclude<Excluded...>)
+    {
+        return ComponentView<Exclude<Excluded...>, Included...>(
+            GetStorage<std::remove_const_t<Included>>()...,
+            GetStorage<Excluded>()...);
+    }
+
+    template<typename... Owned>
+    ComponentGroup<Owned...>& Scene::Group()
+    {
+        if (auto* group = FindGroup<Owned...>())
+            return *group;
+
+        std::unique_lock<std::shared_mutex> writeLock(m_GroupMutex);
+
+        auto& slot = m_Groups[std::type_index(typeid(ComponentGroup<Owned...>))];
+        if (!slot)
+            slot = std::make_unique<ComponentGroup<Owned...>>(GetStorage<Owned>()...);
+        return *static_cast<ComponentGroup<Owned...>*>(slot.get());
+    }
+
+    template<typename... Owned>
+    ComponentGroup<Owned...>* Scene::FindGroup()
+    {
+        std::shared_lock<std::shared_mutex> readLock(m_GroupMutex);
+
+        auto it = m_Groups.find(std::type_index(typeid(ComponentGroup<Owned...>)));
+        if (it == m_Groups.end())
+            return nullptr;
+        return static_cast<ComponentGroup<Owned...>*>(it->second.get());
+    }
+
     template<typename T>
     T& Scene::AddComponent(EntityID entity)
     {
         GG_CORE_ASSERT(IsEntityValid(entity), "Invalid entity");
+        if (m_StorageMode == SceneStorageMode::Archetype)
+            return m_Archetypes.Add<T>(entity.Index);
         return GetStorage<T>().Add(entity.Index);
     }
 
@@ -170,6 +323,8 @@ namespace GGEngine {
     T& Scene::AddComponent(EntityID entity, const T& component)
     {
         GG_CORE_ASSERT(IsEntityValid(entity), "Invalid entity");
+        if (m_StorageMode == SceneStorageMode::Archetype)
+            return m_Archetypes.Add<T>(entity.Index, component);
         return GetStorage<T>().Add(entity.Index, component);
     }
 
@@ -177,13 +332,21 @@ namespace GGEngine {
     void Scene::RemoveComponent(EntityID entity)
     {
         if (!IsEntityValid(entity)) return;
-        GetStorage<T>().Remove(entity.Index);
+        if (m_StorageMode == SceneStorageMode::Archetype)
+            m_Archetypes.Remove<T>(entity.Index);
+        else
+            GetStorage<T>().Remove(entity.Index);
+
+        if constexpr (std::is_same_v<T, TransformComponent>)
+            RemoveFromSpatialIndex(entity.Index);
     }
 
     template<typename T>
     bool Scene::HasComponent(EntityID entity) const
     {
         if (!IsEntityValid(entity)) return false;
+        if (m_StorageMode == SceneStorageMode::Archetype)
+            return m_Archetypes.Has<T>(entity.Index);
         return GetStorage<T>().Has(entity.Index);
     }
 
@@ -191,6 +354,8 @@ namespace GGEngine {
     T* Scene::GetComponent(EntityID entity)
     {
         if (!IsEntityValid(entity)) return nullptr;
+        if (m_StorageMode == SceneStorageMode::Archetype)
+            return m_Archetypes.Get<T>(entity.Index);
         return GetStorage<T>().Get(entity.Index);
     }
 
@@ -198,6 +363,8 @@ namespace GGEngine {
     const T* Scene::GetComponent(EntityID entity) const
     {
         if (!IsEntityValid(entity)) return nullptr;
+        if (m_StorageMode == SceneStorageMode::Archetype)
+            return m_Archetypes.Get<T>(entity.Index);
         return GetStorage<T>().Get(entity.Index);
     }
 
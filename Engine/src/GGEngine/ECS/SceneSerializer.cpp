@@ -50,6 +50,7 @@ namespace GGEngine {
             SerializeComponentIfPresent<SpriteRendererComponent>(m_Scene, entityId, entityJson);
             SerializeComponentIfPresent<TilemapComponent>(m_Scene, entityId, entityJson);
             SerializeComponentIfPresent<CameraComponent>(m_Scene, entityId, entityJson);
+            SerializeComponentIfPresent<ParticleEmitterComponent>(m_Scene, entityId, entityJson);
 
             entitiesArray.push_back(entityJson);
         }
@@ -140,6 +141,7 @@ namespace GGEngine {
                 DeserializeComponentIfPresent<SpriteRendererComponent>(m_Scene, entity, entityJson);
                 DeserializeComponentIfPresent<TilemapComponent>(m_Scene, entity, entityJson);
                 DeserializeComponentIfPresent<CameraComponent>(m_Scene, entity, entityJson);
+                DeserializeComponentIfPresent<ParticleEmitterComponent>(m_Scene, entity, entityJson);
             }
         }
 
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Entity.h"
+#include "GGEngine/Core/Core.h"
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+
+namespace GGEngine {
+
+    // Paged sparse array mapping Entity -> dense slot
+    //
+    // Entity indices are small, dense integers handed out by Scene, so a flat
+    // array lookup beats hashing. The array is split into fixed-size pages that
+    // are allocated on first use, which keeps memory proportional to the range of
+    // entity indices actually touched instead of the largest index ever seen.
+    //
+    // Pages are only released by Clear(); removing entities leaves their page
+    // allocated so add/remove churn never hits the allocator.
+    //
+    class SparseIndex
+    {
+    public:
+        static constexpr uint32_t InvalidSlot = UINT32_MAX;
+
+        // 4096 slots * 4 bytes = 16 KiB per page
+        static constexpr uint32_t PageShift = 12;
+        static constexpr uint32_t PageSize = 1u << PageShift;
+        static constexpr uint32_t PageMask = PageSize - 1;
+
+        // Dense slot for entity, or InvalidSlot if not present
+        uint32_t Find(Entity entity) const
+        {
+            const size_t page = entity >> PageShift;
+            if (page >= m_Pages.size() || !m_Pages[page])
+                return InvalidSlot;
+            return m_Pages[page][entity & PageMask];
+        }
+
+        bool Contains(Entity entity) const { return Find(entity) != InvalidSlot; }
+
+        // Map entity to slot, allocating its page if needed
+        void Set(Entity entity, uint32_t slot)
+        {
+            GG_CORE_ASSERT(entity != InvalidEntity, "Cannot index InvalidEntity");
+            EnsurePage(entity >> PageShift)[entity & PageMask] = slot;
+        }
+
+        // Unmap entity (no-op if its page was never allocated)
+        void Erase(Entity entity)
+        {
+            const size_t page = entity >> PageShift;
+            if (page < m_Pages.size() && m_Pages[page])
+                m_Pages[page][entity & PageMask] = InvalidSlot;
+        }
+
+        // Release all pages
+        void Clear() { m_Pages.clear(); }
+
+        // Number of allocated pages (for memory diagnostics)
+        size_t GetPageCount() const
+        {
+            size_t count = 0;
+            for (const auto& page : m_Pages)
+                if (page) count++;
+            return count;
+        }
+
+    private:
+        uint32_t* EnsurePage(size_t page)
+        {
+            if (page >= m_Pages.size())
+                m_Pages.resize(page + 1);
+
+            if (!m_Pages[page])
+            {
+                m_Pages[page] = std::make_unique<uint32_t[]>(PageSize);
+                std::fill_n(m_Pages[page].get(), PageSize, InvalidSlot);
+            }
+            return m_Pages[page].get();
+        }
+
+        std::vector<std::unique_ptr<uint32_t[]>> m_Pages;
+    };
+
+}
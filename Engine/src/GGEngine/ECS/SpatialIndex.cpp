@@ -0,0 +1,140 @@
+#include "ggpch.h"
+#include "SpatialIndex.h"
+
+#include <algorithm>
+
+namespace GGEngine {
+
+    namespace {
+
+        // Closest distance from the point to the rectangle, squared
+        float DistanceSquared(const Bounds2D& bounds, float x, float y)
+        {
+            const float dx = std::max({ bounds.MinX - x, 0.0f, x - bounds.MaxX });
+            const float dy = std::max({ bounds.MinY - y, 0.0f, y - bounds.MaxY });
+            return dx * dx + dy * dy;
+        }
+
+    }
+
+    SpatialIndex::SpatialIndex(float cellSize)
+        : m_CellSize(cellSize > 0.0f ? cellSize : DefaultCellSize)
+        , m_InvCellSize(1.0f / m_CellSize)
+    {
+    }
+
+    uint64_t SpatialIndex::CellOf(const Bounds2D& bounds) const
+    {
+        const float halfX = bounds.MaxX * 0.5f - bounds.MinX * 0.5f;
+        const float halfY = bounds.MaxY * 0.5f - bounds.MinY * 0.5f;
+        if (!(halfX <= m_CellSize) || !(halfY <= m_CellSize))
+            return OversizedCell;
+
+        const double cellX = std::floor((static_cast<double>(bounds.MinX) + halfX) * m_InvCellSize);
+        const double cellY = std::floor((static_cast<double>(bounds.MinY) + halfY) * m_InvCellSize);
+        if (!(std::abs(cellX) < MaxCellCoordinate) || !(std::abs(cellY) < MaxCellCoordinate))
+            return OversizedCell;
+
+        return MakeCellKey(static_cast<int32_t>(cellX), static_cast<int32_t>(cellY));
+    }
+
+    std::vector<SpatialIndex::Item>& SpatialIndex::ItemsOf(uint64_t cell)
+    {
+        return cell == OversizedCell ? m_Oversized : m_Cells[cell];
+    }
+
+    void SpatialIndex::Update(Entity entity, const Bounds2D& bounds)
+    {
+        if (entity >= m_Entries.size())
+            m_Entries.resize(static_cast<size_t>(entity) + 1);
+
+        Entry& entry = m_Entries[entity];
+        const uint64_t cell = CellOf(bounds);
+
+        // Same cell: just refresh the bounds in place
+        if (entry.Slot != InvalidSlot)
+        {
+            if (entry.Cell == cell)
+            {
+                (*entry.Items)[entry.Slot].Bounds = bounds;
+                return;
+            }
+            Unlink(entity);
+        }
+        else
+        {
+            m_Count++;
+        }
+
+        auto& items = ItemsOf(cell);
+        entry.Cell = cell;
+        entry.Items = &items;
+        entry.Slot = static_cast<uint32_t>(items.size());
+        items.push_back({ bounds, entity });
+    }
+
+    bool SpatialIndex::Remove(Entity entity)
+    {
+        if (!Contains(entity))
+            return false;
+
+        Unlink(entity);
+        m_Entries[entity].Slot = InvalidSlot;
+        m_Count--;
+        return true;
+    }
+
+    void SpatialIndex::Unlink(Entity entity)
+    {
+        const Entry& entry = m_Entries[entity];
+        auto& items = *entry.Items;
+
+        // Swap-and-pop, fixing up the moved item's slot
+        if (entry.Slot + 1 != items.size())
+        {
+            items[entry.Slot] = items.back();
+            m_Entries[items[entry.Slot].Owner].Slot = entry.Slot;
+        }
+        items.pop_back();
+    }
+
+    const Bounds2D& SpatialIndex::GetBounds(Entity entity) const
+    {
+        GG_CORE_ASSERT(Contains(entity), "Entity is not in the spatial index");
+        const Entry& entry = m_Entries[entity];
+        return (*entry.Items)[entry.Slot].Bounds;
+    }
+
+    void SpatialIndex::Clear()
+    {
+        m_Entries.clear();
+        m_Cells.clear();
+        m_Oversized.clear();
+        m_Count = 0;
+    }
+
+    void SpatialIndex::QueryAABB(const Bounds2D& area, std::vector<Entity>& out) const
+    {
+        QueryAABB(area, [&](Entity entity, const Bounds2D&) { out.push_back(entity); });
+    }
+
+    void SpatialIndex::QueryPoint(float x, float y, std::vector<Entity>& out) const
+    {
+        QueryAABB(Bounds2D{ x, y, x, y }, out);
+    }
+
+    void SpatialIndex::QueryRadius(float x, float y, float radius, std::vector<Entity>& out) const
+    {
+        if (!(radius >= 0.0f))
+            return;
+
+        const float radiusSquared = radius * radius;
+        QueryAABB(Bounds2D{ x - radius, y - radius, x + radius, y + radius },
+            [&](Entity entity, const Bounds2D& bounds)
+        {
+            if (DistanceSquared(bounds, x, y) <= radiusSquared)
+                out.push_back(entity);
+        });
+    }
+
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Entity.h"
+#include "GGEngine/Core/Core.h"
+#include "GGEngine/Renderer/ViewFrustum.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace GGEngine {
+
+    // =============================================================================
+    // SpatialIndex
+    // =============================================================================
+    // Loose uniform grid over entity bounds in the xy plane, for culling and
+    // picking without touching every entity.
+    //
+    // Each entity lives in the one cell containing the center of its bounds.
+    // Entities no larger than a cell (half extent <= cell size) reach at most one
+    // cell past their own, so a query only has to widen its cell range by one;
+    // larger ones go in a separate list that every query scans. Moving an entity
+    // is O(1): it only changes cells when its center crosses a cell edge.
+    //
+    // Queries are conservative on the grid but exact on the stored bounds:
+    // callbacks only see entities whose bounds touch the query.
+    //
+    // Not thread-safe; Scene updates it in OnUpdate, before systems read it (Scene::GetSpatialIndex).
+    //
+    class GG_API SpatialIndex
+    {
+    public:
+        static constexpr float DefaultCellSize = 8.0f;
+
+        explicit SpatialIndex(float cellSize = DefaultCellSize);
+
+        // Insert entity or move it to new bounds
+        void Update(Entity entity, const Bounds2D& bounds);
+
+        // Returns false if entity is not indexed
+        bool Remove(Entity entity);
+
+        bool Contains(Entity entity) const
+        {
+            return entity < m_Entries.size() && m_Entries[entity].Slot != InvalidSlot;
+        }
+
+        // Stored bounds of entity (must be Contains)
+        const Bounds2D& GetBounds(Entity entity) const;
+
+        void Clear();
+
+        size_t Size() const { return m_Count; }
+        float GetCellSize() const { return m_CellSize; }
+
+        // Remove every entity pred rejects, e.g. ones that lost their transform
+        template<typename Pred>
+        void RemoveUnless(Pred&& keep)
+        {
+            for (Entity entity = 0; entity < m_Entries.size(); entity++)
+            {
+                if (m_Entries[entity].Slot != InvalidSlot && !keep(entity))
+                    Remove(entity);
+            }
+        }
+
+        // Invoke fn(Entity, const Bounds2D&) for every entity whose bounds touch area.
+        // Order is unspecified. The index must not be modified from fn.
+        template<typename Fn>
+        void QueryAABB(const Bounds2D& area, Fn&& fn) const;
+
+        void QueryAABB(const Bounds2D& area, std::vector<Entity>& out) const;
+
+        // Entities whose bounds contain the point
+        void QueryPoint(float x, float y, std::vector<Entity>& out) const;
+
+        // Entities whose bounds touch the circle
+        void QueryRadius(float x, float y, float radius, std::vector<Entity>& out) const;
+
+    private:
+        static constexpr uint32_t InvalidSlot = ~0u;
+        static constexpr uint64_t OversizedCell = ~0ull;
+        // Cell coordinates beyond this go in the oversized list rather than overflow
+        static constexpr double MaxCellCoordinate = 1 << 30;
+
+        struct Item
+        {
+            Bounds2D Bounds;
+            Entity Owner;
+        };
+
+        struct Entry
+        {
+            uint64_t Cell = OversizedCell;
+            std::vector<Item>* Items = nullptr;   // The cell's (or the oversized) item list; map nodes don't move
+            uint32_t Slot = InvalidSlot;          // Index in Items
+        };
+
+        static uint64_t MakeCellKey(int32_t x, int32_t y)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(y)) << 32) | static_cast<uint32_t>(x);
+        }
+
+        uint64_t CellOf(const Bounds2D& bounds) const;
+        std::vector<Item>& ItemsOf(uint64_t cell);
+        void Unlink(Entity entity);
+
+        template<typename Fn>
+        static void VisitItems(const std::vector<Item>& items, const Bounds2D& area, Fn& fn)
+        {
+            for (const Item& item : items)
+            {
+                if (item.Bounds.Overlaps(area))
+                    fn(item.Owner, item.Bounds);
+            }
+        }
+
+        float m_CellSize;
+        float m_InvCellSize;
+        size_t m_Count = 0;
+
+        std::vector<Entry> m_Entries;   // Indexed by Entity
+        // Cells are kept when they empty out, so entities moving back and forth
+        // don't reallocate; Clear() releases them
+        std::unordered_map<uint64_t, std::vector<Item>> m_Cells;
+        std::vector<Item> m_Oversized;
+    };
+
+    template<typename Fn>
+    void SpatialIndex::QueryAABB(const Bounds2D& area, Fn&& fn) const
+    {
+        // Written to reject NaN as well as empty areas
+        if (!(area.MinX <= area.MaxX) || !(area.MinY <= area.MaxY) || m_Count == 0)
+            return;
+
+        VisitItems(m_Oversized, area, fn);
+        if (m_Cells.empty())
+            return;
+
+        // Cells whose members can reach the area: one ring past the cells it covers.
+        // Computed in double and clamped to the cell range in use so huge (or
+        // Infinite()) areas don't overflow.
+        auto toCell = [this](float coordinate, double ring) {
+            const double cell = std::floor(static_cast<double>(coordinate) * m_InvCellSize) + ring;
+            return std::min(std::max(cell, -MaxCellCoordinate), MaxCellCoordinate);
+        };
+        const double minX = toCell(area.MinX, -1.0);
+        const double minY = toCell(area.MinY, -1.0);
+        const double maxX = toCell(area.MaxX, 1.0);
+        const double maxY = toCell(area.MaxY, 1.0);
+
+        // Walking the occupied cells is cheaper than probing that many coordinates
+        const double rangeCells = (maxX - minX + 1.0) * (maxY - minY + 1.0);
+        if (rangeCells >= static_cast<double>(m_Cells.size()))
+        {
+            for (const auto& [key, items] : m_Cells)
+                VisitItems(items, area, fn);
+            return;
+        }
+
+        for (int32_t y = static_cast<int32_t>(minY); y <= static_cast<int32_t>(maxY); y++)
+        {
+            for (int32_t x = static_cast<int32_t>(minX); x <= static_cast<int32_t>(maxX); x++)
+            {
+                auto it = m_Cells.find(MakeCellKey(x, y));
+                if (it != m_Cells.end())
+                    VisitItems(it->second, area, fn);
+            }
+        }
+    }
+
+}
@@ -3,6 +3,7 @@
 #include "GGEngine/Core/Core.h"
 #include "GGEngine/Core/Timestep.h"
 
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <typeindex>
@@ -24,18 +25,41 @@ namespace GGEngine {
         Exclude     // Entities with this component are excluded from iteration
     };
 
+    // =============================================================================
+    // System Phases
+    // =============================================================================
+    // Every system of a phase finishes before any system of a later phase starts.
+    // Access conflicts only order systems within a phase.
+    //
+    enum class SystemPhase : uint8_t
+    {
+        PreUpdate,
+        Update,
+        PostUpdate,
+        Render
+    };
+
     // =============================================================================
     // Component Requirement
     // =============================================================================
     // Describes a system's requirement for a specific component type.
     //
+    // ViewFiltered is a promise about how the system iterates: it only visits
+    // entities that have this component, and only touches this component on
+    // the entities it visits. Exclude requirements always filter the view.
+    // Two systems whose views are disjoint (one excludes a component the
+    // other's view filters on) may then write the same component types at
+    // once, but only if every component type they share and either writes is
+    // ViewFiltered in both; otherwise shared writes serialize them as usual.
+    //
     struct ComponentRequirement
     {
         std::type_index Type;
         AccessMode Access;
+        bool ViewFiltered;
 
-        ComponentRequirement(std::type_index type, AccessMode access)
-            : Type(type), Access(access) {}
+        ComponentRequirement(std::type_index type, AccessMode access, bool viewFiltered = false)
+            : Type(type), Access(access), ViewFiltered(viewFiltered) {}
     };
 
     // Helper to create a requirement for a component type
@@ -45,6 +69,44 @@ namespace GGEngine {
         return ComponentRequirement(std::type_index(typeid(T)), access);
     }
 
+    // Helper for a requirement the system's view filters on (see ComponentRequirement)
+    template<typename T>
+    ComponentRequirement RequireInView(AccessMode access)
+    {
+        return ComponentRequirement(std::type_index(typeid(T)), access, true);
+    }
+
+    // =============================================================================
+    // System Ordering
+    // =============================================================================
+    // An explicit ordering constraint against another system type, for ordering
+    // that component access doesn't express. Constraints on systems that aren't
+    // registered, or in another phase, are ignored.
+    //
+    struct SystemOrdering
+    {
+        enum class Kind : uint8_t { Before, After };
+
+        std::type_index System;
+        Kind Order;
+
+        SystemOrdering(std::type_index system, Kind order)
+            : System(system), Order(order) {}
+    };
+
+    // Helpers to create ordering constraints against a system type
+    template<typename T>
+    SystemOrdering RunBefore()
+    {
+        return SystemOrdering(std::type_index(typeid(T)), SystemOrdering::Kind::Before);
+    }
+
+    template<typename T>
+    SystemOrdering RunAfter()
+    {
+        return SystemOrdering(std::type_index(typeid(T)), SystemOrdering::Kind::After);
+    }
+
     // =============================================================================
     // ISystem Interface
     // =============================================================================
@@ -83,23 +145,51 @@ namespace GGEngine {
         // Optional: System name for debugging/profiling
         virtual const char* GetName() const { return "UnnamedSystem"; }
 
+        // Optional: Phase this system runs in (queried when the graph is rebuilt)
+        virtual SystemPhase GetPhase() const { return SystemPhase::Update; }
+
+        // Optional: Explicit ordering against other systems in the same phase
+        virtual std::vector<SystemOrdering> GetOrdering() const { return {}; }
+
+        // Optional: Skip Execute on frames where no storage this system reads has
+        // changed since it last ran (see IComponentStorage::GetVersion). Only for
+        // systems whose work depends on nothing but their Read components, e.g.
+        // rebuilding a cache. Never skips in archetype scenes.
+        virtual bool SkipWhenUnchanged() const { return false; }
+
         // Optional: Whether this system supports parallel chunk execution
-        // If true, ExecuteChunk() will be called from multiple threads
+        // If true, ExecuteChunk() will be called from multiple threads instead of
+        // Execute(). Queried when the scheduler's graph is rebuilt.
         virtual bool SupportsParallelChunks() const { return false; }
 
         // Optional: Execute a subset of entities (for parallel chunked execution)
-        // Only called if SupportsParallelChunks() returns true
+        // Only called if SupportsParallelChunks() returns true. Indices are dense
+        // indices into the driving storage: the first Write requirement, or the
+        // first Read requirement if there is none. Execute() is called instead
+        // when that storage is empty or the scene uses archetype storage.
         virtual void ExecuteChunk(Scene& scene, float deltaTime,
                                   size_t startIndex, size_t count)
         {
             (void)scene; (void)deltaTime; (void)startIndex; (void)count;
         }
 
-        // Optional: Called once when system is first registered
+        // Optional: Per-scene setup. SystemScheduler calls it on the calling thread
+        // before the system first runs against a scene, with no other system
+        // running, so it may restructure storages (e.g. create groups) where
+        // Execute must not. Call it yourself when running a system directly.
         virtual void OnRegister(Scene& scene) { (void)scene; }
 
         // Optional: Called once when system is removed
         virtual void OnUnregister(Scene& scene) { (void)scene; }
+
+        // Change tick this system last ran at (0 before its first run). Pass it to
+        // Changed<T>/Added<T> view filters to process only what changed since.
+        // Includes the system's own writes when other systems ran concurrently.
+        uint32_t GetLastRunTick() const { return m_LastRunTick; }
+
+    private:
+        friend class SystemScheduler;
+        uint32_t m_LastRunTick = 0;
     };
 
 }
@@ -1,14 +1,28 @@
 #include "ggpch.h"
 #include "SystemScheduler.h"
 #include "Scene.h"
+#include "ChangeTick.h"
 #include "GGEngine/Core/TaskGraph.h"
 #include "GGEngine/Core/Profiler.h"
 
 #include <queue>
 #include <algorithm>
+#include <chrono>
 
 namespace GGEngine {
 
+    namespace {
+        // Chunk length ExecuteChunk aims for once a system's cost is known. Long
+        // enough that claiming and timing a chunk is noise, short enough to balance.
+        constexpr double TargetChunkNs = 50000.0;
+
+        // Chunk floor before the first measurement
+        constexpr size_t InitialChunkGrain = 256;
+
+        // Weight of the newest frame in the per-entity cost average
+        constexpr double ChunkCostSmoothing = 0.25;
+    }
+
     SystemScheduler::SystemScheduler() = default;
     SystemScheduler::~SystemScheduler() = default;
 
@@ -33,6 +47,32 @@ namespace GGEngine {
 
     bool SystemScheduler::HasConflict(const SystemNode& a, const SystemNode& b) const
     {
+        // If one system excludes a component the other's view filters on, their
+        // views never see the same entities. Writes to shared component types are
+        // then disjoint too, as long as both only touch those types inside their
+        // views (see ComponentRequirement).
+        bool disjointViews = false;
+        bool sharedWritesInViews = true;
+        for (const auto& reqA : a.Requirements)
+        {
+            for (const auto& reqB : b.Requirements)
+            {
+                if (reqA.Type != reqB.Type)
+                    continue;
+
+                const bool excludeA = reqA.Access == AccessMode::Exclude;
+                const bool excludeB = reqB.Access == AccessMode::Exclude;
+                if ((excludeA && !excludeB && reqB.ViewFiltered) || (excludeB && !excludeA && reqA.ViewFiltered))
+                    disjointViews = true;
+
+                const bool written = reqA.Access == AccessMode::Write || reqB.Access == AccessMode::Write;
+                if (!excludeA && !excludeB && written && !(reqA.ViewFiltered && reqB.ViewFiltered))
+                    sharedWritesInViews = false;
+            }
+        }
+        if (disjointViews && sharedWritesInViews)
+            return false;
+
         // Check all pairs of requirements
         for (const auto& reqA : a.Requirements)
         {
@@ -75,26 +115,203 @@ namespace GGEngine {
             node->Dependents.clear();
         }
 
-        // Build dependency graph based on access conflicts
-        // Systems that conflict must run sequentially
-        for (size_t i = 0; i < m_Systems.size(); ++i)
+        auto addEdge = [this](size_t from, size_t to) {
+            // to depends on from (from must complete before to starts)
+            m_Systems[to]->Dependencies.insert(from);
+            m_Systems[from]->Dependents.insert(to);
+        };
+
+        std::vector<std::vector<size_t>> constraints;
+        std::vector<size_t> priority = GetPriorityOrder(constraints);
+
+        // Build dependency graph based on access conflicts and explicit ordering.
+        // Systems that conflict must run sequentially, in priority order.
+        for (size_t p = 0; p < priority.size(); ++p)
         {
-            for (size_t j = i + 1; j < m_Systems.size(); ++j)
+            const size_t i = priority[p];
+            for (size_t q = p + 1; q < priority.size(); ++q)
             {
-                if (HasConflict(*m_Systems[i], *m_Systems[j]))
+                const size_t j = priority[q];
+                if (m_Systems[j]->Phase != m_Systems[i]->Phase)
+                    break;
+
+                const auto& before = constraints[i];
+                if (std::find(before.begin(), before.end(), j) != before.end() ||
+                    HasConflict(*m_Systems[i], *m_Systems[j]))
+                {
+                    addEdge(i, j);
+                }
+            }
+        }
+
+        // Phase barriers: the last systems of each phase gate the first systems of
+        // the next non-empty phase, which orders every pair across the two phases
+        std::vector<size_t> phaseSinks;
+        for (size_t begin = 0; begin < priority.size();)
+        {
+            size_t end = begin;
+            while (end < priority.size() && m_Systems[priority[end]]->Phase == m_Systems[priority[begin]]->Phase)
+                ++end;
+
+            std::vector<size_t> sinks;
+            for (size_t p = begin; p < end; ++p)
+            {
+                const size_t i = priority[p];
+                if (m_Systems[i]->Dependencies.empty())
                 {
-                    // j depends on i (i must complete before j starts)
-                    m_Systems[j]->Dependencies.insert(i);
-                    m_Systems[i]->Dependents.insert(j);
+                    for (size_t sink : phaseSinks)
+                        addEdge(sink, i);
                 }
+                if (m_Systems[i]->Dependents.empty())
+                    sinks.push_back(i);
             }
+
+            phaseSinks = std::move(sinks);
+            begin = end;
         }
 
+        CompilePlan();
         m_DirtyGraph = false;
 
         GG_CORE_TRACE("Rebuilt system dependency graph with {} systems", m_Systems.size());
     }
 
+    void SystemScheduler::CompilePlan()
+    {
+        const size_t count = m_Systems.size();
+        ExecutionPlan& plan = m_Plan;
+
+        // Edges only point forward in the priority order, so this is acyclic
+        auto order = GetExecutionOrder();
+        plan.Order.assign(order.begin(), order.end());
+
+        plan.Roots.clear();
+        plan.DependencyCounts.assign(count, 0);
+        plan.DependentOffsets.assign(count + 1, 0);
+        plan.Dependents.clear();
+        plan.ChunkDrivers.assign(count, -1);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const SystemNode& node = *m_Systems[i];
+            plan.DependencyCounts[i] = static_cast<uint32_t>(node.Dependencies.size());
+            if (node.Dependencies.empty())
+                plan.Roots.push_back(static_cast<uint32_t>(i));
+
+            plan.DependentOffsets[i] = static_cast<uint32_t>(plan.Dependents.size());
+            for (size_t dependent : node.Dependents)
+                plan.Dependents.push_back(static_cast<uint32_t>(dependent));
+
+            // Chunked systems iterate the storage they write, else the one they read
+            if (node.System->SupportsParallelChunks())
+            {
+                for (AccessMode mode : { AccessMode::Write, AccessMode::Read })
+                {
+                    auto it = std::find_if(node.Requirements.begin(), node.Requirements.end(),
+                        [mode](const ComponentRequirement& req) { return req.Access == mode; });
+                    if (it != node.Requirements.end())
+                    {
+                        plan.ChunkDrivers[i] = static_cast<int32_t>(it - node.Requirements.begin());
+                        break;
+                    }
+                }
+            }
+        }
+        plan.DependentOffsets[count] = static_cast<uint32_t>(plan.Dependents.size());
+
+        plan.Remaining = std::make_unique<std::atomic<uint32_t>[]>(count);
+    }
+
+    std::vector<size_t> SystemScheduler::GetPriorityOrder(std::vector<std::vector<size_t>>& constraints) const
+    {
+        const size_t count = m_Systems.size();
+        constraints.assign(count, {});
+
+        // Resolve RunBefore/RunAfter into "i runs before j" within a phase
+        std::vector<size_t> inDegree(count, 0);
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (const auto& ordering : m_Systems[i]->Ordering)
+            {
+                auto it = m_TypeToIndex.find(ordering.System);
+                if (it == m_TypeToIndex.end() || it->second == i ||
+                    m_Systems[it->second]->Phase != m_Systems[i]->Phase)
+                    continue;
+
+                const bool before = ordering.Order == SystemOrdering::Kind::Before;
+                const size_t from = before ? i : it->second;
+                const size_t to = before ? it->second : i;
+                auto& edges = constraints[from];
+                if (std::find(edges.begin(), edges.end(), to) == edges.end())
+                {
+                    edges.push_back(to);
+                    ++inDegree[to];
+                }
+            }
+        }
+
+        // Kahn's algorithm, taking the earliest phase and then the earliest
+        // registration first, so unconstrained systems keep registration order
+        auto later = [this](size_t a, size_t b) {
+            if (m_Systems[a]->Phase != m_Systems[b]->Phase)
+                return m_Systems[a]->Phase > m_Systems[b]->Phase;
+            return a > b;
+        };
+        std::priority_queue<size_t, std::vector<size_t>, decltype(later)> ready(later);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (inDegree[i] == 0)
+                ready.push(i);
+        }
+
+        std::vector<size_t> order;
+        order.reserve(count);
+        while (!ready.empty())
+        {
+            size_t current = ready.top();
+            ready.pop();
+            order.push_back(current);
+
+            for (size_t next : constraints[current])
+            {
+                if (--inDegree[next] == 0)
+                    ready.push(next);
+            }
+        }
+
+        if (order.size() != count)
+        {
+            GG_CORE_ERROR("Cycle in system ordering constraints - ignoring them for {} systems",
+                          count - order.size());
+
+            // Append the rest by phase and registration; constraints pointing
+            // backwards in the final order are dropped
+            std::vector<bool> placed(count, false);
+            for (size_t i : order)
+                placed[i] = true;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!placed[i])
+                    order.push_back(i);
+            }
+            std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+                return m_Systems[a]->Phase < m_Systems[b]->Phase;
+            });
+
+            std::vector<size_t> rank(count);
+            for (size_t p = 0; p < count; ++p)
+                rank[order[p]] = p;
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto& edges = constraints[i];
+                edges.erase(std::remove_if(edges.begin(), edges.end(),
+                    [&](size_t j) { return rank[j] < rank[i]; }), edges.end());
+            }
+        }
+
+        return order;
+    }
+
     std::vector<size_t> SystemScheduler::GetExecutionOrder() const
     {
         // Kahn's algorithm for topological sort
@@ -145,56 +362,174 @@ namespace GGEngine {
         if (m_Systems.empty())
             return;
 
+        auto& taskGraph = TaskGraph::Get();
+        if (!taskGraph.IsInitialized())
+        {
+            ExecuteSequential(scene, deltaTime);
+            return;
+        }
+
         GG_PROFILE_FUNCTION();
 
-        // Rebuild graph if dirty
+        // Rebuild graph and plan if dirty
         RebuildDependencyGraph();
+        RegisterWithScene(scene);
+
+        // Re-arm the plan for this frame
+        const size_t count = m_Systems.size();
+        for (size_t i = 0; i < count; ++i)
+            m_Plan.Remaining[i].store(m_Plan.DependencyCounts[i], std::memory_order_relaxed);
+        m_FrameOutstanding.store(static_cast<uint32_t>(count), std::memory_order_relaxed);
+        m_FrameScene = &scene;
+        m_FrameDeltaTime = deltaTime;
+        m_FrameDone = taskGraph.CreateEvent("SystemScheduler::Frame");
+
+        // Dispatching publishes the state above to the workers
+        for (uint32_t root : m_Plan.Roots)
+            DispatchSystem(root);
+
+        // Wait for all systems to complete (the main thread runs system tasks meanwhile)
+        taskGraph.Wait(m_FrameDone);
+        taskGraph.Release(m_FrameDone);
+        m_FrameDone = TaskID{};
+        m_FrameScene = nullptr;
+    }
 
+    void SystemScheduler::DispatchSystem(uint32_t index)
+    {
+        // Fire and forget - completion is tracked by the plan's counters
         auto& taskGraph = TaskGraph::Get();
+        TaskID task = taskGraph.CreateTask(m_Systems[index]->System->GetName(), [this, index]() -> TaskResult {
+            RunSystem(index);
+            return TaskResult::Success();
+        });
+        taskGraph.Release(task);
+    }
 
-        // Track TaskIDs for each system
-        std::vector<TaskID> systemTasks(m_Systems.size());
+    void SystemScheduler::RunSystem(uint32_t index)
+    {
+        RunSystemBody(*m_Systems[index], *m_FrameScene, m_FrameDeltaTime, m_Plan.ChunkDrivers[index]);
 
-        // Get topological order
-        auto order = GetExecutionOrder();
+        // acq_rel: whoever releases a dependent has seen every write of its dependencies
+        for (uint32_t i = m_Plan.DependentOffsets[index]; i < m_Plan.DependentOffsets[index + 1]; ++i)
+        {
+            const uint32_t dependent = m_Plan.Dependents[i];
+            if (m_Plan.Remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                DispatchSystem(dependent);
+        }
+
+        if (m_FrameOutstanding.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            TaskGraph::Get().Signal(m_FrameDone);
+    }
 
-        // Create tasks in dependency order
-        for (size_t idx : order)
+    void SystemScheduler::RegisterWithScene(Scene& scene)
+    {
+        // Runs on the calling thread with no system in flight, so OnRegister
+        // may restructure storages (e.g. create groups)
+        for (auto& node : m_Systems)
         {
-            auto& node = m_Systems[idx];
+            if (node->RegisteredScene == &scene)
+                continue;
+            node->System->OnRegister(scene);
+            node->RegisteredScene = &scene;
+        }
+    }
 
-            // Collect dependency TaskIDs
-            std::vector<TaskID> deps;
-            for (size_t depIdx : node->Dependencies)
+    bool SystemScheduler::IsUnchanged(SystemNode& node, const Scene& scene) const
+    {
+        if (!node.SkipWhenUnchanged || scene.GetStorageMode() != SceneStorageMode::SparseSet)
+            return false;
+
+        // Compare every read storage, and remember the versions this run will see
+        bool unchanged = node.HasRun;
+        for (size_t r = 0; r < node.Requirements.size(); ++r)
+        {
+            if (node.Requirements[r].Access != AccessMode::Read)
+                continue;
+
+            const uint64_t version = scene.GetComponentVersion(node.Requirements[r].Type);
+            if (version != node.SeenVersions[r])
             {
-                if (systemTasks[depIdx].IsValid())
-                {
-                    deps.push_back(systemTasks[depIdx]);
-                }
+                node.SeenVersions[r] = version;
+                unchanged = false;
             }
+        }
+        return unchanged;
+    }
+
+    void SystemScheduler::RunSystemBody(SystemNode& node, Scene& scene, float deltaTime, int32_t chunkDriver)
+    {
+        if (IsUnchanged(node, scene))
+            return;
+        node.HasRun = true;
+
+        // Rows this run stamps are newer than the system's previous run
+        const uint32_t tick = ChangeTicks::Advance();
+
+        ISystem* system = node.System.get();
+        try
+        {
+            GG_PROFILE_SCOPE(system->GetName());
 
-            // Create task for this system
-            ISystem* systemPtr = node->System.get();
+            const size_t count = chunkDriver >= 0
+                ? scene.GetComponentCount(node.Requirements[chunkDriver].Type)
+                : 0;
 
-            systemTasks[idx] = taskGraph.CreateTask(
-                std::string("System:") + systemPtr->GetName(),
-                [systemPtr, &scene, deltaTime]() -> TaskResult {
-                    GG_PROFILE_SCOPE(systemPtr->GetName());
-                    systemPtr->Execute(scene, deltaTime);
-                    return TaskResult::Success();
-                },
-                deps
-            );
+            if (count > 0)
+                RunChunked(node, scene, deltaTime, count);
+            else
+                system->Execute(scene, deltaTime);
+        }
+        catch (const std::exception& e)
+        {
+            // Dependents still run, or the frame would never finish
+            GG_CORE_ERROR("System {} threw: {}", system->GetName(), e.what());
         }
 
-        // Wait for all systems to complete
-        for (size_t i = 0; i < m_Systems.size(); ++i)
+        // Declared writes count as changes, so readers that skip see them
+        for (const auto& req : node.Requirements)
         {
-            if (systemTasks[i].IsValid())
+            if (req.Access == AccessMode::Write)
+                scene.MarkComponentChanged(req.Type);
+        }
+
+        // Anything stamped from here on, even outside a system, is newer than this run
+        system->m_LastRunTick = tick;
+        ChangeTicks::Advance();
+    }
+
+    void SystemScheduler::RunChunked(SystemNode& node, Scene& scene, float deltaTime, size_t count)
+    {
+        ISystem* system = node.System.get();
+
+        size_t minGrain = InitialChunkGrain;
+        if (node.ChunkCostNs > 0.0)
+            minGrain = static_cast<size_t>(std::clamp(TargetChunkNs / node.ChunkCostNs, 1.0, static_cast<double>(count)));
+
+        std::atomic<uint64_t> elapsedNs{0};
+        std::atomic<bool> failed{false};
+
+        // Returns once every chunk has run, so dependents see all of them
+        TaskGraph::Get().ParallelFor(0, count, minGrain, [&](size_t begin, size_t end) {
+            auto start = std::chrono::steady_clock::now();
+            try
             {
-                taskGraph.Wait(systemTasks[i]);
+                system->ExecuteChunk(scene, deltaTime, begin, end - begin);
             }
-        }
+            catch (const std::exception& e)
+            {
+                if (!failed.exchange(true))
+                    GG_CORE_ERROR("System {} threw: {}", system->GetName(), e.what());
+            }
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            elapsedNs.fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+        });
+
+        // Only this system's task writes its cost, and frames don't overlap
+        const double sample = static_cast<double>(elapsedNs.load(std::memory_order_relaxed)) / static_cast<double>(count);
+        node.ChunkCostNs = node.ChunkCostNs > 0.0
+            ? node.ChunkCostNs + (sample - node.ChunkCostNs) * ChunkCostSmoothing
+            : sample;
     }
 
     void SystemScheduler::ExecuteSequential(Scene& scene, float deltaTime)
@@ -204,19 +539,13 @@ namespace GGEngine {
 
         GG_PROFILE_FUNCTION();
 
-        // Rebuild graph if dirty (for consistency)
+        // Rebuild graph and plan if dirty (for consistency)
         RebuildDependencyGraph();
+        RegisterWithScene(scene);
 
-        // Get topological order
-        auto order = GetExecutionOrder();
-
-        // Execute each system in order
-        for (size_t idx : order)
-        {
-            auto& node = m_Systems[idx];
-            GG_PROFILE_SCOPE(node->System->GetName());
-            node->System->Execute(scene, deltaTime);
-        }
+        // Execute each system in topological order, unchunked
+        for (uint32_t idx : m_Plan.Order)
+            RunSystemBody(*m_Systems[idx], scene, deltaTime, -1);
     }
 
 }
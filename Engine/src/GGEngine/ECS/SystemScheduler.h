@@ -2,7 +2,10 @@
 
 #include "System.h"
 #include "GGEngine/Core/Core.h"
+#include "GGEngine/Core/TaskGraph.h"
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <typeindex>
@@ -12,7 +15,6 @@
 namespace GGEngine {
 
     class Scene;
-    class TaskGraph;
 
     // =============================================================================
     // SystemScheduler
@@ -20,8 +22,12 @@ namespace GGEngine {
     // Manages system registration and parallel execution based on component access.
     //
     // Systems are analyzed at registration time to build a dependency graph:
-    // - Systems that only READ the same components can run in parallel
-    // - Systems that WRITE to a component block other readers/writers of that type
+    // - Systems run in phase order (PreUpdate, Update, PostUpdate, Render)
+    // - Within a phase, systems that only READ the same components can run in parallel
+    // - Systems that WRITE to a component block other readers/writers of that type,
+    //   unless one excludes a component the other requires (disjoint entities)
+    // - RunBefore<T>/RunAfter<T> constraints order systems explicitly; otherwise
+    //   conflicting systems run in registration order
     //
     // Example:
     //   SystemScheduler scheduler;
@@ -32,6 +38,16 @@ namespace GGEngine {
     //   // In game loop:
     //   scheduler.Execute(scene, deltaTime);  // Runs compatible systems in parallel
     //
+    // The graph is compiled into a flat execution plan whenever systems are added
+    // or removed. Each frame only re-arms one atomic counter per system: roots are
+    // dispatched as tasks, and the system that drops a dependent's counter to zero
+    // dispatches it. Steady-state frames don't allocate.
+    //
+    // Systems that opt into SupportsParallelChunks() are fanned out across the
+    // workers with ExecuteChunk() over their driving storage, and joined before
+    // any of their dependents start. Chunk size adapts to the per-entity cost
+    // measured on previous frames.
+    //
     class GG_API SystemScheduler
     {
     public:
@@ -85,25 +101,88 @@ namespace GGEngine {
             // Systems that depend on this one (blocked until this completes)
             std::unordered_set<size_t> Dependents;
 
+            // Measured ExecuteChunk cost per entity in ns (moving average, 0 = unknown)
+            double ChunkCostNs = 0.0;
+
+            SystemPhase Phase;
+            std::vector<SystemOrdering> Ordering;
+            bool SkipWhenUnchanged;
+
+            // Storage version per requirement when the system last ran (SkipWhenUnchanged only)
+            std::vector<uint64_t> SeenVersions;
+            bool HasRun = false;
+
+            // Scene OnRegister last ran for
+            const Scene* RegisteredScene = nullptr;
+
             SystemNode(std::unique_ptr<ISystem> sys, std::type_index type)
                 : System(std::move(sys))
                 , TypeIndex(type)
                 , Requirements(System->GetRequirements())
+                , Phase(System->GetPhase())
+                , Ordering(System->GetOrdering())
+                , SkipWhenUnchanged(System->SkipWhenUnchanged())
+                , SeenVersions(Requirements.size(), 0)
             {}
         };
 
         // Check if two systems have conflicting access
         bool HasConflict(const SystemNode& a, const SystemNode& b) const;
 
-        // Rebuild dependency graph after adding/removing systems
+        // Rebuild dependency graph and execution plan after adding/removing systems
         void RebuildDependencyGraph();
 
         // Topological sort for execution order
         std::vector<size_t> GetExecutionOrder() const;
 
+        // Order in which conflicts are resolved: by phase, then RunBefore/RunAfter,
+        // then registration. Fills constraints[i] with the systems i must run before.
+        std::vector<size_t> GetPriorityOrder(std::vector<std::vector<size_t>>& constraints) const;
+
+        // Call OnRegister for systems that haven't seen this scene yet (before any system runs)
+        void RegisterWithScene(Scene& scene);
+
+        // Whether a SkipWhenUnchanged system can skip this frame; records the read versions it saw
+        bool IsUnchanged(SystemNode& node, const Scene& scene) const;
+
+        // Run a system (chunked if chunkDriver >= 0), then record the storages it wrote as changed
+        void RunSystemBody(SystemNode& node, Scene& scene, float deltaTime, int32_t chunkDriver);
+
+        // Flatten the dependency graph into m_Plan
+        void CompilePlan();
+
+        // Queue a system whose dependencies are all done this frame
+        void DispatchSystem(uint32_t index);
+
+        // Run a system, then release its dependents (and the frame, if it was last)
+        void RunSystem(uint32_t index);
+
+        // Split count entities into ExecuteChunk calls across the workers and join
+        void RunChunked(SystemNode& node, Scene& scene, float deltaTime, size_t count);
+
+        // Compiled form of the dependency graph, rebuilt only when it's dirty
+        struct ExecutionPlan
+        {
+            std::vector<uint32_t> Order;                // Topological order
+            std::vector<uint32_t> Roots;                // Systems with no dependencies
+            std::vector<uint32_t> DependencyCounts;     // Static in-degree per system
+            std::vector<uint32_t> DependentOffsets;     // Dependents of i: [Offsets[i], Offsets[i + 1])
+            std::vector<uint32_t> Dependents;
+            std::vector<int32_t> ChunkDrivers;          // Requirement sizing ExecuteChunk, or -1 to call Execute
+            std::unique_ptr<std::atomic<uint32_t>[]> Remaining;     // Unfinished dependencies, re-armed per frame
+        };
+
         std::vector<std::unique_ptr<SystemNode>> m_Systems;
         std::unordered_map<std::type_index, size_t> m_TypeToIndex;
         bool m_DirtyGraph = false;
+
+        ExecutionPlan m_Plan;
+
+        // Current frame (valid during Execute)
+        Scene* m_FrameScene = nullptr;
+        float m_FrameDeltaTime = 0.0f;
+        std::atomic<uint32_t> m_FrameOutstanding{0};   // Systems not yet finished
+        TaskID m_FrameDone;                             // Event signalled by the last system
     };
 
     // =========================================================================
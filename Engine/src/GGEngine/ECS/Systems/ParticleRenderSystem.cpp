@@ -0,0 +1,99 @@
+#include "ggpch.h"
+#include "ParticleRenderSystem.h"
+#include "GGEngine/ECS/Scene.h"
+#include "GGEngine/ECS/Components.h"
+#include "GGEngine/Renderer/InstancedRenderer2D.h"
+#include "GGEngine/Renderer/SceneCamera.h"
+#include "GGEngine/Core/Profiler.h"
+#include "GGEngine/Core/TaskGraph.h"
+
+namespace GGEngine {
+
+    namespace {
+
+        // Emitters per task when writing instances; small pools are cheap, and
+        // a large pool splits its own work (ParticleSystem::WriteInstances)
+        constexpr size_t MinEmittersPerTask = 16;
+
+    }
+
+    std::vector<ComponentRequirement> ParticleRenderSystem::GetRequirements() const
+    {
+        return {
+            Require<ParticleEmitterComponent>(AccessMode::Read)
+        };
+    }
+
+    void ParticleRenderSystem::Execute(Scene& scene, float deltaTime)
+    {
+        (void)deltaTime;  // Not used for rendering
+        GG_PROFILE_FUNCTION();
+
+        if (!m_RenderContext.IsValid())
+        {
+            GG_CORE_WARN("ParticleRenderSystem::Execute - Invalid render context");
+            return;
+        }
+
+        m_Pools.clear();
+        m_Offsets.clear();
+        uint32_t total = 0;
+        scene.Each<const ParticleEmitterComponent>([&](const ParticleEmitterComponent& emitter)
+        {
+            const uint32_t count = emitter.Particles.GetActiveCount();
+            if (count == 0)
+                return;
+            m_Pools.push_back(&emitter.Particles);
+            m_Offsets.push_back(total);
+            total += count;
+        });
+
+        if (total == 0)
+            return;
+
+        BeginInstancedScene();
+
+        QuadInstanceData* instances = InstancedRenderer2D::AllocateInstances(total);
+        if (instances)
+        {
+            const uint32_t whiteTextureIndex = InstancedRenderer2D::GetWhiteTextureIndex();
+            TaskGraph::Get().ParallelFor(0, m_Pools.size(), MinEmittersPerTask, [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; i++)
+                    m_Pools[i]->WriteInstances(instances + m_Offsets[i], whiteTextureIndex);
+            });
+        }
+        else
+        {
+            GG_CORE_WARN("ParticleRenderSystem::Execute - Failed to allocate {} instances", total);
+        }
+
+        InstancedRenderer2D::EndScene();
+    }
+
+    void ParticleRenderSystem::BeginInstancedScene()
+    {
+        if (m_RenderContext.UsesRuntimeCamera())
+        {
+            InstancedRenderer2D::BeginScene(
+                *m_RenderContext.RuntimeCamera,
+                *m_RenderContext.CameraTransform,
+                m_RenderContext.RenderPass,
+                m_RenderContext.CommandBuffer,
+                m_RenderContext.ViewportWidth,
+                m_RenderContext.ViewportHeight
+            );
+        }
+        else
+        {
+            InstancedRenderer2D::BeginScene(
+                *m_RenderContext.ExternalCamera,
+                m_RenderContext.RenderPass,
+                m_RenderContext.CommandBuffer,
+                m_RenderContext.ViewportWidth,
+                m_RenderContext.ViewportHeight
+            );
+        }
+    }
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "RenderSystem.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace GGEngine {
+
+    class ParticleSystem;
+
+    // =============================================================================
+    // ParticleRenderSystem
+    // =============================================================================
+    // Draws the live particles of every ParticleEmitterComponent with
+    // InstancedRenderer2D. All emitters share one instance allocation: each
+    // writes its particles at its own offset, emitters in parallel, so the
+    // whole scene's particles are a single instanced draw.
+    //
+    // Runs in SystemPhase::Render, after ParticleUpdateSystem. Particles are
+    // not culled on the CPU; the GPU clips them.
+    //
+    class GG_API ParticleRenderSystem : public IRenderSystem
+    {
+    public:
+        // ISystem interface
+        std::vector<ComponentRequirement> GetRequirements() const override;
+        void Execute(Scene& scene, float deltaTime) override;
+        const char* GetName() const override { return "ParticleRenderSystem"; }
+        SystemPhase GetPhase() const override { return SystemPhase::Render; }
+
+    private:
+        void BeginInstancedScene();
+
+        // Emitters with live particles and their first instance, reused across frames
+        std::vector<const ParticleSystem*> m_Pools;
+        std::vector<uint32_t> m_Offsets;
+    };
+
+}
@@ -0,0 +1,158 @@
+#include "ggpch.h"
+#include "ParticleUpdateSystem.h"
+#include "GGEngine/ECS/Scene.h"
+#include "GGEngine/ECS/Components.h"
+#include "GGEngine/Core/Math.h"
+#include "GGEngine/Core/Profiler.h"
+#include "GGEngine/Core/TaskGraph.h"
+#include "GGEngine/ParticleSystem/Random.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace GGEngine {
+
+    namespace {
+
+        // Particles the emitter owes for this frame's dt
+        uint32_t TakeSpawnCount(ParticleEmitterComponent& emitter, float deltaTime)
+        {
+            if (!emitter.Emitting)
+            {
+                emitter.SpawnAccumulator = 0.0f;
+                return 0;
+            }
+
+            emitter.SpawnAccumulator += std::max(emitter.Rate, 0.0f) * deltaTime;
+            const float owed = std::min(std::floor(emitter.SpawnAccumulator), static_cast<float>(emitter.MaxParticles));
+            emitter.SpawnAccumulator -= owed;
+            uint64_t count = static_cast<uint64_t>(owed);
+
+            if (emitter.BurstCount > 0)
+            {
+                emitter.BurstTimer -= deltaTime;
+                if (emitter.BurstTimer <= 0.0f)
+                {
+                    // Catch up on every burst a long frame skipped over
+                    uint64_t bursts = 1;
+                    if (emitter.BurstInterval > 0.0f)
+                    {
+                        bursts += static_cast<uint64_t>(-emitter.BurstTimer / emitter.BurstInterval);
+                        emitter.BurstTimer += static_cast<float>(bursts) * emitter.BurstInterval;
+                    }
+                    else
+                    {
+                        emitter.BurstTimer = 0.0f;
+                    }
+                    count += std::min<uint64_t>(bursts, emitter.MaxParticles) * emitter.BurstCount;
+                }
+            }
+
+            // Spawning more than the pool holds would only overwrite itself
+            return static_cast<uint32_t>(std::min<uint64_t>(count, emitter.MaxParticles));
+        }
+
+        void UpdateEmitter(ParticleEmitterComponent& emitter, Entity entity, const TransformComponent* transform,
+                           float deltaTime)
+        {
+            // Pools are created on whichever worker gets the emitter, so seed them
+            // from the entity rather than from creation order
+            if (emitter.Particles.GetMaxParticles() != emitter.MaxParticles)
+                emitter.Particles = ParticleSystem(emitter.MaxParticles, Random::GetStreamSeed(entity));
+
+            // Age first, so this frame's particles start with their full lifetime
+            emitter.Particles.OnUpdate(deltaTime);
+
+            const uint32_t count = TakeSpawnCount(emitter, deltaTime);
+            if (count == 0)
+                return;
+
+            ParticleSpawnParams params;
+            float rotation = 0.0f;
+            if (transform)
+            {
+                params.Position[0] = transform->Position[0];
+                params.Position[1] = transform->Position[1];
+                rotation = transform->Rotation;
+            }
+            params.Direction = Math::ToRadians(emitter.Direction + rotation);
+            params.Spread = Math::ToRadians(emitter.ConeAngle);
+            params.Speed = emitter.Speed;
+            params.SpeedVariation = emitter.SpeedVariation;
+            params.LifeTime = emitter.LifeTime;
+            params.LifeTimeVariation = emitter.LifeTimeVariation;
+            std::copy(emitter.ColorBegin, emitter.ColorBegin + 4, params.ColorBegin);
+            std::copy(emitter.ColorEnd, emitter.ColorEnd + 4, params.ColorEnd);
+            params.SizeBegin = emitter.SizeBegin;
+            params.SizeEnd = emitter.SizeEnd;
+            params.SizeVariation = emitter.SizeVariation;
+
+            emitter.Particles.Spawn(params, count);
+        }
+
+    }
+
+    std::vector<ComponentRequirement> ParticleUpdateSystem::GetRequirements() const
+    {
+        return {
+            Require<ParticleEmitterComponent>(AccessMode::Write),
+            Require<TransformComponent>(AccessMode::Read)
+        };
+    }
+
+    void ParticleUpdateSystem::Execute(Scene& scene, float deltaTime)
+    {
+        GG_PROFILE_FUNCTION();
+
+        if (scene.GetStorageMode() == SceneStorageMode::Archetype)
+        {
+            // Every emitter, transform or not, as on sparse-set scenes. The
+            // scheduler only chunks sparse storages, so split the chunks here.
+            struct EmitterChunk
+            {
+                const Entity* Entities;
+                ParticleEmitterComponent* Emitters;
+                size_t Count;
+            };
+            std::vector<EmitterChunk> chunks;
+            const ArchetypeStorage& archetypes = scene.GetArchetypes();
+            archetypes.EachChunk<ParticleEmitterComponent>(
+                [&](size_t count, const Entity* entities, ParticleEmitterComponent* emitters)
+            {
+                chunks.push_back({ entities, emitters, count });
+            });
+
+            TaskGraph::Get().ParallelFor(0, chunks.size(), 1, [&](size_t first, size_t last)
+            {
+                for (size_t c = first; c < last; c++)
+                {
+                    const EmitterChunk& chunk = chunks[c];
+                    for (size_t row = 0; row < chunk.Count; row++)
+                    {
+                        const Entity entity = chunk.Entities[row];
+                        UpdateEmitter(chunk.Emitters[row], entity, archetypes.Get<TransformComponent>(entity), deltaTime);
+                    }
+                }
+            });
+            return;
+        }
+
+        ExecuteChunk(scene, deltaTime, 0, scene.GetStorage<ParticleEmitterComponent>().Size());
+    }
+
+    void ParticleUpdateSystem::ExecuteChunk(Scene& scene, float deltaTime, size_t startIndex, size_t count)
+    {
+        auto& emitters = scene.GetStorage<ParticleEmitterComponent>();
+        const auto& transforms = std::as_const(scene).GetStorage<TransformComponent>();
+
+        ParticleEmitterComponent* data = emitters.Data();
+        for (size_t i = startIndex; i < startIndex + count; i++)
+        {
+            const Entity entity = emitters.GetEntity(i);
+            UpdateEmitter(data[i], entity, transforms.Get(entity), deltaTime);
+        }
+    }
+
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "GGEngine/ECS/System.h"
+
+namespace GGEngine {
+
+    // =============================================================================
+    // ParticleUpdateSystem
+    // =============================================================================
+    // Simulates every ParticleEmitterComponent: ages its live particles, then
+    // spawns what Rate and BurstCount owe this frame in one ParticleSystem::Spawn
+    // call at the entity's TransformComponent (the origin if it has none).
+    //
+    // Emitters are independent, so on sparse-set scenes the scheduler splits
+    // them across workers (SupportsParallelChunks); archetype scenes split
+    // their emitter chunks across workers in Execute. A large pool is further
+    // split by ParticleSystem::OnUpdate itself.
+    //
+    class GG_API ParticleUpdateSystem : public ISystem
+    {
+    public:
+        // ISystem interface
+        std::vector<ComponentRequirement> GetRequirements() const override;
+        void Execute(Scene& scene, float deltaTime) override;
+        const char* GetName() const override { return "ParticleUpdateSystem"; }
+
+        bool SupportsParallelChunks() const override { return true; }
+        void ExecuteChunk(Scene& scene, float deltaTime, size_t startIndex, size_t count) override;
+    };
+
+}
@@ -2,7 +2,9 @@
 
 #include "GGEngine/ECS/System.h"
 #include "GGEngine/RHI/RHITypes.h"
+#include "GGEngine/Renderer/ViewFrustum.h"
 #include <glm/glm.hpp>
+#include <cmath>
 
 namespace GGEngine {
 
@@ -78,8 +80,45 @@ namespace GGEngine {
         void SetRenderContext(const RenderContext& context) { m_RenderContext = context; }
         const RenderContext& GetRenderContext() const { return m_RenderContext; }
 
+        // CPU culling against the context's camera (on by default)
+        void SetCullingEnabled(bool enabled) { m_CullingEnabled = enabled; }
+        bool IsCullingEnabled() const { return m_CullingEnabled; }
+
     protected:
+        // Frustum of the context's camera; accepts everything when culling is off
+        ViewFrustum GetViewFrustum() const
+        {
+            if (!m_CullingEnabled)
+                return ViewFrustum();
+            return GetCameraFrustum();
+        }
+
+        // Screen pixels per world unit for a view looking straight down z (an
+        // orthographic 2D camera); 0 if it varies with depth or is unknown.
+        // Used to report texture usage for streaming (see TextureStreamer).
+        float GetPixelsPerWorldUnit() const
+        {
+            Bounds2D bounds;
+            if (!GetCameraFrustum().GetDepthIndependentBounds(bounds))
+                return 0.0f;
+            const float height = bounds.MaxY - bounds.MinY;
+            if (!(height > 0.0f) || !std::isfinite(height))
+                return 0.0f;
+            return static_cast<float>(m_RenderContext.ViewportHeight) / height;
+        }
+
         RenderContext m_RenderContext;
+        bool m_CullingEnabled = true;
+
+    private:
+        ViewFrustum GetCameraFrustum() const
+        {
+            if (m_RenderContext.UsesRuntimeCamera())
+                return ViewFrustum::FromCamera(*m_RenderContext.RuntimeCamera, *m_RenderContext.CameraTransform);
+            if (m_RenderContext.ExternalCamera)
+                return ViewFrustum::FromCamera(*m_RenderContext.ExternalCamera);
+            return ViewFrustum();
+        }
     };
 
 }
@@ -2,21 +2,291 @@
 #include "SpriteRenderSystem.h"
 #include "GGEngine/ECS/Scene.h"
 #include "GGEngine/ECS/Components.h"
+#include "GGEngine/ECS/ChangeTick.h"
 #include "GGEngine/Renderer/Renderer2D.h"
 #include "GGEngine/Renderer/InstancedRenderer2D.h"
+#include "GGEngine/Renderer/RetainedInstanceBuffer.h"
 #include "GGEngine/Renderer/SubTexture2D.h"
 #include "GGEngine/Renderer/SceneCamera.h"
 #include "GGEngine/Asset/TextureLibrary.h"
 #include "GGEngine/Core/Math.h"
+#include "GGEngine/Core/Profiler.h"
 #include "GGEngine/Core/TaskGraph.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <utility>
+
 namespace GGEngine {
 
+    namespace {
+
+        // Contiguous run of parallel transform/sprite rows feeding instances [FirstInstance, FirstInstance + Count)
+        struct SpriteSpan
+        {
+            const TransformComponent* Transforms;
+            const SpriteRendererComponent* Sprites;
+            size_t Count;
+            size_t FirstInstance;
+        };
+
+        // Sprites per culling block; blocks are the unit of parallel work and of output ordering
+        constexpr size_t CullBlockSize = 1024;
+
+        // Invoke fn(instance, transform, sprite) for instances [first, last), which may straddle spans
+        template<typename Fn>
+        void ForEachSprite(const std::vector<SpriteSpan>& spans, size_t first, size_t last, Fn&& fn)
+        {
+            auto span = std::upper_bound(spans.begin(), spans.end(), first,
+                [](size_t instance, const SpriteSpan& s) { return instance < s.FirstInstance; }) - 1;
+
+            for (size_t instance = first; instance < last; ++span)
+            {
+                const size_t row = instance - span->FirstInstance;
+                const size_t rowEnd = std::min(span->Count, last - span->FirstInstance);
+                for (size_t i = row; i < rowEnd; ++i, ++instance)
+                    fn(instance, span->Transforms[i], span->Sprites[i]);
+            }
+        }
+
+        // Spans over every archetype chunk with both components, in Scene::Each order
+        size_t GatherArchetypeSpans(Scene& scene, std::vector<SpriteSpan>& spans)
+        {
+            size_t spriteCount = 0;
+            scene.GetArchetypes().EachChunk<const TransformComponent, const SpriteRendererComponent>(
+                [&](size_t count, const Entity*, const TransformComponent* transforms, const SpriteRendererComponent* sprites)
+            {
+                spans.push_back({ transforms, sprites, count, spriteCount });
+                spriteCount += count;
+            });
+            return spriteCount;
+        }
+
+        bool IsSpriteVisible(const ViewFrustum& frustum, const TransformComponent& transform)
+        {
+            return frustum.IsQuadVisible(transform.Position[0], transform.Position[1], transform.Position[2],
+                                         transform.Scale[0], transform.Scale[1],
+                                         Math::ToRadians(transform.Rotation));
+        }
+
+        // Passed as pixelsPerUnit when draws should not be reported to TextureStreamer
+        constexpr float NoUsageReport = -1.0f;
+
+        // Tell a streamed texture how many of its texels cover each screen
+        // pixel along the sprite's more minified axis, i.e. which mip it needs
+        void ReportTextureUsage(Texture& texture, const TransformComponent& transform,
+                                const SpriteRendererComponent& sprite, float pixelsPerUnit)
+        {
+            if (!texture.IsStreamed() || pixelsPerUnit < 0.0f)
+                return;
+            if (pixelsPerUnit == 0.0f)
+            {
+                texture.ReportUsage(0.0f);  // Unknown scale: ask for full detail
+                return;
+            }
+
+            float texelsX = static_cast<float>(texture.GetWidth()) * sprite.TilingFactor;
+            float texelsY = static_cast<float>(texture.GetHeight()) * sprite.TilingFactor;
+            if (sprite.UseAtlas)
+            {
+                texelsX = sprite.AtlasSpriteWidth * sprite.AtlasCellWidth;
+                texelsY = sprite.AtlasSpriteHeight * sprite.AtlasCellHeight;
+            }
+            const float pixelsX = std::abs(transform.Scale[0]) * pixelsPerUnit;
+            const float pixelsY = std::abs(transform.Scale[1]) * pixelsPerUnit;
+            texture.ReportUsage(std::max(texelsX / pixelsX, texelsY / pixelsY));
+        }
+
+        void BuildSpriteQuad(const TransformComponent& transform, const SpriteRendererComponent& sprite,
+                             TextureLibrary& textureLib, float pixelsPerUnit, QuadSpec& spec, float (&texCoords)[4][2])
+        {
+            float rotationRadians = Math::ToRadians(transform.Rotation);
+
+            // Resolve texture from library
+            Texture* texture = nullptr;
+            if (!sprite.TextureName.empty())
+            {
+                texture = textureLib.GetTexturePtr(sprite.TextureName);
+            }
+
+            // Build QuadSpec for this sprite
+            spec = QuadSpec();
+            spec.x = transform.Position[0];
+            spec.y = transform.Position[1];
+            spec.z = transform.Position[2];
+            spec.width = transform.Scale[0];
+            spec.height = transform.Scale[1];
+            spec.rotation = rotationRadians;
+            spec.color[0] = sprite.Color[0];
+            spec.color[1] = sprite.Color[1];
+            spec.color[2] = sprite.Color[2];
+            spec.color[3] = sprite.Color[3];
+
+            if (texture)
+            {
+                spec.texture = texture;
+                ReportTextureUsage(*texture, transform, sprite, pixelsPerUnit);
+
+                if (sprite.UseAtlas)
+                {
+                    // Spritesheet/Atlas rendering - UVs live next to the spec
+                    SubTexture2D::CalculateGridUVs(
+                        texture,
+                        sprite.AtlasCellX, sprite.AtlasCellY,
+                        sprite.AtlasCellWidth, sprite.AtlasCellHeight,
+                        sprite.AtlasSpriteWidth, sprite.AtlasSpriteHeight,
+                        texCoords
+                    );
+                    spec.texCoords = texCoords;
+                }
+                else
+                {
+                    spec.tilingFactor = sprite.TilingFactor;
+                }
+            }
+        }
+
+        // Turns one culling block's sprites into quads in its submit context,
+        // handing them over in groups so vertices are generated four at a time
+        class SpriteQuadWriter
+        {
+        public:
+            SpriteQuadWriter(QuadSubmitContext& context, TextureLibrary& textureLib, float pixelsPerUnit)
+                : m_Context(context), m_TextureLib(textureLib), m_PixelsPerUnit(pixelsPerUnit)
+            {
+            }
+
+            ~SpriteQuadWriter() { Flush(); }
+
+            void Add(const TransformComponent& transform, const SpriteRendererComponent& sprite)
+            {
+                if (m_Count == Capacity)
+                    Flush();
+                BuildSpriteQuad(transform, sprite, m_TextureLib, m_PixelsPerUnit, m_Specs[m_Count], m_TexCoords[m_Count]);
+                m_Count++;
+            }
+
+        private:
+            static constexpr size_t Capacity = 64;
+
+            void Flush()
+            {
+                m_Context.DrawQuads(m_Specs, m_Count);
+                m_Count = 0;
+            }
+
+            QuadSubmitContext& m_Context;
+            TextureLibrary& m_TextureLib;
+            float m_PixelsPerUnit;
+            QuadSpec m_Specs[Capacity];
+            float m_TexCoords[Capacity][4][2];
+            size_t m_Count = 0;
+        };
+
+        // Run fill(block, writer) -> culled sprite count for blocks [0, blockCount)
+        // in parallel, each into its own submit context. Contexts merge in block
+        // order, so sprites draw in the same order as a serial walk.
+        template<typename Fill>
+        void SubmitSpriteBlocks(size_t blockCount, TextureLibrary& textureLib, float pixelsPerUnit,
+                                uint32_t& visible, uint32_t& culled, Fill&& fill)
+        {
+            std::atomic<uint32_t> culledCount{ 0 };
+            Renderer2D::BeginParallelSubmit(static_cast<uint32_t>(blockCount));
+
+            TaskGraph::Get().ParallelFor(0, blockCount, 1, [&](size_t firstBlock, size_t lastBlock)
+            {
+                uint32_t blockCulled = 0;
+                for (size_t block = firstBlock; block < lastBlock; block++)
+                {
+                    SpriteQuadWriter writer(Renderer2D::GetSubmitContext(static_cast<uint32_t>(block)), textureLib, pixelsPerUnit);
+                    blockCulled += fill(block, writer);
+                }
+                culledCount.fetch_add(blockCulled, std::memory_order_relaxed);
+            });
+
+            for (size_t block = 0; block < blockCount; block++)
+                visible += Renderer2D::GetSubmitContext(static_cast<uint32_t>(block)).GetQuadCount();
+            culled += culledCount.load(std::memory_order_relaxed);
+
+            Renderer2D::EndParallelSubmit();
+        }
+
+        void WriteInstance(QuadInstanceData& inst, const TransformComponent& transform,
+                           const SpriteRendererComponent& sprite, TextureLibrary& textureLib, uint32_t whiteTexIndex,
+                           float pixelsPerUnit)
+        {
+            // Set transform (position, rotation, scale)
+            inst.SetTransform(
+                transform.Position[0],
+                transform.Position[1],
+                transform.Position[2],
+                Math::ToRadians(transform.Rotation),
+                transform.Scale[0],
+                transform.Scale[1]
+            );
+
+            // Set color
+            inst.SetColor(
+                sprite.Color[0],
+                sprite.Color[1],
+                sprite.Color[2],
+                sprite.Color[3]
+            );
+
+            // Resolve texture and UVs
+            uint32_t texIndex = whiteTexIndex;
+            float minU = 0.0f, minV = 0.0f, maxU = 1.0f, maxV = 1.0f;
+            float tiling = sprite.TilingFactor;
+
+            if (!sprite.TextureName.empty())
+            {
+                Texture* texture = textureLib.GetTexturePtr(sprite.TextureName);
+                if (texture)
+                {
+                    texIndex = texture->GetBindlessIndex();
+                    ReportTextureUsage(*texture, transform, sprite, pixelsPerUnit);
+
+                    if (sprite.UseAtlas && texture->GetWidth() > 0 && texture->GetHeight() > 0)
+                    {
+                        // Calculate atlas UVs
+                        float texWidth = static_cast<float>(texture->GetWidth());
+                        float texHeight = static_cast<float>(texture->GetHeight());
+
+                        minU = (sprite.AtlasCellX * sprite.AtlasCellWidth) / texWidth;
+                        minV = (sprite.AtlasCellY * sprite.AtlasCellHeight) / texHeight;
+                        maxU = minU + (sprite.AtlasSpriteWidth * sprite.AtlasCellWidth) / texWidth;
+                        maxV = minV + (sprite.AtlasSpriteHeight * sprite.AtlasCellHeight) / texHeight;
+                    }
+                }
+            }
+
+            inst.SetTexCoords(minU, minV, maxU, maxV, texIndex, tiling);
+        }
+
+    }
+
     SpriteRenderSystem::SpriteRenderSystem(RenderMode mode)
         : m_RenderMode(mode)
     {
     }
 
+    void SpriteRenderSystem::SetRenderMode(RenderMode mode)
+    {
+        // InstancedRenderer2D keeps drawing retained instances until they are cleared
+        if (m_RenderMode == RenderMode::Retained && mode != RenderMode::Retained)
+            ResetRetained();
+        m_RenderMode = mode;
+    }
+
+    void SpriteRenderSystem::OnRegister(Scene& scene)
+    {
+        // Creating the group re-packs both storages, so it happens here rather
+        // than in Execute, which only reads them
+        if (scene.GetStorageMode() == SceneStorageMode::SparseSet)
+            scene.Group<TransformComponent, SpriteRendererComponent>();
+    }
+
     std::vector<ComponentRequirement> SpriteRenderSystem::GetRequirements() const
     {
         return {
@@ -35,16 +305,58 @@ namespace GGEngine {
             return;
         }
 
-        if (m_RenderMode == RenderMode::Batched)
+        // Instanced and Retained read sparse-set scenes through the group OnRegister creates
+        const bool hasGroup = scene.GetStorageMode() == SceneStorageMode::Archetype ||
+                              scene.FindGroup<TransformComponent, SpriteRendererComponent>() != nullptr;
+        if (m_RenderMode != RenderMode::Batched && !hasGroup)
+        {
+            if (!m_WarnedMissingGroup)
+            {
+                GG_CORE_WARN("SpriteRenderSystem::Execute - OnRegister was not called for this scene; rendering batched");
+                m_WarnedMissingGroup = true;
+            }
+            ResetRetained();
+            RenderBatched(scene);
+        }
+        else if (m_RenderMode == RenderMode::Batched)
         {
             RenderBatched(scene);
         }
+        else if (m_RenderMode == RenderMode::Retained)
+        {
+            RenderRetained(scene);
+        }
         else
         {
             RenderInstanced(scene);
         }
     }
 
+    void SpriteRenderSystem::BeginInstancedScene()
+    {
+        if (m_RenderContext.UsesRuntimeCamera())
+        {
+            InstancedRenderer2D::BeginScene(
+                *m_RenderContext.RuntimeCamera,
+                *m_RenderContext.CameraTransform,
+                m_RenderContext.RenderPass,
+                m_RenderContext.CommandBuffer,
+                m_RenderContext.ViewportWidth,
+                m_RenderContext.ViewportHeight
+            );
+        }
+        else
+        {
+            InstancedRenderer2D::BeginScene(
+                *m_RenderContext.ExternalCamera,
+                m_RenderContext.RenderPass,
+                m_RenderContext.CommandBuffer,
+                m_RenderContext.ViewportWidth,
+                m_RenderContext.ViewportHeight
+            );
+        }
+    }
+
     void SpriteRenderSystem::RenderBatched(Scene& scene)
     {
         // Begin scene with appropriate camera
@@ -74,107 +386,183 @@ namespace GGEngine {
 
         // Render sprites
         auto& textureLib = TextureLibrary::Get();
-        auto& sprites = scene.GetStorage<SpriteRendererComponent>();
-        auto& transforms = scene.GetStorage<TransformComponent>();
-
-        for (size_t i = 0; i < sprites.Size(); i++)
+        const ViewFrustum frustum = GetViewFrustum();
+        const float pixelsPerUnit = GetPixelsPerWorldUnit();
+        uint32_t visible = 0;
+        uint32_t culled = 0;
+
+        // A 2D camera sees the same rectangle at every depth, so the scene's
+        // spatial index can hand over just the sprites inside it
+        Bounds2D viewBounds;
+        if (IsCullingEnabled() && scene.GetStorageMode() == SceneStorageMode::SparseSet &&
+            scene.IsSpatialIndexCurrent() && frustum.GetDepthIndependentBounds(viewBounds))
         {
-            Entity entity = sprites.GetEntity(i);
+            const auto& spriteStorage = std::as_const(scene).GetStorage<SpriteRendererComponent>();
+            const auto& transformStorage = std::as_const(scene).GetStorage<TransformComponent>();
 
-            const TransformComponent* transform = transforms.Get(entity);
-            if (!transform) continue;
-
-            const SpriteRendererComponent& sprite = sprites.Data()[i];
+            // Sprite storage order is the order the full walk would draw in
+            m_Candidates.clear();
+            scene.GetSpatialIndex().QueryAABB(viewBounds, [&](Entity entity, const Bounds2D&)
+            {
+                const uint32_t slot = spriteStorage.IndexOf(entity);
+                if (slot != SparseIndex::InvalidSlot)
+                    m_Candidates.push_back(slot);
+            });
+            std::sort(m_Candidates.begin(), m_Candidates.end());
+
+            const size_t blockCount = (m_Candidates.size() + CullBlockSize - 1) / CullBlockSize;
+            SubmitSpriteBlocks(blockCount, textureLib, pixelsPerUnit, visible, culled, [&](size_t block, SpriteQuadWriter& writer)
+            {
+                const size_t first = block * CullBlockSize;
+                const size_t last = std::min(first + CullBlockSize, m_Candidates.size());
+                uint32_t blockCulled = 0;
+                for (size_t i = first; i < last; i++)
+                {
+                    const uint32_t slot = m_Candidates[i];
+                    const TransformComponent& transform = *transformStorage.Get(spriteStorage.GetEntity(slot));
 
-            float rotationRadians = Math::ToRadians(transform->Rotation);
+                    // The index only knows xy; the depth range still applies
+                    if (!IsSpriteVisible(frustum, transform))
+                    {
+                        blockCulled++;
+                        continue;
+                    }
+                    writer.Add(transform, spriteStorage.Data()[slot]);
+                }
+                return blockCulled;
+            });
 
-            // Resolve texture from library
-            Texture* texture = nullptr;
-            if (!sprite.TextureName.empty())
+            // Sprites the index didn't return were culled too; those without a
+            // transform are never drawn, so they don't count
+            size_t drawable = 0;
+            if (const auto* group = scene.FindGroup<TransformComponent, SpriteRendererComponent>())
             {
-                texture = textureLib.GetTexturePtr(sprite.TextureName);
+                drawable = group->Size();
             }
-
-            // Build QuadSpec for this sprite
-            QuadSpec spec;
-            spec.x = transform->Position[0];
-            spec.y = transform->Position[1];
-            spec.z = transform->Position[2];
-            spec.width = transform->Scale[0];
-            spec.height = transform->Scale[1];
-            spec.rotation = rotationRadians;
-            spec.color[0] = sprite.Color[0];
-            spec.color[1] = sprite.Color[1];
-            spec.color[2] = sprite.Color[2];
-            spec.color[3] = sprite.Color[3];
-
-            if (texture)
+            else
             {
-                spec.texture = texture;
+                for (size_t i = 0; i < spriteStorage.Size(); i++)
+                    drawable += transformStorage.Has(spriteStorage.GetEntity(i)) ? 1 : 0;
+            }
+            culled = static_cast<uint32_t>(drawable) - visible;
+        }
+        else if (scene.GetStorageMode() == SceneStorageMode::Archetype)
+        {
+            std::vector<SpriteSpan> spans;
+            const size_t spriteCount = GatherArchetypeSpans(scene, spans);
 
-                if (sprite.UseAtlas)
-                {
-                    // Spritesheet/Atlas rendering - calculate UVs on stack
-                    float texCoords[4][2];
-                    SubTexture2D::CalculateGridUVs(
-                        texture,
-                        sprite.AtlasCellX, sprite.AtlasCellY,
-                        sprite.AtlasCellWidth, sprite.AtlasCellHeight,
-                        sprite.AtlasSpriteWidth, sprite.AtlasSpriteHeight,
-                        texCoords
-                    );
-                    spec.texCoords = texCoords;
-                }
-                else
+            const size_t blockCount = (spriteCount + CullBlockSize - 1) / CullBlockSize;
+            SubmitSpriteBlocks(blockCount, textureLib, pixelsPerUnit, visible, culled, [&](size_t block, SpriteQuadWriter& writer)
+            {
+                uint32_t blockCulled = 0;
+                const size_t first = block * CullBlockSize;
+                ForEachSprite(spans, first, std::min(first + CullBlockSize, spriteCount),
+                    [&](size_t, const TransformComponent& transform, const SpriteRendererComponent& sprite)
                 {
-                    spec.tilingFactor = sprite.TilingFactor;
-                }
-            }
+                    if (!IsSpriteVisible(frustum, transform))
+                    {
+                        blockCulled++;
+                        return;
+                    }
+                    writer.Add(transform, sprite);
+                });
+                return blockCulled;
+            });
+        }
+        else
+        {
+            // Blocks of the view's driving storage, in Scene::Each order
+            const auto view = scene.View<const TransformComponent, const SpriteRendererComponent>();
+            const size_t positions = view.SizeHint();
 
-            Renderer2D::DrawQuad(spec);
+            const size_t blockCount = (positions + CullBlockSize - 1) / CullBlockSize;
+            SubmitSpriteBlocks(blockCount, textureLib, pixelsPerUnit, visible, culled, [&](size_t block, SpriteQuadWriter& writer)
+            {
+                uint32_t blockCulled = 0;
+                const size_t first = block * CullBlockSize;
+                view.EachInRange(first, first + CullBlockSize,
+                    [&](const TransformComponent& transform, const SpriteRendererComponent& sprite)
+                {
+                    if (!IsSpriteVisible(frustum, transform))
+                    {
+                        blockCulled++;
+                        return;
+                    }
+                    writer.Add(transform, sprite);
+                });
+                return blockCulled;
+            });
         }
 
+        Renderer2D::RecordCulling(visible, culled);
         Renderer2D::EndScene();
     }
 
     void SpriteRenderSystem::RenderInstanced(Scene& scene)
     {
         auto& textureLib = TextureLibrary::Get();
-        auto& taskGraph = TaskGraph::Get();
-        auto& sprites = scene.GetStorage<SpriteRendererComponent>();
-        auto& transforms = scene.GetStorage<TransformComponent>();
 
-        const size_t spriteCount = sprites.Size();
+        // Gather contiguous runs of (transform, sprite) rows. Both storage modes
+        // yield parallel arrays: a co-sorted group, or archetype chunks.
+        std::vector<SpriteSpan> spans;
+        size_t spriteCount = 0;
+
+        if (scene.GetStorageMode() == SceneStorageMode::Archetype)
+        {
+            spriteCount = GatherArchetypeSpans(scene, spans);
+        }
+        else
+        {
+            // Transform + Sprite rows are co-sorted, so instance i reads row i of both arrays
+            const auto& group = std::as_const(*scene.FindGroup<TransformComponent, SpriteRendererComponent>());
+            spriteCount = group.Size();
+            spans.push_back({ group.Data<TransformComponent>(), group.Data<SpriteRendererComponent>(), spriteCount, 0 });
+        }
+
         if (spriteCount == 0)
             return;
 
+        // Cull in blocks, counting survivors per block so the fill below can
+        // keep scene order (instances are drawn in order, with blending)
+        const ViewFrustum frustum = GetViewFrustum();
+        const size_t blockCount = (spriteCount + CullBlockSize - 1) / CullBlockSize;
+        m_Visible.resize(spriteCount);
+        m_BlockOffsets.assign(blockCount + 1, 0);
+
+        TaskGraph::Get().ParallelFor(0, blockCount, 1, [&](size_t firstBlock, size_t lastBlock)
+        {
+            for (size_t block = firstBlock; block < lastBlock; block++)
+            {
+                uint32_t count = 0;
+                const size_t first = block * CullBlockSize;
+                ForEachSprite(spans, first, std::min(first + CullBlockSize, spriteCount),
+                    [&](size_t instance, const TransformComponent& transform, const SpriteRendererComponent&)
+                {
+                    const bool visible = IsSpriteVisible(frustum, transform);
+                    m_Visible[instance] = visible;
+                    count += visible;
+                });
+                m_BlockOffsets[block + 1] = count;
+            }
+        });
+
+        for (size_t block = 0; block < blockCount; block++)
+            m_BlockOffsets[block + 1] += m_BlockOffsets[block];
+        const uint32_t visibleCount = m_BlockOffsets[blockCount];
+
         // Begin scene with appropriate camera
         InstancedRenderer2D::ResetStats();
+        InstancedRenderer2D::RecordCulling(visibleCount, static_cast<uint32_t>(spriteCount) - visibleCount);
+        BeginInstancedScene();
 
-        if (m_RenderContext.UsesRuntimeCamera())
+        if (visibleCount == 0)
         {
-            InstancedRenderer2D::BeginScene(
-                *m_RenderContext.RuntimeCamera,
-                *m_RenderContext.CameraTransform,
-                m_RenderContext.RenderPass,
-                m_RenderContext.CommandBuffer,
-                m_RenderContext.ViewportWidth,
-                m_RenderContext.ViewportHeight
-            );
-        }
-        else
-        {
-            InstancedRenderer2D::BeginScene(
-                *m_RenderContext.ExternalCamera,
-                m_RenderContext.RenderPass,
-                m_RenderContext.CommandBuffer,
-                m_RenderContext.ViewportWidth,
-                m_RenderContext.ViewportHeight
-            );
+            InstancedRenderer2D::EndScene();
+            return;
         }
 
         // Allocate instance buffer space (thread-safe)
-        QuadInstanceData* instances = InstancedRenderer2D::AllocateInstances(static_cast<uint32_t>(spriteCount));
+        QuadInstanceData* instances = InstancedRenderer2D::AllocateInstances(visibleCount);
         if (!instances)
         {
             GG_CORE_WARN("SpriteRenderSystem::RenderInstanced - Failed to allocate instance buffer");
@@ -182,96 +570,124 @@ namespace GGEngine {
             return;
         }
 
-        // Get raw data pointers for parallel access
-        const SpriteRendererComponent* spriteData = sprites.Data();
         const uint32_t whiteTexIndex = InstancedRenderer2D::GetWhiteTextureIndex();
+        const float pixelsPerUnit = GetPixelsPerWorldUnit();
+
+        // Fill the instance buffer in parallel; each block writes after the survivors of earlier blocks
+        TaskGraph::Get().ParallelFor(0, blockCount, 1, [&](size_t firstBlock, size_t lastBlock)
+        {
+            for (size_t block = firstBlock; block < lastBlock; block++)
+            {
+                QuadInstanceData* out = instances + m_BlockOffsets[block];
+                const size_t first = block * CullBlockSize;
+                ForEachSprite(spans, first, std::min(first + CullBlockSize, spriteCount),
+                    [&](size_t instance, const TransformComponent& transform, const SpriteRendererComponent& sprite)
+                {
+                    if (m_Visible[instance])
+                        WriteInstance(*out++, transform, sprite, textureLib, whiteTexIndex, pixelsPerUnit);
+                });
+            }
+        });
+
+        InstancedRenderer2D::EndScene();
+    }
+
+    void SpriteRenderSystem::RenderRetained(Scene& scene)
+    {
+        // Archetype storage keeps no per-row change ticks
+        if (scene.GetStorageMode() == SceneStorageMode::Archetype)
+        {
+            ResetRetained();
+            RenderInstanced(scene);
+            return;
+        }
 
-        // Determine chunk size based on worker count
-        const uint32_t workerCount = taskGraph.GetWorkerCount();
-        const size_t minChunkSize = 256;
-        const size_t chunkSize = std::max(minChunkSize, (spriteCount + workerCount) / (workerCount + 1));
+        SyncRetained(scene);
 
-        // Create parallel tasks for instance buffer preparation
-        std::vector<TaskID> tasks;
-        tasks.reserve((spriteCount + chunkSize - 1) / chunkSize);
+        // Also runs when nothing is left to draw, so emptied slots stop being drawn
+        InstancedRenderer2D::ResetStats();
+        BeginInstancedScene();
+        InstancedRenderer2D::EndScene();
+    }
+
+    void SpriteRenderSystem::SyncRetained(Scene& scene)
+    {
+        GG_PROFILE_FUNCTION();
 
-        for (size_t start = 0; start < spriteCount; start += chunkSize)
+        auto& retained = InstancedRenderer2D::GetRetainedInstances();
+
+        const bool rebuild = m_RetainedScene != &scene;
+        if (rebuild)
         {
-            size_t end = std::min(start + chunkSize, spriteCount);
+            retained.Clear();
+            m_RetainedScene = &scene;
+        }
 
-            TaskID taskId = taskGraph.CreateTask("PrepareInstances",
-                [&textureLib, &sprites, &transforms, spriteData, instances, whiteTexIndex, start, end]() -> TaskResult
-                {
-                    for (size_t i = start; i < end; ++i)
-                    {
-                        Entity entity = sprites.GetEntity(i);
-
-                        const TransformComponent* transform = transforms.Get(entity);
-                        if (!transform)
-                            continue;
-
-                        const SpriteRendererComponent& sprite = spriteData[i];
-                        QuadInstanceData& inst = instances[i];
-
-                        // Set transform (position, rotation, scale)
-                        inst.SetTransform(
-                            transform->Position[0],
-                            transform->Position[1],
-                            transform->Position[2],
-                            Math::ToRadians(transform->Rotation),
-                            transform->Scale[0],
-                            transform->Scale[1]
-                        );
-
-                        // Set color
-                        inst.SetColor(
-                            sprite.Color[0],
-                            sprite.Color[1],
-                            sprite.Color[2],
-                            sprite.Color[3]
-                        );
-
-                        // Resolve texture and UVs
-                        uint32_t texIndex = whiteTexIndex;
-                        float minU = 0.0f, minV = 0.0f, maxU = 1.0f, maxV = 1.0f;
-                        float tiling = sprite.TilingFactor;
-
-                        if (!sprite.TextureName.empty())
-                        {
-                            Texture* texture = textureLib.GetTexturePtr(sprite.TextureName);
-                            if (texture)
-                            {
-                                texIndex = texture->GetBindlessIndex();
-
-                                if (sprite.UseAtlas && texture->GetWidth() > 0 && texture->GetHeight() > 0)
-                                {
-                                    // Calculate atlas UVs
-                                    float texWidth = static_cast<float>(texture->GetWidth());
-                                    float texHeight = static_cast<float>(texture->GetHeight());
-
-                                    minU = (sprite.AtlasCellX * sprite.AtlasCellWidth) / texWidth;
-                                    minV = (sprite.AtlasCellY * sprite.AtlasCellHeight) / texHeight;
-                                    maxU = minU + (sprite.AtlasSpriteWidth * sprite.AtlasCellWidth) / texWidth;
-                                    maxV = minV + (sprite.AtlasSpriteHeight * sprite.AtlasCellHeight) / texHeight;
-                                }
-                            }
-                        }
-
-                        inst.SetTexCoords(minU, minV, maxU, maxV, texIndex, tiling);
-                    }
+        // No writes, adds or removes to either storage: every slot is current
+        const uint64_t transformVersion = scene.GetComponentVersion(std::type_index(typeid(TransformComponent)));
+        const uint64_t spriteVersion = scene.GetComponentVersion(std::type_index(typeid(SpriteRendererComponent)));
+        if (!rebuild && transformVersion == m_TransformVersion && spriteVersion == m_SpriteVersion)
+            return;
+        m_TransformVersion = transformVersion;
+        m_SpriteVersion = spriteVersion;
 
-                    return TaskResult::Success();
-                },
-                JobPriority::High
-            );
+        // Rows stamped after this tick are picked up by the next sync
+        const uint32_t since = m_RetainedTick;
+        m_RetainedTick = ChangeTicks::Current();
+        ChangeTicks::Advance();
+
+        const auto& group = std::as_const(*scene.FindGroup<TransformComponent, SpriteRendererComponent>());
+        const auto& transformStorage = scene.GetStorage<TransformComponent>();
+        const auto& spriteStorage = scene.GetStorage<SpriteRendererComponent>();
 
-            tasks.push_back(taskId);
+        const Entity* entities = group.Entities();
+        const TransformComponent* transforms = group.Data<TransformComponent>();
+        const SpriteRendererComponent* sprites = group.Data<SpriteRendererComponent>();
+
+        auto& textureLib = TextureLibrary::Get();
+        const uint32_t whiteTexIndex = InstancedRenderer2D::GetWhiteTextureIndex();
+
+        // Grouped rows share dense indices, so row i's ticks are at index i of both storages
+        // (and its block at the same block of both). Adds stamp the changed tick too, so new
+        // members are caught here. Blocks neither storage stamped are skipped whole, so a
+        // sync costs about what changed rather than the number of sprites.
+        constexpr size_t BlockRows = ComponentStorage<TransformComponent>::ChangeBlockRows;
+
+        QuadInstanceData instance;
+        const size_t size = group.Size();
+        for (size_t block = 0; block * BlockRows < size; block++)
+        {
+            if (!rebuild && !transformStorage.IsBlockChangedSince(block, since) &&
+                !spriteStorage.IsBlockChangedSince(block, since))
+            {
+                continue;
+            }
+
+            const size_t end = std::min(size, (block + 1) * BlockRows);
+            for (size_t i = block * BlockRows; i < end; i++)
+            {
+                if (!rebuild && !transformStorage.IsChangedSince(i, since) && !spriteStorage.IsChangedSince(i, since))
+                    continue;
+
+                WriteInstance(instance, transforms[i], sprites[i], textureLib, whiteTexIndex, NoUsageReport);
+                retained.Set(RetainedInstanceBuffer::MakeKey(entities[i], 0), instance);
+            }
         }
 
-        // Wait for all preparation tasks to complete
-        taskGraph.WaitAll(tasks);
+        // Every member has a slot now, so extra slots belong to entities that left the group
+        if (retained.Size() != group.Size())
+        {
+            retained.RemoveUnless([&](uint64_t key) {
+                return group.Contains(static_cast<Entity>(key));
+            });
+        }
+    }
 
-        InstancedRenderer2D::EndScene();
+    void SpriteRenderSystem::ResetRetained()
+    {
+        if (m_RetainedScene)
+            InstancedRenderer2D::GetRetainedInstances().Clear();
+        m_RetainedScene = nullptr;
     }
 
 }
@@ -2,6 +2,9 @@
 
 #include "RenderSystem.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace GGEngine {
 
     // =============================================================================
@@ -10,8 +13,32 @@ namespace GGEngine {
     // Renders all entities with SpriteRendererComponent and TransformComponent.
     // Supports both batched (Renderer2D) and instanced (InstancedRenderer2D) modes.
     //
-    // Batched mode: Good for small numbers of sprites, simpler to debug
-    // Instanced mode: Better for large numbers (10k+) sprites, parallel preparation
+    // Batched mode: Good for small numbers of sprites, simpler to debug. Blocks
+    //              of sprites become quads in parallel, each in its own
+    //              Renderer2D submit context, merged back in scene order.
+    // Instanced mode: Better for large numbers (10k+) sprites, parallel preparation.
+    //                Reads a Transform + SpriteRenderer group on sparse-set scenes
+    //                (archetype scenes walk chunks) so preparation reads both arrays linearly.
+    //                OnRegister creates the group; call it once per scene at setup
+    //                when running the system outside a SystemScheduler. Without the
+    //                group, Instanced and Retained fall back to Batched.
+    // Retained mode: For mostly static scenes. Each sprite keeps a slot in
+    //                InstancedRenderer2D's retained instances; only rows whose change
+    //                tick moved (see ChangeTick.h) are rewritten and re-uploaded, and a
+    //                frame where neither storage version moved does no per-sprite work.
+    //                Changes appear one frame late. Sparse-set scenes only (archetype
+    //                scenes fall back to Instanced). Only one system should use it at a time.
+    //                Slots are not culled; the GPU clips them. Draws are not
+    //                reported to TextureStreamer, so streamed textures stay at
+    //                whatever detail other systems ask for.
+    //
+    // Batched and Instanced modes skip sprites outside the camera's view
+    // (see ViewFrustum) and report visible/culled counts in the renderer stats.
+    // Batched mode on a sparse-set scene with a 2D camera asks the scene's
+    // spatial index (Scene::GetSpatialIndex) for the sprites in view instead of
+    // testing every one, as long as Scene::OnUpdate has indexed every transform
+    // change (otherwise it tests every sprite). Both also report each textured sprite's on-screen
+    // size to streamed textures (see TextureStreamer).
     //
     class GG_API SpriteRenderSystem : public IRenderSystem
     {
@@ -19,26 +46,46 @@ namespace GGEngine {
         enum class RenderMode
         {
             Batched,    // Use Renderer2D batched quads
-            Instanced   // Use InstancedRenderer2D with parallel preparation
+            Instanced,  // Use InstancedRenderer2D with parallel preparation
+            Retained    // Use InstancedRenderer2D's retained instances, updated incrementally
         };
 
         explicit SpriteRenderSystem(RenderMode mode = RenderMode::Batched);
         ~SpriteRenderSystem() override = default;
 
         // ISystem interface
+        void OnRegister(Scene& scene) override;
         std::vector<ComponentRequirement> GetRequirements() const override;
         void Execute(Scene& scene, float deltaTime) override;
         const char* GetName() const override { return "SpriteRenderSystem"; }
 
         // Render mode control
-        void SetRenderMode(RenderMode mode) { m_RenderMode = mode; }
+        void SetRenderMode(RenderMode mode);
         RenderMode GetRenderMode() const { return m_RenderMode; }
 
     private:
+        void BeginInstancedScene();
         void RenderBatched(Scene& scene);
         void RenderInstanced(Scene& scene);
+        void RenderRetained(Scene& scene);
+        void SyncRetained(Scene& scene);
+        void ResetRetained();
 
         RenderMode m_RenderMode;
+        bool m_WarnedMissingGroup = false;
+
+        // Batched mode: sprite storage slots returned by the spatial index
+        std::vector<uint32_t> m_Candidates;
+
+        // Instanced mode culling scratch, reused across frames
+        std::vector<uint8_t> m_Visible;         // Per sprite, in instance order
+        std::vector<uint32_t> m_BlockOffsets;   // First output instance of each cull block
+
+        // Retained mode: what the retained instances were last synced from
+        const Scene* m_RetainedScene = nullptr;
+        uint32_t m_RetainedTick = 0;
+        uint64_t m_TransformVersion = 0;
+        uint64_t m_SpriteVersion = 0;
     };
 
 }
@@ -6,9 +6,28 @@
 #include "GGEngine/Renderer/SubTexture2D.h"
 #include "GGEngine/Renderer/SceneCamera.h"
 #include "GGEngine/Asset/TextureLibrary.h"
+#include "GGEngine/Core/Profiler.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace GGEngine {
 
+    TilemapRenderSystem::TilemapRenderSystem() = default;
+    TilemapRenderSystem::~TilemapRenderSystem() = default;
+
+    bool TilemapRenderSystem::ChunkLayout::operator==(const ChunkLayout& other) const
+    {
+        return Width == other.Width && Height == other.Height
+            && TileWidth == other.TileWidth && TileHeight == other.TileHeight
+            && BaseX == other.BaseX && BaseY == other.BaseY && BaseZ == other.BaseZ
+            && TilemapTexture == other.TilemapTexture && BindlessIndex == other.BindlessIndex
+            && AtlasCellWidth == other.AtlasCellWidth && AtlasCellHeight == other.AtlasCellHeight
+            && AtlasColumns == other.AtlasColumns
+            && std::equal(std::begin(Color), std::end(Color), std::begin(other.Color))
+            && Tiles == other.Tiles;
+    }
+
     std::vector<ComponentRequirement> TilemapRenderSystem::GetRequirements() const
     {
         return {
@@ -55,76 +74,213 @@ namespace GGEngine {
         RenderTilemaps(scene);
 
         Renderer2D::EndScene();
+
+        EvictStaleTilemaps();
+    }
+
+    void TilemapRenderSystem::ReleaseCache()
+    {
+        // QuadMesh defers freeing its buffers until frames in flight are done with them
+        m_Cache.clear();
+        m_CachedScene = nullptr;
+    }
+
+    void TilemapRenderSystem::EvictStaleTilemaps()
+    {
+        // Entities that lost their tilemap this frame. Their meshes may still be in
+        // use by frames in flight; QuadMesh frees the buffers once they are done.
+        for (auto it = m_Cache.begin(); it != m_Cache.end(); )
+        {
+            if (it->second.LastFrame != m_Frame)
+                it = m_Cache.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    void TilemapRenderSystem::BuildChunk(const TilemapComponent& tilemap, const ChunkLayout& layout,
+                                         uint32_t chunkX, uint32_t chunkY, QuadMesh& mesh) const
+    {
+        GG_PROFILE_FUNCTION();
+
+        mesh.Clear();
+
+        const uint32_t minX = chunkX * TilemapComponent::ChunkSize;
+        const uint32_t minY = chunkY * TilemapComponent::ChunkSize;
+        const uint32_t maxX = std::min(minX + TilemapComponent::ChunkSize, tilemap.Width);
+        const uint32_t maxY = std::min(minY + TilemapComponent::ChunkSize, tilemap.Height);
+
+        for (uint32_t ty = minY; ty < maxY; ty++)
+        {
+            for (uint32_t tx = minX; tx < maxX; tx++)
+            {
+                int32_t tileIndex = tilemap.GetTile(tx, ty);
+                if (tileIndex < 0) continue;  // Skip empty tiles
+
+                // Convert linear atlas index to cell coordinates
+                uint32_t cellX, cellY;
+                tilemap.IndexToCell(tileIndex, cellX, cellY);
+
+                // Calculate UV coordinates on stack (no heap allocation)
+                float texCoords[4][2];
+                SubTexture2D::CalculateGridUVs(
+                    layout.TilemapTexture,
+                    cellX, cellY,
+                    tilemap.AtlasCellWidth, tilemap.AtlasCellHeight,
+                    1.0f, 1.0f,
+                    texCoords
+                );
+
+                // Calculate world position for this tile (center of tile)
+                float worldX = layout.BaseX + tx * tilemap.TileWidth + tilemap.TileWidth * 0.5f;
+                float worldY = layout.BaseY + ty * tilemap.TileHeight + tilemap.TileHeight * 0.5f;
+
+                QuadSpec spec;
+                spec.x = worldX;
+                spec.y = worldY;
+                spec.z = layout.BaseZ;
+                spec.width = tilemap.TileWidth;
+                spec.height = tilemap.TileHeight;
+                spec.texture = layout.TilemapTexture;
+                spec.texCoords = texCoords;
+                spec.color[0] = tilemap.Color[0];
+                spec.color[1] = tilemap.Color[1];
+                spec.color[2] = tilemap.Color[2];
+                spec.color[3] = tilemap.Color[3];
+                mesh.AddQuad(spec);
+            }
+        }
     }
 
     void TilemapRenderSystem::RenderTilemaps(Scene& scene)
     {
         auto& textureLib = TextureLibrary::Get();
-        auto& tilemaps = scene.GetStorage<TilemapComponent>();
-        auto& transforms = scene.GetStorage<TransformComponent>();
+        const ViewFrustum frustum = GetViewFrustum();
+        const float pixelsPerUnit = GetPixelsPerWorldUnit();
 
-        for (size_t i = 0; i < tilemaps.Size(); i++)
+        // Entity indices only identify cached tilemaps within one scene
+        if (m_CachedScene != &scene)
         {
-            Entity entity = tilemaps.GetEntity(i);
+            ReleaseCache();
+            m_CachedScene = &scene;
+        }
+        m_Frame++;
 
-            const TransformComponent* transform = transforms.Get(entity);
-            if (!transform) continue;
+        uint64_t visibleTiles = 0;
+        uint64_t culledTiles = 0;
 
-            const TilemapComponent& tilemap = tilemaps.Data()[i];
+        scene.Each<const TransformComponent, const TilemapComponent>(
+            [&](Entity entity, const TransformComponent& transform, const TilemapComponent& tilemap)
+        {
+            // Kept while the entity has a tilemap, even if it can't be drawn this frame
+            CachedTilemap& cached = m_Cache[entity];
+            cached.LastFrame = m_Frame;
 
             // Skip if no texture assigned
-            if (tilemap.TextureName.empty()) continue;
+            if (tilemap.TextureName.empty()) return;
 
             Texture* texture = textureLib.GetTexturePtr(tilemap.TextureName);
-            if (!texture) continue;
+            if (!texture) return;
+
+            // Tiles may not have been sized to Width x Height yet
+            if (tilemap.Tiles.size() < static_cast<size_t>(tilemap.Width) * tilemap.Height)
+                return;
 
             // Calculate base position (tilemap is centered on entity position)
-            float baseX = transform->Position[0] - (tilemap.Width * tilemap.TileWidth * 0.5f);
-            float baseY = transform->Position[1] - (tilemap.Height * tilemap.TileHeight * 0.5f);
-            float baseZ = transform->Position[2] + tilemap.ZOffset;
+            ChunkLayout layout;
+            layout.Width = tilemap.Width;
+            layout.Height = tilemap.Height;
+            layout.TileWidth = tilemap.TileWidth;
+            layout.TileHeight = tilemap.TileHeight;
+            layout.BaseX = transform.Position[0] - (tilemap.Width * tilemap.TileWidth * 0.5f);
+            layout.BaseY = transform.Position[1] - (tilemap.Height * tilemap.TileHeight * 0.5f);
+            layout.BaseZ = transform.Position[2] + tilemap.ZOffset;
+            layout.TilemapTexture = texture;
+            layout.BindlessIndex = texture->GetBindlessIndex();
+            layout.AtlasCellWidth = tilemap.AtlasCellWidth;
+            layout.AtlasCellHeight = tilemap.AtlasCellHeight;
+            layout.AtlasColumns = tilemap.AtlasColumns;
+            std::copy(std::begin(tilemap.Color), std::end(tilemap.Color), std::begin(layout.Color));
+            layout.Tiles = tilemap.Tiles.data();
+
+            const uint32_t chunksX = tilemap.GetChunksX();
+            const uint32_t chunksY = tilemap.GetChunksY();
 
-            // Render each tile
-            for (uint32_t ty = 0; ty < tilemap.Height; ty++)
+            // A different entity in the slot or a different chunk grid: start over
+            const EntityID id = scene.GetEntityID(entity);
+            const size_t chunkCount = static_cast<size_t>(chunksX) * chunksY;
+            if (cached.Generation != id.Generation || cached.Chunks.size() != chunkCount)
             {
-                for (uint32_t tx = 0; tx < tilemap.Width; tx++)
+                cached.Chunks.clear();
+                cached.Chunks.resize(chunkCount);
+                cached.Generation = id.Generation;
+                cached.Layout = layout;
+            }
+            else if (!(cached.Layout == layout))
+            {
+                // Something baked into the vertices changed: rebuild chunks in place
+                for (CachedChunk& chunk : cached.Chunks)
+                    chunk.Stale = true;
+                cached.Layout = layout;
+            }
+
+            // Only visit the chunks the camera can see
+            const float chunkWidth = tilemap.TileWidth * TilemapComponent::ChunkSize;
+            const float chunkHeight = tilemap.TileHeight * TilemapComponent::ChunkSize;
+            const TileRect visible = frustum.GetVisibleTiles(layout.BaseX, layout.BaseY, layout.BaseZ,
+                chunkWidth, chunkHeight, chunksX, chunksY);
+
+            if (!visible.IsEmpty())
+            {
+                const uint64_t visibleX = std::min(visible.MaxX * TilemapComponent::ChunkSize, tilemap.Width) -
+                                          visible.MinX * TilemapComponent::ChunkSize;
+                const uint64_t visibleY = std::min(visible.MaxY * TilemapComponent::ChunkSize, tilemap.Height) -
+                                          visible.MinY * TilemapComponent::ChunkSize;
+                visibleTiles += visibleX * visibleY;
+                culledTiles += static_cast<uint64_t>(tilemap.Width) * tilemap.Height - visibleX * visibleY;
+
+                // Texels of one atlas cell per screen pixel of one tile, for TextureStreamer
+                if (texture->IsStreamed())
                 {
-                    int32_t tileIndex = tilemap.GetTile(tx, ty);
-                    if (tileIndex < 0) continue;  // Skip empty tiles
-
-                    // Convert linear atlas index to cell coordinates
-                    uint32_t cellX, cellY;
-                    tilemap.IndexToCell(tileIndex, cellX, cellY);
-
-                    // Calculate UV coordinates on stack (no heap allocation)
-                    float texCoords[4][2];
-                    SubTexture2D::CalculateGridUVs(
-                        texture,
-                        cellX, cellY,
-                        tilemap.AtlasCellWidth, tilemap.AtlasCellHeight,
-                        1.0f, 1.0f,
-                        texCoords
-                    );
-
-                    // Calculate world position for this tile (center of tile)
-                    float worldX = baseX + tx * tilemap.TileWidth + tilemap.TileWidth * 0.5f;
-                    float worldY = baseY + ty * tilemap.TileHeight + tilemap.TileHeight * 0.5f;
-
-                    QuadSpec spec;
-                    spec.x = worldX;
-                    spec.y = worldY;
-                    spec.z = baseZ;
-                    spec.width = tilemap.TileWidth;
-                    spec.height = tilemap.TileHeight;
-                    spec.texture = texture;
-                    spec.texCoords = texCoords;
-                    spec.color[0] = tilemap.Color[0];
-                    spec.color[1] = tilemap.Color[1];
-                    spec.color[2] = tilemap.Color[2];
-                    spec.color[3] = tilemap.Color[3];
-                    Renderer2D::DrawQuad(spec);
+                    const float pixelsX = std::abs(tilemap.TileWidth) * pixelsPerUnit;
+                    const float pixelsY = std::abs(tilemap.TileHeight) * pixelsPerUnit;
+                    texture->ReportUsage(pixelsPerUnit > 0.0f
+                        ? std::max(tilemap.AtlasCellWidth / pixelsX, tilemap.AtlasCellHeight / pixelsY)
+                        : 0.0f);
                 }
             }
-        }
+            else
+            {
+                culledTiles += static_cast<uint64_t>(tilemap.Width) * tilemap.Height;
+            }
+
+            for (uint32_t cy = visible.MinY; cy < visible.MaxY; cy++)
+            {
+                for (uint32_t cx = visible.MinX; cx < visible.MaxX; cx++)
+                {
+                    CachedChunk& chunk = cached.Chunks[static_cast<size_t>(cy) * chunksX + cx];
+                    const uint32_t version = tilemap.GetChunkVersion(cx, cy);
+
+                    if (chunk.Stale || chunk.Version != version)
+                    {
+                        if (!chunk.Mesh)
+                            chunk.Mesh = CreateScope<QuadMesh>();
+
+                        // A refused upload leaves the chunk stale, so it is retried next frame
+                        BuildChunk(tilemap, layout, cx, cy, *chunk.Mesh);
+                        if (chunk.Mesh->Upload())
+                        {
+                            chunk.Version = version;
+                            chunk.Stale = false;
+                        }
+                    }
+
+                    Renderer2D::DrawMesh(*chunk.Mesh);
+                }
+            }
+        });
+
+        Renderer2D::RecordCulling(static_cast<uint32_t>(visibleTiles), static_cast<uint32_t>(culledTiles));
     }
 
 }
@@ -1,14 +1,36 @@
 #pragma once
 
 #include "RenderSystem.h"
+#include "GGEngine/ECS/Entity.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace GGEngine {
 
+    class Texture;
+    class QuadMesh;
+    struct TilemapComponent;
+
     // =============================================================================
     // TilemapRenderSystem
     // =============================================================================
     // Renders all entities with TilemapComponent and TransformComponent.
-    // Uses Renderer2D batched rendering for tilemaps.
+    //
+    // Each tilemap is drawn in TilemapComponent::ChunkSize square chunks. A
+    // chunk's quads are built into a Renderer2D QuadMesh the first time it comes
+    // into view and kept in GPU memory; afterwards it costs one draw call per
+    // frame and is only rebuilt when SetTile bumps its version. Chunks outside
+    // the camera's view (see ViewFrustum::GetVisibleTiles) are skipped, so a
+    // stationary camera pays the same for a huge map as for a small one.
+    // Visible tilemaps report their on-screen tile size to streamed textures
+    // (see TextureStreamer).
+    //
+    // Moving the tilemap or changing its texture, atlas or tint rebuilds its
+    // chunks as they are drawn. Rebuilt chunks show up one frame
+    // late (see QuadMesh). Built chunks stay cached until the entity loses its
+    // tilemap; call ReleaseCache before Renderer2D shuts down.
     //
     // Tilemaps are rendered before sprites (lower z-order typically) so this
     // system should be registered before SpriteRenderSystem in the scheduler.
@@ -16,16 +38,65 @@ namespace GGEngine {
     class GG_API TilemapRenderSystem : public IRenderSystem
     {
     public:
-        TilemapRenderSystem() = default;
-        ~TilemapRenderSystem() override = default;
+        TilemapRenderSystem();
+        ~TilemapRenderSystem() override;
+
+        TilemapRenderSystem(const TilemapRenderSystem&) = delete;
+        TilemapRenderSystem& operator=(const TilemapRenderSystem&) = delete;
 
         // ISystem interface
         std::vector<ComponentRequirement> GetRequirements() const override;
         void Execute(Scene& scene, float deltaTime) override;
         const char* GetName() const override { return "TilemapRenderSystem"; }
 
+        // Drop every cached chunk mesh (their buffers are freed once frames in flight are done with them)
+        void ReleaseCache();
+
     private:
+        // What a chunk's vertices were built from, besides its tiles
+        struct ChunkLayout
+        {
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+            float TileWidth = 0.0f;
+            float TileHeight = 0.0f;
+            float BaseX = 0.0f;
+            float BaseY = 0.0f;
+            float BaseZ = 0.0f;
+            const Texture* TilemapTexture = nullptr;
+            uint32_t BindlessIndex = 0;
+            float AtlasCellWidth = 0.0f;
+            float AtlasCellHeight = 0.0f;
+            uint32_t AtlasColumns = 0;
+            float Color[4] = {};
+            const int32_t* Tiles = nullptr;   // Tells a replaced component apart
+
+            bool operator==(const ChunkLayout& other) const;
+        };
+
+        struct CachedChunk
+        {
+            Scope<QuadMesh> Mesh;
+            uint32_t Version = 0;   // TilemapComponent::GetChunkVersion it was built at
+            bool Stale = true;      // Needs building regardless of Version
+        };
+
+        struct CachedTilemap
+        {
+            uint32_t Generation = 0;
+            uint64_t LastFrame = 0;
+            ChunkLayout Layout;
+            std::vector<CachedChunk> Chunks;   // Row-major, like TilemapComponent::ChunkVersions
+        };
+
         void RenderTilemaps(Scene& scene);
+        void BuildChunk(const TilemapComponent& tilemap, const ChunkLayout& layout,
+                        uint32_t chunkX, uint32_t chunkY, QuadMesh& mesh) const;
+        void EvictStaleTilemaps();
+
+        std::unordered_map<Entity, CachedTilemap> m_Cache;
+        const Scene* m_CachedScene = nullptr;
+        uint64_t m_Frame = 0;
     };
 
 }
@@ -0,0 +1,328 @@
+#pragma once
+
+#include "ComponentStorage.h"
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace GGEngine {
+
+    // Exclusion filter for views - entities that have any of these components are skipped
+    // Mirrors AccessMode::Exclude in System.h
+    //
+    // Example:
+    //   scene.View<TransformComponent>(Exclude<CameraComponent>{})
+    //
+    template<typename... T>
+    struct Exclude {};
+
+    // Change filters for views - keep entities whose T component was changed (or
+    // added) after a tick, usually ISystem::GetLastRunTick(). T must be included.
+    //
+    // Example:
+    //   scene.View<const TransformComponent>().Filter(Changed<TransformComponent>{ GetLastRunTick() })
+    //
+    template<typename T>
+    struct Changed { uint32_t Since = 0; };
+
+    template<typename T>
+    struct Added { uint32_t Since = 0; };
+
+    template<typename Excluded, typename... Included>
+    class ComponentView;
+
+    // =============================================================================
+    // ComponentView
+    // =============================================================================
+    // Joins several component storages and yields entities that have all the
+    // included components and none of the excluded ones.
+    //
+    // The smallest included storage drives iteration; the others are checked with
+    // O(1) sparse lookups. Components come out as references all at once, so
+    // systems no longer hand-write "iterate A, probe B" loops.
+    //
+    // Declare a component const (View<const TransformComponent>) for read-only
+    // access - this matches declaring AccessMode::Read in GetRequirements().
+    //
+    // Usage:
+    //   for (auto [entity, transform, sprite] : scene.View<TransformComponent, const SpriteRendererComponent>())
+    //       transform.Position[0] += 1.0f;
+    //
+    //   scene.View<TransformComponent>().Each([](TransformComponent& t) { ... });
+    //
+    // Like direct storage access, a view takes no locks and is invalidated by
+    // adding/removing included components while iterating. Fetching a non-const
+    // component marks it changed (see ComponentStorage change detection).
+    //
+    template<typename... Excluded, typename... Included>
+    class ComponentView<Exclude<Excluded...>, Included...>
+    {
+        static_assert(sizeof...(Included) > 0, "ComponentView needs at least one included component");
+
+        template<typename T>
+        using StorageOf = ComponentStorage<std::remove_const_t<T>>;
+
+        using IncludedStorages = std::tuple<StorageOf<Included>*...>;
+        using ExcludedStorages = std::tuple<const StorageOf<Excluded>*...>;
+        using Indices = std::index_sequence_for<Included...>;
+
+        static constexpr size_t MaxFilters = 4;
+
+        // Position of T among Included... (ignoring const), or sizeof...(Included)
+        template<typename T>
+        static constexpr size_t ComponentIndex()
+        {
+            constexpr bool matches[] = { std::is_same_v<std::remove_const_t<Included>, T>... };
+            for (size_t i = 0; i < sizeof...(Included); i++)
+            {
+                if (matches[i])
+                    return i;
+            }
+            return sizeof...(Included);
+        }
+
+    public:
+        using value_type = std::tuple<Entity, Included&...>;
+
+        ComponentView(StorageOf<Included>&... included, const StorageOf<Excluded>&... excluded)
+            : m_Included(&included...)
+            , m_Excluded(&excluded...)
+        {
+            // Pick the smallest storage as the driver
+            const size_t sizes[] = { included.Size()... };
+            for (size_t i = 1; i < sizeof...(Included); i++)
+            {
+                if (sizes[i] < sizes[m_Driver])
+                    m_Driver = i;
+            }
+
+            const Entity* entities[] = { included.Entities()... };
+            m_DriverEntities = entities[m_Driver];
+            m_DriverSize = sizes[m_Driver];
+        }
+
+        // -------------------------------------------------------------------------
+        // Range-for support
+        // -------------------------------------------------------------------------
+
+        class Iterator
+        {
+        public:
+            Iterator(const ComponentView* view, size_t position)
+                : m_View(view), m_Position(position)
+            {
+                SkipUnmatched();
+            }
+
+            value_type operator*() const { return m_View->Fetch(m_Position, Indices{}); }
+
+            Iterator& operator++()
+            {
+                ++m_Position;
+                SkipUnmatched();
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const { return m_Position == other.m_Position; }
+            bool operator!=(const Iterator& other) const { return m_Position != other.m_Position; }
+
+            // Position in the driving storage's dense array
+            size_t GetPosition() const { return m_Position; }
+
+        private:
+            void SkipUnmatched()
+            {
+                while (m_Position < m_View->m_DriverSize && !m_View->MatchesAt(m_Position))
+                    ++m_Position;
+            }
+
+            const ComponentView* m_View;
+            size_t m_Position;
+        };
+
+        Iterator begin() const { return Iterator(this, 0); }
+        Iterator end() const { return Iterator(this, m_DriverSize); }
+
+        // -------------------------------------------------------------------------
+        // Callback iteration
+        // -------------------------------------------------------------------------
+
+        // Invoke fn for every match. fn takes (Entity, Included&...) or (Included&...)
+        template<typename Fn>
+        void Each(Fn&& fn) const
+        {
+            EachInRange(0, m_DriverSize, std::forward<Fn>(fn));
+        }
+
+        // Invoke fn for matches among driver positions [begin, end)
+        // Disjoint ranges can be processed from different threads, which is how
+        // systems split a view into parallel chunks (see SizeHint())
+        template<typename Fn>
+        void EachInRange(size_t begin, size_t end, Fn&& fn) const
+        {
+            if (end > m_DriverSize)
+                end = m_DriverSize;
+
+            for (size_t position = begin; position < end; ++position)
+            {
+                if (MatchesAt(position))
+                    std::apply(fn, ArgsFor<Fn>(position));
+            }
+        }
+
+        // -------------------------------------------------------------------------
+        // Queries
+        // -------------------------------------------------------------------------
+
+        // Upper bound on the number of matches (size of the driving storage)
+        size_t SizeHint() const { return m_DriverSize; }
+
+        // Copy of this view that also requires T to have changed / been added
+        // after filter.Since. Up to MaxFilters filters can be combined.
+        template<typename T>
+        ComponentView Filter(Changed<T> filter) const { return WithFilter<T>(filter.Since, false); }
+
+        template<typename T>
+        ComponentView Filter(Added<T> filter) const { return WithFilter<T>(filter.Since, true); }
+
+        // Check whether a specific entity matches the view
+        bool Contains(Entity entity) const
+        {
+            return HasAll(entity, Indices{}) && !HasAny(entity);
+        }
+
+        // Direct access to one of the included components of a matching entity
+        template<typename T>
+        T* Get(Entity entity) const
+        {
+            auto* storage = std::get<StorageOf<T>*>(m_Included);
+            if constexpr (std::is_const_v<T>)
+                return std::as_const(*storage).Get(entity);
+            else
+                return storage->Get(entity);
+        }
+
+    private:
+        struct ChangeFilter
+        {
+            size_t Component = 0;       // Index into Included...
+            uint32_t Since = 0;
+            bool AddedOnly = false;
+        };
+
+        template<typename T>
+        ComponentView WithFilter(uint32_t since, bool addedOnly) const
+        {
+            static_assert(ComponentIndex<std::remove_const_t<T>>() < sizeof...(Included),
+                          "Change filters only apply to included components");
+            GG_CORE_ASSERT(m_FilterCount < MaxFilters, "Too many change filters on one view");
+
+            ComponentView view = *this;
+            view.m_Filters[view.m_FilterCount++] = { ComponentIndex<std::remove_const_t<T>>(), since, addedOnly };
+            return view;
+        }
+
+        bool MatchesAt(size_t position) const
+        {
+            const Entity entity = m_DriverEntities[position];
+            return HasAllExceptDriver(entity, Indices{}) && !HasAny(entity) &&
+                   PassesFilters(entity, position);
+        }
+
+        bool PassesFilters(Entity entity, size_t position) const
+        {
+            for (size_t f = 0; f < m_FilterCount; f++)
+            {
+                if (!PassesFilter(m_Filters[f], entity, position, Indices{}))
+                    return false;
+            }
+            return true;
+        }
+
+        template<size_t... I>
+        bool PassesFilter(const ChangeFilter& filter, Entity entity, size_t position, std::index_sequence<I...>) const
+        {
+            bool passes = false;
+            ((I == filter.Component && (passes = PassesFilterOn<I>(filter, entity, position))), ...);
+            return passes;
+        }
+
+        template<size_t I>
+        bool PassesFilterOn(const ChangeFilter& filter, Entity entity, size_t position) const
+        {
+            const auto* storage = std::get<I>(m_Included);
+            const size_t index = I == m_Driver ? position : storage->IndexOf(entity);
+            return filter.AddedOnly ? storage->IsAddedSince(index, filter.Since)
+                                    : storage->IsChangedSince(index, filter.Since);
+        }
+
+        template<size_t... I>
+        bool HasAll(Entity entity, std::index_sequence<I...>) const
+        {
+            return (std::get<I>(m_Included)->Has(entity) && ...);
+        }
+
+        // The driver trivially contains its own entities, so skip its lookup
+        template<size_t... I>
+        bool HasAllExceptDriver(Entity entity, std::index_sequence<I...>) const
+        {
+            return ((I == m_Driver || std::get<I>(m_Included)->Has(entity)) && ...);
+        }
+
+        bool HasAny(Entity entity) const
+        {
+            return std::apply([entity](const auto*... storages) {
+                return (storages->Has(entity) || ...);
+            }, m_Excluded);
+        }
+
+        // Driver's component is read straight from its dense array; the rest via sparse lookup
+        template<size_t I>
+        std::tuple_element_t<I, std::tuple<Included...>>& FetchOne(Entity entity, size_t position) const
+        {
+            auto* storage = std::get<I>(m_Included);
+            const size_t index = I == m_Driver ? position : storage->IndexOf(entity);
+            if constexpr (!std::is_const_v<std::tuple_element_t<I, std::tuple<Included...>>>)
+                storage->MarkChangedAt(index);
+            return storage->Data()[index];
+        }
+
+        template<size_t... I>
+        value_type Fetch(size_t position, std::index_sequence<I...>) const
+        {
+            const Entity entity = m_DriverEntities[position];
+            return value_type(entity, FetchOne<I>(entity, position)...);
+        }
+
+        template<size_t... I>
+        std::tuple<Included&...> FetchComponents(size_t position, std::index_sequence<I...>) const
+        {
+            const Entity entity = m_DriverEntities[position];
+            return std::tuple<Included&...>(FetchOne<I>(entity, position)...);
+        }
+
+        // Build the argument tuple matching fn's signature
+        template<typename Fn>
+        auto ArgsFor(size_t position) const
+        {
+            if constexpr (std::is_invocable_v<Fn&, Entity, Included&...>)
+                return Fetch(position, Indices{});
+            else
+                return FetchComponents(position, Indices{});
+        }
+
+        IncludedStorages m_Included;
+        ExcludedStorages m_Excluded;
+
+        size_t m_Driver = 0;
+        const Entity* m_DriverEntities = nullptr;
+        size_t m_DriverSize = 0;
+
+        std::array<ChangeFilter, MaxFilters> m_Filters{};
+        size_t m_FilterCount = 0;
+    };
+
+}
@@ -1,108 +1,323 @@
 #include "ggpch.h"
 #include "ParticleSystem.h"
 #include "Random.h"
-#include "GGEngine/Renderer/Renderer2D.h"
+#include "GGEngine/Renderer/InstancedRenderer2D.h"
 #include "GGEngine/Core/Math.h"
+#include "GGEngine/Core/SIMD.h"
+#include "GGEngine/Core/TaskGraph.h"
+#include "GGEngine/Core/Profiler.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstring>
 
 namespace GGEngine {
 
+    namespace {
+
+        // Particles per SIMD step
+        constexpr uint32_t Lanes = 4;
+
+        // Smallest run of SIMD steps worth handing to another thread
+        constexpr size_t MinGroupsPerTask = 1024;
+
+        constexpr float RotationSpeed = 0.01f;   // Radians per second
+
+        // WriteInstances stores each instance as five 4-float rows
+        static_assert(offsetof(QuadInstanceData, Position) == 0 &&
+                      offsetof(QuadInstanceData, Rotation) == 3 * sizeof(float) &&
+                      offsetof(QuadInstanceData, Scale) == 4 * sizeof(float) &&
+                      offsetof(QuadInstanceData, Color) == 8 * sizeof(float) &&
+                      offsetof(QuadInstanceData, TexCoords) == 12 * sizeof(float) &&
+                      offsetof(QuadInstanceData, TexIndex) == 16 * sizeof(float) &&
+                      offsetof(QuadInstanceData, TilingFactor) == 17 * sizeof(float),
+                      "WriteInstances stores QuadInstanceData as 4-float rows");
+
+    }
+
     ParticleSystem::ParticleSystem(uint32_t maxParticles)
+        : ParticleSystem(maxParticles, Random::NextStreamSeed())
+    {
+    }
+
+    ParticleSystem::ParticleSystem(uint32_t maxParticles, uint64_t seed)
+        : m_MaxParticles(maxParticles), m_Random(seed)
     {
-        m_ParticlePool.resize(maxParticles);
+        const size_t capacity = (static_cast<size_t>(maxParticles) + Lanes - 1) / Lanes * Lanes;
+        for (auto& column : m_Columns)
+            column.resize(capacity);
     }
 
     void ParticleSystem::Emit(const ParticleProps& props)
     {
-        Particle& particle = m_ParticlePool[m_PoolIndex];
-        particle.Active = true;
-        particle.Position[0] = props.Position[0];
-        particle.Position[1] = props.Position[1];
-        particle.Rotation = Random::Float() * Math::TwoPi;
+        if (m_MaxParticles == 0)
+            return;
+
+        uint32_t i;
+        if (m_ActiveCount < m_MaxParticles)
+        {
+            i = m_ActiveCount++;
+        }
+        else
+        {
+            i = m_RecycleIndex;
+            m_RecycleIndex = (m_RecycleIndex + 1) % m_MaxParticles;
+        }
+
+        GetColumn(PositionX)[i] = props.Position[0];
+        GetColumn(PositionY)[i] = props.Position[1];
+        GetColumn(Rotation)[i] = m_Random.NextFloat() * Math::TwoPi;
 
         // Velocity with variation
-        particle.Velocity[0] = props.Velocity[0] + props.VelocityVariation[0] * (Random::Float() - 0.5f);
-        particle.Velocity[1] = props.Velocity[1] + props.VelocityVariation[1] * (Random::Float() - 0.5f);
+        GetColumn(VelocityX)[i] = props.Velocity[0] + props.VelocityVariation[0] * (m_Random.NextFloat() - 0.5f);
+        GetColumn(VelocityY)[i] = props.Velocity[1] + props.VelocityVariation[1] * (m_Random.NextFloat() - 0.5f);
 
         // Color
-        particle.ColorBegin[0] = props.ColorBegin[0];
-        particle.ColorBegin[1] = props.ColorBegin[1];
-        particle.ColorBegin[2] = props.ColorBegin[2];
-        particle.ColorBegin[3] = props.ColorBegin[3];
-        particle.ColorEnd[0] = props.ColorEnd[0];
-        particle.ColorEnd[1] = props.ColorEnd[1];
-        particle.ColorEnd[2] = props.ColorEnd[2];
-        particle.ColorEnd[3] = props.ColorEnd[3];
+        for (uint32_t channel = 0; channel < 4; channel++)
+        {
+            GetColumn(static_cast<Column>(ColorBeginR + channel))[i] = props.ColorBegin[channel];
+            GetColumn(static_cast<Column>(ColorEndR + channel))[i] = props.ColorEnd[channel];
+        }
 
         // Size with variation
-        particle.SizeBegin = props.SizeBegin + props.SizeVariation * (Random::Float() - 0.5f);
-        particle.SizeEnd = props.SizeEnd;
+        GetColumn(SizeBegin)[i] = props.SizeBegin + props.SizeVariation * (m_Random.NextFloat() - 0.5f);
+        GetColumn(SizeEnd)[i] = props.SizeEnd;
 
         // Life
-        particle.LifeTime = props.LifeTime;
-        particle.LifeRemaining = props.LifeTime;
+        GetColumn(LifeRemaining)[i] = props.LifeTime;
+        GetColumn(InverseLifeTime)[i] = props.LifeTime > 0.0f ? 1.0f / props.LifeTime : 0.0f;
+    }
+
+    void ParticleSystem::Spawn(const ParticleSpawnParams& params, uint32_t count)
+    {
+        count = std::min(count, m_MaxParticles);
+        if (count == 0)
+            return;
 
-        m_PoolIndex = (m_PoolIndex + 1) % m_ParticlePool.size();
+        // Free slots first, then reuse live ones round-robin like Emit; that
+        // wraps at most once, so every run is contiguous
+        const uint32_t fresh = std::min(count, m_MaxParticles - m_ActiveCount);
+        SpawnRange(params, m_ActiveCount, fresh);
+        m_ActiveCount += fresh;
+
+        uint32_t reused = count - fresh;
+        while (reused > 0)
+        {
+            const uint32_t run = std::min(reused, m_MaxParticles - m_RecycleIndex);
+            SpawnRange(params, m_RecycleIndex, run);
+            m_RecycleIndex = (m_RecycleIndex + run) % m_MaxParticles;
+            reused -= run;
+        }
+    }
+
+    void ParticleSystem::SpawnRange(const ParticleSpawnParams& params, uint32_t first, uint32_t count)
+    {
+        if (count == 0)
+            return;
+
+        auto fill = [&](Column column, float value) { std::fill_n(GetColumn(column) + first, count, value); };
+        fill(PositionX, params.Position[0]);
+        fill(PositionY, params.Position[1]);
+        fill(SizeEnd, params.SizeEnd);
+        for (uint32_t channel = 0; channel < 4; channel++)
+        {
+            fill(static_cast<Column>(ColorBeginR + channel), params.ColorBegin[channel]);
+            fill(static_cast<Column>(ColorEndR + channel), params.ColorEnd[channel]);
+        }
+
+        m_Random.Fill(GetColumn(Rotation) + first, count, 0.0f, Math::TwoPi);
+
+        // Each varied value is within half its variation of the base
+        auto fillVaried = [&](Column column, float base, float variation) {
+            m_Random.Fill(GetColumn(column) + first, count, base - variation * 0.5f, base + variation * 0.5f);
+        };
+        fillVaried(SizeBegin, params.SizeBegin, params.SizeVariation);
+        fillVaried(LifeRemaining, params.LifeTime, params.LifeTimeVariation);
+
+        // Angle and speed go in the velocity columns until converted below
+        fillVaried(VelocityX, params.Direction, params.Spread);
+        fillVaried(VelocityY, params.Speed, params.SpeedVariation);
+
+        float* velocityX = GetColumn(VelocityX) + first;
+        float* velocityY = GetColumn(VelocityY) + first;
+        const float* life = GetColumn(LifeRemaining) + first;
+        float* inverseLife = GetColumn(InverseLifeTime) + first;
+        for (uint32_t i = 0; i < count; i++)
+            inverseLife[i] = life[i] > 0.0f ? 1.0f / life[i] : 0.0f;
+
+        using namespace Simd;
+        uint32_t i = 0;
+        for (; i + Lanes <= count; i += Lanes)
+        {
+            Float4 sine, cosine;
+            SinCos(Load(velocityX + i), sine, cosine);
+            const Float4 speed = Load(velocityY + i);
+            Store(velocityX + i, cosine * speed);
+            Store(velocityY + i, sine * speed);
+        }
+        for (; i < count; i++)
+        {
+            const float angle = velocityX[i];
+            const float speed = velocityY[i];
+            velocityX[i] = std::cos(angle) * speed;
+            velocityY[i] = std::sin(angle) * speed;
+        }
     }
 
     void ParticleSystem::OnUpdate(Timestep ts)
     {
-        for (auto& particle : m_ParticlePool)
+        if (m_ActiveCount == 0)
+            return;
+
+        using namespace Simd;
+
+        const float dt = ts;
+        const uint32_t count = m_ActiveCount;
+        const size_t groups = (count + Lanes - 1) / Lanes;
+
+        float* positionX = GetColumn(PositionX);
+        float* positionY = GetColumn(PositionY);
+        const float* velocityX = GetColumn(VelocityX);
+        const float* velocityY = GetColumn(VelocityY);
+        float* rotation = GetColumn(Rotation);
+        float* life = GetColumn(LifeRemaining);
+
+        // Integrate four particles per step; lanes past count hold stale data and
+        // are updated harmlessly. Each chunk lists the particles that died in it
+        // in its own dead list, which keeps its capacity from frame to frame.
+        const size_t grain = TaskGraph::Get().GetParallelGrain(groups, MinGroupsPerTask);
+        const size_t chunks = (groups + grain - 1) / grain;
+        if (m_DeadLists.size() < chunks)
+            m_DeadLists.resize(chunks);
+        std::vector<uint32_t>* deadLists = m_DeadLists.data();
+
+        TaskGraph::Get().ParallelFor(0, groups, MinGroupsPerTask, [=](size_t firstGroup, size_t lastGroup)
         {
-            if (!particle.Active)
-                continue;
+            const Float4 step = Splat(dt);
+            const Float4 spin = Splat(RotationSpeed * dt);
+            const Float4 zero = Splat(0.0f);
 
-            if (particle.LifeRemaining <= 0.0f)
+            std::vector<uint32_t>& died = deadLists[firstGroup / grain];
+            died.clear();
+            for (size_t group = firstGroup; group < lastGroup; group++)
             {
-                particle.Active = false;
-                continue;
+                const size_t i = group * Lanes;
+
+                const Float4 remaining = Load(life + i) - step;
+                Store(life + i, remaining);
+                Store(positionX + i, Load(positionX + i) + Load(velocityX + i) * step);
+                Store(positionY + i, Load(positionY + i) + Load(velocityY + i) * step);
+                Store(rotation + i, Load(rotation + i) + spin);
+
+                int mask = MoveMask(LessEqual(remaining, zero));
+                if (mask == 0)
+                    continue;
+
+                for (uint32_t lane = 0; lane < Lanes; lane++)
+                {
+                    if ((mask & (1 << lane)) && i + lane < count)
+                        died.push_back(static_cast<uint32_t>(i + lane));
+                }
             }
+        });
+
+        RemoveDead(chunks);
+    }
 
-            particle.LifeRemaining -= ts;
-            particle.Position[0] += particle.Velocity[0] * ts;
-            particle.Position[1] += particle.Velocity[1] * ts;
-            particle.Rotation += 0.01f * ts;
+    void ParticleSystem::RemoveDead(size_t chunks)
+    {
+        // Highest first: everything past the slot being filled is then alive, so
+        // the last live particle can always move into it. Chunks cover ascending
+        // ranges and list their slots in order, so walking them backwards is enough.
+        for (size_t chunk = chunks; chunk-- > 0;)
+        {
+            const std::vector<uint32_t>& dead = m_DeadLists[chunk];
+            for (auto it = dead.rbegin(); it != dead.rend(); ++it)
+            {
+                const uint32_t slot = *it;
+                const uint32_t last = --m_ActiveCount;
+                if (slot != last)
+                {
+                    for (auto& column : m_Columns)
+                        column[slot] = column[last];
+                }
+            }
         }
     }
 
+    void ParticleSystem::WriteInstances(QuadInstanceData* out, uint32_t whiteTextureIndex) const
+    {
+        using namespace Simd;
+
+        const uint32_t count = m_ActiveCount;
+        const size_t groups = (count + Lanes - 1) / Lanes;
+
+        float textureIndexBits;
+        std::memcpy(&textureIndexBits, &whiteTextureIndex, sizeof(float));
+
+        TaskGraph::Get().ParallelFor(0, groups, MinGroupsPerTask, [&](size_t firstGroup, size_t lastGroup)
+        {
+            const Float4 zero = Splat(0.0f);
+            const Float4 texCoords = Set(0.0f, 0.0f, 1.0f, 1.0f);
+            const Float4 texture = Set(textureIndexBits, 1.0f, 0.0f, 0.0f);
+
+            for (size_t group = firstGroup; group < lastGroup; group++)
+            {
+                const size_t i = group * Lanes;
+
+                // Life progress: 1 = just born, 0 = dead
+                const Float4 t = Load(GetColumn(LifeRemaining) + i) * Load(GetColumn(InverseLifeTime) + i);
+                auto lerp = [&](Column begin, Column end) {
+                    const Float4 to = Load(GetColumn(end) + i);
+                    return to + (Load(GetColumn(begin) + i) - to) * t;
+                };
+
+                // Columns become one (x y z rotation), (w h) and (r g b a) row per particle
+                Float4 head0 = Load(GetColumn(PositionX) + i), head1 = Load(GetColumn(PositionY) + i);
+                Float4 head2 = zero, head3 = Load(GetColumn(Rotation) + i);
+                Transpose(head0, head1, head2, head3);
+
+                Float4 scale0 = lerp(SizeBegin, SizeEnd), scale1 = scale0, scale2 = zero, scale3 = zero;
+                Transpose(scale0, scale1, scale2, scale3);
+
+                Float4 color0 = lerp(ColorBeginR, ColorEndR), color1 = lerp(ColorBeginG, ColorEndG);
+                Float4 color2 = lerp(ColorBeginB, ColorEndB), color3 = lerp(ColorBeginA, ColorEndA);
+                Transpose(color0, color1, color2, color3);
+
+                const Float4 heads[Lanes] = { head0, head1, head2, head3 };
+                const Float4 scales[Lanes] = { scale0, scale1, scale2, scale3 };
+                const Float4 colors[Lanes] = { color0, color1, color2, color3 };
+
+                const uint32_t lanes = static_cast<uint32_t>(std::min<size_t>(Lanes, count - i));
+                for (uint32_t lane = 0; lane < lanes; lane++)
+                {
+                    float* dst = reinterpret_cast<float*>(out + i + lane);
+                    Store(dst, heads[lane]);
+                    Store(dst + 4, scales[lane]);
+                    Store(dst + 8, colors[lane]);
+                    Store(dst + 12, texCoords);
+                    Store(dst + 16, texture);
+                }
+            }
+        });
+    }
+
     void ParticleSystem::OnRender(const Camera& camera)
     {
-        Renderer2D::BeginScene(camera);
+        GG_PROFILE_FUNCTION();
+        InstancedRenderer2D::BeginScene(camera);
 
-        for (auto& particle : m_ParticlePool)
+        if (m_ActiveCount > 0)
         {
-            if (!particle.Active)
-                continue;
-
-            // Calculate life progress (1.0 = just born, 0.0 = dead)
-            float life = particle.LifeRemaining / particle.LifeTime;
-
-            // Interpolate color
-            float r = particle.ColorEnd[0] + (particle.ColorBegin[0] - particle.ColorEnd[0]) * life;
-            float g = particle.ColorEnd[1] + (particle.ColorBegin[1] - particle.ColorEnd[1]) * life;
-            float b = particle.ColorEnd[2] + (particle.ColorBegin[2] - particle.ColorEnd[2]) * life;
-            float a = particle.ColorEnd[3] + (particle.ColorBegin[3] - particle.ColorEnd[3]) * life;
-
-            // Interpolate size
-            float size = particle.SizeEnd + (particle.SizeBegin - particle.SizeEnd) * life;
-
-            // Draw particle using QuadSpec
-            QuadSpec spec;
-            spec.x = particle.Position[0];
-            spec.y = particle.Position[1];
-            spec.z = 0.0f;
-            spec.width = size;
-            spec.height = size;
-            spec.rotation = particle.Rotation;
-            spec.color[0] = r;
-            spec.color[1] = g;
-            spec.color[2] = b;
-            spec.color[3] = a;
-            Renderer2D::DrawQuad(spec);
+            QuadInstanceData* instances = InstancedRenderer2D::AllocateInstances(m_ActiveCount);
+            if (instances)
+                WriteInstances(instances, InstancedRenderer2D::GetWhiteTextureIndex());
+            else
+                GG_CORE_WARN("ParticleSystem::OnRender - Failed to allocate {} instances", m_ActiveCount);
         }
 
-        Renderer2D::EndScene();
+        InstancedRenderer2D::EndScene();
     }
 
 }
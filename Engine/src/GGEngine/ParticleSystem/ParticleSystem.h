@@ -2,6 +2,7 @@
 
 #include "GGEngine/Core/Core.h"
 #include "GGEngine/Core/Timestep.h"
+#include "GGEngine/Core/RandomStream.h"
 #include "GGEngine/Renderer/Camera.h"
 
 #include <vector>
@@ -9,6 +10,8 @@
 
 namespace GGEngine {
 
+    struct QuadInstanceData;
+
     struct GG_API ParticleProps
     {
         float Position[2] = { 0.0f, 0.0f };
@@ -22,34 +25,96 @@ namespace GGEngine {
         float LifeTime = 1.0f;
     };
 
+    // Shared starting state for a run of particles spawned together. Each
+    // particle picks its direction within Spread around Direction and varies
+    // speed, lifetime and starting size by up to half the given variation.
+    struct GG_API ParticleSpawnParams
+    {
+        float Position[2] = { 0.0f, 0.0f };
+        float Direction = 0.0f;         // Radians, counter-clockwise from +x
+        float Spread = 0.0f;            // Cone width around Direction in radians
+        float Speed = 1.0f;
+        float SpeedVariation = 0.0f;
+        float LifeTime = 1.0f;
+        float LifeTimeVariation = 0.0f;
+        float ColorBegin[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        float ColorEnd[4] = { 1.0f, 1.0f, 1.0f, 0.0f };
+        float SizeBegin = 1.0f;
+        float SizeEnd = 0.0f;
+        float SizeVariation = 0.0f;
+    };
+
+    // Fixed-capacity pool of 2D particles.
+    //
+    // Particles are stored as structure-of-arrays with the live ones packed at
+    // the front: a particle that dies is replaced by the last live one. Update
+    // and render therefore only touch live particles, four at a time with SIMD
+    // (see Core/SIMD.h), and large pools are split across TaskGraph workers.
+    // Live order is not emission order.
+    // Randomness comes from a per-pool stream, so a pool's particles depend
+    // only on its seed and its own calls. The seed is either given (e.g.
+    // Random::GetStreamSeed of the owning entity) or taken from
+    // Random::NextStreamSeed, i.e. from the pool's creation order.
     class GG_API ParticleSystem
     {
     public:
         ParticleSystem(uint32_t maxParticles = 10000);
+        ParticleSystem(uint32_t maxParticles, uint64_t seed);
 
+        // Spawn a particle. A full pool reuses a live particle's slot, cycling
+        // through the pool.
         void Emit(const ParticleProps& props);
+
+        // Spawn count particles at once, writing each column in one pass.
+        // Reuses slots like Emit when the pool is full.
+        void Spawn(const ParticleSpawnParams& params, uint32_t count);
+
         void OnUpdate(Timestep ts);
+
+        // Draw every live particle with InstancedRenderer2D
         void OnRender(const Camera& camera);
 
+        // Write one instance per live particle to out, which must hold
+        // GetActiveCount() entries
+        void WriteInstances(QuadInstanceData* out, uint32_t whiteTextureIndex) const;
+
+        uint32_t GetActiveCount() const { return m_ActiveCount; }
+        uint32_t GetMaxParticles() const { return m_MaxParticles; }
+
+        // Kill every particle
+        void Clear() { m_ActiveCount = 0; }
+
     private:
-        struct Particle
+        enum Column : uint32_t
         {
-            float Position[2] = { 0.0f, 0.0f };
-            float Velocity[2] = { 0.0f, 0.0f };
-            float ColorBegin[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-            float ColorEnd[4] = { 1.0f, 1.0f, 1.0f, 0.0f };
-            float Rotation = 0.0f;
-            float SizeBegin = 1.0f;
-            float SizeEnd = 0.0f;
-
-            float LifeTime = 1.0f;
-            float LifeRemaining = 0.0f;
-
-            bool Active = false;
+            PositionX, PositionY,
+            VelocityX, VelocityY,
+            Rotation,
+            SizeBegin, SizeEnd,
+            LifeRemaining, InverseLifeTime,
+            ColorBeginR, ColorBeginG, ColorBeginB, ColorBeginA,
+            ColorEndR, ColorEndG, ColorEndB, ColorEndA,
+            ColumnCount
         };
 
-        std::vector<Particle> m_ParticlePool;
-        uint32_t m_PoolIndex = 0;
+        float* GetColumn(Column column) { return m_Columns[column].data(); }
+        const float* GetColumn(Column column) const { return m_Columns[column].data(); }
+
+        void SpawnRange(const ParticleSpawnParams& params, uint32_t first, uint32_t count);
+        void RemoveDead(size_t chunks);
+
+        // Each column holds m_MaxParticles rounded up to a multiple of 4, so
+        // SIMD steps never run past the end
+        std::vector<float> m_Columns[ColumnCount];
+        uint32_t m_MaxParticles = 0;
+        uint32_t m_ActiveCount = 0;
+        uint32_t m_RecycleIndex = 0;   // Next slot reused when the pool is full
+
+        // Slots that died in each OnUpdate chunk; kept so steady frames don't allocate
+        std::vector<std::vector<uint32_t>> m_DeadLists;
+
+        // The pool's own stream, so separate pools can emit from separate threads
+        RandomStream m_Random;
     };
 
 }
@@ -1,21 +1,87 @@
 #include "ggpch.h"
 #include "Random.h"
 
+#include <atomic>
 #include <random>
 
 namespace GGEngine {
 
-    static std::mt19937 s_RandomEngine;
-    static std::uniform_real_distribution<float> s_Distribution(0.0f, 1.0f);
+    namespace {
+
+        // Until Init, every run draws the same numbers
+        constexpr uint64_t DefaultSeed = 5489;
+
+        std::atomic<uint64_t> s_Seed{ DefaultSeed };
+        std::atomic<uint32_t> s_Generation{ 0 };     // Bumped by Init so threads reseed
+        std::atomic<uint64_t> s_ThreadCount{ 0 };
+        std::atomic<uint64_t> s_StreamCount{ 0 };
+
+        // Thread streams, NextStreamSeed and GetStreamSeed draw from disjoint index ranges
+        constexpr uint64_t ThreadStreamBit = 1ull << 63;
+        constexpr uint64_t KeyedStreamBit = 1ull << 62;
+
+        struct ThreadStream
+        {
+            RandomStream Stream;
+            uint64_t Index = s_ThreadCount.fetch_add(1, std::memory_order_relaxed);
+            uint32_t Generation = ~0u;
+        };
+
+    }
 
     void Random::Init()
     {
-        s_RandomEngine.seed(std::random_device()());
+        std::random_device device;
+        const uint64_t seed = (static_cast<uint64_t>(device()) << 32) | device();
+        Init(seed);
+    }
+
+    void Random::Init(uint64_t seed)
+    {
+        s_Seed.store(seed, std::memory_order_relaxed);
+        s_StreamCount.store(0, std::memory_order_relaxed);
+        s_Generation.fetch_add(1, std::memory_order_release);
     }
 
     float Random::Float()
     {
-        return s_Distribution(s_RandomEngine);
+        return GetThreadStream().NextFloat();
+    }
+
+    float Random::Float(float min, float max)
+    {
+        return GetThreadStream().NextFloat(min, max);
+    }
+
+    void Random::Fill(float* out, size_t count)
+    {
+        GetThreadStream().Fill(out, count);
+    }
+
+    RandomStream& Random::GetThreadStream()
+    {
+        static thread_local ThreadStream t_Stream;
+
+        const uint32_t generation = s_Generation.load(std::memory_order_acquire);
+        if (t_Stream.Generation != generation)
+        {
+            t_Stream.Stream.Seed(RandomStream::DeriveSeed(s_Seed.load(std::memory_order_relaxed),
+                                                          t_Stream.Index | ThreadStreamBit));
+            t_Stream.Generation = generation;
+        }
+        return t_Stream.Stream;
+    }
+
+    uint64_t Random::NextStreamSeed()
+    {
+        const uint64_t index = s_StreamCount.fetch_add(1, std::memory_order_relaxed);
+        return RandomStream::DeriveSeed(s_Seed.load(std::memory_order_relaxed), index);
+    }
+
+    uint64_t Random::GetStreamSeed(uint64_t key)
+    {
+        GG_CORE_ASSERT(key < KeyedStreamBit, "Stream key out of range");
+        return RandomStream::DeriveSeed(s_Seed.load(std::memory_order_relaxed), key | KeyedStreamBit);
     }
 
 }
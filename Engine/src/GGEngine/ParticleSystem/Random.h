@@ -1,14 +1,44 @@
 #pragma once
 
 #include "GGEngine/Core/Core.h"
+#include "GGEngine/Core/RandomStream.h"
+
+#include <cstddef>
+#include <cstdint>
 
 namespace GGEngine {
 
+    // Global random numbers, safe to call from any thread.
+    //
+    // Each thread draws from its own RandomStream, seeded from the Init seed
+    // and the order in which threads first use Random. A thread's sequence is
+    // therefore reproducible for a fixed seed, but which worker gets which
+    // stream is not; simulations that must replay exactly should own a
+    // stream seeded from NextStreamSeed or GetStreamSeed (as ParticleSystem
+    // does).
     class GG_API Random
     {
     public:
+        // Reseed every thread's stream: from std::random_device, or from a
+        // fixed seed for replays. Also restarts NextStreamSeed.
         static void Init();
-        static float Float();  // Returns [0.0, 1.0]
+        static void Init(uint64_t seed);
+
+        static float Float();                           // [0, 1)
+        static float Float(float min, float max);       // [min, max)
+        static void Fill(float* out, size_t count);     // [0, 1)
+
+        // The calling thread's stream
+        static RandomStream& GetThreadStream();
+
+        // Seed for a new independent stream; the n-th call after Init(seed)
+        // always returns the same value
+        static uint64_t NextStreamSeed();
+
+        // Seed for the stream identified by key (e.g. an entity). Unlike
+        // NextStreamSeed it doesn't depend on call order, so streams created
+        // from worker threads still replay exactly after Init(seed).
+        static uint64_t GetStreamSeed(uint64_t key);
     };
 
 }
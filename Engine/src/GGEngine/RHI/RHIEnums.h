@@ -246,6 +246,73 @@ namespace GGEngine {
         }
     }
 
+    // Bytes per texel of uncompressed formats; 0 for Undefined and block-compressed formats
+    inline uint32_t GetTexelSize(TextureFormat format)
+    {
+        switch (format)
+        {
+            case TextureFormat::R8_UNORM:
+            case TextureFormat::R8_SNORM:
+            case TextureFormat::R8_UINT:
+            case TextureFormat::R8_SINT:
+            case TextureFormat::S8_UINT:
+                return 1;
+            case TextureFormat::R8G8_UNORM:
+            case TextureFormat::R8G8_SNORM:
+            case TextureFormat::R8G8_UINT:
+            case TextureFormat::R8G8_SINT:
+            case TextureFormat::R16_UNORM:
+            case TextureFormat::R16_SNORM:
+            case TextureFormat::R16_UINT:
+            case TextureFormat::R16_SINT:
+            case TextureFormat::R16_SFLOAT:
+            case TextureFormat::D16_UNORM:
+                return 2;
+            case TextureFormat::R8G8B8_UNORM:
+            case TextureFormat::R8G8B8_SRGB:
+                return 3;
+            case TextureFormat::R8G8B8A8_UNORM:
+            case TextureFormat::R8G8B8A8_SNORM:
+            case TextureFormat::R8G8B8A8_UINT:
+            case TextureFormat::R8G8B8A8_SINT:
+            case TextureFormat::R8G8B8A8_SRGB:
+            case TextureFormat::B8G8R8A8_UNORM:
+            case TextureFormat::B8G8R8A8_SRGB:
+            case TextureFormat::R16G16_UNORM:
+            case TextureFormat::R16G16_SNORM:
+            case TextureFormat::R16G16_UINT:
+            case TextureFormat::R16G16_SINT:
+            case TextureFormat::R16G16_SFLOAT:
+            case TextureFormat::R32_UINT:
+            case TextureFormat::R32_SINT:
+            case TextureFormat::R32_SFLOAT:
+            case TextureFormat::D32_SFLOAT:
+            case TextureFormat::D24_UNORM_S8_UINT:
+                return 4;
+            case TextureFormat::D32_SFLOAT_S8_UINT:
+                return 5;
+            case TextureFormat::R16G16B16A16_UNORM:
+            case TextureFormat::R16G16B16A16_SNORM:
+            case TextureFormat::R16G16B16A16_UINT:
+            case TextureFormat::R16G16B16A16_SINT:
+            case TextureFormat::R16G16B16A16_SFLOAT:
+            case TextureFormat::R32G32_UINT:
+            case TextureFormat::R32G32_SINT:
+            case TextureFormat::R32G32_SFLOAT:
+                return 8;
+            case TextureFormat::R32G32B32_UINT:
+            case TextureFormat::R32G32B32_SINT:
+            case TextureFormat::R32G32B32_SFLOAT:
+                return 12;
+            case TextureFormat::R32G32B32A32_UINT:
+            case TextureFormat::R32G32B32A32_SINT:
+            case TextureFormat::R32G32B32A32_SFLOAT:
+                return 16;
+            default:
+                return 0;
+        }
+    }
+
     // ============================================================================
     // Texture Filter Mode
     // ============================================================================
@@ -403,4 +470,14 @@ namespace GGEngine {
         Present
     };
 
+    // ============================================================================
+    // Buffer Memory Access (for RHIMemoryBarrier)
+    // ============================================================================
+    enum class MemoryAccess : uint8_t
+    {
+        None,
+        TransferWrite,      // Copy destination
+        DrawRead            // Vertex, index, uniform and shader reads of draws
+    };
+
 }
@@ -316,10 +316,17 @@ namespace GGEngine {
         uint32_t layerCount = 1;
     };
 
+    // Orders buffer accesses; applies to all buffers like a global memory barrier
+    struct GG_API RHIMemoryBarrier
+    {
+        MemoryAccess srcAccess = MemoryAccess::TransferWrite;
+        MemoryAccess dstAccess = MemoryAccess::DrawRead;
+    };
+
     struct GG_API RHIPipelineBarrier
     {
         std::vector<RHIImageBarrier> imageBarriers;
-        // Buffer barriers can be added here if needed
+        std::vector<RHIMemoryBarrier> memoryBarriers;
     };
 
 }
@@ -1,5 +1,6 @@
 #include "ggpch.h"
 #include "InstancedRenderer2D.h"
+#include "RetainedInstanceBuffer.h"
 #include "Renderer2DBase.h"
 #include "Camera.h"
 #include "SceneCamera.h"
@@ -8,6 +9,7 @@
 #include "IndexBuffer.h"
 #include "VertexLayout.h"
 #include "RenderCommand.h"
+#include "TransferQueue.h"
 #include "GGEngine/Asset/Shader.h"
 #include "GGEngine/Asset/ShaderLibrary.h"
 #include "GGEngine/RHI/RHIDevice.h"
@@ -48,6 +50,19 @@ namespace GGEngine {
         std::unique_ptr<QuadInstanceData[]> InstanceBufferBase;
         std::atomic<uint32_t> InstanceCount{0};
 
+        // Retained instances, drawn from one device-local buffer shared by all
+        // frames. TransferQueue orders each rewrite after earlier frames' reads.
+        RetainedInstanceBuffer Retained;
+        Scope<VertexBuffer> RetainedGpuBuffer;
+        uint32_t RetainedGpuCapacity = 0;
+        Scope<VertexBuffer> RetiredRetainedBuffer;  // Replaced by growth; drawn until the new one is uploaded
+        std::vector<Scope<VertexBuffer>> RetiredInFlight[MaxFramesInFlight];  // No longer drawn; earlier frames may still read them
+        uint32_t RetiredSyncFrameIndex = UINT32_MAX;
+        uint32_t RetainedVisibleCount = 0;          // Instances the GPU holds for this frame's draws
+        uint32_t RetainedQueuedCount = 0;           // Instances it holds once queued uploads are flushed
+        uint64_t RetainedQueuedAtFlush = 0;         // TransferQueue flush count when they were queued
+        bool RetainedUploadsPending = false;
+
         // Shader
         AssetHandle<Shader> InstancedShader;
 
@@ -62,8 +77,11 @@ namespace GGEngine {
             { { -0.5f,  0.5f }, { 0.0f, 1.0f } }
         }};
 
+        static constexpr uint32_t MinRetainedCapacity = 1024;
+
         void Init(uint32_t initialMaxInstances);
         void Shutdown();
+        void SyncRetained();
         void Flush();
 
     protected:
@@ -151,6 +169,17 @@ namespace GGEngine {
 
         InstanceBufferBase.reset();
 
+        Retained.Clear();
+        RetainedGpuBuffer.reset();
+        RetiredRetainedBuffer.reset();
+        for (auto& retired : RetiredInFlight)
+            retired.clear();
+        RetiredSyncFrameIndex = UINT32_MAX;
+        RetainedGpuCapacity = 0;
+        RetainedVisibleCount = 0;
+        RetainedQueuedCount = 0;
+        RetainedUploadsPending = false;
+
         for (uint32_t i = 0; i < MaxFramesInFlight; i++)
         {
             InstanceBuffers[i].reset();
@@ -158,6 +187,10 @@ namespace GGEngine {
         QuadIndexBuffer.reset();
         StaticQuadBuffer.reset();
 
+        // Init pushes the attributes again
+        StaticVertexLayout = VertexLayout();
+        InstanceLayout = VertexLayout();
+
         InstancedShader = AssetHandle<Shader>();
 
         // Shutdown base class resources
@@ -232,17 +265,97 @@ namespace GGEngine {
                      MaxInstances, (MaxInstances * sizeof(QuadInstanceData)) / (1024 * 1024));
     }
 
+    void InstancedRenderer2DImpl::SyncRetained()
+    {
+        GG_PROFILE_FUNCTION();
+
+        auto& transfers = TransferQueue::Get();
+
+        // Buffers retired when this frame index last ran are no longer in use (its fence was waited)
+        if (m_CurrentFrameIndex != RetiredSyncFrameIndex)
+        {
+            RetiredInFlight[m_CurrentFrameIndex].clear();
+            RetiredSyncFrameIndex = m_CurrentFrameIndex;
+        }
+
+        // Once a flush has recorded the queued uploads, this frame's draws see them
+        if (RetainedUploadsPending && transfers.GetFlushCount() != RetainedQueuedAtFlush)
+        {
+            RetainedVisibleCount = RetainedQueuedCount;
+            RetainedUploadsPending = false;
+
+            // Frames still in flight may draw the retired buffer; free it when this index comes around again
+            if (RetiredRetainedBuffer)
+                RetiredInFlight[m_CurrentFrameIndex].push_back(std::move(RetiredRetainedBuffer));
+        }
+
+        const uint32_t size = Retained.Size();
+        if (!Retained.HasDirtySlots() && size == RetainedQueuedCount)
+            return;
+
+        if (size > RetainedGpuCapacity)
+        {
+            // Queued uploads still reference the current buffer; grow after they flush
+            if (RetainedUploadsPending)
+                return;
+
+            if (size > AbsoluteMaxInstances)
+            {
+                GG_CORE_WARN("InstancedRenderer2D: {} retained instances exceed the maximum of {}",
+                             size, AbsoluteMaxInstances);
+                return;
+            }
+
+            uint32_t capacity = std::max(std::max(RetainedGpuCapacity * 2, MinRetainedCapacity), size);
+            capacity = std::min(capacity, AbsoluteMaxInstances);
+
+            RetiredRetainedBuffer = std::move(RetainedGpuBuffer);
+            RetainedGpuBuffer = CreateScope<VertexBuffer>(
+                static_cast<uint64_t>(capacity) * sizeof(QuadInstanceData),
+                InstanceLayout
+            );
+            RetainedGpuCapacity = capacity;
+            Retained.MarkAllDirty();
+        }
+
+        // Each range becomes one staging copy, recorded at the next TransferQueue flush
+        const auto& ranges = Retained.TakeDirtyRanges();
+        for (const auto& range : ranges)
+        {
+            transfers.QueueBufferUpload(
+                RetainedGpuBuffer->GetHandle(),
+                Retained.Data() + range.First,
+                static_cast<uint64_t>(range.Count) * sizeof(QuadInstanceData),
+                static_cast<uint64_t>(range.First) * sizeof(QuadInstanceData)
+            );
+            Stats.RetainedUploadedInstances += range.Count;
+        }
+        Stats.RetainedUploadRanges += static_cast<uint32_t>(ranges.size());
+
+        RetainedQueuedCount = size;
+        RetainedQueuedAtFlush = transfers.GetFlushCount();
+        RetainedUploadsPending = true;
+    }
+
     void InstancedRenderer2DImpl::Flush()
     {
         GG_PROFILE_FUNCTION();
 
         uint32_t instanceCount = InstanceCount.load(std::memory_order_relaxed);
-        if (instanceCount == 0)
+
+        // Until growth has been uploaded, the retired buffer holds what is visible
+        VertexBuffer* retainedBuffer = RetiredRetainedBuffer ? RetiredRetainedBuffer.get() : RetainedGpuBuffer.get();
+        uint32_t retainedCount = retainedBuffer ? RetainedVisibleCount : 0;
+
+        if (instanceCount == 0 && retainedCount == 0)
             return;
 
         // Upload instance data to GPU
-        uint64_t dataSize = static_cast<uint64_t>(instanceCount) * sizeof(QuadInstanceData);
-        InstanceBuffers[m_CurrentFrameIndex]->SetData(InstanceBufferBase.get(), dataSize);
+        if (instanceCount > 0)
+        {
+            uint64_t dataSize = static_cast<uint64_t>(instanceCount) * sizeof(QuadInstanceData);
+            InstanceBuffers[m_CurrentFrameIndex]->SetData(InstanceBufferBase.get(), dataSize);
+        }
 
         // Set viewport and scissor
         SetViewportAndScissor();
@@ -256,17 +369,31 @@ namespace GGEngine {
 
         // Bind vertex buffers
         StaticQuadBuffer->Bind(m_CurrentCommandBuffer, 0);       // Binding 0: static quad
-        InstanceBuffers[m_CurrentFrameIndex]->Bind(m_CurrentCommandBuffer, 1);  // Binding 1: instance data
 
         // Bind index buffer
         QuadIndexBuffer->Bind(m_CurrentCommandBuffer);
 
-        // Draw instanced: 6 indices per quad, instanceCount instances
-        RHICmd::DrawIndexed(m_CurrentCommandBuffer, 6, instanceCount, 0, 0, 0);
+        // Retained instances first, so this frame's instances draw over them
+        if (retainedCount > 0)
+        {
+            retainedBuffer->Bind(m_CurrentCommandBuffer, 1);
+            RHICmd::DrawIndexed(m_CurrentCommandBuffer, 6, retainedCount, 0, 0, 0);
 
-        // Update stats
-        Stats.DrawCalls++;
-        Stats.InstanceCount = instanceCount;
+            Stats.DrawCalls++;
+            Stats.RetainedInstanceCount = retainedCount;
+        }
+
+        if (instanceCount > 0)
+        {
+            InstanceBuffers[m_CurrentFrameIndex]->Bind(m_CurrentCommandBuffer, 1);  // Binding 1: instance data
+
+            // Draw instanced: 6 indices per quad, instanceCount instances
+            RHICmd::DrawIndexed(m_CurrentCommandBuffer, 6, instanceCount, 0, 0, 0);
+
+            // Update stats
+            Stats.DrawCalls++;
+            Stats.InstanceCount = instanceCount;
+        }
     }
 
     // ============================================================================
@@ -323,6 +450,7 @@ namespace GGEngine {
     void InstancedRenderer2D::EndScene()
     {
         GG_PROFILE_FUNCTION();
+        s_Impl.SyncRetained();
         s_Impl.Flush();
         s_Impl.SetSceneStarted(false);
         s_Impl.ClearCommandBuffer();
@@ -362,6 +490,11 @@ namespace GGEngine {
         }
     }
 
+    RetainedInstanceBuffer& InstancedRenderer2D::GetRetainedInstances()
+    {
+        return s_Impl.Retained;
+    }
+
     uint32_t InstancedRenderer2D::GetWhiteTextureIndex()
     {
         return s_Impl.GetWhiteTextureIndex();
@@ -373,6 +506,12 @@ namespace GGEngine {
         s_Impl.Stats.MaxInstanceCapacity = s_Impl.MaxInstances;
     }
 
+    void InstancedRenderer2D::RecordCulling(uint32_t visible, uint32_t culled)
+    {
+        s_Impl.Stats.VisibleCount += visible;
+        s_Impl.Stats.CulledCount += culled;
+    }
+
     InstancedRenderer2D::Statistics InstancedRenderer2D::GetStats()
     {
         s_Impl.Stats.MaxInstanceCapacity = s_Impl.MaxInstances;
@@ -10,6 +10,7 @@ namespace GGEngine {
 
     class Camera;
     class SceneCamera;
+    class RetainedInstanceBuffer;
 
     // Per-instance data for GPU instancing (80 bytes, aligned)
     struct GG_API QuadInstanceData
@@ -99,6 +100,13 @@ namespace GGEngine {
         // Single instance submission (convenience, not thread-safe with AllocateInstances)
         static void SubmitInstance(const QuadInstanceData& instance);
 
+        // Retained instances persist across frames (see RetainedInstanceBuffer).
+        // EndScene uploads only the slots written since the last EndScene, via
+        // TransferQueue, and draws them before this frame's instances. Uploads
+        // are recorded at the next TransferQueue flush, so changes reach the
+        // screen one frame later - meant for sprites that rarely change.
+        static RetainedInstanceBuffer& GetRetainedInstances();
+
         // Get white texture index for solid color rendering
         static uint32_t GetWhiteTextureIndex();
 
@@ -108,10 +116,18 @@ namespace GGEngine {
             uint32_t DrawCalls = 0;
             uint32_t InstanceCount = 0;
             uint32_t MaxInstanceCapacity = 0;
+            uint32_t RetainedInstanceCount = 0;     // Retained instances drawn
+            uint32_t RetainedUploadedInstances = 0; // Retained slots queued for upload
+            uint32_t RetainedUploadRanges = 0;
+            uint32_t VisibleCount = 0;              // Instances that passed CPU culling (see ViewFrustum)
+            uint32_t CulledCount = 0;               // Instances rejected before being written
         };
 
         static void ResetStats();
         static Statistics GetStats();
+
+        // Add culling results from a render system to the statistics
+        static void RecordCulling(uint32_t visible, uint32_t culled);
     };
 
 }
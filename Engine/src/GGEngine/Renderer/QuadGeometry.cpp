@@ -0,0 +1,261 @@
+#include "ggpch.h"
+#include "QuadGeometry.h"
+#include "Renderer2D.h"
+#include "SubTexture2D.h"
+#include "GGEngine/Core/SIMD.h"
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstring>
+
+namespace GGEngine {
+
+    namespace {
+
+        // Unit quad corners (BL, BR, TR, TL), centered at the origin
+        constexpr float QuadPositions[4][2] = {
+            { -0.5f, -0.5f },
+            {  0.5f, -0.5f },
+            {  0.5f,  0.5f },
+            { -0.5f,  0.5f }
+        };
+
+        // Texture coordinates when the spec has none
+        constexpr float QuadTexCoords[4][2] = {
+            { 0.0f, 0.0f },
+            { 1.0f, 0.0f },
+            { 1.0f, 1.0f },
+            { 0.0f, 1.0f }
+        };
+
+        // What a spec samples: texture index, UVs and tiling
+        struct QuadMaterial
+        {
+            const float* TexCoords;   // 4 interleaved (u, v) pairs
+            float TilingFactor;
+            uint32_t TextureIndex;
+        };
+
+        QuadMaterial ResolveMaterial(const QuadSpec& spec, uint32_t whiteTextureIndex)
+        {
+            const Texture* texture = spec.texture;
+            QuadMaterial material;
+            material.TexCoords = spec.texCoords ? &spec.texCoords[0][0] : &QuadTexCoords[0][0];
+            material.TilingFactor = spec.tilingFactor;
+
+            if (spec.subTexture)
+            {
+                texture = spec.subTexture->GetTexture();
+                material.TexCoords = spec.subTexture->GetTexCoords();
+                material.TilingFactor = 1.0f;
+            }
+
+            material.TextureIndex = whiteTextureIndex;
+            if (texture != nullptr)
+            {
+                BindlessTextureIndex bindlessIdx = texture->GetBindlessIndex();
+                if (bindlessIdx != InvalidBindlessIndex)
+                {
+                    material.TextureIndex = bindlessIdx;
+                }
+            }
+            return material;
+        }
+
+        // Corner positions of the spec, from its transform or position/size/rotation
+        void ComputeQuadPositions(const QuadSpec& spec, float positions[4][3])
+        {
+            if (spec.transform)
+            {
+                static constexpr glm::vec4 unitQuadPositions[4] = {
+                    { -0.5f, -0.5f, 0.0f, 1.0f },
+                    {  0.5f, -0.5f, 0.0f, 1.0f },
+                    {  0.5f,  0.5f, 0.0f, 1.0f },
+                    { -0.5f,  0.5f, 0.0f, 1.0f }
+                };
+
+                for (int i = 0; i < 4; i++)
+                {
+                    glm::vec4 worldPos = *spec.transform * unitQuadPositions[i];
+                    positions[i][0] = worldPos.x;
+                    positions[i][1] = worldPos.y;
+                    positions[i][2] = worldPos.z;
+                }
+                return;
+            }
+
+            float cosR = 1.0f, sinR = 0.0f;
+            if (spec.rotation != 0.0f)
+            {
+                cosR = std::cos(spec.rotation);
+                sinR = std::sin(spec.rotation);
+            }
+
+            for (int i = 0; i < 4; i++)
+            {
+                float localX = QuadPositions[i][0] * spec.width;
+                float localY = QuadPositions[i][1] * spec.height;
+
+                positions[i][0] = spec.x + (localX * cosR - localY * sinR);
+                positions[i][1] = spec.y + (localX * sinR + localY * cosR);
+                positions[i][2] = spec.z;
+            }
+        }
+
+        void WriteQuadScalar(const QuadSpec& spec, uint32_t whiteTextureIndex, QuadVertex* vertex)
+        {
+            const QuadMaterial material = ResolveMaterial(spec, whiteTextureIndex);
+
+            float positions[4][3];
+            ComputeQuadPositions(spec, positions);
+
+            for (int i = 0; i < 4; i++, vertex++)
+            {
+                vertex->position[0] = positions[i][0];
+                vertex->position[1] = positions[i][1];
+                vertex->position[2] = positions[i][2];
+
+                vertex->texCoord[0] = material.TexCoords[i * 2 + 0];
+                vertex->texCoord[1] = material.TexCoords[i * 2 + 1];
+
+                vertex->color[0] = spec.color[0];
+                vertex->color[1] = spec.color[1];
+                vertex->color[2] = spec.color[2];
+                vertex->color[3] = spec.color[3];
+
+                vertex->tilingFactor = material.TilingFactor;
+                vertex->texIndex = material.TextureIndex;
+            }
+        }
+
+        constexpr size_t VertexFloats = sizeof(QuadVertex) / sizeof(float);
+
+        // One vertex as three 4-float stores; the last spills one float into
+        // the following vertex
+        inline void WriteVertex(float* dst, Simd::Float4 head, Simd::Float4 mid, Simd::Float4 tail)
+        {
+            Simd::Store(dst, head);
+            Simd::Store(dst + 4, mid);
+            Simd::Store(dst + 8, tail);
+        }
+
+        // Four specs without transforms -> 16 vertices
+        void WriteQuadGroup(const QuadSpec* specs, uint32_t whiteTextureIndex, QuadVertex* out)
+        {
+            using namespace Simd;
+
+            // Gather the group's placement into lanes. Set rather than filling
+            // float arrays: reloading those as vectors stalls on store forwarding.
+            const QuadSpec& s0 = specs[0];
+            const QuadSpec& s1 = specs[1];
+            const QuadSpec& s2 = specs[2];
+            const QuadSpec& s3 = specs[3];
+
+            Float4 sinR = Splat(0.0f);
+            Float4 cosR = Splat(1.0f);
+            if (s0.rotation != 0.0f || s1.rotation != 0.0f || s2.rotation != 0.0f || s3.rotation != 0.0f)
+                SinCos(Set(s0.rotation, s1.rotation, s2.rotation, s3.rotation), sinR, cosR);
+
+            // Rotated half extents: corner = center +/- (hw*c, hw*s) +/- (-hh*s, hh*c)
+            const Float4 centerX = Set(s0.x, s1.x, s2.x, s3.x);
+            const Float4 centerY = Set(s0.y, s1.y, s2.y, s3.y);
+            const Float4 hw = Set(s0.width, s1.width, s2.width, s3.width) * Splat(0.5f);
+            const Float4 hh = Set(s0.height, s1.height, s2.height, s3.height) * Splat(0.5f);
+            const Float4 ax = hw * cosR;
+            const Float4 ay = hw * sinR;
+            const Float4 bx = hh * sinR;
+            const Float4 by = hh * cosR;
+
+            // [corner][quad], transposed below to [quad][corner]
+            Float4 cornerX[4] = {
+                centerX - ax + bx,
+                centerX + ax + bx,
+                centerX + ax - bx,
+                centerX - ax - bx
+            };
+            Float4 cornerY[4] = {
+                centerY - ay - by,
+                centerY + ay - by,
+                centerY + ay + by,
+                centerY - ay + by
+            };
+            Transpose(cornerX[0], cornerX[1], cornerX[2], cornerX[3]);
+            Transpose(cornerY[0], cornerY[1], cornerY[2], cornerY[3]);
+
+            for (int q = 0; q < 4; q++)
+            {
+                const QuadSpec& spec = specs[q];
+                const QuadMaterial material = ResolveMaterial(spec, whiteTextureIndex);
+
+                Float4 u, v;
+                Deinterleave(Load(material.TexCoords), Load(material.TexCoords + 4), u, v);
+
+                // Columns of per-corner values become one row per vertex:
+                // (x y z u) and (v r g b), matching QuadVertex's first 8 floats
+                Float4 head0 = cornerX[q], head1 = cornerY[q], head2 = Splat(spec.z), head3 = u;
+                Transpose(head0, head1, head2, head3);
+                Float4 mid0 = v, mid1 = Splat(spec.color[0]), mid2 = Splat(spec.color[1]), mid3 = Splat(spec.color[2]);
+                Transpose(mid0, mid1, mid2, mid3);
+
+                // (a tiling texIndex) and one float of padding. Its 16-byte store
+                // runs into the next vertex's x, which that vertex's own store
+                // then overwrites; the group's last vertex ends the buffer, so
+                // it writes its tail field by field.
+                float textureIndexBits;
+                std::memcpy(&textureIndexBits, &material.TextureIndex, sizeof(float));
+                const Float4 tail = Set(spec.color[3], material.TilingFactor, textureIndexBits, 0.0f);
+
+                float* dst = reinterpret_cast<float*>(out + q * 4);
+                WriteVertex(dst, head0, mid0, tail);
+                WriteVertex(dst + VertexFloats, head1, mid1, tail);
+                WriteVertex(dst + VertexFloats * 2, head2, mid2, tail);
+                if (q < 3)
+                {
+                    WriteVertex(dst + VertexFloats * 3, head3, mid3, tail);
+                }
+                else
+                {
+                    QuadVertex* last = out + 15;
+                    Store(dst + VertexFloats * 3, head3);
+                    Store(dst + VertexFloats * 3 + 4, mid3);
+                    last->color[3] = spec.color[3];
+                    last->tilingFactor = material.TilingFactor;
+                    last->texIndex = material.TextureIndex;
+                }
+            }
+        }
+
+    }
+
+    static_assert(offsetof(QuadVertex, texCoord) == 3 * sizeof(float) &&
+                  offsetof(QuadVertex, color) == 5 * sizeof(float),
+                  "WriteQuadGroup stores (x y z u) and (v r g b) as two 4-float rows");
+
+    void GenerateQuadVertices(const QuadSpec* specs, size_t count,
+                              uint32_t whiteTextureIndex, QuadVertex* out)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const QuadSpec* group = specs + i;
+            if (group[0].transform || group[1].transform || group[2].transform || group[3].transform)
+            {
+                for (size_t q = 0; q < 4; q++)
+                    WriteQuadScalar(group[q], whiteTextureIndex, out + (i + q) * 4);
+                continue;
+            }
+            WriteQuadGroup(group, whiteTextureIndex, out + i * 4);
+        }
+
+        for (; i < count; i++)
+            WriteQuadScalar(specs[i], whiteTextureIndex, out + i * 4);
+    }
+
+    void GenerateQuadVerticesScalar(const QuadSpec* specs, size_t count,
+                                    uint32_t whiteTextureIndex, QuadVertex* out)
+    {
+        for (size_t i = 0; i < count; i++)
+            WriteQuadScalar(specs[i], whiteTextureIndex, out + i * 4);
+    }
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "GGEngine/Core/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GGEngine {
+
+    struct QuadSpec;
+
+    // Vertex structure for batched quads (bindless rendering)
+    struct QuadVertex
+    {
+        float position[3];     // World-space position (CPU-transformed)
+        float texCoord[2];     // UV coordinates
+        float color[4];        // RGBA color
+        float tilingFactor;    // Texture tiling multiplier
+        uint32_t texIndex;     // Bindless texture index (0 = white texture)
+    };
+
+    // GenerateQuadVertices writes each vertex as two 4-float stores plus a tail
+    static_assert(sizeof(QuadVertex) == 11 * sizeof(float), "QuadVertex must stay tightly packed");
+
+    // Write the 4 vertices (BL, BR, TR, TL) of each spec to out, which must
+    // hold count * 4 vertices. Textures resolve to their bindless index, or to
+    // whiteTextureIndex when missing or not yet registered.
+    //
+    // Specs without a transform matrix are processed four at a time with
+    // 4-wide SIMD (see Core/SIMD.h): positions and rotations for the group at
+    // once, then each vertex written as two wide stores. Results match
+    // GenerateQuadVerticesScalar to within float rounding.
+    GG_API void GenerateQuadVertices(const QuadSpec* specs, size_t count,
+                                     uint32_t whiteTextureIndex, QuadVertex* out);
+
+    // One quad at a time with std::sin/std::cos; the reference for the SIMD path
+    GG_API void GenerateQuadVerticesScalar(const QuadSpec* specs, size_t count,
+                                           uint32_t whiteTextureIndex, QuadVertex* out);
+
+}
@@ -5,31 +5,24 @@
 #include "Camera.h"
 #include "SceneCamera.h"
 #include "GGEngine/Core/Profiler.h"
+#include "GGEngine/Core/TaskGraph.h"
 #include "VertexBuffer.h"
 #include "IndexBuffer.h"
 #include "VertexLayout.h"
 #include "RenderCommand.h"
+#include "TransferQueue.h"
+#include "QuadGeometry.h"
 #include "GGEngine/Asset/Shader.h"
 #include "GGEngine/Asset/ShaderLibrary.h"
 #include "GGEngine/RHI/RHIDevice.h"
 #include "GGEngine/RHI/RHICommandBuffer.h"
 
 #include <glm/glm.hpp>
-#include <cmath>
-#include <array>
+#include <algorithm>
+#include <cstring>
 
 namespace GGEngine {
 
-    // Vertex structure for batched quads (bindless rendering)
-    struct QuadVertex
-    {
-        float position[3];     // World-space position (CPU-transformed)
-        float texCoord[2];     // UV coordinates
-        float color[4];        // RGBA color
-        float tilingFactor;    // Texture tiling multiplier
-        uint32_t texIndex;     // Bindless texture index (0 = white texture)
-    };
-
     // Implementation class inheriting from base
     class Renderer2DImpl : public Renderer2DBase
     {
@@ -64,25 +57,27 @@ namespace GGEngine {
         // Track frame for vertex offset reset
         uint32_t LastResetFrameIndex = UINT32_MAX;
 
-        // Unit quad vertex positions (centered at origin)
-        static constexpr std::array<float[3], 4> QuadPositions = {{
-            { -0.5f, -0.5f, 0.0f },
-            {  0.5f, -0.5f, 0.0f },
-            {  0.5f,  0.5f, 0.0f },
-            { -0.5f,  0.5f, 0.0f }
-        }};
-
-        // Quad texture coordinates
-        static constexpr std::array<float[2], 4> QuadTexCoords = {{
-            { 0.0f, 0.0f },
-            { 1.0f, 0.0f },
-            { 1.0f, 1.0f },
-            { 0.0f, 1.0f }
-        }};
+        // QuadMesh buffers start at this many quads
+        static constexpr uint32_t MinMeshCapacity = 256;
+
+        // QuadMesh buffers no longer drawn; frames in flight may still read them
+        std::vector<Scope<VertexBuffer>> RetiredMeshBuffers[MaxFramesInFlight];
+
+        // Parallel submission (Scope keeps handed-out references valid as this grows)
+        std::vector<Scope<QuadSubmitContext>> SubmitContexts;
+        uint32_t ActiveSubmitContexts = 0;
+        bool ParallelSubmitActive = false;
 
         void Init();
         void Shutdown();
         void Flush();
+        void DrawMesh(const VertexBuffer& buffer, uint32_t quadCount);
+        void RetireMeshBuffer(Scope<VertexBuffer> buffer);
+
+        // Quads that fit in the current batch, flushing it first if full.
+        // 0 means this frame's vertex buffer is full; growth has been requested.
+        uint32_t ReserveQuads();
+        void MergeSubmitContexts();
 
     protected:
         void OnBeginScene() override;
@@ -94,12 +89,6 @@ namespace GGEngine {
 
     static Renderer2DImpl s_Impl;
 
-    // Helper declarations
-    static bool PrepareForQuad(const Texture* texture, uint32_t& outTextureIndex);
-    static void WriteQuadVertices(const float positions[4][3], const float* texCoords,
-                                   float r, float g, float b, float a,
-                                   float tilingFactor, uint32_t textureIndex);
-
     // ============================================================================
     // Renderer2DImpl Implementation
     // ============================================================================
@@ -180,6 +169,18 @@ namespace GGEngine {
 
         QuadShader = AssetHandle<Shader>();
 
+        // Leave nothing for a later Init to pick up (layout, offsets of the last frame)
+        QuadVertexLayout = VertexLayout();
+        QuadIndexCount = 0;
+        QuadVertexOffset = 0;
+        LastResetFrameIndex = UINT32_MAX;
+        for (auto& retired : RetiredMeshBuffers)
+            retired.clear();
+
+        SubmitContexts.clear();
+        ActiveSubmitContexts = 0;
+        ParallelSubmitActive = false;
+
         // Shutdown base class resources
         ShutdownBase();
 
@@ -197,6 +198,9 @@ namespace GGEngine {
         {
             QuadVertexOffset = 0;
             LastResetFrameIndex = m_CurrentFrameIndex;
+
+            // Mesh buffers retired when this frame index last ran are no longer in use (its fence was waited)
+            RetiredMeshBuffers[m_CurrentFrameIndex].clear();
         }
     }
 
@@ -318,6 +322,112 @@ namespace GGEngine {
         QuadVertexBufferPtr = QuadVertexBufferBase.get();
     }
 
+    void Renderer2DImpl::DrawMesh(const VertexBuffer& buffer, uint32_t quadCount)
+    {
+        GG_PROFILE_FUNCTION();
+
+        // Keep draw order: quads batched so far go first
+        Flush();
+
+        SetViewportAndScissor();
+        m_Pipeline->Bind(m_CurrentCommandBuffer);
+        BindCameraDescriptorSet(m_Pipeline->GetLayoutHandle());
+        BindBindlessDescriptorSet(m_Pipeline->GetLayoutHandle());
+
+        buffer.Bind(m_CurrentCommandBuffer);
+        QuadIndexBuffer->Bind(m_CurrentCommandBuffer);
+
+        // The shared index buffer covers MaxQuads, so larger meshes take several draws
+        for (uint32_t first = 0; first < quadCount; first += MaxQuads)
+        {
+            const uint32_t count = std::min(quadCount - first, MaxQuads);
+            RHICmd::DrawIndexed(m_CurrentCommandBuffer, count * 6, 1, 0,
+                                static_cast<int32_t>(first * 4), 0);
+            Stats.DrawCalls++;
+        }
+        Stats.QuadCount += quadCount;
+    }
+
+    void Renderer2DImpl::RetireMeshBuffer(Scope<VertexBuffer> buffer)
+    {
+        // Freed when this frame index next begins a scene. Once Renderer2D is
+        // shut down nothing it drew is in flight, so the buffer goes now.
+        if (buffer && QuadVertexBufferBase)
+            RetiredMeshBuffers[m_CurrentFrameIndex].push_back(std::move(buffer));
+    }
+
+    uint32_t Renderer2DImpl::ReserveQuads()
+    {
+        if (QuadIndexCount >= MaxIndices)
+            Flush();
+
+        // As many quads as fit in both the batch and this frame's vertex buffer
+        uint32_t currentBatchVertices = static_cast<uint32_t>(QuadVertexBufferPtr - QuadVertexBufferBase.get());
+        uint32_t usedVertices = QuadVertexOffset + currentBatchVertices;
+        uint32_t freeQuads = usedVertices < MaxVertices ? (MaxVertices - usedVertices) / 4 : 0;
+        freeQuads = std::min(freeQuads, (MaxIndices - QuadIndexCount) / 6);
+
+        if (freeQuads == 0 && !NeedsBufferGrowth() && MaxQuads < AbsoluteMaxQuads)
+        {
+            RequestBufferGrowth();
+            GG_CORE_INFO("Renderer2D: Buffer capacity exceeded - will grow on next frame");
+        }
+        return freeQuads;
+    }
+
+    void Renderer2DImpl::MergeSubmitContexts()
+    {
+        GG_PROFILE_FUNCTION();
+        if (!ParallelSubmitActive)
+            return;
+        ParallelSubmitActive = false;
+
+        // Where each context's quads start in the merged sequence
+        std::vector<size_t> firstQuad(ActiveSubmitContexts + 1, 0);
+        for (uint32_t i = 0; i < ActiveSubmitContexts; i++)
+            firstQuad[i + 1] = firstQuad[i] + SubmitContexts[i]->m_QuadCount;
+        const size_t totalQuads = firstQuad[ActiveSubmitContexts];
+
+        // Copy the sequence into batches; contexts copy their overlap with a
+        // batch in parallel, each to its own place in the staging buffer
+        size_t merged = 0;
+        while (merged < totalQuads)
+        {
+            const uint32_t freeQuads = ReserveQuads();
+            if (freeQuads == 0)
+                break;
+
+            const size_t batchFirst = merged;
+            const size_t batchLast = std::min(totalQuads, merged + freeQuads);
+            QuadVertex* batchOut = QuadVertexBufferPtr;
+
+            TaskGraph::Get().ParallelFor(0, ActiveSubmitContexts, 1, [&](size_t firstContext, size_t lastContext)
+            {
+                for (size_t i = firstContext; i < lastContext; i++)
+                {
+                    const size_t first = std::max(firstQuad[i], batchFirst);
+                    const size_t last = std::min(firstQuad[i + 1], batchLast);
+                    if (first >= last)
+                        continue;
+
+                    std::memcpy(batchOut + (first - batchFirst) * 4,
+                                SubmitContexts[i]->m_Vertices.data() + (first - firstQuad[i]) * 4,
+                                (last - first) * 4 * sizeof(QuadVertex));
+                }
+            });
+
+            const uint32_t quads = static_cast<uint32_t>(batchLast - batchFirst);
+            QuadVertexBufferPtr += static_cast<size_t>(quads) * 4;
+            QuadIndexCount += quads * 6;
+            Stats.QuadCount += quads;
+            merged = batchLast;
+        }
+
+        for (uint32_t i = 0; i < ActiveSubmitContexts; i++)
+            SubmitContexts[i]->m_QuadCount = 0;
+        ActiveSubmitContexts = 0;
+    }
+
     // ============================================================================
     // Static API Implementation (delegates to s_Impl)
     // ============================================================================
@@ -372,6 +482,7 @@ namespace GGEngine {
     void Renderer2D::EndScene()
     {
         GG_PROFILE_FUNCTION();
+        s_Impl.MergeSubmitContexts();
         Flush();
         s_Impl.SetSceneStarted(false);
         s_Impl.ClearCommandBuffer();
@@ -383,187 +494,209 @@ namespace GGEngine {
     }
 
     // ============================================================================
-    // Quad Drawing Helpers
+    // Quad Drawing
     // ============================================================================
 
-    static bool PrepareForQuad(const Texture* texture, uint32_t& outTextureIndex)
+    void Renderer2D::DrawQuad(const QuadSpec& spec)
+    {
+        DrawQuads(&spec, 1);
+    }
+
+    void Renderer2D::DrawQuads(const QuadSpec* specs, size_t count)
     {
         if (!s_Impl.IsSceneStarted())
         {
             GG_CORE_WARN("Renderer2D::DrawQuad called outside BeginScene/EndScene");
-            return false;
+            return;
         }
 
-        // Get bindless texture index
-        outTextureIndex = s_Impl.GetWhiteTextureIndex();
-        if (texture != nullptr)
+        while (count > 0)
         {
-            BindlessTextureIndex bindlessIdx = texture->GetBindlessIndex();
-            if (bindlessIdx != InvalidBindlessIndex)
-            {
-                outTextureIndex = bindlessIdx;
-            }
-        }
+            const uint32_t freeQuads = s_Impl.ReserveQuads();
+            if (freeQuads == 0)
+                return;
 
-        // Flush if batch is full
-        if (s_Impl.QuadIndexCount >= s_Impl.MaxIndices)
-        {
-            Renderer2D::Flush();
+            const uint32_t quads = static_cast<uint32_t>(std::min<size_t>(count, freeQuads));
+            GenerateQuadVertices(specs, quads, s_Impl.GetWhiteTextureIndex(), s_Impl.QuadVertexBufferPtr);
+
+            s_Impl.QuadVertexBufferPtr += static_cast<size_t>(quads) * 4;
+            s_Impl.QuadIndexCount += quads * 6;
+            s_Impl.Stats.QuadCount += quads;
+
+            specs += quads;
+            count -= quads;
         }
+    }
 
-        // Check capacity
-        uint32_t currentBatchVertices = static_cast<uint32_t>(s_Impl.QuadVertexBufferPtr - s_Impl.QuadVertexBufferBase.get());
-        uint32_t totalVerticesAfterThisQuad = s_Impl.QuadVertexOffset + currentBatchVertices + 4;
-        if (totalVerticesAfterThisQuad > s_Impl.MaxVertices)
+    void Renderer2D::DrawMesh(QuadMesh& mesh)
+    {
+        if (!s_Impl.IsSceneStarted())
         {
-            if (!s_Impl.NeedsBufferGrowth() && s_Impl.MaxQuads < Renderer2DImpl::AbsoluteMaxQuads)
-            {
-                s_Impl.RequestBufferGrowth();
-                GG_CORE_INFO("Renderer2D: Buffer capacity exceeded - will grow on next frame");
-            }
-            return false;
+            GG_CORE_WARN("Renderer2D::DrawMesh called outside BeginScene/EndScene");
+            return;
         }
 
-        return true;
+        mesh.Sync();
+
+        // Until growth has been uploaded, the retired buffer holds what is visible
+        const VertexBuffer* buffer = mesh.m_RetiredBuffer ? mesh.m_RetiredBuffer.get() : mesh.m_Buffer.get();
+        if (buffer && mesh.m_VisibleQuads > 0)
+            s_Impl.DrawMesh(*buffer, mesh.m_VisibleQuads);
     }
 
-    static void WriteQuadVertices(const float positions[4][3],
-                                   const float* texCoords,
-                                   float r, float g, float b, float a,
-                                   float tilingFactor,
-                                   uint32_t textureIndex)
+    void Renderer2D::BeginParallelSubmit(uint32_t contextCount)
     {
-        for (int i = 0; i < 4; i++)
+        if (!s_Impl.IsSceneStarted())
         {
-            s_Impl.QuadVertexBufferPtr->position[0] = positions[i][0];
-            s_Impl.QuadVertexBufferPtr->position[1] = positions[i][1];
-            s_Impl.QuadVertexBufferPtr->position[2] = positions[i][2];
+            GG_CORE_WARN("Renderer2D::BeginParallelSubmit called outside BeginScene/EndScene");
+            contextCount = 0;
+        }
 
-            if (texCoords)
-            {
-                s_Impl.QuadVertexBufferPtr->texCoord[0] = texCoords[i * 2 + 0];
-                s_Impl.QuadVertexBufferPtr->texCoord[1] = texCoords[i * 2 + 1];
-            }
-            else
-            {
-                s_Impl.QuadVertexBufferPtr->texCoord[0] = Renderer2DImpl::QuadTexCoords[i][0];
-                s_Impl.QuadVertexBufferPtr->texCoord[1] = Renderer2DImpl::QuadTexCoords[i][1];
-            }
+        // Anything still pending goes first
+        s_Impl.MergeSubmitContexts();
 
-            s_Impl.QuadVertexBufferPtr->color[0] = r;
-            s_Impl.QuadVertexBufferPtr->color[1] = g;
-            s_Impl.QuadVertexBufferPtr->color[2] = b;
-            s_Impl.QuadVertexBufferPtr->color[3] = a;
+        auto& contexts = s_Impl.SubmitContexts;
+        while (contexts.size() < contextCount)
+            contexts.push_back(CreateScope<QuadSubmitContext>());
 
-            s_Impl.QuadVertexBufferPtr->tilingFactor = tilingFactor;
-            s_Impl.QuadVertexBufferPtr->texIndex = textureIndex;
+        const uint32_t whiteTextureIndex = s_Impl.GetWhiteTextureIndex();
+        for (uint32_t i = 0; i < contextCount; i++)
+            contexts[i]->m_WhiteTextureIndex = whiteTextureIndex;
 
-            s_Impl.QuadVertexBufferPtr++;
-        }
+        s_Impl.ActiveSubmitContexts = contextCount;
+        s_Impl.ParallelSubmitActive = true;
+    }
 
-        s_Impl.QuadIndexCount += 6;
-        s_Impl.Stats.QuadCount++;
+    QuadSubmitContext& Renderer2D::GetSubmitContext(uint32_t index)
+    {
+        GG_CORE_ASSERT(index < s_Impl.ActiveSubmitContexts, "Submit context index out of range");
+        return *s_Impl.SubmitContexts[index];
     }
 
-    static void DrawQuadInternal(float x, float y, float z, float width, float height,
-                                 const Texture* texture, float r, float g, float b, float a,
-                                 float rotation = 0.0f, float tilingFactor = 1.0f,
-                                 const float* texCoords = nullptr)
+    void Renderer2D::EndParallelSubmit()
     {
-        uint32_t textureIndex;
-        if (!PrepareForQuad(texture, textureIndex))
-            return;
+        s_Impl.MergeSubmitContexts();
+    }
 
-        float cosR = 1.0f, sinR = 0.0f;
-        if (rotation != 0.0f)
-        {
-            cosR = std::cos(rotation);
-            sinR = std::sin(rotation);
-        }
+    // ============================================================================
+    // QuadSubmitContext
+    // ============================================================================
 
-        float positions[4][3];
-        for (int i = 0; i < 4; i++)
-        {
-            float localX = Renderer2DImpl::QuadPositions[i][0] * width;
-            float localY = Renderer2DImpl::QuadPositions[i][1] * height;
+    QuadSubmitContext::QuadSubmitContext() = default;
+    QuadSubmitContext::~QuadSubmitContext() = default;
 
-            positions[i][0] = x + (localX * cosR - localY * sinR);
-            positions[i][1] = y + (localX * sinR + localY * cosR);
-            positions[i][2] = z;
-        }
+    void QuadSubmitContext::DrawQuad(const QuadSpec& spec)
+    {
+        DrawQuads(&spec, 1);
+    }
 
-        WriteQuadVertices(positions, texCoords, r, g, b, a, tilingFactor, textureIndex);
+    void QuadSubmitContext::DrawQuads(const QuadSpec* specs, size_t count)
+    {
+        // Grow geometrically; the arena is never shrunk, so steady frames don't allocate
+        const size_t used = static_cast<size_t>(m_QuadCount) * 4;
+        const size_t needed = used + count * 4;
+        if (needed > m_Vertices.size())
+            m_Vertices.resize(std::max(needed, m_Vertices.size() * 2));
+
+        GenerateQuadVertices(specs, count, m_WhiteTextureIndex, m_Vertices.data() + used);
+        m_QuadCount += static_cast<uint32_t>(count);
     }
 
-    static void DrawQuadWithMatrix(const glm::mat4& transform,
-                                   const Texture* texture, float r, float g, float b, float a,
-                                   float tilingFactor = 1.0f,
-                                   const float* texCoords = nullptr)
+    // ============================================================================
+    // QuadMesh
+    // ============================================================================
+
+    QuadMesh::QuadMesh() = default;
+
+    QuadMesh::~QuadMesh()
     {
-        uint32_t textureIndex;
-        if (!PrepareForQuad(texture, textureIndex))
-            return;
+        s_Impl.RetireMeshBuffer(std::move(m_Buffer));
+        s_Impl.RetireMeshBuffer(std::move(m_RetiredBuffer));
+    }
 
-        static constexpr glm::vec4 unitQuadPositions[4] = {
-            { -0.5f, -0.5f, 0.0f, 1.0f },
-            {  0.5f, -0.5f, 0.0f, 1.0f },
-            {  0.5f,  0.5f, 0.0f, 1.0f },
-            { -0.5f,  0.5f, 0.0f, 1.0f }
-        };
+    void QuadMesh::Clear()
+    {
+        m_Vertices.clear();
+    }
 
-        float positions[4][3];
-        for (int i = 0; i < 4; i++)
-        {
-            glm::vec4 worldPos = transform * unitQuadPositions[i];
-            positions[i][0] = worldPos.x;
-            positions[i][1] = worldPos.y;
-            positions[i][2] = worldPos.z;
-        }
+    void QuadMesh::AddQuad(const QuadSpec& spec)
+    {
+        m_Vertices.resize(m_Vertices.size() + 4);
+        GenerateQuadVertices(&spec, 1, s_Impl.GetWhiteTextureIndex(), m_Vertices.data() + m_Vertices.size() - 4);
+    }
 
-        WriteQuadVertices(positions, texCoords, r, g, b, a, tilingFactor, textureIndex);
+    uint32_t QuadMesh::GetQuadCount() const
+    {
+        return static_cast<uint32_t>(m_Vertices.size() / 4);
     }
 
-    void Renderer2D::DrawQuad(const QuadSpec& spec)
+    uint64_t QuadMesh::GetGpuSize() const
     {
-        const Texture* texture = spec.texture;
-        const float* texCoordsPtr = spec.texCoords ? &spec.texCoords[0][0] : nullptr;
-        float tilingFactor = spec.tilingFactor;
+        return static_cast<uint64_t>(m_Capacity) * 4 * sizeof(QuadVertex);
+    }
 
-        if (spec.subTexture)
+    void QuadMesh::Sync()
+    {
+        // Once a flush has recorded the queued upload, this frame's draws see it
+        if (m_UploadsPending && TransferQueue::Get().GetFlushCount() != m_QueuedAtFlush)
         {
-            texture = spec.subTexture->GetTexture();
-            texCoordsPtr = spec.subTexture->GetTexCoords();
-            tilingFactor = 1.0f;
+            m_VisibleQuads = m_QueuedQuads;
+            m_UploadsPending = false;
+
+            // Frames in flight may draw the retired buffer; free it when this index comes around again
+            s_Impl.RetireMeshBuffer(std::move(m_RetiredBuffer));
         }
+    }
+
+    bool QuadMesh::Upload()
+    {
+        GG_PROFILE_FUNCTION();
+
+        Sync();
 
-        if (spec.transform)
+        const uint32_t quadCount = GetQuadCount();
+        if (quadCount > m_Capacity)
         {
-            DrawQuadWithMatrix(
-                *spec.transform,
-                texture,
-                spec.color[0], spec.color[1], spec.color[2], spec.color[3],
-                tilingFactor,
-                texCoordsPtr
+            // The queued upload still references the current buffer; grow after it flushes
+            if (m_UploadsPending)
+                return false;
+
+            const uint32_t capacity = std::max({ m_Capacity * 2, Renderer2DImpl::MinMeshCapacity, quadCount });
+            m_RetiredBuffer = std::move(m_Buffer);
+            m_Buffer = CreateScope<VertexBuffer>(
+                static_cast<uint64_t>(capacity) * 4 * sizeof(QuadVertex),
+                s_Impl.QuadVertexLayout
             );
+            m_Capacity = capacity;
         }
-        else
+
+        // Staging copies the data now, so the CPU vertices can go
+        auto& transfers = TransferQueue::Get();
+        if (quadCount > 0)
         {
-            DrawQuadInternal(
-                spec.x, spec.y, spec.z,
-                spec.width, spec.height,
-                texture,
-                spec.color[0], spec.color[1], spec.color[2], spec.color[3],
-                spec.rotation,
-                tilingFactor,
-                texCoordsPtr
-            );
+            transfers.QueueBufferUpload(m_Buffer->GetHandle(), m_Vertices.data(),
+                                        m_Vertices.size() * sizeof(QuadVertex), 0);
         }
+        std::vector<QuadVertex>().swap(m_Vertices);
+
+        m_QueuedQuads = quadCount;
+        m_QueuedAtFlush = transfers.GetFlushCount();
+        m_UploadsPending = true;
+        return true;
     }
 
     void Renderer2D::ResetStats()
     {
         s_Impl.Stats.DrawCalls = 0;
         s_Impl.Stats.QuadCount = 0;
+        s_Impl.Stats.VisibleCount = 0;
+        s_Impl.Stats.CulledCount = 0;
+    }
+
+    void Renderer2D::RecordCulling(uint32_t visible, uint32_t culled)
+    {
+        s_Impl.Stats.VisibleCount += visible;
+        s_Impl.Stats.CulledCount += culled;
     }
 
     Renderer2D::Statistics Renderer2D::GetStats()
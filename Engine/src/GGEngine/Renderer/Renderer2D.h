@@ -3,7 +3,9 @@
 #include "GGEngine/Core/Core.h"
 #include "GGEngine/RHI/RHITypes.h"
 #include <glm/glm.hpp>
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace GGEngine {
 
@@ -11,6 +13,8 @@ namespace GGEngine {
     class SubTexture2D;
     class Camera;
     class SceneCamera;
+    class VertexBuffer;
+    struct QuadVertex;
 
     // Unified specification for drawing a quad
     // This is the PREFERRED API for all quad rendering.
@@ -99,6 +103,89 @@ namespace GGEngine {
         }
     };
 
+    // Quads built once and kept in GPU memory, for geometry that rarely changes
+    // (e.g. tilemap chunks). Fill it with AddQuad, Upload it, then draw it each
+    // frame with Renderer2D::DrawMesh: one draw call and no per-frame vertex work.
+    //
+    // Upload queues a copy on the TransferQueue and drops the CPU vertices; draws
+    // keep showing the previous contents until the next TransferQueue flush
+    // records the copy. Buffers a mesh replaces or leaves behind when destroyed
+    // are freed once frames in flight are done with them; a mesh destroyed after
+    // Renderer2D::Shutdown frees them at once, so only do that with the GPU idle.
+    class GG_API QuadMesh
+    {
+    public:
+        QuadMesh();
+        ~QuadMesh();
+
+        QuadMesh(const QuadMesh&) = delete;
+        QuadMesh& operator=(const QuadMesh&) = delete;
+
+        // Start a new set of quads (what was uploaded stays drawable)
+        void Clear();
+
+        // Append a quad; position, size, rotation, transform, texture, UVs and
+        // color mean the same as for DrawQuad
+        void AddQuad(const QuadSpec& spec);
+
+        // Quads added since Clear
+        uint32_t GetQuadCount() const;
+
+        // Queue the added quads for the GPU. Returns false, keeping them, while
+        // a previous upload into a smaller buffer is still in flight; call again
+        // next frame.
+        bool Upload();
+
+        // GPU memory held by the mesh
+        uint64_t GetGpuSize() const;
+
+    private:
+        friend class Renderer2D;
+
+        // Pick up uploads recorded by a TransferQueue flush
+        void Sync();
+
+        std::vector<QuadVertex> m_Vertices;
+        Scope<VertexBuffer> m_Buffer;
+        Scope<VertexBuffer> m_RetiredBuffer;   // Replaced by growth; drawn until the new one is uploaded
+        uint32_t m_Capacity = 0;               // Quads m_Buffer holds
+        uint32_t m_VisibleQuads = 0;           // Quads this frame's draws see
+        uint32_t m_QueuedQuads = 0;            // Quads they see once queued uploads are flushed
+        uint64_t m_QueuedAtFlush = 0;          // TransferQueue flush count when they were queued
+        bool m_UploadsPending = false;
+    };
+
+    // Quads recorded by one worker thread for Renderer2D to draw later, into
+    // the context's own vertex arena. Contexts come from
+    // Renderer2D::BeginParallelSubmit; each may be filled by one thread at a
+    // time, and Renderer2D::EndParallelSubmit draws them in context order, so
+    // the result doesn't depend on which thread ran what. Arenas keep their
+    // memory across frames.
+    class GG_API QuadSubmitContext
+    {
+    public:
+        QuadSubmitContext();
+        ~QuadSubmitContext();
+
+        QuadSubmitContext(const QuadSubmitContext&) = delete;
+        QuadSubmitContext& operator=(const QuadSubmitContext&) = delete;
+
+        // Same meaning as Renderer2D::DrawQuad/DrawQuads
+        void DrawQuad(const QuadSpec& spec);
+        void DrawQuads(const QuadSpec* specs, size_t count);
+
+        // Quads recorded since BeginParallelSubmit
+        uint32_t GetQuadCount() const { return m_QuadCount; }
+
+    private:
+        friend class Renderer2D;
+        friend class Renderer2DImpl;
+
+        std::vector<QuadVertex> m_Vertices;   // Arena; only the first m_QuadCount * 4 are in use
+        uint32_t m_QuadCount = 0;
+        uint32_t m_WhiteTextureIndex = 0;
+    };
+
     class GG_API Renderer2D
     {
     public:
@@ -127,16 +214,37 @@ namespace GGEngine {
         // Draw a quad using the unified QuadSpec
         static void DrawQuad(const QuadSpec& spec);
 
+        // Draw many quads at once; vertices for specs without a transform are
+        // generated four at a time with SIMD (see QuadGeometry.h)
+        static void DrawQuads(const QuadSpec* specs, size_t count);
+
+        // Draw every uploaded quad of mesh in one call, in order with DrawQuad
+        static void DrawMesh(QuadMesh& mesh);
+
+        // Parallel submission: hands out contextCount empty QuadSubmitContexts
+        // to fill from worker threads (see GetSubmitContext). EndParallelSubmit,
+        // or EndScene if it comes first, appends their quads in index order
+        // after everything drawn before that point. Workers must only draw
+        // through their context, and be done with it before the merge.
+        static void BeginParallelSubmit(uint32_t contextCount);
+        static QuadSubmitContext& GetSubmitContext(uint32_t index);
+        static void EndParallelSubmit();
+
         // Statistics
         struct Statistics
         {
             uint32_t DrawCalls = 0;
             uint32_t QuadCount = 0;
             uint32_t MaxQuadCapacity = 0;  // Current buffer capacity
+            uint32_t VisibleCount = 0;     // Objects that passed CPU culling (see ViewFrustum)
+            uint32_t CulledCount = 0;      // Objects rejected before becoming quads
         };
 
         static void ResetStats();
         static Statistics GetStats();
+
+        // Add culling results from a render system to the statistics
+        static void RecordCulling(uint32_t visible, uint32_t culled);
     };
 
 }
@@ -0,0 +1,157 @@
+#include "ggpch.h"
+#include "RetainedInstanceBuffer.h"
+
+#include <algorithm>
+
+namespace GGEngine {
+
+    namespace {
+
+        uint32_t KeyIndex(uint64_t key) { return static_cast<uint32_t>(key); }
+
+    }
+
+    uint32_t RetainedInstanceBuffer::FindSlot(uint64_t key) const
+    {
+        const uint32_t index = KeyIndex(key);
+        if (index >= m_IndexToSlot.size())
+            return InvalidSlot;
+
+        const uint32_t slot = m_IndexToSlot[index];
+        if (slot == InvalidSlot || m_Keys[slot] != key)
+            return InvalidSlot;
+        return slot;
+    }
+
+    uint32_t RetainedInstanceBuffer::AllocateSlot(uint64_t key)
+    {
+        const uint32_t index = KeyIndex(key);
+        if (index >= m_IndexToSlot.size())
+            m_IndexToSlot.resize(static_cast<size_t>(index) + 1, InvalidSlot);
+
+        // A stale generation of this index hands its slot over
+        uint32_t slot = m_IndexToSlot[index];
+        if (slot != InvalidSlot)
+        {
+            m_Keys[slot] = key;
+            return slot;
+        }
+
+        slot = Size();
+        m_Instances.emplace_back();
+        m_Keys.push_back(key);
+        m_DirtyFlags.push_back(0);
+        m_IndexToSlot[index] = slot;
+        return slot;
+    }
+
+    void RetainedInstanceBuffer::Set(uint64_t key, const QuadInstanceData& instance)
+    {
+        const uint32_t slot = AllocateSlot(key);
+        m_Instances[slot] = instance;
+        MarkDirty(slot);
+    }
+
+    QuadInstanceData* RetainedInstanceBuffer::Edit(uint64_t key)
+    {
+        const uint32_t slot = FindSlot(key);
+        if (slot == InvalidSlot)
+            return nullptr;
+
+        MarkDirty(slot);
+        return &m_Instances[slot];
+    }
+
+    bool RetainedInstanceBuffer::Remove(uint64_t key)
+    {
+        const uint32_t slot = FindSlot(key);
+        if (slot == InvalidSlot)
+            return false;
+
+        // Fill the hole with the last slot so [0, Size()) stays drawable
+        const uint32_t last = Size() - 1;
+        if (slot != last)
+        {
+            m_Instances[slot] = m_Instances[last];
+            m_Keys[slot] = m_Keys[last];
+            m_IndexToSlot[KeyIndex(m_Keys[slot])] = slot;
+            MarkDirty(slot);
+        }
+
+        m_Instances.pop_back();
+        m_Keys.pop_back();
+        m_DirtyFlags.pop_back();
+        m_IndexToSlot[KeyIndex(key)] = InvalidSlot;
+        return true;
+    }
+
+    void RetainedInstanceBuffer::Clear()
+    {
+        m_Instances.clear();
+        m_Keys.clear();
+        m_IndexToSlot.clear();
+        m_DirtySlots.clear();
+        m_DirtyFlags.clear();
+    }
+
+    void RetainedInstanceBuffer::MarkDirty(uint32_t slot)
+    {
+        if (m_DirtyFlags[slot])
+            return;
+        m_DirtyFlags[slot] = 1;
+        m_DirtySlots.push_back(slot);
+    }
+
+    void RetainedInstanceBuffer::MarkAllDirty()
+    {
+        m_DirtySlots.clear();
+        m_DirtySlots.reserve(m_Instances.size());
+        for (uint32_t slot = 0; slot < Size(); slot++)
+        {
+            m_DirtyFlags[slot] = 1;
+            m_DirtySlots.push_back(slot);
+        }
+    }
+
+    const std::vector<RetainedInstanceBuffer::DirtyRange>& RetainedInstanceBuffer::TakeDirtyRanges()
+    {
+        m_Ranges.clear();
+
+        // Slots popped by Remove may still be listed, and a slot popped and
+        // reallocated may be listed twice
+        const uint32_t size = Size();
+        std::sort(m_DirtySlots.begin(), m_DirtySlots.end());
+        auto end = std::unique(m_DirtySlots.begin(), m_DirtySlots.end());
+        end = std::lower_bound(m_DirtySlots.begin(), end, size);
+
+        for (auto it = m_DirtySlots.begin(); it != end; ++it)
+        {
+            const uint32_t slot = *it;
+            m_DirtyFlags[slot] = 0;
+
+            if (!m_Ranges.empty())
+            {
+                DirtyRange& back = m_Ranges.back();
+                if (slot - (back.First + back.Count) <= MergeGap)
+                {
+                    back.Count = slot - back.First + 1;
+                    continue;
+                }
+            }
+            m_Ranges.push_back({ slot, 1 });
+        }
+        m_DirtySlots.clear();
+
+        // Many scattered ranges cost more in staging copies than the clean slots between them
+        if (m_Ranges.size() > MaxUploadRanges)
+        {
+            const DirtyRange span{ m_Ranges.front().First,
+                                   m_Ranges.back().First + m_Ranges.back().Count - m_Ranges.front().First };
+            m_Ranges.clear();
+            m_Ranges.push_back(span);
+        }
+
+        return m_Ranges;
+    }
+
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "GGEngine/Core/Core.h"
+#include "InstancedRenderer2D.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace GGEngine {
+
+    // =============================================================================
+    // RetainedInstanceBuffer
+    // =============================================================================
+    // CPU side of InstancedRenderer2D's retained instances. Each key owns one
+    // slot in a packed array that persists across frames; only slots written
+    // since the last upload are sent to the GPU.
+    //
+    // Keys pack an index in the low 32 bits and a generation in the high 32 bits
+    // (see MakeKey), like Entity. Writing a key whose index is held by another
+    // generation reuses that slot, since the older owner must have been destroyed.
+    //
+    // Remove keeps the slots packed by moving the last slot into the hole, so
+    // removing costs one dirty slot, and Size() is always the draw count.
+    //
+    // Not thread-safe; fill it from one thread between frames.
+    //
+    class GG_API RetainedInstanceBuffer
+    {
+    public:
+        static constexpr uint32_t InvalidSlot = ~0u;
+
+        // Dirty slots closer than this are uploaded as one range (one staging copy)
+        static constexpr uint32_t MergeGap = 16;
+        // Past this many ranges the whole dirty span is uploaded at once
+        static constexpr size_t MaxUploadRanges = 64;
+
+        struct DirtyRange
+        {
+            uint32_t First;
+            uint32_t Count;
+        };
+
+        static constexpr uint64_t MakeKey(uint32_t index, uint32_t generation)
+        {
+            return (static_cast<uint64_t>(generation) << 32) | index;
+        }
+
+        // Write the instance for key, allocating a slot if it has none
+        void Set(uint64_t key, const QuadInstanceData& instance);
+
+        // Direct access to key's instance for in-place updates; marks the slot dirty
+        QuadInstanceData* Edit(uint64_t key);
+
+        // Release key's slot. Returns false if key has no slot.
+        bool Remove(uint64_t key);
+
+        bool Contains(uint64_t key) const { return FindSlot(key) != InvalidSlot; }
+        uint32_t FindSlot(uint64_t key) const;
+
+        void Clear();
+
+        uint32_t Size() const { return static_cast<uint32_t>(m_Instances.size()); }
+        bool Empty() const { return m_Instances.empty(); }
+
+        const QuadInstanceData* Data() const { return m_Instances.data(); }
+        uint64_t GetKey(uint32_t slot) const { return m_Keys[slot]; }
+
+        // Remove every key pred rejects, e.g. entities that no longer have a sprite
+        template<typename Pred>
+        void RemoveUnless(Pred&& keep)
+        {
+            for (uint32_t slot = Size(); slot-- > 0;)
+            {
+                if (!keep(m_Keys[slot]))
+                    Remove(m_Keys[slot]);
+            }
+        }
+
+        bool HasDirtySlots() const { return !m_DirtySlots.empty(); }
+        uint32_t GetDirtySlotCount() const { return static_cast<uint32_t>(m_DirtySlots.size()); }
+
+        // Coalesce the slots written since the last call into sorted ranges
+        // within [0, Size()), then forget them. The returned vector is reused.
+        const std::vector<DirtyRange>& TakeDirtyRanges();
+
+        // Mark every slot dirty, e.g. after the GPU buffer was recreated
+        void MarkAllDirty();
+
+    private:
+        void MarkDirty(uint32_t slot);
+        uint32_t AllocateSlot(uint64_t key);
+
+        std::vector<QuadInstanceData> m_Instances;
+        std::vector<uint64_t> m_Keys;           // Parallel to m_Instances
+        std::vector<uint32_t> m_IndexToSlot;    // Key index -> slot, InvalidSlot if none
+
+        std::vector<uint32_t> m_DirtySlots;
+        std::vector<uint8_t> m_DirtyFlags;      // Parallel to m_Instances, dedupes m_DirtySlots
+        std::vector<DirtyRange> m_Ranges;
+    };
+
+}
@@ -0,0 +1,219 @@
+#include "ggpch.h"
+#include "TextureStreamer.h"
+#include "GGEngine/Asset/Texture.h"
+#include "GGEngine/Core/Profiler.h"
+#include "GGEngine/RHI/RHIDevice.h"
+
+#include <algorithm>
+
+namespace GGEngine {
+
+    TextureStreamer& TextureStreamer::Get()
+    {
+        static TextureStreamer instance;
+        return instance;
+    }
+
+    void TextureStreamer::Init(uint64_t budgetBytes)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Budget = budgetBytes;
+        m_Initialized = true;
+        GG_CORE_INFO("TextureStreamer initialized ({} MB budget)", budgetBytes / (1024 * 1024));
+    }
+
+    void TextureStreamer::Shutdown()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        // Textures still registered keep whatever is resident; only retired images are ours
+        auto& device = RHIDevice::Get();
+        for (auto& retired : m_Retired)
+        {
+            for (RHITextureHandle handle : retired)
+                device.DestroyTexture(handle);
+            retired.clear();
+        }
+
+        m_Entries.clear();
+        m_Stats = Statistics();
+        m_Frame = 0;
+        m_Initialized = false;
+        GG_CORE_TRACE("TextureStreamer shutdown");
+    }
+
+    uint32_t TextureStreamer::GetTailMip(const std::vector<TextureMipLevel>& mips)
+    {
+        for (uint32_t i = 0; i < mips.size(); i++)
+        {
+            if (std::max(mips[i].width, mips[i].height) <= MinResidentSize)
+                return i;
+        }
+        return mips.empty() ? 0 : static_cast<uint32_t>(mips.size()) - 1;
+    }
+
+    void TextureStreamer::Register(Texture& texture)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        const uint32_t tail = GetTailMip(texture.m_StreamSource.mips);
+        m_Entries.push_back({ &texture, tail, texture.m_ResidentMip, texture.m_ResidentMip, m_Frame, false });
+    }
+
+    void TextureStreamer::Unregister(Texture& texture)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        auto it = std::find_if(m_Entries.begin(), m_Entries.end(),
+                               [&](const Entry& entry) { return entry.texture == &texture; });
+        if (it != m_Entries.end())
+        {
+            *it = m_Entries.back();
+            m_Entries.pop_back();
+        }
+    }
+
+    uint64_t TextureStreamer::GetResidentSize(const Entry& entry, uint32_t mip)
+    {
+        return GetMipChainSize(entry.texture->m_StreamSource.mips, mip);
+    }
+
+    uint64_t TextureStreamer::ShedToBudget(uint64_t total)
+    {
+        auto coarsen = [&](Entry& entry, uint32_t mip)
+        {
+            total -= GetResidentSize(entry, entry.targetMip) - GetResidentSize(entry, mip);
+            entry.targetMip = mip;
+        };
+
+        // 1. Detail visible textures were not drawn at
+        for (Entry& entry : m_Entries)
+        {
+            if (total <= m_Budget)
+                return total;
+            if (entry.visible && entry.targetMip < entry.wantedMip)
+                coarsen(entry, entry.wantedMip);
+        }
+
+        // 2. Unseen textures, least recently seen first, down to their tail
+        std::vector<Entry*> unseen;
+        for (Entry& entry : m_Entries)
+        {
+            if (!entry.visible && entry.targetMip < entry.tailMip)
+                unseen.push_back(&entry);
+        }
+        std::sort(unseen.begin(), unseen.end(),
+                  [](const Entry* a, const Entry* b) { return a->lastSeenFrame < b->lastSeenFrame; });
+        for (Entry* entry : unseen)
+        {
+            if (total <= m_Budget)
+                return total;
+            coarsen(*entry, entry->tailMip);
+        }
+
+        // 3. Whichever visible texture has the largest top level loses it, until within budget
+        while (total > m_Budget)
+        {
+            Entry* largest = nullptr;
+            uint64_t largestSize = 0;
+            for (Entry& entry : m_Entries)
+            {
+                if (!entry.visible || entry.targetMip >= entry.tailMip)
+                    continue;
+                const uint64_t size = entry.texture->m_StreamSource.mips[entry.targetMip].size;
+                if (size > largestSize)
+                {
+                    largest = &entry;
+                    largestSize = size;
+                }
+            }
+            if (!largest)
+                break;  // Everything is at its tail
+            coarsen(*largest, largest->targetMip + 1);
+        }
+        return total;
+    }
+
+    void TextureStreamer::Update(uint32_t frameIndex)
+    {
+        GG_PROFILE_FUNCTION();
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        if (!m_Initialized)
+            return;
+
+        // Images retired when this frame index last ran are no longer in use (its fence was waited)
+        auto& retired = m_Retired[frameIndex % MaxFramesInFlight];
+        for (RHITextureHandle handle : retired)
+            RHIDevice::Get().DestroyTexture(handle);
+        retired.clear();
+
+        m_Frame++;
+        m_Stats = Statistics();
+        m_Stats.StreamedTextures = static_cast<uint32_t>(m_Entries.size());
+
+        // Visible textures aim for the finest level they were drawn at; the
+        // rest keep what they have unless the budget needs it back
+        uint64_t total = 0;
+        for (Entry& entry : m_Entries)
+        {
+            Texture& texture = *entry.texture;
+            const uint32_t requested = texture.m_RequestedMip.exchange(Texture::NoMipRequest, std::memory_order_relaxed);
+            entry.visible = requested != Texture::NoMipRequest;
+            if (entry.visible)
+            {
+                entry.wantedMip = std::min(requested, entry.tailMip);
+                entry.lastSeenFrame = m_Frame;
+                m_Stats.VisibleTextures++;
+            }
+
+            entry.targetMip = entry.visible ? std::min(entry.wantedMip, texture.m_ResidentMip) : texture.m_ResidentMip;
+            total += GetResidentSize(entry, entry.targetMip);
+        }
+
+        if (total > m_Budget)
+            ShedToBudget(total);
+
+        // Stream out first so memory is freed before more is taken
+        for (Entry& entry : m_Entries)
+        {
+            Texture& texture = *entry.texture;
+            if (entry.targetMip <= texture.m_ResidentMip)
+                continue;
+
+            RHITextureHandle old = texture.StreamTo(entry.targetMip);
+            if (old.IsValid())
+            {
+                retired.push_back(old);
+                m_Stats.StreamOuts++;
+                m_Stats.UploadBytes += GetResidentSize(entry, entry.targetMip);
+            }
+        }
+
+        // Stream in within the upload limit; the rest waits for a later frame
+        uint64_t streamedIn = 0;
+        for (Entry& entry : m_Entries)
+        {
+            Texture& texture = *entry.texture;
+            if (entry.targetMip >= texture.m_ResidentMip)
+                continue;
+
+            const uint64_t size = GetResidentSize(entry, entry.targetMip);
+            if (streamedIn > 0 && streamedIn + size > m_UploadLimit)
+                continue;
+
+            RHITextureHandle old = texture.StreamTo(entry.targetMip);
+            if (old.IsValid())
+            {
+                retired.push_back(old);
+                streamedIn += size;
+                m_Stats.StreamIns++;
+            }
+        }
+        m_Stats.UploadBytes += streamedIn;
+
+        for (const Entry& entry : m_Entries)
+            m_Stats.ResidentBytes += GetResidentSize(entry, entry.texture->m_ResidentMip);
+    }
+
+}
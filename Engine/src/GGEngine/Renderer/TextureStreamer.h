@@ -0,0 +1,111 @@
+#pragma once
+
+#include "GGEngine/Core/Core.h"
+#include "GGEngine/RHI/RHITypes.h"
+#include "GGEngine/RHI/RHIDevice.h"
+#include "GGEngine/Asset/MipChain.h"
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace GGEngine {
+
+    class Texture;
+
+    // Keeps the mip levels of large textures resident within a GPU memory
+    // budget, based on how big they were last drawn on screen.
+    //
+    // While initialized, textures loaded from files keep their mip chain on the
+    // CPU and start with only the levels of at most MinResidentSize resident.
+    // Render systems report each draw with Texture::ReportUsage, and Update
+    // streams each visible texture in to the finest level it was drawn at. When
+    // that exceeds the budget it sheds, in order: detail visible textures don't
+    // need, unseen textures (least recently seen first), then the largest
+    // visible textures one level at a time. Nothing drops below its tail.
+    //
+    // A change re-creates the texture's image with the new levels, uploads them
+    // through TransferQueue and rebinds the texture's bindless slot, so cached
+    // bindless indices stay valid. Old images are destroyed once no frame in
+    // flight can sample them. Main thread only, apart from Texture::ReportUsage.
+    class GG_API TextureStreamer
+    {
+    public:
+        static TextureStreamer& Get();
+
+        // Levels no larger than this on either side are always resident
+        static constexpr uint32_t MinResidentSize = 64;
+        static constexpr uint64_t DefaultBudget = 256ull * 1024 * 1024;
+        static constexpr uint64_t DefaultUploadLimit = 16ull * 1024 * 1024;
+
+        void Init(uint64_t budgetBytes = DefaultBudget);
+        void Shutdown();
+        bool IsInitialized() const { return m_Initialized; }
+
+        // Bytes of streamed textures' resident levels to aim for
+        void SetBudget(uint64_t bytes) { m_Budget = bytes; }
+        uint64_t GetBudget() const { return m_Budget; }
+
+        // Bytes streamed in per frame; at least one texture is always allowed
+        void SetUploadLimit(uint64_t bytes) { m_UploadLimit = bytes; }
+        uint64_t GetUploadLimit() const { return m_UploadLimit; }
+
+        // Apply last frame's usage reports. Call once per frame after
+        // TransferQueue::EndFrame and before TransferQueue::FlushUploads.
+        void Update(uint32_t frameIndex);
+
+        // First level of a chain no larger than MinResidentSize (the last if none is)
+        static uint32_t GetTailMip(const std::vector<TextureMipLevel>& mips);
+
+        // Called by Texture when it starts and stops streaming
+        void Register(Texture& texture);
+        void Unregister(Texture& texture);
+
+        struct Statistics
+        {
+            uint32_t StreamedTextures = 0;
+            uint32_t VisibleTextures = 0;   // Reported since the previous Update
+            uint32_t StreamIns = 0;
+            uint32_t StreamOuts = 0;
+            uint64_t UploadBytes = 0;
+            uint64_t ResidentBytes = 0;
+        };
+        // Counts from the last Update
+        const Statistics& GetStats() const { return m_Stats; }
+
+    private:
+        TextureStreamer() = default;
+        ~TextureStreamer() = default;
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+        struct Entry
+        {
+            Texture* texture;
+            uint32_t tailMip;         // Levels from here down are always resident
+            uint32_t wantedMip;       // Finest level reported when last seen
+            uint32_t targetMip;       // Level to make resident this Update
+            uint64_t lastSeenFrame;
+            bool visible;
+        };
+
+        static uint64_t GetResidentSize(const Entry& entry, uint32_t mip);
+
+        // Bring total down to the budget by coarsening targets; returns the new total
+        uint64_t ShedToBudget(uint64_t total);
+
+        std::vector<Entry> m_Entries;
+        std::mutex m_Mutex;
+
+        uint64_t m_Budget = DefaultBudget;
+        uint64_t m_UploadLimit = DefaultUploadLimit;
+        uint64_t m_Frame = 0;
+        bool m_Initialized = false;
+        Statistics m_Stats;
+
+        // Images replaced while a frame was in flight, destroyed when its index comes around again
+        static constexpr uint32_t MaxFramesInFlight = RHIDevice::GetMaxFramesInFlight();
+        std::vector<RHITextureHandle> m_Retired[MaxFramesInFlight];
+    };
+
+}
@@ -1,10 +1,7 @@
 #include "ggpch.h"
 #include "TransferQueue.h"
 #include "GGEngine/RHI/RHIDevice.h"
-#include "Platform/Vulkan/VulkanRHI.h"
-#include "Platform/Vulkan/VulkanContext.h"
-
-#include <vulkan/vulkan.h>
+#include "GGEngine/RHI/RHICommandBuffer.h"
 
 namespace GGEngine {
 
@@ -22,7 +19,21 @@ namespace GGEngine {
         uint32_t height,
         UploadCompleteCallback callback)
     {
-        if (!texture.IsValid() || !data || size == 0)
+        RHIBufferImageCopy region{};
+        region.imageWidth = width;
+        region.imageHeight = height;
+        region.imageDepth = 1;
+        QueueTextureUpload(texture, data, size, std::vector<RHIBufferImageCopy>{ region }, std::move(callback));
+    }
+
+    void TransferQueue::QueueTextureUpload(
+        RHITextureHandle texture,
+        const void* data,
+        uint64_t size,
+        std::vector<RHIBufferImageCopy> regions,
+        UploadCompleteCallback callback)
+    {
+        if (!texture.IsValid() || !data || size == 0 || regions.empty())
         {
             GG_CORE_WARN("TransferQueue::QueueTextureUpload - invalid parameters");
             return;
@@ -46,19 +57,24 @@ namespace GGEngine {
         // Copy data to staging buffer
         device.UploadBufferData(stagingBuffer, data, size, 0);
 
+        uint32_t mipCount = 1;
+        for (const auto& region : regions)
+            mipCount = std::max(mipCount, region.mipLevel + 1);
+
+        GG_CORE_TRACE("TransferQueue: queued texture upload ({}x{}, {} regions, {} bytes)",
+                      regions[0].imageWidth, regions[0].imageHeight, regions.size(), size);
+
         // Queue the upload request
         {
             std::lock_guard<std::mutex> lock(m_Mutex);
             m_PendingTextureUploads.push_back({
                 texture,
                 stagingBuffer,
-                width,
-                height,
+                std::move(regions),
+                mipCount,
                 std::move(callback)
             });
         }
-
-        GG_CORE_TRACE("TransferQueue: queued texture upload ({}x{}, {} bytes)", width, height, size);
     }
 
     void TransferQueue::QueueBufferUpload(
@@ -118,60 +134,22 @@ namespace GGEngine {
         }
 
         if (textureUploads.empty() && bufferUploads.empty())
+        {
+            m_FlushCount.fetch_add(1, std::memory_order_release);
             return;
+        }
 
-        auto& registry = VulkanResourceRegistry::Get();
-        VkCommandBuffer vkCmd = VulkanContext::Get().GetCurrentCommandBuffer();
         uint32_t frameIndex = RHIDevice::Get().GetCurrentFrameIndex();
 
         // Process texture uploads
         for (auto& request : textureUploads)
         {
-            auto textureData = registry.GetTextureData(request.texture);
-            VkBuffer stagingVkBuffer = registry.GetBuffer(request.stagingBuffer);
-
-            // Transition to transfer dst
-            VkImageMemoryBarrier barrier{};
-            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier.image = textureData.image;
-            barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            barrier.subresourceRange.baseMipLevel = 0;
-            barrier.subresourceRange.levelCount = 1;
-            barrier.subresourceRange.baseArrayLayer = 0;
-            barrier.subresourceRange.layerCount = 1;
-            barrier.srcAccessMask = 0;
-            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-
-            vkCmdPipelineBarrier(vkCmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                 0, 0, nullptr, 0, nullptr, 1, &barrier);
-
-            // Copy buffer to image
-            VkBufferImageCopy region{};
-            region.bufferOffset = 0;
-            region.bufferRowLength = 0;
-            region.bufferImageHeight = 0;
-            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            region.imageSubresource.mipLevel = 0;
-            region.imageSubresource.baseArrayLayer = 0;
-            region.imageSubresource.layerCount = 1;
-            region.imageOffset = { 0, 0, 0 };
-            region.imageExtent = { request.width, request.height, 1 };
-
-            vkCmdCopyBufferToImage(vkCmd, stagingVkBuffer, textureData.image,
-                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
-
-            // Transition to shader read
-            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-            vkCmdPipelineBarrier(vkCmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                                 0, 0, nullptr, 0, nullptr, 1, &barrier);
+            RHICmd::TransitionImageLayout(cmd, request.texture, ImageLayout::Undefined, ImageLayout::TransferDst,
+                                          0, request.mipCount, 0, 1);
+            for (const auto& region : request.regions)
+                RHICmd::CopyBufferToTexture(cmd, request.stagingBuffer, request.texture, region);
+            RHICmd::TransitionImageLayout(cmd, request.texture, ImageLayout::TransferDst, ImageLayout::ShaderReadOnly,
+                                          0, request.mipCount, 0, 1);
 
             // Track staging buffer for cleanup after frame completes
             m_StagingBuffersInFlight[frameIndex].push_back(request.stagingBuffer);
@@ -181,18 +159,19 @@ namespace GGEngine {
                 m_PendingCallbacks[frameIndex].push_back(std::move(request.callback));
         }
 
+        // Buffers may be rewritten while earlier frames still read them (e.g.
+        // retained instance buffers), so wait for those reads before copying
+        if (!bufferUploads.empty())
+        {
+            RHIPipelineBarrier barrier;
+            barrier.memoryBarriers.push_back({ MemoryAccess::DrawRead, MemoryAccess::TransferWrite });
+            RHICmd::PipelineBarrier(cmd, barrier);
+        }
+
         // Process buffer uploads
         for (auto& request : bufferUploads)
         {
-            VkBuffer stagingVkBuffer = registry.GetBuffer(request.stagingBuffer);
-            VkBuffer targetVkBuffer = registry.GetBuffer(request.target);
-
-            VkBufferCopy copyRegion{};
-            copyRegion.srcOffset = 0;
-            copyRegion.dstOffset = request.offset;
-            copyRegion.size = request.size;
-
-            vkCmdCopyBuffer(vkCmd, stagingVkBuffer, targetVkBuffer, 1, &copyRegion);
+            RHICmd::CopyBuffer(cmd, request.stagingBuffer, request.target, 0, request.offset, request.size);
 
             m_StagingBuffersInFlight[frameIndex].push_back(request.stagingBuffer);
 
@@ -200,6 +179,16 @@ namespace GGEngine {
                 m_PendingCallbacks[frameIndex].push_back(std::move(request.callback));
         }
 
+        // Make the copies visible to this frame's draws
+        if (!bufferUploads.empty())
+        {
+            RHIPipelineBarrier barrier;
+            barrier.memoryBarriers.push_back({ MemoryAccess::TransferWrite, MemoryAccess::DrawRead });
+            RHICmd::PipelineBarrier(cmd, barrier);
+        }
+
+        m_FlushCount.fetch_add(1, std::memory_order_release);
+
         GG_CORE_TRACE("TransferQueue: flushed {} texture and {} buffer uploads",
                       textureUploads.size(), bufferUploads.size());
     }
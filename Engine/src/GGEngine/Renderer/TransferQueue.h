@@ -2,10 +2,12 @@
 
 #include "GGEngine/Core/Core.h"
 #include "GGEngine/RHI/RHITypes.h"
+#include "GGEngine/RHI/RHISpecifications.h"
 
 #include <vector>
 #include <functional>
 #include <mutex>
+#include <atomic>
 
 namespace GGEngine {
 
@@ -30,6 +32,16 @@ namespace GGEngine {
             uint32_t height,
             UploadCompleteCallback callback = nullptr);
 
+        // Queue an upload of several regions of one texture (e.g. a mip chain)
+        // from one block of data; each region's bufferOffset is into data.
+        // Every mip level up to the highest one in regions must be covered.
+        void QueueTextureUpload(
+            RHITextureHandle texture,
+            const void* data,
+            uint64_t size,
+            std::vector<RHIBufferImageCopy> regions,
+            UploadCompleteCallback callback = nullptr);
+
         // Queue a buffer upload (thread-safe)
         void QueueBufferUpload(
             RHIBufferHandle buffer,
@@ -49,6 +61,10 @@ namespace GGEngine {
         // Get number of pending uploads
         uint32_t GetPendingCount() const;
 
+        // Number of FlushUploads calls so far. Uploads queued before the count
+        // advanced are recorded ahead of any later rendering commands.
+        uint64_t GetFlushCount() const { return m_FlushCount.load(std::memory_order_acquire); }
+
         // Shutdown - cleanup all resources
         void Shutdown();
 
@@ -62,8 +78,8 @@ namespace GGEngine {
         {
             RHITextureHandle texture;
             RHIBufferHandle stagingBuffer;
-            uint32_t width;
-            uint32_t height;
+            std::vector<RHIBufferImageCopy> regions;
+            uint32_t mipCount;
             UploadCompleteCallback callback;
         };
 
@@ -80,6 +96,7 @@ namespace GGEngine {
         std::vector<TextureUploadRequest> m_PendingTextureUploads;
         std::vector<BufferUploadRequest> m_PendingBufferUploads;
         mutable std::mutex m_Mutex;
+        std::atomic<uint64_t> m_FlushCount{0};
 
         // Staging buffers waiting for GPU completion (per-frame)
         static constexpr uint32_t MaxFramesInFlight = 2;
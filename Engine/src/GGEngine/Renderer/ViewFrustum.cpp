@@ -0,0 +1,202 @@
+#include "ggpch.h"
+#include "ViewFrustum.h"
+#include "Camera.h"
+#include "SceneCamera.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace GGEngine {
+
+    namespace {
+
+        // Solve a1*x + b1*y + e1 = 0, a2*x + b2*y + e2 = 0
+        bool IntersectLines(const glm::vec4& p1, float e1, const glm::vec4& p2, float e2, float& x, float& y)
+        {
+            const float det = p1.x * p2.y - p2.x * p1.y;
+            const float scale = (std::abs(p1.x) + std::abs(p1.y)) * (std::abs(p2.x) + std::abs(p2.y));
+            if (std::abs(det) <= 1e-6f * scale)
+                return false;
+
+            x = (p1.y * e2 - p2.y * e1) / det;
+            y = (p2.x * e1 - p1.x * e2) / det;
+            return true;
+        }
+
+        // Clamp a (possibly huge) cell coordinate into [0, limit]
+        uint32_t ClampCell(double cell, uint32_t limit)
+        {
+            if (!(cell > 0.0))
+                return 0;
+            if (cell >= static_cast<double>(limit))
+                return limit;
+            return static_cast<uint32_t>(cell);
+        }
+
+    }
+
+    // ============================================================================
+    // Bounds2D
+    // ============================================================================
+
+    Bounds2D Bounds2D::FromQuad(float x, float y, float width, float height, float rotation)
+    {
+        float halfX = std::abs(width) * 0.5f;
+        float halfY = std::abs(height) * 0.5f;
+
+        if (rotation != 0.0f)
+        {
+            const float c = std::abs(std::cos(rotation));
+            const float s = std::abs(std::sin(rotation));
+            const float rotatedX = halfX * c + halfY * s;
+            const float rotatedY = halfX * s + halfY * c;
+            halfX = rotatedX;
+            halfY = rotatedY;
+        }
+
+        return { x - halfX, y - halfY, x + halfX, y + halfY };
+    }
+
+    Bounds2D Bounds2D::Infinite()
+    {
+        return { -FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX };
+    }
+
+    // ============================================================================
+    // ViewFrustum
+    // ============================================================================
+
+    ViewFrustum::ViewFrustum()
+    {
+        for (auto& plane : m_Planes)
+            plane = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+
+    ViewFrustum::ViewFrustum(const glm::mat4& viewProjection)
+    {
+        // Rows of the (column-major) matrix
+        glm::vec4 rows[4];
+        for (int i = 0; i < 4; i++)
+            rows[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+
+        m_Planes[Left] = rows[3] + rows[0];
+        m_Planes[Right] = rows[3] - rows[0];
+        m_Planes[Bottom] = rows[3] + rows[1];
+        m_Planes[Top] = rows[3] - rows[1];
+        m_Planes[Near] = rows[3] + rows[2];
+        m_Planes[Far] = rows[3] - rows[2];
+    }
+
+    ViewFrustum ViewFrustum::FromCamera(const Camera& camera)
+    {
+        return ViewFrustum(camera.GetViewProjectionMatrix());
+    }
+
+    ViewFrustum ViewFrustum::FromCamera(const SceneCamera& camera, const glm::mat4& transform)
+    {
+        return ViewFrustum(camera.GetProjection() * glm::inverse(transform));
+    }
+
+    bool ViewFrustum::IsVisible(const Bounds2D& bounds, float z) const
+    {
+        // Halve before subtracting so Infinite() stays finite
+        const float centerX = bounds.MinX * 0.5f + bounds.MaxX * 0.5f;
+        const float centerY = bounds.MinY * 0.5f + bounds.MaxY * 0.5f;
+        const float extentX = bounds.MaxX * 0.5f - bounds.MinX * 0.5f;
+        const float extentY = bounds.MaxY * 0.5f - bounds.MinY * 0.5f;
+
+        for (const auto& plane : m_Planes)
+        {
+            const float distance = plane.x * centerX + plane.y * centerY + plane.z * z + plane.w;
+            const float radius = std::abs(plane.x) * extentX + std::abs(plane.y) * extentY;
+            if (distance + radius < 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    Bounds2D ViewFrustum::GetVisibleBounds(float z) const
+    {
+        // Depth planes parallel to the z plane either keep or reject all of it
+        for (const auto& plane : m_Planes)
+        {
+            if (plane.x == 0.0f && plane.y == 0.0f && plane.z * z + plane.w < 0.0f)
+                return { 0.0f, 0.0f, -1.0f, -1.0f };
+        }
+
+        return GetSideBounds(z);
+    }
+
+    bool ViewFrustum::GetDepthIndependentBounds(Bounds2D& bounds) const
+    {
+        for (int plane = Left; plane <= Top; plane++)
+        {
+            const glm::vec4& p = m_Planes[plane];
+            if (std::abs(p.z) > 1e-6f * (std::abs(p.x) + std::abs(p.y)))
+                return false;
+        }
+
+        bounds = GetSideBounds(0.0f);
+        return true;
+    }
+
+    Bounds2D ViewFrustum::GetSideBounds(float z) const
+    {
+        // On the plane the side planes become lines; the visible region is the
+        // quad between their pairwise intersections
+        const Plane horizontal[2] = { Left, Right };
+        const Plane vertical[2] = { Bottom, Top };
+
+        Bounds2D bounds{ FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX };
+        for (Plane h : horizontal)
+        {
+            for (Plane v : vertical)
+            {
+                const glm::vec4& ph = m_Planes[h];
+                const glm::vec4& pv = m_Planes[v];
+
+                float x, y;
+                if (!IntersectLines(ph, ph.z * z + ph.w, pv, pv.z * z + pv.w, x, y))
+                    return Bounds2D::Infinite();
+
+                // A corner outside the opposite planes means the region is not that quad
+                const glm::vec4& oppositeH = m_Planes[h == Left ? Right : Left];
+                const glm::vec4& oppositeV = m_Planes[v == Bottom ? Top : Bottom];
+                const float slack = 1e-4f * (std::abs(x) + std::abs(y) + 1.0f);
+                auto inside = [&](const glm::vec4& p) {
+                    return p.x * x + p.y * y + p.z * z + p.w >= -slack * (std::abs(p.x) + std::abs(p.y));
+                };
+                if (!inside(oppositeH) || !inside(oppositeV))
+                    return Bounds2D::Infinite();
+
+                bounds.MinX = std::min(bounds.MinX, x);
+                bounds.MinY = std::min(bounds.MinY, y);
+                bounds.MaxX = std::max(bounds.MaxX, x);
+                bounds.MaxY = std::max(bounds.MaxY, y);
+            }
+        }
+        return bounds;
+    }
+
+    TileRect ViewFrustum::GetVisibleTiles(float originX, float originY, float z,
+                                          float tileWidth, float tileHeight,
+                                          uint32_t width, uint32_t height) const
+    {
+        if (!(tileWidth > 0.0f) || !(tileHeight > 0.0f))
+            return { 0, 0, width, height };
+
+        const Bounds2D visible = GetVisibleBounds(z);
+        if (visible.IsEmpty())
+            return {};
+
+        // A cell is kept if it touches the visible rectangle
+        TileRect rect;
+        rect.MinX = ClampCell(std::floor((static_cast<double>(visible.MinX) - originX) / tileWidth), width);
+        rect.MinY = ClampCell(std::floor((static_cast<double>(visible.MinY) - originY) / tileHeight), height);
+        rect.MaxX = ClampCell(std::floor((static_cast<double>(visible.MaxX) - originX) / tileWidth) + 1.0, width);
+        rect.MaxY = ClampCell(std::floor((static_cast<double>(visible.MaxY) - originY) / tileHeight) + 1.0, height);
+        return rect;
+    }
+
+}
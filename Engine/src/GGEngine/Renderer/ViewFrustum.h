@@ -0,0 +1,105 @@
+#pragma once
+
+#include "GGEngine/Core/Core.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace GGEngine {
+
+    class Camera;
+    class SceneCamera;
+
+    // Axis-aligned rectangle in world units
+    struct GG_API Bounds2D
+    {
+        float MinX = 0.0f;
+        float MinY = 0.0f;
+        float MaxX = 0.0f;
+        float MaxY = 0.0f;
+
+        bool IsEmpty() const { return MinX > MaxX || MinY > MaxY; }
+
+        bool Overlaps(const Bounds2D& other) const
+        {
+            return MinX <= other.MaxX && other.MinX <= MaxX &&
+                   MinY <= other.MaxY && other.MinY <= MaxY;
+        }
+
+        // Bounds of a centered width x height quad rotated by rotation radians
+        static Bounds2D FromQuad(float x, float y, float width, float height, float rotation);
+
+        // Covers everything; what an unbounded view reports
+        static Bounds2D Infinite();
+    };
+
+    // Cells [MinX, MaxX) x [MinY, MaxY) of a grid
+    struct GG_API TileRect
+    {
+        uint32_t MinX = 0;
+        uint32_t MinY = 0;
+        uint32_t MaxX = 0;
+        uint32_t MaxY = 0;
+
+        bool IsEmpty() const { return MinX >= MaxX || MinY >= MaxY; }
+        uint64_t GetCount() const { return IsEmpty() ? 0 : static_cast<uint64_t>(MaxX - MinX) * (MaxY - MinY); }
+    };
+
+    // =============================================================================
+    // ViewFrustum
+    // =============================================================================
+    // The six clip planes of a view-projection matrix, for CPU culling of flat
+    // (constant z) geometry before it is turned into quads. Tests are
+    // conservative: anything that may touch the view passes.
+    //
+    // Works for orthographic and perspective cameras with any orientation; the
+    // near plane uses the -w..w depth range glm produces, which contains the
+    // 0..w range the GPU clips to.
+    //
+    // Pure math - no GPU state, so it can be unit tested directly.
+    //
+    class GG_API ViewFrustum
+    {
+    public:
+        // Accepts everything
+        ViewFrustum();
+        explicit ViewFrustum(const glm::mat4& viewProjection);
+
+        static ViewFrustum FromCamera(const Camera& camera);
+        static ViewFrustum FromCamera(const SceneCamera& camera, const glm::mat4& transform);
+
+        // Whether the rectangle, lying on the plane at depth z, may be visible
+        bool IsVisible(const Bounds2D& bounds, float z) const;
+
+        bool IsQuadVisible(float x, float y, float z, float width, float height, float rotation) const
+        {
+            return IsVisible(Bounds2D::FromQuad(x, y, width, height, rotation), z);
+        }
+
+        // World rectangle covering what is visible on the plane at depth z.
+        // Empty if the plane lies outside the near/far range; Infinite() if the
+        // view is unbounded on that plane (e.g. a camera looking along it).
+        Bounds2D GetVisibleBounds(float z) const;
+
+        // If the view looks straight down z (its side planes don't depend on
+        // depth, as with an orthographic 2D camera), the rectangle visible at
+        // every depth - depth range aside - so a 2D query can stand in for the
+        // side-plane tests. Returns false for other views.
+        bool GetDepthIndependentBounds(Bounds2D& bounds) const;
+
+        // Cells of a width x height grid whose cell (0, 0) has its lower-left
+        // corner at (originX, originY) that overlap GetVisibleBounds(z)
+        TileRect GetVisibleTiles(float originX, float originY, float z,
+                                 float tileWidth, float tileHeight,
+                                 uint32_t width, uint32_t height) const;
+
+    private:
+        enum Plane { Left = 0, Right, Bottom, Top, Near, Far, PlaneCount };
+
+        // Region between the side planes on the plane at depth z
+        Bounds2D GetSideBounds(float z) const;
+
+        // (a, b, c, d): a*x + b*y + c*z + d >= 0 inside
+        glm::vec4 m_Planes[PlaneCount];
+    };
+
+}
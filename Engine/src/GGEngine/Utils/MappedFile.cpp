@@ -0,0 +1,117 @@
+#include "ggpch.h"
+#include "MappedFile.h"
+
+#ifdef GG_PLATFORM_WINDOWS
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace GGEngine {
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+#ifdef GG_PLATFORM_WINDOWS
+    // ========================================================================
+    // Windows Implementation using CreateFileMapping
+    // ========================================================================
+
+    Result<void> MappedFile::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return Result<void>::Err("Failed to open '" + path.string() + "'");
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return Result<void>::Err("Cannot map empty file '" + path.string() + "'");
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!data)
+        {
+            if (mapping)
+                CloseHandle(mapping);
+            CloseHandle(file);
+            return Result<void>::Err("Failed to map '" + path.string() + "'");
+        }
+
+        m_File = file;
+        m_Mapping = mapping;
+        m_Data = static_cast<const uint8_t*>(data);
+        m_Size = static_cast<uint64_t>(size.QuadPart);
+        return Result<void>::Ok();
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Data)
+            UnmapViewOfFile(m_Data);
+        if (m_Mapping)
+            CloseHandle(static_cast<HANDLE>(m_Mapping));
+        if (m_File)
+            CloseHandle(static_cast<HANDLE>(m_File));
+
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Mapping = nullptr;
+        m_File = nullptr;
+    }
+
+#else
+    // ========================================================================
+    // POSIX Implementation using mmap
+    // ========================================================================
+
+    Result<void> MappedFile::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return Result<void>::Err("Failed to open '" + path.string() + "'");
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0)
+        {
+            close(fd);
+            return Result<void>::Err("Cannot map empty file '" + path.string() + "'");
+        }
+
+        // The mapping keeps the file referenced; the descriptor isn't needed past this
+        void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+            return Result<void>::Err("Failed to map '" + path.string() + "'");
+
+        // Whole file is about to be read front to back; start reading ahead now
+        madvise(data, static_cast<size_t>(info.st_size), MADV_WILLNEED);
+
+        m_Data = static_cast<const uint8_t*>(data);
+        m_Size = static_cast<uint64_t>(info.st_size);
+        return Result<void>::Ok();
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Data)
+            munmap(const_cast<uint8_t*>(m_Data), static_cast<size_t>(m_Size));
+
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+#endif
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "GGEngine/Core/Core.h"
+#include "GGEngine/Core/Result.h"
+
+#include <cstdint>
+#include <filesystem>
+
+namespace GGEngine {
+
+    // Read-only memory mapping of a whole file.
+    // Pages are read in by the OS as they are first touched, so opening is
+    // cheap and bytes go from the page cache straight to whoever reads them.
+    // Uses CreateFileMapping on Windows and mmap elsewhere.
+    class GG_API MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Map the file, closing any previous mapping. Empty files fail.
+        Result<void> Open(const std::filesystem::path& path);
+        void Close();
+
+        bool IsOpen() const { return m_Data != nullptr; }
+        const uint8_t* GetData() const { return m_Data; }
+        uint64_t GetSize() const { return m_Size; }
+
+    private:
+        const uint8_t* m_Data = nullptr;
+        uint64_t m_Size = 0;
+
+#ifdef GG_PLATFORM_WINDOWS
+        void* m_File = nullptr;      // HANDLE
+        void* m_Mapping = nullptr;   // HANDLE
+#endif
+    };
+
+}
@@ -0,0 +1,204 @@
+#pragma once
+
+// NullRHI.h - Headless RHI backend
+// Implements RHIDevice and RHICmd without a GPU: buffers and textures live in
+// host memory and commands are appended to an in-memory log per command
+// buffer. Transfers (CopyBuffer, CopyBufferToTexture) take effect as soon as
+// they are recorded, as if the GPU finished them instantly.
+//
+// Built instead of the Vulkan backend when GGENGINE_NULL_RHI is ON, so the
+// renderer's CPU paths run in tests and benchmarks on machines without a GPU.
+
+#include "GGEngine/RHI/RHITypes.h"
+#include "GGEngine/RHI/RHIEnums.h"
+#include "GGEngine/RHI/RHISpecifications.h"
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace GGEngine {
+
+    // ============================================================================
+    // Recorded Commands
+    // ============================================================================
+
+    enum class NullCommandType : uint8_t
+    {
+        SetViewport,
+        SetScissor,
+        BindPipeline,
+        BindVertexBuffer,
+        BindIndexBuffer,
+        BindDescriptorSet,
+        PushConstants,
+        Draw,
+        DrawIndexed,
+        BeginRenderPass,
+        EndRenderPass,
+        CopyBuffer,
+        CopyBufferToTexture,
+        TransitionImageLayout,  // Also recorded once per RHIImageBarrier
+        BufferBarrier           // Recorded once per RHIMemoryBarrier
+    };
+
+    // One recorded command; fields a command does not use stay zero
+    struct GG_API NullCommand
+    {
+        NullCommandType type = NullCommandType::Draw;
+
+        uint64_t resource = 0;      // Pipeline, buffer, texture, render pass or descriptor set id
+        uint64_t target = 0;        // Copy destination, framebuffer or pipeline layout id
+        uint32_t binding = 0;       // Vertex buffer binding, descriptor set index or mip level
+
+        // Draw / DrawIndexed
+        uint32_t elementCount = 0;  // Vertices or indices
+        uint32_t instanceCount = 0;
+        uint32_t firstElement = 0;  // First vertex or index
+        uint32_t firstInstance = 0;
+        int32_t vertexOffset = 0;
+
+        // Viewport, scissor, render pass or texture copy extent
+        uint32_t width = 0;
+        uint32_t height = 0;
+
+        // CopyBuffer / CopyBufferToTexture / PushConstants
+        uint64_t srcOffset = 0;
+        uint64_t dstOffset = 0;
+        uint64_t size = 0;
+
+        // TransitionImageLayout / BufferBarrier
+        ImageLayout oldLayout = ImageLayout::Undefined;
+        ImageLayout newLayout = ImageLayout::Undefined;
+        MemoryAccess srcAccess = MemoryAccess::None;
+        MemoryAccess dstAccess = MemoryAccess::None;
+    };
+
+    // ============================================================================
+    // Null Device State
+    // ============================================================================
+    // Owns every null resource and command log. RHIDevice/RHICmd forward here;
+    // tests and benchmarks read the results back through the inspection API.
+    // Thread-safe: one lock guards all state.
+
+    class GG_API NullDevice
+    {
+    public:
+        static NullDevice& Get();
+
+        static constexpr uint32_t DefaultSwapchainWidth = 1280;
+        static constexpr uint32_t DefaultSwapchainHeight = 720;
+
+        // ========================================================================
+        // Inspection
+        // ========================================================================
+
+        // Commands recorded into cmd since its frame began (or since the
+        // ImmediateSubmit that used it started)
+        std::vector<NullCommand> GetCommands(RHICommandBufferHandle cmd) const;
+        uint32_t CountCommands(RHICommandBufferHandle cmd, NullCommandType type) const;
+
+        // Buffer contents (empty if the handle is unknown)
+        std::vector<uint8_t> ReadBuffer(RHIBufferHandle handle) const;
+
+        // Bytes last copied into a texture mip, and its current layout
+        std::vector<uint8_t> ReadTexture(RHITextureHandle handle, uint32_t mipLevel = 0) const;
+        ImageLayout GetTextureLayout(RHITextureHandle handle) const;
+
+        // Live objects of every kind; returns to its previous value once
+        // everything created since has been destroyed
+        size_t GetLiveResourceCount() const;
+
+        // Frames ended since Init
+        uint64_t GetFrameCount() const;
+
+        // ========================================================================
+        // Backend (used by the null RHIDevice / RHICmd implementation)
+        // ========================================================================
+
+        struct BufferData
+        {
+            std::vector<uint8_t> bytes;
+            BufferUsage usage = BufferUsage::Vertex;
+            bool cpuVisible = false;
+        };
+
+        struct TextureData
+        {
+            RHITextureSpecification spec;
+            ImageLayout layout = ImageLayout::Undefined;
+            std::vector<std::vector<uint8_t>> mips;  // Bytes last copied, per mip level
+        };
+
+        void Reset(uint32_t swapchainWidth, uint32_t swapchainHeight);
+
+        // Objects without backing data (layouts, sets, samplers, pipelines, ...)
+        uint64_t CreateObject();
+        void DestroyObject(uint64_t id);
+
+        RHIBufferHandle CreateBuffer(const RHIBufferSpecification& spec);
+        void DestroyBuffer(RHIBufferHandle handle);
+        uint8_t* GetBufferBytes(RHIBufferHandle handle, uint64_t* size = nullptr);
+        bool IsBufferCPUVisible(RHIBufferHandle handle) const;
+
+        RHITextureHandle CreateTexture(const RHITextureSpecification& spec);
+        void DestroyTexture(RHITextureHandle handle);
+        bool GetTextureSpec(RHITextureHandle handle, RHITextureSpecification& spec) const;
+        void WriteTexture(RHITextureHandle handle, uint32_t mipLevel, const void* data, uint64_t size);
+
+        void SetPipelineLayout(RHIPipelineHandle pipeline, RHIPipelineLayoutHandle layout);
+        RHIPipelineLayoutHandle GetPipelineLayout(RHIPipelineHandle pipeline) const;
+
+        // Frames: each frame in flight records into its own command buffer,
+        // cleared when that frame begins again
+        void BeginFrame();
+        void EndFrame();
+        uint32_t GetCurrentFrameIndex() const;
+        RHICommandBufferHandle GetCurrentCommandBuffer() const;
+        RHICommandBufferHandle BeginImmediate();
+
+        void SetSwapchainSize(uint32_t width, uint32_t height);
+        uint32_t GetSwapchainWidth() const;
+        uint32_t GetSwapchainHeight() const;
+        void SetSwapchainPassActive(bool active);
+        bool IsSwapchainPassActive() const;
+
+        // Appends to cmd's log; ignored for handles that are not null command buffers
+        void Record(RHICommandBufferHandle cmd, const NullCommand& command);
+
+        // Executes a recorded transfer on the host
+        void CopyBuffer(RHIBufferHandle src, RHIBufferHandle dst, uint64_t srcOffset, uint64_t dstOffset, uint64_t size);
+        void CopyBufferToTexture(RHIBufferHandle src, RHITextureHandle dst, uint64_t srcOffset, uint32_t mipLevel,
+                                 uint32_t width, uint32_t height);
+        void SetTextureLayout(RHITextureHandle handle, ImageLayout layout);
+
+    private:
+        NullDevice() = default;
+        NullDevice(const NullDevice&) = delete;
+        NullDevice& operator=(const NullDevice&) = delete;
+
+        static constexpr uint32_t MaxFramesInFlight = 2;
+        static constexpr uint64_t ImmediateCommandBuffer = MaxFramesInFlight + 1;
+
+        mutable std::mutex m_Mutex;
+
+        // Ids start above the command buffer handles so every handle is unique
+        uint64_t m_NextID = ImmediateCommandBuffer + 1;
+
+        std::unordered_map<uint64_t, BufferData> m_Buffers;
+        std::unordered_map<uint64_t, TextureData> m_Textures;
+        std::unordered_map<uint64_t, uint64_t> m_PipelineLayouts;  // Pipeline -> layout
+        std::unordered_set<uint64_t> m_Objects;
+
+        std::vector<NullCommand> m_Commands[ImmediateCommandBuffer];  // Indexed by handle id - 1
+        uint32_t m_FrameIndex = 0;
+        uint64_t m_FrameCount = 0;
+
+        uint32_t m_SwapchainWidth = DefaultSwapchainWidth;
+        uint32_t m_SwapchainHeight = DefaultSwapchainHeight;
+        bool m_SwapchainPassActive = false;
+    };
+
+}
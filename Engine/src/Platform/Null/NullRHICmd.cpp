@@ -0,0 +1,257 @@
+#include "ggpch.h"
+#include "NullRHI.h"
+#include "GGEngine/RHI/RHICommandBuffer.h"
+
+namespace GGEngine {
+
+    namespace {
+
+        NullCommand MakeCommand(NullCommandType type, uint64_t resource = 0, uint64_t target = 0)
+        {
+            NullCommand command;
+            command.type = type;
+            command.resource = resource;
+            command.target = target;
+            return command;
+        }
+
+        void RecordTransition(RHICommandBufferHandle cmd, RHITextureHandle texture,
+                              ImageLayout oldLayout, ImageLayout newLayout, uint32_t baseMipLevel)
+        {
+            auto& device = NullDevice::Get();
+
+            NullCommand command = MakeCommand(NullCommandType::TransitionImageLayout, texture.id);
+            command.binding = baseMipLevel;
+            command.oldLayout = oldLayout;
+            command.newLayout = newLayout;
+            device.Record(cmd, command);
+
+            // One layout per texture; the last transition of any mip range wins
+            device.SetTextureLayout(texture, newLayout);
+        }
+
+    }
+
+    // ============================================================================
+    // RHICmd Implementation
+    // ============================================================================
+
+    void RHICmd::SetViewport(RHICommandBufferHandle cmd, float x, float y, float width, float height,
+                             float minDepth, float maxDepth)
+    {
+        NullCommand command = MakeCommand(NullCommandType::SetViewport);
+        command.width = static_cast<uint32_t>(width);
+        command.height = static_cast<uint32_t>(height);
+        NullDevice::Get().Record(cmd, command);
+    }
+
+    void RHICmd::SetViewport(RHICommandBufferHandle cmd, float width, float height)
+    {
+        SetViewport(cmd, 0.0f, 0.0f, width, height, 0.0f, 1.0f);
+    }
+
+    void RHICmd::SetViewport(RHICommandBufferHandle cmd, uint32_t width, uint32_t height)
+    {
+        SetViewport(cmd, 0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f, 1.0f);
+    }
+
+    void RHICmd::SetScissor(RHICommandBufferHandle cmd, int32_t x, int32_t y, uint32_t width, uint32_t height)
+    {
+        NullCommand command = MakeCommand(NullCommandType::SetScissor);
+        command.width = width;
+        command.height = height;
+        NullDevice::Get().Record(cmd, command);
+    }
+
+    void RHICmd::SetScissor(RHICommandBufferHandle cmd, uint32_t width, uint32_t height)
+    {
+        SetScissor(cmd, 0, 0, width, height);
+    }
+
+    // ============================================================================
+    // RHICmd: Binding
+    // ============================================================================
+
+    void RHICmd::BindPipeline(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline)
+    {
+        NullDevice::Get().Record(cmd, MakeCommand(NullCommandType::BindPipeline, pipeline.id));
+    }
+
+    void RHICmd::BindVertexBuffer(RHICommandBufferHandle cmd, RHIBufferHandle buffer, uint32_t binding)
+    {
+        NullCommand command = MakeCommand(NullCommandType::BindVertexBuffer, buffer.id);
+        command.binding = binding;
+        NullDevice::Get().Record(cmd, command);
+    }
+
+    void RHICmd::BindIndexBuffer(RHICommandBufferHandle cmd, RHIBufferHandle buffer, IndexType indexType)
+    {
+        NullDevice::Get().Record(cmd, MakeCommand(NullCommandType::BindIndexBuffer, buffer.id));
+    }
+
+    void RHICmd::BindDescriptorSet(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline,
+                                   RHIDescriptorSetHandle set, uint32_t setIndex)
+    {
+        auto& device = NullDevice::Get();
+        NullCommand command = MakeCommand(NullCommandType::BindDescriptorSet, set.id,
+                                          device.GetPipelineLayout(pipeline).id);
+        command.binding = setIndex;
+        device.Record(cmd, command);
+    }
+
+    void RHICmd::BindDescriptorSet(RHICommandBufferHandle cmd, RHIPipelineLayoutHandle layout,
+                                   RHIDescriptorSetHandle set, uint32_t setIndex)
+    {
+        NullCommand command = MakeCommand(NullCommandType::BindDescriptorSet, set.id, layout.id);
+        command.binding = setIndex;
+        NullDevice::Get().Record(cmd, command);
+    }
+
+    void RHICmd::BindDescriptorSetRaw(RHICommandBufferHandle cmd, RHIPipelineLayoutHandle layout,
+                                      void* descriptorSet, uint32_t setIndex)
+    {
+        // GetRawDescriptorSet hands out the set id as the raw pointer
+        NullCommand command = MakeCommand(NullCommandType::BindDescriptorSet,
+                                          static_cast<uint64_t>(reinterpret_cast<uintptr_t>(descriptorSet)), layout.id);
+        command.binding = setIndex;
+        NullDevice::Get().Record(cmd, command);
+    }
+
+    void RHICmd::PushConstants(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline,
+                               ShaderStage stages, uint32_t offset, uint32_t size, const void* data)
+    {
+        auto& device = NullDevice::Get();
+        PushConstants(cmd, device.GetPipelineLayout(pipeline), stages, offset, size, data);
+    }
+
+    void RHICmd::PushConstants(RHICommandBufferHandle cmd, RHIPipelineLayoutHandle layout,
+                               ShaderStage stages, uint32_t offset, uint32_t size, const void* data)
+    {
+        NullCommand command = MakeCommand(NullCommandType::PushConstants, 0, layout.id);
+        command.dstOffset = offset;
+        command.size = size;
+        NullDevice::Get().Record(cmd, command);
+    }
+
+    // ============================================================================
+    // RHICmd: Draw and Render Pass Commands
+    // ============================================================================
+
+    void RHICmd::Draw(RHICommandBufferHandle cmd, uint32_t vertexCount, uint32_t instanceCount,
+                      uint32_t firstVertex, uint32_t firstInstance)
+    {
+        NullCommand command = MakeCommand(NullCommandType::Draw);
+        command.elementCount = vertexCount;
+        command.instanceCount = instanceCount;
+        command.firstElement = firstVertex;
+        command.firstInstance = firstInstance;
+        NullDevice::Get().Record(cmd, command);
+    }
+
+    void RHICmd::DrawIndexed(RHICommandBufferHandle cmd, uint32_t indexCount, uint32_t instanceCount,
+                             uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+    {
+        NullCommand command = MakeCommand(NullCommandType::DrawIndexed);
+        command.elementCount = indexCount;
+        command.instanceCount = instanceCount;
+        command.firstElement = firstIndex;
+        command.vertexOffset = vertexOffset;
+        command.firstInstance = firstInstance;
+        NullDevice::Get().Record(cmd, command);
+    }
+
+    void RHICmd::BeginRenderPass(RHICommandBufferHandle cmd, RHIRenderPassHandle renderPass,
+                                 RHIFramebufferHandle framebuffer, uint32_t width, uint32_t height,
+                                 float clearR, float clearG, float clearB, float clearA)
+    {
+        NullCommand command = MakeCommand(NullCommandType::BeginRenderPass, renderPass.id, framebuffer.id);
+        command.width = width;
+        command.height = height;
+        NullDevice::Get().Record(cmd, command);
+    }
+
+    void RHICmd::EndRenderPass(RHICommandBufferHandle cmd)
+    {
+        NullDevice::Get().Record(cmd, MakeCommand(NullCommandType::EndRenderPass));
+    }
+
+    // ============================================================================
+    // RHICmd: Transfer Commands
+    // ============================================================================
+    // Transfers execute on the host as they are recorded
+
+    void RHICmd::CopyBuffer(RHICommandBufferHandle cmd, RHIBufferHandle src, RHIBufferHandle dst,
+                            uint64_t srcOffset, uint64_t dstOffset, uint64_t size)
+    {
+        auto& device = NullDevice::Get();
+
+        NullCommand command = MakeCommand(NullCommandType::CopyBuffer, src.id, dst.id);
+        command.srcOffset = srcOffset;
+        command.dstOffset = dstOffset;
+        command.size = size;
+        device.Record(cmd, command);
+
+        device.CopyBuffer(src, dst, srcOffset, dstOffset, size);
+    }
+
+    void RHICmd::CopyBufferToTexture(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+                                     RHITextureHandle texture, const RHIBufferImageCopy& region)
+    {
+        auto& device = NullDevice::Get();
+
+        NullCommand command = MakeCommand(NullCommandType::CopyBufferToTexture, buffer.id, texture.id);
+        command.binding = region.mipLevel;
+        command.width = region.imageWidth;
+        command.height = region.imageHeight;
+        command.srcOffset = region.bufferOffset;
+        device.Record(cmd, command);
+
+        device.CopyBufferToTexture(buffer, texture, region.bufferOffset, region.mipLevel,
+                                   region.imageWidth, region.imageHeight);
+    }
+
+    void RHICmd::CopyBufferToTexture(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+                                     RHITextureHandle texture, uint32_t width, uint32_t height)
+    {
+        RHIBufferImageCopy region{};
+        region.imageWidth = width;
+        region.imageHeight = height;
+        region.imageDepth = 1;
+        CopyBufferToTexture(cmd, buffer, texture, region);
+    }
+
+    // ============================================================================
+    // RHICmd: Image Layout Transitions and Barriers
+    // ============================================================================
+
+    void RHICmd::TransitionImageLayout(RHICommandBufferHandle cmd, RHITextureHandle texture,
+                                       ImageLayout oldLayout, ImageLayout newLayout)
+    {
+        RecordTransition(cmd, texture, oldLayout, newLayout, 0);
+    }
+
+    void RHICmd::TransitionImageLayout(RHICommandBufferHandle cmd, RHITextureHandle texture,
+                                       ImageLayout oldLayout, ImageLayout newLayout,
+                                       uint32_t baseMipLevel, uint32_t mipCount,
+                                       uint32_t baseArrayLayer, uint32_t layerCount)
+    {
+        RecordTransition(cmd, texture, oldLayout, newLayout, baseMipLevel);
+    }
+
+    void RHICmd::PipelineBarrier(RHICommandBufferHandle cmd, const RHIPipelineBarrier& barrier)
+    {
+        auto& device = NullDevice::Get();
+        for (const auto& memoryBarrier : barrier.memoryBarriers)
+        {
+            NullCommand command = MakeCommand(NullCommandType::BufferBarrier);
+            command.srcAccess = memoryBarrier.srcAccess;
+            command.dstAccess = memoryBarrier.dstAccess;
+            device.Record(cmd, command);
+        }
+
+        for (const auto& imageBarrier : barrier.imageBarriers)
+            RecordTransition(cmd, imageBarrier.texture, imageBarrier.oldLayout, imageBarrier.newLayout,
+                             imageBarrier.baseMipLevel);
+    }
+
+}
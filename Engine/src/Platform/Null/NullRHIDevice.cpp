@@ -0,0 +1,764 @@
+#include "ggpch.h"
+#include "NullRHI.h"
+#include "GGEngine/RHI/RHIDevice.h"
+#include "GGEngine/RHI/RHICommandBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace GGEngine {
+
+    // ============================================================================
+    // NullDevice - Inspection
+    // ============================================================================
+
+    NullDevice& NullDevice::Get()
+    {
+        static NullDevice instance;
+        return instance;
+    }
+
+    std::vector<NullCommand> NullDevice::GetCommands(RHICommandBufferHandle cmd) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (cmd.id == 0 || cmd.id > ImmediateCommandBuffer) return {};
+        return m_Commands[cmd.id - 1];
+    }
+
+    uint32_t NullDevice::CountCommands(RHICommandBufferHandle cmd, NullCommandType type) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (cmd.id == 0 || cmd.id > ImmediateCommandBuffer) return 0;
+
+        const auto& commands = m_Commands[cmd.id - 1];
+        return static_cast<uint32_t>(std::count_if(commands.begin(), commands.end(),
+            [type](const NullCommand& command) { return command.type == type; }));
+    }
+
+    std::vector<uint8_t> NullDevice::ReadBuffer(RHIBufferHandle handle) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Buffers.find(handle.id);
+        return it != m_Buffers.end() ? it->second.bytes : std::vector<uint8_t>{};
+    }
+
+    std::vector<uint8_t> NullDevice::ReadTexture(RHITextureHandle handle, uint32_t mipLevel) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Textures.find(handle.id);
+        if (it == m_Textures.end() || mipLevel >= it->second.mips.size()) return {};
+        return it->second.mips[mipLevel];
+    }
+
+    ImageLayout NullDevice::GetTextureLayout(RHITextureHandle handle) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Textures.find(handle.id);
+        return it != m_Textures.end() ? it->second.layout : ImageLayout::Undefined;
+    }
+
+    size_t NullDevice::GetLiveResourceCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Objects.size() + m_Buffers.size() + m_Textures.size();
+    }
+
+    uint64_t NullDevice::GetFrameCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_FrameCount;
+    }
+
+    // ============================================================================
+    // NullDevice - Resources
+    // ============================================================================
+
+    void NullDevice::Reset(uint32_t swapchainWidth, uint32_t swapchainHeight)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Buffers.clear();
+        m_Textures.clear();
+        m_PipelineLayouts.clear();
+        m_Objects.clear();
+        for (auto& commands : m_Commands)
+            commands.clear();
+
+        m_FrameIndex = 0;
+        m_FrameCount = 0;
+        m_SwapchainWidth = swapchainWidth;
+        m_SwapchainHeight = swapchainHeight;
+        m_SwapchainPassActive = false;
+    }
+
+    uint64_t NullDevice::CreateObject()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        uint64_t id = m_NextID++;
+        m_Objects.insert(id);
+        return id;
+    }
+
+    void NullDevice::DestroyObject(uint64_t id)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Objects.erase(id);
+        m_PipelineLayouts.erase(id);
+    }
+
+    RHIBufferHandle NullDevice::CreateBuffer(const RHIBufferSpecification& spec)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        uint64_t id = m_NextID++;
+
+        BufferData& data = m_Buffers[id];
+        data.bytes.resize(static_cast<size_t>(spec.size));
+        data.usage = spec.usage;
+        data.cpuVisible = spec.cpuVisible;
+        return RHIBufferHandle{ id };
+    }
+
+    void NullDevice::DestroyBuffer(RHIBufferHandle handle)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Buffers.erase(handle.id);
+    }
+
+    uint8_t* NullDevice::GetBufferBytes(RHIBufferHandle handle, uint64_t* size)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Buffers.find(handle.id);
+        if (it == m_Buffers.end())
+        {
+            if (size) *size = 0;
+            return nullptr;
+        }
+
+        // Buffers never resize, so the pointer stays valid until DestroyBuffer
+        if (size) *size = it->second.bytes.size();
+        return it->second.bytes.data();
+    }
+
+    bool NullDevice::IsBufferCPUVisible(RHIBufferHandle handle) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Buffers.find(handle.id);
+        return it != m_Buffers.end() && it->second.cpuVisible;
+    }
+
+    RHITextureHandle NullDevice::CreateTexture(const RHITextureSpecification& spec)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        uint64_t id = m_NextID++;
+
+        TextureData& data = m_Textures[id];
+        data.spec = spec;
+        data.layout = spec.initialLayout;
+        data.mips.resize(std::max(spec.mipLevels, 1u));
+        return RHITextureHandle{ id };
+    }
+
+    void NullDevice::DestroyTexture(RHITextureHandle handle)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Textures.erase(handle.id);
+    }
+
+    bool NullDevice::GetTextureSpec(RHITextureHandle handle, RHITextureSpecification& spec) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Textures.find(handle.id);
+        if (it == m_Textures.end()) return false;
+
+        spec = it->second.spec;
+        return true;
+    }
+
+    void NullDevice::WriteTexture(RHITextureHandle handle, uint32_t mipLevel, const void* data, uint64_t size)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Textures.find(handle.id);
+        if (it == m_Textures.end() || mipLevel >= it->second.mips.size()) return;
+
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        it->second.mips[mipLevel].assign(bytes, bytes + size);
+    }
+
+    void NullDevice::SetPipelineLayout(RHIPipelineHandle pipeline, RHIPipelineLayoutHandle layout)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_PipelineLayouts[pipeline.id] = layout.id;
+    }
+
+    RHIPipelineLayoutHandle NullDevice::GetPipelineLayout(RHIPipelineHandle pipeline) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_PipelineLayouts.find(pipeline.id);
+        return it != m_PipelineLayouts.end() ? RHIPipelineLayoutHandle{ it->second } : NullPipelineLayout;
+    }
+
+    // ============================================================================
+    // NullDevice - Frames and Recording
+    // ============================================================================
+
+    void NullDevice::BeginFrame()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Commands[m_FrameIndex].clear();
+    }
+
+    void NullDevice::EndFrame()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_FrameIndex = (m_FrameIndex + 1) % MaxFramesInFlight;
+        m_FrameCount++;
+    }
+
+    uint32_t NullDevice::GetCurrentFrameIndex() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_FrameIndex;
+    }
+
+    RHICommandBufferHandle NullDevice::GetCurrentCommandBuffer() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return RHICommandBufferHandle{ m_FrameIndex + 1u };
+    }
+
+    RHICommandBufferHandle NullDevice::BeginImmediate()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Commands[ImmediateCommandBuffer - 1].clear();
+        return RHICommandBufferHandle{ ImmediateCommandBuffer };
+    }
+
+    void NullDevice::SetSwapchainSize(uint32_t width, uint32_t height)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_SwapchainWidth = width;
+        m_SwapchainHeight = height;
+    }
+
+    uint32_t NullDevice::GetSwapchainWidth() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_SwapchainWidth;
+    }
+
+    uint32_t NullDevice::GetSwapchainHeight() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_SwapchainHeight;
+    }
+
+    void NullDevice::SetSwapchainPassActive(bool active)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_SwapchainPassActive = active;
+    }
+
+    bool NullDevice::IsSwapchainPassActive() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_SwapchainPassActive;
+    }
+
+    void NullDevice::Record(RHICommandBufferHandle cmd, const NullCommand& command)
+    {
+        if (cmd.id == 0 || cmd.id > ImmediateCommandBuffer) return;
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Commands[cmd.id - 1].push_back(command);
+    }
+
+    void NullDevice::CopyBuffer(RHIBufferHandle src, RHIBufferHandle dst,
+                                uint64_t srcOffset, uint64_t dstOffset, uint64_t size)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto srcIt = m_Buffers.find(src.id);
+        auto dstIt = m_Buffers.find(dst.id);
+        if (srcIt == m_Buffers.end() || dstIt == m_Buffers.end()) return;
+
+        auto& srcBytes = srcIt->second.bytes;
+        auto& dstBytes = dstIt->second.bytes;
+        if (srcOffset + size > srcBytes.size() || dstOffset + size > dstBytes.size())
+        {
+            GG_CORE_ERROR("NullDevice::CopyBuffer: copy of {} bytes is out of range", size);
+            return;
+        }
+
+        std::memmove(dstBytes.data() + dstOffset, srcBytes.data() + srcOffset, static_cast<size_t>(size));
+    }
+
+    void NullDevice::CopyBufferToTexture(RHIBufferHandle src, RHITextureHandle dst, uint64_t srcOffset, uint32_t mipLevel,
+                                         uint32_t width, uint32_t height)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto srcIt = m_Buffers.find(src.id);
+        auto dstIt = m_Textures.find(dst.id);
+        if (srcIt == m_Buffers.end() || dstIt == m_Textures.end()) return;
+        if (mipLevel >= dstIt->second.mips.size() || srcOffset > srcIt->second.bytes.size()) return;
+
+        // Compressed formats have no texel size, so their mip takes everything from srcOffset on
+        const auto& bytes = srcIt->second.bytes;
+        const uint64_t texelSize = GetTexelSize(dstIt->second.spec.format);
+        uint64_t size = bytes.size() - srcOffset;
+        if (texelSize > 0)
+            size = std::min(size, static_cast<uint64_t>(width) * height * texelSize);
+
+        const auto first = bytes.begin() + static_cast<ptrdiff_t>(srcOffset);
+        dstIt->second.mips[mipLevel].assign(first, first + static_cast<ptrdiff_t>(size));
+    }
+
+    void NullDevice::SetTextureLayout(RHITextureHandle handle, ImageLayout layout)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Textures.find(handle.id);
+        if (it != m_Textures.end())
+            it->second.layout = layout;
+    }
+
+    // ============================================================================
+    // RHIDevice Implementation - Core
+    // ============================================================================
+
+    RHIDevice& RHIDevice::Get()
+    {
+        static RHIDevice instance;
+        return instance;
+    }
+
+    void RHIDevice::Init(void* windowHandle)
+    {
+        if (m_Initialized) return;
+
+        GG_CORE_INFO("RHIDevice: Initializing (null backend)...");
+
+        auto& device = NullDevice::Get();
+        device.Reset(NullDevice::DefaultSwapchainWidth, NullDevice::DefaultSwapchainHeight);
+        m_SwapchainRenderPassHandle = RHIRenderPassHandle{ device.CreateObject() };
+
+        m_Initialized = true;
+        GG_CORE_INFO("RHIDevice: Initialized");
+    }
+
+    void RHIDevice::Shutdown()
+    {
+        GG_CORE_INFO("RHIDevice: Shutting down...");
+
+        size_t leaked = NullDevice::Get().GetLiveResourceCount();
+        if (leaked > 1)  // The swapchain render pass lives until here
+            GG_CORE_WARN("RHIDevice: {} resources still alive at shutdown", leaked - 1);
+
+        NullDevice::Get().Reset(NullDevice::DefaultSwapchainWidth, NullDevice::DefaultSwapchainHeight);
+        m_SwapchainRenderPassHandle = NullRenderPass;
+
+        m_Initialized = false;
+        GG_CORE_TRACE("RHIDevice: Shutdown complete");
+    }
+
+    void RHIDevice::BeginFrame()
+    {
+        NullDevice::Get().BeginFrame();
+    }
+
+    void RHIDevice::EndFrame()
+    {
+        auto& device = NullDevice::Get();
+        if (device.IsSwapchainPassActive())
+        {
+            RHICmd::EndRenderPass(device.GetCurrentCommandBuffer());
+            device.SetSwapchainPassActive(false);
+        }
+        device.EndFrame();
+    }
+
+    void RHIDevice::BeginSwapchainRenderPass()
+    {
+        auto& device = NullDevice::Get();
+        RHICmd::BeginRenderPass(device.GetCurrentCommandBuffer(), m_SwapchainRenderPassHandle, NullFramebuffer,
+                                device.GetSwapchainWidth(), device.GetSwapchainHeight());
+        device.SetSwapchainPassActive(true);
+    }
+
+    RHICommandBufferHandle RHIDevice::GetCurrentCommandBuffer() const
+    {
+        return NullDevice::Get().GetCurrentCommandBuffer();
+    }
+
+    RHIRenderPassHandle RHIDevice::GetSwapchainRenderPass() const
+    {
+        return m_SwapchainRenderPassHandle;
+    }
+
+    uint32_t RHIDevice::GetSwapchainWidth() const
+    {
+        return NullDevice::Get().GetSwapchainWidth();
+    }
+
+    uint32_t RHIDevice::GetSwapchainHeight() const
+    {
+        return NullDevice::Get().GetSwapchainHeight();
+    }
+
+    uint32_t RHIDevice::GetCurrentFrameIndex() const
+    {
+        return NullDevice::Get().GetCurrentFrameIndex();
+    }
+
+    void RHIDevice::ImmediateSubmit(const std::function<void(RHICommandBufferHandle)>& func)
+    {
+        // Recorded transfers have already executed when func returns
+        func(NullDevice::Get().BeginImmediate());
+    }
+
+    void RHIDevice::WaitIdle()
+    {
+    }
+
+    void RHIDevice::OnWindowResize(uint32_t width, uint32_t height)
+    {
+        NullDevice::Get().SetSwapchainSize(width, height);
+    }
+
+    void RHIDevice::SetVSync(bool enabled)
+    {
+    }
+
+    bool RHIDevice::IsVSync() const
+    {
+        return false;
+    }
+
+    // ============================================================================
+    // Descriptor Sets
+    // ============================================================================
+
+    RHIDescriptorSetLayoutHandle RHIDevice::CreateDescriptorSetLayout(const std::vector<RHIDescriptorBinding>& bindings)
+    {
+        return RHIDescriptorSetLayoutHandle{ NullDevice::Get().CreateObject() };
+    }
+
+    void RHIDevice::DestroyDescriptorSetLayout(RHIDescriptorSetLayoutHandle handle)
+    {
+        if (!handle.IsValid()) return;
+        NullDevice::Get().DestroyObject(handle.id);
+    }
+
+    RHIDescriptorSetHandle RHIDevice::AllocateDescriptorSet(RHIDescriptorSetLayoutHandle layout)
+    {
+        if (!layout.IsValid()) return NullDescriptorSet;
+        return RHIDescriptorSetHandle{ NullDevice::Get().CreateObject() };
+    }
+
+    void RHIDevice::FreeDescriptorSet(RHIDescriptorSetHandle handle)
+    {
+        if (!handle.IsValid()) return;
+        NullDevice::Get().DestroyObject(handle.id);
+    }
+
+    void RHIDevice::UpdateDescriptorSet(RHIDescriptorSetHandle set, const std::vector<RHIDescriptorWrite>& writes)
+    {
+    }
+
+    // ============================================================================
+    // Buffer Management
+    // ============================================================================
+
+    Result<RHIBufferHandle> RHIDevice::TryCreateBuffer(const RHIBufferSpecification& spec)
+    {
+        if (spec.size == 0)
+            return Result<RHIBufferHandle>::Err("buffer size is zero");
+
+        return Result<RHIBufferHandle>::Ok(NullDevice::Get().CreateBuffer(spec));
+    }
+
+    RHIBufferHandle RHIDevice::CreateBuffer(const RHIBufferSpecification& spec)
+    {
+        auto result = TryCreateBuffer(spec);
+        if (result.IsErr())
+        {
+            GG_CORE_ERROR("RHIDevice::CreateBuffer: {}", result.Error());
+            return NullBuffer;
+        }
+        return result.Value();
+    }
+
+    void RHIDevice::DestroyBuffer(RHIBufferHandle handle)
+    {
+        if (!handle.IsValid()) return;
+        NullDevice::Get().DestroyBuffer(handle);
+    }
+
+    void* RHIDevice::MapBuffer(RHIBufferHandle handle)
+    {
+        if (!handle.IsValid()) return nullptr;
+
+        auto& device = NullDevice::Get();
+        if (!device.IsBufferCPUVisible(handle))
+        {
+            GG_CORE_ERROR("RHIDevice::MapBuffer: Buffer is not CPU-visible");
+            return nullptr;
+        }
+        return device.GetBufferBytes(handle);
+    }
+
+    void RHIDevice::UnmapBuffer(RHIBufferHandle handle)
+    {
+    }
+
+    void RHIDevice::FlushBuffer(RHIBufferHandle handle, uint64_t offset, uint64_t size)
+    {
+    }
+
+    void RHIDevice::UploadBufferData(RHIBufferHandle handle, const void* data, uint64_t size, uint64_t offset)
+    {
+        if (!handle.IsValid() || !data || size == 0) return;
+
+        // Host memory either way, so no staging copy even for GPU-only buffers
+        uint64_t bufferSize = 0;
+        uint8_t* bytes = NullDevice::Get().GetBufferBytes(handle, &bufferSize);
+        if (!bytes || offset + size > bufferSize)
+        {
+            GG_CORE_ERROR("RHIDevice::UploadBufferData: upload of {} bytes at offset {} is out of range", size, offset);
+            return;
+        }
+        std::memcpy(bytes + offset, data, static_cast<size_t>(size));
+    }
+
+    // ============================================================================
+    // Texture Management
+    // ============================================================================
+
+    Result<RHITextureHandle> RHIDevice::TryCreateTexture(const RHITextureSpecification& spec)
+    {
+        if (spec.width == 0 || spec.height == 0)
+        {
+            return Result<RHITextureHandle>::Err(
+                "invalid texture size (" + std::to_string(spec.width) + "x" + std::to_string(spec.height) + ")");
+        }
+
+        return Result<RHITextureHandle>::Ok(NullDevice::Get().CreateTexture(spec));
+    }
+
+    RHITextureHandle RHIDevice::CreateTexture(const RHITextureSpecification& spec)
+    {
+        auto result = TryCreateTexture(spec);
+        if (result.IsErr())
+        {
+            GG_CORE_ERROR("RHIDevice::CreateTexture: {}", result.Error());
+            return NullTexture;
+        }
+        return result.Value();
+    }
+
+    void RHIDevice::DestroyTexture(RHITextureHandle handle)
+    {
+        if (!handle.IsValid()) return;
+        NullDevice::Get().DestroyTexture(handle);
+    }
+
+    void RHIDevice::UploadTextureData(RHITextureHandle handle, const void* pixels, uint64_t size)
+    {
+        if (!handle.IsValid() || !pixels || size == 0) return;
+
+        auto& device = NullDevice::Get();
+        device.WriteTexture(handle, 0, pixels, size);
+        device.SetTextureLayout(handle, ImageLayout::ShaderReadOnly);
+    }
+
+    uint32_t RHIDevice::GetTextureWidth(RHITextureHandle handle) const
+    {
+        RHITextureSpecification spec;
+        return NullDevice::Get().GetTextureSpec(handle, spec) ? spec.width : 0;
+    }
+
+    uint32_t RHIDevice::GetTextureHeight(RHITextureHandle handle) const
+    {
+        RHITextureSpecification spec;
+        return NullDevice::Get().GetTextureSpec(handle, spec) ? spec.height : 0;
+    }
+
+    // ============================================================================
+    // Samplers and Shaders
+    // ============================================================================
+
+    RHISamplerHandle RHIDevice::CreateSampler(const RHISamplerSpecification& spec)
+    {
+        return RHISamplerHandle{ NullDevice::Get().CreateObject() };
+    }
+
+    void RHIDevice::DestroySampler(RHISamplerHandle handle)
+    {
+        if (!handle.IsValid()) return;
+        NullDevice::Get().DestroyObject(handle.id);
+    }
+
+    RHIShaderModuleHandle RHIDevice::CreateShaderModule(ShaderStage stage, const std::vector<char>& spirvCode)
+    {
+        return CreateShaderModule(stage, spirvCode.data(), spirvCode.size());
+    }
+
+    RHIShaderModuleHandle RHIDevice::CreateShaderModule(ShaderStage stage, const void* spirvData, size_t spirvSize)
+    {
+        auto result = TryCreateShaderModule(stage, spirvData, spirvSize);
+        if (result.IsErr())
+        {
+            GG_CORE_ERROR("RHIDevice::CreateShaderModule: {}", result.Error());
+            return NullShaderModule;
+        }
+        return result.Value();
+    }
+
+    Result<RHIShaderModuleHandle> RHIDevice::TryCreateShaderModule(ShaderStage stage, const std::vector<char>& spirvCode)
+    {
+        return TryCreateShaderModule(stage, spirvCode.data(), spirvCode.size());
+    }
+
+    Result<RHIShaderModuleHandle> RHIDevice::TryCreateShaderModule(ShaderStage stage, const void* spirvData, size_t spirvSize)
+    {
+        // The bytecode is never run, so any non-empty blob is accepted
+        if (!spirvData || spirvSize == 0)
+            return Result<RHIShaderModuleHandle>::Err("empty shader bytecode");
+
+        return Result<RHIShaderModuleHandle>::Ok(RHIShaderModuleHandle{ NullDevice::Get().CreateObject() });
+    }
+
+    void RHIDevice::DestroyShaderModule(RHIShaderModuleHandle handle)
+    {
+        if (!handle.IsValid()) return;
+        NullDevice::Get().DestroyObject(handle.id);
+    }
+
+    // ============================================================================
+    // Pipelines, Render Passes and Framebuffers
+    // ============================================================================
+
+    RHIGraphicsPipelineResult RHIDevice::CreateGraphicsPipeline(const RHIGraphicsPipelineSpecification& spec)
+    {
+        auto result = TryCreateGraphicsPipeline(spec);
+        if (result.IsErr())
+        {
+            GG_CORE_ERROR("RHIDevice::CreateGraphicsPipeline: {}", result.Error());
+            return RHIGraphicsPipelineResult{};
+        }
+        return result.Value();
+    }
+
+    Result<RHIGraphicsPipelineResult> RHIDevice::TryCreateGraphicsPipeline(const RHIGraphicsPipelineSpecification& spec)
+    {
+        if (spec.shaderModules.empty())
+            return Result<RHIGraphicsPipelineResult>::Err("no shader modules");
+
+        auto& device = NullDevice::Get();
+        RHIGraphicsPipelineResult result;
+        result.pipeline = RHIPipelineHandle{ device.CreateObject() };
+        result.layout = RHIPipelineLayoutHandle{ device.CreateObject() };
+        device.SetPipelineLayout(result.pipeline, result.layout);
+        return Result<RHIGraphicsPipelineResult>::Ok(result);
+    }
+
+    void RHIDevice::DestroyPipeline(RHIPipelineHandle handle)
+    {
+        if (!handle.IsValid()) return;
+        NullDevice::Get().DestroyObject(handle.id);
+    }
+
+    void RHIDevice::DestroyPipelineLayout(RHIPipelineLayoutHandle handle)
+    {
+        if (!handle.IsValid()) return;
+        NullDevice::Get().DestroyObject(handle.id);
+    }
+
+    RHIPipelineLayoutHandle RHIDevice::GetPipelineLayout(RHIPipelineHandle pipeline) const
+    {
+        return NullDevice::Get().GetPipelineLayout(pipeline);
+    }
+
+    RHIRenderPassHandle RHIDevice::CreateRenderPass(const RHIRenderPassSpecification& spec)
+    {
+        return RHIRenderPassHandle{ NullDevice::Get().CreateObject() };
+    }
+
+    void RHIDevice::DestroyRenderPass(RHIRenderPassHandle handle)
+    {
+        if (!handle.IsValid()) return;
+        NullDevice::Get().DestroyObject(handle.id);
+    }
+
+    RHIFramebufferHandle RHIDevice::CreateFramebuffer(const RHIFramebufferSpecification& spec)
+    {
+        return RHIFramebufferHandle{ NullDevice::Get().CreateObject() };
+    }
+
+    void RHIDevice::DestroyFramebuffer(RHIFramebufferHandle handle)
+    {
+        if (!handle.IsValid()) return;
+        NullDevice::Get().DestroyObject(handle.id);
+    }
+
+    // ============================================================================
+    // Bindless Textures
+    // ============================================================================
+
+    uint32_t RHIDevice::GetMaxBindlessTextures() const
+    {
+        // Same order as desktop GPUs report, so BindlessTextureManager never clamps
+        return 1u << 20;
+    }
+
+    RHIDescriptorSetLayoutHandle RHIDevice::CreateBindlessTextureLayout(uint32_t maxTextures)
+    {
+        return RHIDescriptorSetLayoutHandle{ NullDevice::Get().CreateObject() };
+    }
+
+    RHIDescriptorSetHandle RHIDevice::AllocateBindlessDescriptorSet(RHIDescriptorSetLayoutHandle layout, uint32_t maxTextures)
+    {
+        if (!layout.IsValid()) return NullDescriptorSet;
+        return RHIDescriptorSetHandle{ NullDevice::Get().CreateObject() };
+    }
+
+    void RHIDevice::UpdateBindlessTexture(RHIDescriptorSetHandle set, uint32_t index,
+                                          RHITextureHandle texture, RHISamplerHandle sampler)
+    {
+    }
+
+    void* RHIDevice::GetRawDescriptorSet(RHIDescriptorSetHandle handle) const
+    {
+        // The id itself stands in for the native set
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(handle.id));
+    }
+
+    RHIDescriptorSetLayoutHandle RHIDevice::CreateBindlessSamplerTextureLayout(
+        RHISamplerHandle immutableSampler, uint32_t maxTextures)
+    {
+        return RHIDescriptorSetLayoutHandle{ NullDevice::Get().CreateObject() };
+    }
+
+    RHIDescriptorSetHandle RHIDevice::AllocateBindlessSamplerTextureSet(
+        RHIDescriptorSetLayoutHandle layout, uint32_t maxTextures)
+    {
+        if (!layout.IsValid()) return NullDescriptorSet;
+        return RHIDescriptorSetHandle{ NullDevice::Get().CreateObject() };
+    }
+
+    void RHIDevice::UpdateBindlessSamplerTextureSlot(
+        RHIDescriptorSetHandle set, uint32_t index, RHITextureHandle texture)
+    {
+    }
+
+    // ============================================================================
+    // ImGui Integration
+    // ============================================================================
+
+    void* RHIDevice::RegisterImGuiTexture(RHITextureHandle texture, RHISamplerHandle sampler)
+    {
+        // No ImGui backend in headless builds; hand back something non-null and unique
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(texture.id));
+    }
+
+    void RHIDevice::UnregisterImGuiTexture(void* imguiHandle)
+    {
+    }
+
+}
@@ -5,6 +5,33 @@
 
 namespace GGEngine {
 
+    namespace {
+
+        void GetMemoryAccessScope(MemoryAccess access, bool isSource,
+                                  VkAccessFlags& accessMask, VkPipelineStageFlags& stageMask)
+        {
+            switch (access)
+            {
+                case MemoryAccess::TransferWrite:
+                    accessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                    stageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+                    break;
+                case MemoryAccess::DrawRead:
+                    accessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+                                 VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+                    stageMask = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                                VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+                    break;
+                case MemoryAccess::None:
+                default:
+                    accessMask = 0;
+                    stageMask = isSource ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+                    break;
+            }
+        }
+
+    }
+
     // ============================================================================
     // RHICmd Implementation
     // ============================================================================
@@ -363,6 +390,20 @@ namespace GGEngine {
         VkCommandBuffer vkCmd = registry.GetCommandBuffer(cmd);
         if (vkCmd == VK_NULL_HANDLE) return;
 
+        // Memory barriers carry their own stage masks, so each is its own call
+        for (const auto& memBarrier : barrier.memoryBarriers)
+        {
+            VkMemoryBarrier vkBarrier{};
+            vkBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+
+            VkPipelineStageFlags srcStage = 0;
+            VkPipelineStageFlags dstStage = 0;
+            GetMemoryAccessScope(memBarrier.srcAccess, true, vkBarrier.srcAccessMask, srcStage);
+            GetMemoryAccessScope(memBarrier.dstAccess, false, vkBarrier.dstAccessMask, dstStage);
+
+            vkCmdPipelineBarrier(vkCmd, srcStage, dstStage, 0, 1, &vkBarrier, 0, nullptr, 0, nullptr);
+        }
+
         std::vector<VkImageMemoryBarrier> imageBarriers;
         imageBarriers.reserve(barrier.imageBarriers.size());
 
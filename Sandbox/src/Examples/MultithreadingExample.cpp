@@ -360,6 +360,8 @@ void MultithreadingExample::OnRender(const GGEngine::Camera& camera)
 
             // Wait for all parallel tasks
             taskGraph.WaitAll(tasks);
+            for (GGEngine::TaskID task : tasks)
+                taskGraph.Release(task);
         }
 
         GGEngine::InstancedRenderer2D::EndScene();
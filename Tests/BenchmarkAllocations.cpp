@@ -0,0 +1,35 @@
+#include "BenchmarkConfig.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// =============================================================================
+// Allocation counting
+// =============================================================================
+// Replaces global new/delete for the whole benchmark executable so hot paths
+// can be checked for heap traffic. Allocations made inside a Windows Engine
+// DLL go through its own CRT and are not seen here.
+
+namespace {
+    std::atomic<size_t> s_AllocationCount{0};
+}
+
+void* operator new(size_t size)
+{
+    s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+namespace GGEngine::Testing {
+
+    size_t GetAllocationCount()
+    {
+        return s_AllocationCount.load(std::memory_order_relaxed);
+    }
+
+}
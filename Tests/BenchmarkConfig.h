@@ -0,0 +1,58 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+#include <algorithm>
+#include <limits>
+
+namespace GGEngine::Testing {
+
+    // Benchmarks run as gtest cases in the GGEngineBenchmarks executable.
+    // They are not registered with CTest; run them explicitly, e.g.
+    //   GGEngineBenchmarks --gtest_filter=ComponentStorageBenchmark.*
+
+    // Keep a value alive so the optimizer can't discard the work producing it
+    template<typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &value;
+#endif
+    }
+
+    // Run fn `repetitions` times and return the fastest wall time in nanoseconds
+    // Taking the minimum filters out scheduler noise on shared build machines
+    template<typename Fn>
+    double MeasureBestNs(Fn&& fn, int repetitions = 5)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < repetitions; rep++)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            fn();
+            auto end = std::chrono::high_resolution_clock::now();
+            best = std::min(best, static_cast<double>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+        }
+        return best;
+    }
+
+    // Heap allocations made so far by the benchmark executable (see
+    // BenchmarkAllocations.cpp). Diff two readings to count allocations.
+    size_t GetAllocationCount();
+
+    // Print one result row: "[ BENCH    ] <name> n=<count> <ns/op> ns/op <Mops/s>"
+    inline void ReportBenchmark(const char* name, size_t count, double totalNs)
+    {
+        double nsPerOp = count > 0 ? totalNs / static_cast<double>(count) : 0.0;
+        double opsPerSec = totalNs > 0.0 ? static_cast<double>(count) * 1e9 / totalNs : 0.0;
+        std::printf("[ BENCH    ] %-48s n=%-9zu %10.2f ns/op %10.2f Mops/s\n",
+                    name, count, nsPerOp, opsPerSec / 1e6);
+    }
+
+}
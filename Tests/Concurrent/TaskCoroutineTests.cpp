@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Core/TaskGraph.h"
+#include "GGEngine/Core/TaskCoroutine.h"
+
+// Built by GGEngineCoroutineTests, which compiles this file as C++20
+#if !defined(__cpp_impl_coroutine)
+#error "TaskCoroutineTests.cpp needs a compiler with C++20 coroutine support"
+#endif
+
+using namespace GGEngine;
+
+namespace {
+
+    TaskCoroutine SumChain(int count)
+    {
+        int total = 0;
+        for (int i = 1; i <= count; i++)
+        {
+            TaskID step = TaskGraph::Get().CreateTask<int>("Step", [i]() { return i; });
+            const TaskResult& value = co_await AwaitTask(step);
+            total += value.Get<int>();
+            TaskGraph::Get().Release(step);
+        }
+
+        TaskResult result;
+        result.Set(total);
+        co_return result;
+    }
+
+    TaskCoroutine AwaitFailure()
+    {
+        TaskID failing = TaskGraph::Get().CreateTask("Failing", []() -> TaskResult { return TaskResult::Failure("Broken"); });
+        co_await AwaitTask(failing);
+        co_return TaskResult::Success();
+    }
+
+    // Counts how often it got past the co_await
+    TaskCoroutine AwaitStale(TaskID stale, int& resumed)
+    {
+        co_await AwaitTask(stale);
+        resumed++;
+        co_return TaskResult::Success();
+    }
+
+}
+
+class TaskCoroutineTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        if (!TaskGraph::Get().IsInitialized())
+            TaskGraph::Get().Init(2);
+    }
+
+    void TearDown() override
+    {
+        TaskGraph::Get().ProcessCompletedCallbacks();
+    }
+};
+
+TEST_F(TaskCoroutineTest, AwaitsChainOfTasks)
+{
+    TaskID sum = CreateCoroutineTask("SumChain", SumChain(10));
+    TaskID doubled = TaskGraph::Get().Then<int, int>(sum, "Double", [](const int& value) { return value * 2; });
+
+    ASSERT_TRUE(TaskGraph::Get().Wait(doubled));
+    EXPECT_EQ(55, TaskGraph::Get().GetResult(sum).Get<int>());
+    EXPECT_EQ(110, TaskGraph::Get().GetResult(doubled).Get<int>());
+}
+
+TEST_F(TaskCoroutineTest, AwaitedFailureFailsTask)
+{
+    TaskID task = CreateCoroutineTask("AwaitFailure", AwaitFailure());
+    EXPECT_FALSE(TaskGraph::Get().Wait(task));
+    EXPECT_EQ(TaskState::Failed, TaskGraph::Get().GetState(task));
+}
+
+TEST_F(TaskCoroutineTest, AwaitingReleasedOrInvalidTaskFailsTask)
+{
+    TaskID released = TaskGraph::Get().CreateTask<int>("Released", []() { return 1; });
+    ASSERT_TRUE(TaskGraph::Get().Wait(released));
+    TaskGraph::Get().Release(released);
+    ASSERT_FALSE(TaskGraph::Get().IsAlive(released));
+
+    for (TaskID stale : { released, TaskID{} })
+    {
+        int resumed = 0;
+        TaskID task = CreateCoroutineTask("AwaitStale", AwaitStale(stale, resumed));
+        EXPECT_FALSE(TaskGraph::Get().Wait(task));
+        EXPECT_EQ(TaskState::Failed, TaskGraph::Get().GetState(task));
+        EXPECT_TRUE(TaskGraph::Get().GetResult(task).HasError());
+        EXPECT_EQ(0, resumed);
+        TaskGraph::Get().Release(task);
+    }
+}
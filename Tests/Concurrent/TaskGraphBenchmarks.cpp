@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Core/TaskGraph.h"
+#include "BenchmarkConfig.h"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+namespace {
+
+    // Roughly 1us of ALU work - about a PrepareInstances chunk of a few dozen sprites
+    uint32_t SpinWork(uint32_t seed)
+    {
+        uint32_t x = seed | 1u;
+        for (int i = 0; i < 256; i++)
+        {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+        }
+        return x;
+    }
+
+    std::atomic<uint32_t> s_Sink{0};
+
+    TaskResult EmptyTask()
+    {
+        return TaskResult::Success();
+    }
+
+    TaskResult SpinTask()
+    {
+        s_Sink.fetch_add(SpinWork(s_Sink.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        return TaskResult::Success();
+    }
+
+    // Tasks submitted from the main thread (goes through the injection queue)
+    double RunIndependent(size_t count, TaskResult (*work)())
+    {
+        std::vector<TaskID> tasks(count);
+        return MeasureBestNs([&]() {
+            for (size_t i = 0; i < count; i++)
+                tasks[i] = TaskGraph::Get().CreateTask("Bench", work);
+            TaskGraph::Get().WaitAll(tasks);
+            for (TaskID task : tasks)
+                TaskGraph::Get().Release(task);
+        });
+    }
+
+    // One task fans out from a worker (own deque + stealing)
+    double RunFanOut(size_t count, TaskResult (*work)())
+    {
+        std::vector<TaskID> tasks(count);
+        return MeasureBestNs([&]() {
+            TaskID root = TaskGraph::Get().CreateTask("Root", [&]() -> TaskResult {
+                for (size_t i = 0; i < count; i++)
+                    tasks[i] = TaskGraph::Get().CreateTask("Bench", work);
+                return TaskResult::Success();
+            });
+            TaskGraph::Get().Wait(root);
+            TaskGraph::Get().WaitAll(tasks);
+            TaskGraph::Get().Release(root);
+            for (TaskID task : tasks)
+                TaskGraph::Get().Release(task);
+        });
+    }
+
+    // Independent dependency chains (dependency resolution throughput)
+    double RunChains(size_t count, size_t chainLength, TaskResult (*work)())
+    {
+        const size_t chains = count / chainLength;
+        std::vector<TaskID> tails(chains);
+        return MeasureBestNs([&]() {
+            for (size_t c = 0; c < chains; c++)
+            {
+                TaskID previous = TaskGraph::Get().CreateTask("Bench", work);
+                for (size_t i = 1; i < chainLength; i++)
+                {
+                    TaskID next = TaskGraph::Get().CreateTask("Bench", work, { previous });
+                    TaskGraph::Get().Release(previous);
+                    previous = next;
+                }
+                tails[c] = previous;
+            }
+            TaskGraph::Get().WaitAll(tails);
+            for (TaskID tail : tails)
+                TaskGraph::Get().Release(tail);
+        });
+    }
+
+    // Per-item work spread with ParallelFor (caller participates, no per-chunk tasks)
+    double RunParallelFor(size_t count)
+    {
+        std::vector<uint32_t> out(count);
+        return MeasureBestNs([&]() {
+            TaskGraph::Get().ParallelFor(0, count, 64, [&](size_t first, size_t last) {
+                for (size_t i = first; i < last; i++)
+                    out[i] = SpinWork(static_cast<uint32_t>(i));
+            });
+            DoNotOptimize(out.data());
+        });
+    }
+
+}
+
+// Param: worker count. Counts above the machine's hardware threads are skipped.
+class TaskGraphScalingBenchmark : public ::testing::TestWithParam<uint32_t>
+{
+protected:
+    void SetUp() override
+    {
+        const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        if (GetParam() > hardwareThreads)
+            GTEST_SKIP() << "Only " << hardwareThreads << " hardware threads";
+
+        m_PreviousWorkers = TaskGraph::Get().IsInitialized() ? TaskGraph::Get().GetWorkerCount() : 0;
+        TaskGraph::Get().Shutdown();
+        TaskGraph::Get().Init(GetParam());
+    }
+
+    void TearDown() override
+    {
+        if (!TaskGraph::Get().IsInitialized())
+            return;
+
+        TaskGraph::Get().Shutdown();
+        if (m_PreviousWorkers > 0)
+            TaskGraph::Get().Init(m_PreviousWorkers);
+    }
+
+    std::string Label(const char* scenario) const
+    {
+        return std::string(scenario) + "/workers=" + std::to_string(GetParam());
+    }
+
+    uint32_t m_PreviousWorkers = 0;
+};
+
+TEST_P(TaskGraphScalingBenchmark, EmptyTasks)
+{
+    const size_t count = 20'000;
+    ReportBenchmark(Label("Independent(empty)").c_str(), count, RunIndependent(count, EmptyTask));
+    ReportBenchmark(Label("FanOut(empty)").c_str(), count, RunFanOut(count, EmptyTask));
+    ReportBenchmark(Label("Chains8(empty)").c_str(), count, RunChains(count, 8, EmptyTask));
+}
+
+TEST_P(TaskGraphScalingBenchmark, SpinTasks)
+{
+    const size_t count = 20'000;
+    ReportBenchmark(Label("Independent(1us)").c_str(), count, RunIndependent(count, SpinTask));
+    ReportBenchmark(Label("FanOut(1us)").c_str(), count, RunFanOut(count, SpinTask));
+    ReportBenchmark(Label("Chains8(1us)").c_str(), count, RunChains(count, 8, SpinTask));
+}
+
+TEST_P(TaskGraphScalingBenchmark, ParallelFor)
+{
+    const size_t count = 200'000;
+    ReportBenchmark(Label("ParallelFor(1us items)").c_str(), count, RunParallelFor(count));
+}
+
+INSTANTIATE_TEST_SUITE_P(WorkerCounts, TaskGraphScalingBenchmark,
+    ::testing::Values(1u, 2u, 4u, 8u, 16u, 32u));
+
+// =============================================================================
+// Task creation cost
+// =============================================================================
+// Creates, waits for and releases batches of small tasks from the main thread,
+// comparing the std::string/std::function overloads against the allocation-free
+// const char*/TaskFunction path. Reports heap allocations per task after a
+// warm-up batch has grown the slot pool and queues; the fast path should be 0.
+
+class TaskGraphCreationBenchmark : public ::testing::Test
+{
+protected:
+    static constexpr size_t BatchSize = 4096;
+
+    void SetUp() override
+    {
+        if (!TaskGraph::Get().IsInitialized())
+            TaskGraph::Get().Init();
+    }
+
+    // Returns allocations per task over `batches` warm batches; reports throughput
+    template<typename CreateFn>
+    double Measure(const char* name, CreateFn&& create, size_t batches = 8)
+    {
+        std::vector<TaskID> tasks(BatchSize);
+        auto runBatch = [&]() {
+            for (size_t i = 0; i < BatchSize; i++)
+                tasks[i] = create(i, i > 0 ? tasks[i - 1] : TaskID{});
+            TaskGraph::Get().Wait(tasks.back());
+            for (TaskID task : tasks)
+                TaskGraph::Get().Wait(task);
+            for (TaskID task : tasks)
+                TaskGraph::Get().Release(task);
+        };
+
+        // Warm up: grow task pages, inject ring and deques to steady state
+        runBatch();
+        runBatch();
+
+        const size_t before = GetAllocationCount();
+        for (size_t b = 0; b < batches; b++)
+            runBatch();
+        const size_t allocations = GetAllocationCount() - before;
+        const double perTask = static_cast<double>(allocations) / static_cast<double>(BatchSize * batches);
+
+        ReportBenchmark(name, BatchSize, MeasureBestNs(runBatch));
+        std::printf("[ BENCH    ] %-48s %.3f allocations/task\n", name, perTask);
+        return perTask;
+    }
+};
+
+TEST_F(TaskGraphCreationBenchmark, StdFunctionPath)
+{
+    // Captures like a typical system task: a pointer, an index and a delta time
+    std::atomic<uint32_t> counter{0};
+    const double scale = 0.5;
+    Measure("Create(std::string, std::function)", [&](size_t i, TaskID) {
+        return TaskGraph::Get().CreateTask(std::string("System:BenchmarkTask"), [&counter, i, scale]() -> TaskResult {
+            counter.fetch_add(static_cast<uint32_t>(i * scale), std::memory_order_relaxed);
+            return TaskResult::Success();
+        });
+    });
+    Measure("Create(std::string, std::function, deps)", [&](size_t i, TaskID previous) {
+        return TaskGraph::Get().CreateTask(std::string("System:BenchmarkTask"), [&counter, i, scale]() -> TaskResult {
+            counter.fetch_add(static_cast<uint32_t>(i * scale), std::memory_order_relaxed);
+            return TaskResult::Success();
+        }, std::vector<TaskID>{ previous });
+    });
+}
+
+TEST_F(TaskGraphCreationBenchmark, FastPath)
+{
+    std::atomic<uint32_t> counter{0};
+    const double scale = 0.5;
+    const double independent = Measure("Create(const char*, inline lambda)", [&](size_t i, TaskID) {
+        return TaskGraph::Get().CreateTask("System:BenchmarkTask", [&counter, i, scale]() -> TaskResult {
+            counter.fetch_add(static_cast<uint32_t>(i * scale), std::memory_order_relaxed);
+            return TaskResult::Success();
+        });
+    });
+    const double chained = Measure("Create(const char*, inline lambda, deps)", [&](size_t i, TaskID previous) {
+        return TaskGraph::Get().CreateTask("System:BenchmarkTask", [&counter, i, scale]() -> TaskResult {
+            counter.fetch_add(static_cast<uint32_t>(i * scale), std::memory_order_relaxed);
+            return TaskResult::Success();
+        }, { previous });
+    });
+
+    EXPECT_EQ(0.0, independent);
+    EXPECT_EQ(0.0, chained);
+}
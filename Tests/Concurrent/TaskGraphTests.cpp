@@ -1,9 +1,15 @@
 #include <gtest/gtest.h>
 #include "GGEngine/Core/TaskGraph.h"
 #include "TestConfig.h"
+#include <algorithm>
 #include <atomic>
+#include <array>
 #include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 using namespace GGEngine;
 
@@ -151,6 +157,67 @@ TEST_F(TaskResultTest, Failure_Factory)
     EXPECT_EQ("Test error", result.GetError());
 }
 
+// =============================================================================
+// TaskFunction Tests (No TaskGraph needed)
+// =============================================================================
+
+class TaskFunctionTest : public ::testing::Test {};
+
+TEST_F(TaskFunctionTest, DefaultConstruction_IsEmpty)
+{
+    TaskFunction fn;
+    EXPECT_FALSE(static_cast<bool>(fn));
+    EXPECT_FALSE(fn.IsInline());
+}
+
+TEST_F(TaskFunctionTest, EmptyStdFunction_StaysEmpty)
+{
+    TaskFunction fn(std::function<TaskResult()>{});
+    EXPECT_FALSE(static_cast<bool>(fn));
+}
+
+TEST_F(TaskFunctionTest, SmallCapture_StoredInline)
+{
+    int a = 20, b = 22;
+    TaskFunction fn([a, b]() -> TaskResult {
+        TaskResult result;
+        result.Set(a + b);
+        return result;
+    });
+
+    EXPECT_TRUE(fn.IsInline());
+    EXPECT_EQ(42, fn().Get<int>());
+}
+
+TEST_F(TaskFunctionTest, LargeCapture_FallsBackToHeap)
+{
+    std::array<int, 32> values{};
+    values[31] = 7;
+    TaskFunction fn([values]() -> TaskResult {
+        TaskResult result;
+        result.Set(values[31]);
+        return result;
+    });
+
+    EXPECT_FALSE(fn.IsInline());
+    EXPECT_EQ(7, fn().Get<int>());
+}
+
+TEST_F(TaskFunctionTest, MoveAndReset_DestroyCapturesOnce)
+{
+    auto shared = std::make_shared<int>(5);
+    TaskFunction fn([shared]() -> TaskResult { return TaskResult::Success(); });
+    EXPECT_EQ(2, shared.use_count());
+
+    TaskFunction moved(std::move(fn));
+    EXPECT_FALSE(static_cast<bool>(fn));
+    EXPECT_TRUE(static_cast<bool>(moved));
+    EXPECT_EQ(2, shared.use_count());
+
+    moved.Reset();
+    EXPECT_EQ(1, shared.use_count());
+}
+
 // =============================================================================
 // TaskGraph Tests
 // =============================================================================
@@ -254,6 +321,122 @@ TEST_F(TaskGraphTest, WaitAll_MultipleTasks)
     }
 }
 
+TEST_F(TaskGraphTest, Wait_NestedInsideTaskOnSingleWorker)
+{
+    // The only worker waits on a child it queued itself; it has to run the child
+    const uint32_t previousWorkers = TaskGraph::Get().GetWorkerCount();
+    TaskGraph::Get().Shutdown();
+    TaskGraph::Get().Init(1);
+
+    std::atomic<bool> childRan{false};
+    bool childSucceeded = false;
+    TaskID parent = TaskGraph::Get().CreateTask("Parent", [&]() -> TaskResult {
+        TaskID child = TaskGraph::Get().CreateTask("Child", [&]() -> TaskResult {
+            childRan = true;
+            return TaskResult::Success();
+        });
+        childSucceeded = TaskGraph::Get().Wait(child);
+        TaskGraph::Get().Release(child);
+        return TaskResult::Success();
+    });
+
+    EXPECT_TRUE(TaskGraph::Get().Wait(parent));
+    EXPECT_TRUE(childRan.load());
+    EXPECT_TRUE(childSucceeded);
+
+    TaskGraph::Get().Shutdown();
+    TaskGraph::Get().Init(previousWorkers);
+}
+
+TEST_F(TaskGraphTest, Wait_RecursiveNestedWaits)
+{
+    // Every task splits in two and waits on both halves - far more blocked
+    // waits in flight than there are workers
+    struct Splitter
+    {
+        std::atomic<int> Leaves{0};
+
+        void Run(int depth)
+        {
+            if (depth == 0)
+            {
+                Leaves++;
+                return;
+            }
+
+            TaskID left = TaskGraph::Get().CreateTask("Left", [this, depth]() -> TaskResult {
+                Run(depth - 1);
+                return TaskResult::Success();
+            });
+            TaskID right = TaskGraph::Get().CreateTask("Right", [this, depth]() -> TaskResult {
+                Run(depth - 1);
+                return TaskResult::Success();
+            });
+            TaskGraph::Get().Wait(left);
+            TaskGraph::Get().Wait(right);
+            TaskGraph::Get().Release(left);
+            TaskGraph::Get().Release(right);
+        }
+    };
+
+    Splitter splitter;
+    splitter.Run(8);
+    EXPECT_EQ(256, splitter.Leaves.load());
+}
+
+TEST_F(TaskGraphTest, Wait_MainThreadRunsTasksWhileWorkersBusy)
+{
+    // Every worker spins until the target task runs, so only the waiting
+    // main thread can run it
+    const uint32_t workerCount = TaskGraph::Get().GetWorkerCount();
+    std::atomic<bool> release{false};
+    std::atomic<uint32_t> blockersStarted{0};
+
+    std::vector<TaskID> blockers;
+    for (uint32_t i = 0; i < workerCount; i++)
+    {
+        blockers.push_back(TaskGraph::Get().CreateTask("Blocker", [&]() -> TaskResult {
+            blockersStarted++;
+            while (!release.load())
+                std::this_thread::yield();
+            return TaskResult::Success();
+        }));
+    }
+    while (blockersStarted.load() < workerCount)
+        std::this_thread::yield();
+
+    std::thread::id ranOn;
+    TaskID target = TaskGraph::Get().CreateTask("Target", [&]() -> TaskResult {
+        ranOn = std::this_thread::get_id();
+        release = true;
+        return TaskResult::Success();
+    });
+
+    EXPECT_TRUE(TaskGraph::Get().Wait(target));
+    EXPECT_EQ(std::this_thread::get_id(), ranOn);
+    TaskGraph::Get().WaitAll(blockers);
+}
+
+TEST_F(TaskGraphTest, Wait_WakesWhenDependencyChainFinishesElsewhere)
+{
+    // Nothing for the waiter to help with: it must sleep and be woken by completion
+    std::atomic<bool> release{false};
+    TaskID slow = TaskGraph::Get().CreateTask("Slow", [&]() -> TaskResult {
+        while (!release.load())
+            std::this_thread::yield();
+        return TaskResult::Success();
+    });
+    TaskID last = TaskGraph::Get().CreateTask("Last", []() -> TaskResult { return TaskResult::Success(); }, { slow });
+
+    std::thread releaser([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        release = true;
+    });
+
+    EXPECT_TRUE(TaskGraph::Get().Wait(last));
+    releaser.join();
+}
+
 // =============================================================================
 // Task Result Tests
 // =============================================================================
@@ -491,6 +674,495 @@ TEST_F(TaskGraphTest, Cancel_PendingTask)
     EXPECT_FALSE(task2Ran.load());
 }
 
+// =============================================================================
+// Fast Path / Slot Pooling Tests
+// =============================================================================
+
+TEST_F(TaskGraphTest, FastPath_MoreDependenciesThanInline)
+{
+    std::atomic<int> done{0};
+    std::vector<TaskID> deps;
+    for (int i = 0; i < 7; i++)
+    {
+        deps.push_back(TaskGraph::Get().CreateTask("Dep", [&]() -> TaskResult {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            done++;
+            return TaskResult::Success();
+        }));
+    }
+
+    int seen = -1;
+    TaskID last = TaskGraph::Get().CreateTask("Last", [&]() -> TaskResult {
+        seen = done.load();
+        return TaskResult::Success();
+    }, TaskDependencies(deps));
+
+    EXPECT_TRUE(TaskGraph::Get().Wait(last));
+    EXPECT_EQ(7, seen);
+}
+
+TEST_F(TaskGraphTest, Release_StaleIdBehavesLikeInvalid)
+{
+    TaskID id = TaskGraph::Get().CreateTask("Short", []() -> TaskResult { return TaskResult::Success(); });
+    ASSERT_TRUE(TaskGraph::Get().Wait(id));
+    TaskGraph::Get().Release(id);
+
+    // The worker drops its own reference just after waking waiters
+    auto start = std::chrono::steady_clock::now();
+    while (TaskGraph::Get().GetState(id) == TaskState::Completed &&
+           std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+        std::this_thread::yield();
+
+    EXPECT_EQ(TaskState::Failed, TaskGraph::Get().GetState(id));
+    EXPECT_FALSE(TaskGraph::Get().Wait(id));
+
+    // The slot is free again; the next task may reuse it, but never with the same id
+    TaskID next = TaskGraph::Get().CreateTask("Next", []() -> TaskResult { return TaskResult::Success(); });
+    EXPECT_NE(id, next);
+    EXPECT_TRUE(TaskGraph::Get().Wait(next));
+    TaskGraph::Get().Release(next);
+}
+
+TEST_F(TaskGraphTest, Release_BeforeCompletionStillRuns)
+{
+    std::atomic<bool> release{false};
+    std::atomic<bool> ran{false};
+
+    TaskID blocker = TaskGraph::Get().CreateTask("Blocker", [&]() -> TaskResult {
+        while (!release.load())
+            std::this_thread::yield();
+        return TaskResult::Success();
+    });
+    TaskID dependent = TaskGraph::Get().CreateTask("Dependent", [&]() -> TaskResult {
+        ran = true;
+        return TaskResult::Success();
+    }, { blocker });
+
+    TaskGraph::Get().Release(dependent);
+    release = true;
+    TaskGraph::Get().Wait(blocker);
+    TaskGraph::Get().Release(blocker);
+
+    auto start = std::chrono::steady_clock::now();
+    while (!ran.load() && std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+        std::this_thread::yield();
+    EXPECT_TRUE(ran.load());
+}
+
+TEST_F(TaskGraphTest, Release_PredecessorResultOutlivesHandle)
+{
+    std::atomic<bool> release{false};
+
+    TaskID producer = TaskGraph::Get().CreateTask<int>("Producer", [&]() {
+        while (!release.load())
+            std::this_thread::yield();
+        return 41;
+    });
+    TaskID consumer = TaskGraph::Get().Then<int, int>(producer, "Consumer",
+        [](const int& value) { return value + 1; });
+
+    // The continuation reads the producer's result after its handle is gone
+    TaskGraph::Get().Release(producer);
+    release = true;
+
+    ASSERT_TRUE(TaskGraph::Get().Wait(consumer));
+    EXPECT_EQ(42, TaskGraph::Get().GetResult(consumer).Get<int>());
+    TaskGraph::Get().Release(consumer);
+}
+
+TEST_F(TaskGraphTest, Release_CancelledDependentsAreRecycled)
+{
+    std::atomic<bool> release{false};
+    TaskID blocker = TaskGraph::Get().CreateTask("Blocker", [&]() -> TaskResult {
+        while (!release.load())
+            std::this_thread::yield();
+        return TaskResult::Success();
+    });
+    TaskID gate = TaskGraph::Get().CreateTask("Gate", []() -> TaskResult { return TaskResult::Success(); }, { blocker });
+    TaskID dependent = TaskGraph::Get().CreateTask("Dependent", []() -> TaskResult { return TaskResult::Success(); }, { gate });
+
+    TaskGraph::Get().Cancel(gate);
+    EXPECT_EQ(TaskState::Cancelled, TaskGraph::Get().GetState(dependent));
+
+    TaskGraph::Get().Release(gate);
+    TaskGraph::Get().Release(dependent);
+    release = true;
+    TaskGraph::Get().Wait(blocker);
+    TaskGraph::Get().Release(blocker);
+}
+
+TEST_F(TaskGraphTest, Stress_ReleasedTasksReuseSlots)
+{
+    // Released chains recycle their slots, so indices stay bounded instead of
+    // growing by three per round (slack covers slots still being released)
+    uint32_t firstIndex = UINT32_MAX;
+    uint32_t maxIndex = 0;
+    for (int round = 0; round < 2000; round++)
+    {
+        TaskID a = TaskGraph::Get().CreateTask("A", []() -> TaskResult { return TaskResult::Success(); });
+        TaskID b = TaskGraph::Get().CreateTask("B", []() -> TaskResult { return TaskResult::Success(); }, { a });
+        TaskID c = TaskGraph::Get().CreateTask("C", []() -> TaskResult { return TaskResult::Success(); }, { a, b });
+        TaskGraph::Get().Release(a);
+        TaskGraph::Get().Release(b);
+
+        ASSERT_TRUE(TaskGraph::Get().Wait(c));
+        TaskGraph::Get().Release(c);
+        firstIndex = std::min(firstIndex, a.Index);
+        maxIndex = std::max({ maxIndex, a.Index, b.Index, c.Index });
+    }
+
+    EXPECT_LT(maxIndex - firstIndex, 100u);
+}
+
+// =============================================================================
+// Suspension Tests
+// =============================================================================
+
+TEST_F(TaskGraphTest, Suspend_FreesWorkerAndResumesWithResult)
+{
+    std::atomic<bool> release{false};
+    std::atomic<int> steps{0};
+
+    TaskID slow = TaskGraph::Get().CreateTask<int>("Slow", [&]() {
+        while (!release.load())
+            std::this_thread::yield();
+        return 41;
+    });
+
+    TaskID waiter = TaskGraph::Get().CreateTask("Waiter", [&, step = 0]() mutable -> TaskResult {
+        steps++;
+        if (step++ == 0)
+            return TaskGraph::Get().Suspend({ slow });
+
+        TaskResult result;
+        result.Set(TaskGraph::Get().GetResult(slow).Get<int>() + 1);
+        return result;
+    });
+
+    // Suspended: back to Pending, not holding a worker
+    auto start = std::chrono::steady_clock::now();
+    while ((steps.load() == 0 || TaskGraph::Get().GetState(waiter) != TaskState::Pending) &&
+           std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+        std::this_thread::yield();
+    EXPECT_EQ(TaskState::Pending, TaskGraph::Get().GetState(waiter));
+    EXPECT_EQ(1, steps.load());
+
+    release = true;
+    ASSERT_TRUE(TaskGraph::Get().Wait(waiter));
+    EXPECT_EQ(2, steps.load());
+    EXPECT_EQ(42, TaskGraph::Get().GetResult(waiter).Get<int>());
+}
+
+TEST_F(TaskGraphTest, Suspend_ManySuspendedTasksOnSingleWorker)
+{
+    // More suspended tasks than workers; none of them may block the worker
+    const uint32_t previousWorkers = TaskGraph::Get().GetWorkerCount();
+    TaskGraph::Get().Shutdown();
+    TaskGraph::Get().Init(1);
+
+    std::atomic<int> finished{0};
+    std::vector<TaskID> tasks;
+    for (int i = 0; i < 16; i++)
+    {
+        tasks.push_back(TaskGraph::Get().CreateTask("Outer", [&, step = 0, inner = TaskID{}]() mutable -> TaskResult {
+            if (step++ == 0)
+            {
+                inner = TaskGraph::Get().CreateTask("Inner", []() -> TaskResult { return TaskResult::Success(); });
+                TaskResult suspended = TaskGraph::Get().Suspend({ inner });
+                TaskGraph::Get().Release(inner);
+                return suspended;
+            }
+            finished++;
+            return TaskResult::Success();
+        }));
+    }
+
+    TaskGraph::Get().WaitAll(tasks);
+    EXPECT_EQ(16, finished.load());
+
+    TaskGraph::Get().Shutdown();
+    TaskGraph::Get().Init(previousWorkers);
+}
+
+TEST_F(TaskGraphTest, Suspend_AwaitedFailureFailsTask)
+{
+    std::atomic<int> runs{0};
+    TaskID failing = TaskGraph::Get().CreateTask("Failing", []() -> TaskResult {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return TaskResult::Failure("Broken");
+    });
+    TaskID waiter = TaskGraph::Get().CreateTask("Waiter", [&]() -> TaskResult {
+        if (runs++ == 0)
+            return TaskGraph::Get().Suspend({ failing });
+        return TaskResult::Success();
+    });
+
+    EXPECT_FALSE(TaskGraph::Get().Wait(waiter));
+    EXPECT_EQ(TaskState::Failed, TaskGraph::Get().GetState(waiter));
+    EXPECT_EQ(1, runs.load());
+}
+
+TEST_F(TaskGraphTest, Suspend_CancelWhileSuspended)
+{
+    std::atomic<bool> release{false};
+    std::atomic<int> runs{0};
+    TaskID slow = TaskGraph::Get().CreateTask("Slow", [&]() -> TaskResult {
+        while (!release.load())
+            std::this_thread::yield();
+        return TaskResult::Success();
+    });
+    TaskID waiter = TaskGraph::Get().CreateTask("Waiter", [&]() -> TaskResult {
+        if (runs++ == 0)
+            return TaskGraph::Get().Suspend({ slow });
+        return TaskResult::Success();
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    while ((runs.load() == 0 || TaskGraph::Get().GetState(waiter) != TaskState::Pending) &&
+           std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+        std::this_thread::yield();
+
+    TaskGraph::Get().Cancel(waiter);
+    EXPECT_EQ(TaskState::Cancelled, TaskGraph::Get().GetState(waiter));
+
+    release = true;
+    TaskGraph::Get().Wait(slow);
+    EXPECT_EQ(1, runs.load());
+}
+
+TEST_F(TaskGraphTest, Suspend_ThenSeesFinalResult)
+{
+    TaskID producer = TaskGraph::Get().CreateTask("Producer", [step = 0]() mutable -> TaskResult {
+        if (step++ == 0)
+            return TaskGraph::Get().Suspend({});     // Nothing to await: just re-queued
+
+        TaskResult result;
+        result.Set(20);
+        return result;
+    });
+    TaskID doubled = TaskGraph::Get().Then<int, int>(producer, "Double", [](const int& value) { return value * 2; });
+
+    ASSERT_TRUE(TaskGraph::Get().Wait(doubled));
+    EXPECT_EQ(40, TaskGraph::Get().GetResult(doubled).Get<int>());
+}
+
+TEST_F(TaskGraphTest, Suspend_OutsideTaskFails)
+{
+    TaskResult result = TaskGraph::Get().Suspend({});
+    EXPECT_FALSE(result.IsSuspended());
+    EXPECT_TRUE(result.HasError());
+}
+
+// =============================================================================
+// Event Tests
+// =============================================================================
+
+TEST_F(TaskGraphTest, Event_StaysPendingUntilSignalled)
+{
+    TaskID event = TaskGraph::Get().CreateEvent("Event");
+    ASSERT_TRUE(event.IsValid());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(TaskState::Pending, TaskGraph::Get().GetState(event));
+
+    std::thread signaller([event]() { TaskGraph::Get().Signal(event); });
+    EXPECT_TRUE(TaskGraph::Get().Wait(event));
+    signaller.join();
+
+    EXPECT_EQ(TaskState::Completed, TaskGraph::Get().GetState(event));
+    TaskGraph::Get().Release(event);
+}
+
+TEST_F(TaskGraphTest, Event_ReleasesDependents)
+{
+    std::atomic<int> runs{0};
+    TaskID event = TaskGraph::Get().CreateEvent("Event");
+    TaskID dependent = TaskGraph::Get().CreateTask("Dependent", [&]() -> TaskResult {
+        runs++;
+        return TaskResult::Success();
+    }, { event });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(0, runs.load());
+
+    TaskGraph::Get().Signal(event);
+    TaskGraph::Get().Signal(event);     // Repeated signals are ignored
+    EXPECT_TRUE(TaskGraph::Get().Wait(dependent));
+    EXPECT_EQ(1, runs.load());
+}
+
+TEST_F(TaskGraphTest, Event_CancelFailsWaitAndIgnoresSignal)
+{
+    TaskID event = TaskGraph::Get().CreateEvent("Event");
+    TaskGraph::Get().Cancel(event);
+    TaskGraph::Get().Signal(event);
+
+    EXPECT_FALSE(TaskGraph::Get().Wait(event));
+    EXPECT_EQ(TaskState::Cancelled, TaskGraph::Get().GetState(event));
+}
+
+TEST_F(TaskGraphTest, Event_SignalOnOrdinaryTaskIsIgnored)
+{
+    std::atomic<bool> release{false};
+    TaskID task = TaskGraph::Get().CreateTask("Task", [&]() -> TaskResult {
+        while (!release.load())
+            std::this_thread::yield();
+        return TaskResult::Success();
+    });
+
+    TaskGraph::Get().Signal(task);
+    EXPECT_NE(TaskState::Completed, TaskGraph::Get().GetState(task));
+
+    release = true;
+    EXPECT_TRUE(TaskGraph::Get().Wait(task));
+}
+
+// =============================================================================
+// ParallelFor / ParallelReduce Tests
+// =============================================================================
+
+TEST_F(TaskGraphTest, ParallelFor_VisitsEveryIndexOnce)
+{
+    for (size_t count : { size_t(1), size_t(7), size_t(1000), size_t(100000) })
+    {
+        std::vector<std::atomic<int>> visits(count);
+        for (auto& v : visits)
+            v = 0;
+
+        TaskGraph::Get().ParallelFor(0, count, 16, [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++)
+                visits[i]++;
+        });
+
+        for (size_t i = 0; i < count; i++)
+            ASSERT_EQ(1, visits[i].load()) << "count=" << count << " index=" << i;
+    }
+}
+
+TEST_F(TaskGraphTest, ParallelFor_HonoursRangeAndMinGrain)
+{
+    std::mutex chunkMutex;
+    std::vector<std::pair<size_t, size_t>> chunks;
+
+    TaskGraph::Get().ParallelFor(100, 1100, 300, [&](size_t first, size_t last) {
+        std::lock_guard<std::mutex> lock(chunkMutex);
+        chunks.push_back({ first, last });
+    });
+
+    std::sort(chunks.begin(), chunks.end());
+    ASSERT_FALSE(chunks.empty());
+    EXPECT_EQ(100u, chunks.front().first);
+    EXPECT_EQ(1100u, chunks.back().second);
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        if (i + 1 < chunks.size())
+        {
+            EXPECT_EQ(chunks[i].second, chunks[i + 1].first);
+            EXPECT_GE(chunks[i].second - chunks[i].first, 300u);
+        }
+    }
+}
+
+TEST_F(TaskGraphTest, ParallelFor_SmallRangeRunsInlineOnCaller)
+{
+    const std::thread::id caller = std::this_thread::get_id();
+    std::thread::id ranOn;
+
+    TaskGraph::Get().ParallelFor(0, 10, 64, [&](size_t, size_t) {
+        ranOn = std::this_thread::get_id();
+    });
+
+    EXPECT_EQ(caller, ranOn);
+}
+
+TEST_F(TaskGraphTest, ParallelFor_NestedInsideTask)
+{
+    std::atomic<size_t> total{0};
+
+    TaskID outer = TaskGraph::Get().CreateTask("Outer", [&]() -> TaskResult {
+        TaskGraph::Get().ParallelFor(0, 64, 1, [&](size_t first, size_t last) {
+            TaskGraph::Get().ParallelFor(0, 1000, 10, [&](size_t innerFirst, size_t innerLast) {
+                total += (last - first) * (innerLast - innerFirst);
+            });
+        });
+        return TaskResult::Success();
+    });
+
+    ASSERT_TRUE(TaskGraph::Get().Wait(outer));
+    EXPECT_EQ(64000u, total.load());
+}
+
+TEST_F(TaskGraphTest, ParallelFor_InsideTaskDuringShutdownWaitsForHelpers)
+{
+    // Workers drain their queues during shutdown, so the task below may still
+    // split its loop then; it must not return while helpers run its chunks
+    std::atomic<bool> started{false};
+    std::atomic<int> visited{0};
+    std::atomic<int> visitedAtReturn{-1};
+    TaskGraph::Get().CreateTask("Outer", [&]() -> TaskResult {
+        started = true;
+        TaskGraph::Get().ParallelFor(0, 32, 1, [&](size_t first, size_t last)
+        {
+            for (size_t i = first; i < last; i++)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                visited++;
+            }
+        });
+        visitedAtReturn = visited.load();
+        return TaskResult::Success();
+    });
+
+    while (!started.load())
+        std::this_thread::yield();
+
+    const uint32_t previousWorkers = TaskGraph::Get().GetWorkerCount();
+    TaskGraph::Get().Shutdown();
+    EXPECT_EQ(32, visitedAtReturn.load());
+    TaskGraph::Get().Init(previousWorkers);
+}
+
+TEST_F(TaskGraphTest, ParallelReduce_SumMatchesSerial)
+{
+    const size_t count = 123457;
+    uint64_t sum = TaskGraph::Get().ParallelReduce<uint64_t>(0, count, 100, 0,
+        [](size_t first, size_t last) {
+            uint64_t partial = 0;
+            for (size_t i = first; i < last; i++)
+                partial += i;
+            return partial;
+        },
+        [](uint64_t a, uint64_t b) { return a + b; });
+
+    EXPECT_EQ(static_cast<uint64_t>(count) * (count - 1) / 2, sum);
+}
+
+TEST_F(TaskGraphTest, ParallelReduce_CombinesInRangeOrder)
+{
+    // String concatenation is associative but not commutative
+    std::string digits = TaskGraph::Get().ParallelReduce<std::string>(0, 200, 1, std::string(),
+        [](size_t first, size_t last) {
+            std::string part;
+            for (size_t i = first; i < last; i++)
+                part += static_cast<char>('0' + i % 10);
+            return part;
+        },
+        [](std::string a, std::string b) { return a + b; });
+
+    ASSERT_EQ(200u, digits.size());
+    for (size_t i = 0; i < digits.size(); i++)
+        ASSERT_EQ(static_cast<char>('0' + i % 10), digits[i]);
+}
+
+TEST_F(TaskGraphTest, ParallelReduce_EmptyRangeReturnsIdentity)
+{
+    int result = TaskGraph::Get().ParallelReduce<int>(5, 5, 1, 42,
+        [](size_t, size_t) { return 1; },
+        [](int a, int b) { return a + b; });
+
+    EXPECT_EQ(42, result);
+}
+
 // =============================================================================
 // Statistics Tests
 // =============================================================================
@@ -585,3 +1257,101 @@ TEST_F(TaskGraphTest, Stress_DiamondDependency)
     EXPECT_LT(bOrder, dOrder);
     EXPECT_LT(cOrder, dOrder);
 }
+
+TEST_F(TaskGraphTest, Stress_TasksSpawnedFromWorkers)
+{
+    // Tasks created on a worker go to that worker's own deque and get stolen from there
+    const int childCount = 200;
+    std::atomic<int> counter{0};
+    std::vector<TaskID> children(childCount);
+
+    TaskID root = TaskGraph::Get().CreateTask("Root", [&]() -> TaskResult {
+        for (int i = 0; i < childCount; i++)
+        {
+            children[i] = TaskGraph::Get().CreateTask("Child", [&counter]() -> TaskResult {
+                counter++;
+                return TaskResult::Success();
+            });
+        }
+        return TaskResult::Success();
+    });
+
+    TaskGraph::Get().Wait(root);
+    TaskGraph::Get().WaitAll(children);
+
+    EXPECT_EQ(childCount, counter.load());
+}
+
+TEST_F(TaskGraphTest, Stress_DependencyCompletingDuringRegistration)
+{
+    // The dependency usually finishes while the dependent is still being created
+    for (int i = 0; i < 500; i++)
+    {
+        std::atomic<bool> firstDone{false};
+        std::atomic<bool> orderedCorrectly{false};
+
+        TaskID first = TaskGraph::Get().CreateTask("First", [&]() -> TaskResult {
+            firstDone = true;
+            return TaskResult::Success();
+        });
+
+        TaskID second = TaskGraph::Get().CreateTask("Second", [&]() -> TaskResult {
+            orderedCorrectly = firstDone.load();
+            return TaskResult::Success();
+        }, { first });
+
+        ASSERT_TRUE(TaskGraph::Get().Wait(second));
+        EXPECT_TRUE(orderedCorrectly.load());
+    }
+}
+
+TEST_F(TaskGraphTest, Priority_HighRunsBeforeLowWhenQueuedTogether)
+{
+    // Priority order is per worker, so use a single worker to make it deterministic
+    const uint32_t previousWorkers = TaskGraph::Get().GetWorkerCount();
+    TaskGraph::Get().Shutdown();
+    TaskGraph::Get().Init(1);
+
+    // Occupy the worker so the prioritized tasks queue up behind it
+    std::atomic<bool> blockerStarted{false};
+    std::atomic<bool> release{false};
+    TaskID blocker = TaskGraph::Get().CreateTask("Blocker", [&]() -> TaskResult {
+        blockerStarted = true;
+        while (!release.load())
+            std::this_thread::yield();
+        return TaskResult::Success();
+    });
+
+    while (!blockerStarted.load())
+        std::this_thread::yield();
+
+    std::atomic<int> order{0};
+    std::vector<int> lowOrder(4, -1);
+    std::vector<int> highOrder(4, -1);
+    std::vector<TaskID> tasks;
+
+    for (int i = 0; i < 4; i++)
+    {
+        tasks.push_back(TaskGraph::Get().CreateTask("Low", [&, i]() -> TaskResult {
+            lowOrder[i] = order++;
+            return TaskResult::Success();
+        }, JobPriority::Low));
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        tasks.push_back(TaskGraph::Get().CreateTask("High", [&, i]() -> TaskResult {
+            highOrder[i] = order++;
+            return TaskResult::Success();
+        }, JobPriority::High));
+    }
+
+    release = true;
+    TaskGraph::Get().Wait(blocker);
+    TaskGraph::Get().WaitAll(tasks);
+
+    EXPECT_LT(*std::max_element(highOrder.begin(), highOrder.end()),
+              *std::min_element(lowOrder.begin(), lowOrder.end()));
+
+    TaskGraph::Get().Shutdown();
+    TaskGraph::Get().Init(previousWorkers);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Core/WorkStealingDeque.h"
+#include "TestConfig.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace GGEngine;
+
+// =============================================================================
+// Single-threaded behaviour
+// =============================================================================
+
+TEST(WorkStealingDequeTest, EmptyDeque_PopAndStealFail)
+{
+    WorkStealingDeque<int> deque;
+    int value = 0;
+
+    EXPECT_TRUE(deque.Empty());
+    EXPECT_FALSE(deque.Pop(value));
+    EXPECT_FALSE(deque.Steal(value));
+}
+
+TEST(WorkStealingDequeTest, Pop_IsLastInFirstOut)
+{
+    WorkStealingDeque<int> deque;
+    for (int i = 0; i < 3; i++)
+        deque.Push(i);
+
+    int value = -1;
+    ASSERT_TRUE(deque.Pop(value));
+    EXPECT_EQ(2, value);
+    ASSERT_TRUE(deque.Pop(value));
+    EXPECT_EQ(1, value);
+    EXPECT_EQ(1u, deque.Size());
+}
+
+TEST(WorkStealingDequeTest, Steal_IsFirstInFirstOut)
+{
+    WorkStealingDeque<int> deque;
+    for (int i = 0; i < 3; i++)
+        deque.Push(i);
+
+    int value = -1;
+    ASSERT_TRUE(deque.Steal(value));
+    EXPECT_EQ(0, value);
+    ASSERT_TRUE(deque.Pop(value));
+    EXPECT_EQ(2, value);
+    ASSERT_TRUE(deque.Steal(value));
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(deque.Empty());
+}
+
+TEST(WorkStealingDequeTest, Grow_PreservesItems)
+{
+    WorkStealingDeque<int> deque(4);
+
+    // Offset top first so the copied range wraps around the ring
+    for (int i = 0; i < 3; i++)
+        deque.Push(-1);
+    int discard = 0;
+    for (int i = 0; i < 3; i++)
+        deque.Steal(discard);
+
+    const int count = 1000;
+    for (int i = 0; i < count; i++)
+        deque.Push(i);
+    EXPECT_EQ(static_cast<size_t>(count), deque.Size());
+
+    for (int i = 0; i < count; i++)
+    {
+        int value = -1;
+        ASSERT_TRUE(deque.Steal(value));
+        EXPECT_EQ(i, value);
+    }
+}
+
+// =============================================================================
+// Concurrent behaviour
+// =============================================================================
+
+TEST(WorkStealingDequeTest, Concurrent_EveryItemTakenExactlyOnce)
+{
+    const int itemCount = 100000;
+    const int thiefCount = 3;
+
+    WorkStealingDeque<int> deque(16);
+    std::vector<std::atomic<int>> taken(itemCount);
+    for (auto& t : taken)
+        t = 0;
+
+    std::atomic<bool> ownerDone{false};
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < thiefCount; t++)
+    {
+        thieves.emplace_back([&]() {
+            int value = 0;
+            while (!ownerDone.load() || !deque.Empty())
+            {
+                if (deque.Steal(value))
+                    taken[value]++;
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Owner interleaves pushes and pops, racing thieves for the last item
+    int value = 0;
+    for (int i = 0; i < itemCount; i++)
+    {
+        deque.Push(i);
+        if (i % 3 == 0 && deque.Pop(value))
+            taken[value]++;
+    }
+    while (deque.Pop(value))
+        taken[value]++;
+    ownerDone = true;
+
+    for (auto& thief : thieves)
+        thief.join();
+
+    int duplicates = 0;
+    int missing = 0;
+    for (auto& t : taken)
+    {
+        if (t.load() == 0) missing++;
+        if (t.load() > 1) duplicates++;
+    }
+    EXPECT_EQ(0, missing);
+    EXPECT_EQ(0, duplicates);
+}
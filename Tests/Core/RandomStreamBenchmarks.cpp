@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Core/RandomStream.h"
+#include "GGEngine/Core/SIMD.h"
+#include "BenchmarkConfig.h"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+// =============================================================================
+// Random float generation
+// =============================================================================
+// 1M floats in [0, 1) per run. The mt19937 case is what Random::Float used
+// before RandomStream; the per-call cases are the particle Emit hot path and
+// Fill is what ParticleSystem::Spawn uses.
+
+namespace {
+
+    constexpr size_t FloatCount = 1000000;
+
+}
+
+TEST(RandomStreamBenchmark, MersenneTwisterPerCall)
+{
+    std::mt19937 engine(1);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    std::vector<float> values(FloatCount);
+
+    ReportBenchmark("Random mt19937 per call", FloatCount, MeasureBestNs([&]() {
+        for (float& value : values)
+            value = distribution(engine);
+        DoNotOptimize(values.data());
+    }, 10));
+}
+
+TEST(RandomStreamBenchmark, StreamPerCall)
+{
+    RandomStream stream(1);
+    std::vector<float> values(FloatCount);
+
+    ReportBenchmark("Random stream per call", FloatCount, MeasureBestNs([&]() {
+        for (float& value : values)
+            value = stream.NextFloat();
+        DoNotOptimize(values.data());
+    }, 10));
+}
+
+TEST(RandomStreamBenchmark, StreamFill)
+{
+    RandomStream stream(1);
+    std::vector<float> values(FloatCount);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "Random stream fill %s", Simd::GetBackendName());
+    ReportBenchmark(name, FloatCount, MeasureBestNs([&]() {
+        stream.Fill(values.data(), values.size());
+        DoNotOptimize(values.data());
+    }, 10));
+}
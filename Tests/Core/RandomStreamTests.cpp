@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Core/RandomStream.h"
+#include "GGEngine/ParticleSystem/Random.h"
+
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace GGEngine;
+
+// =============================================================================
+// Sequence Tests
+// =============================================================================
+
+TEST(RandomStreamTest, SameSeedRepeatsSequence)
+{
+    RandomStream a(42), b(42), c(43);
+
+    bool differs = false;
+    for (int i = 0; i < 100; i++)
+    {
+        const uint32_t value = a.NextUInt();
+        EXPECT_EQ(value, b.NextUInt());
+        differs |= value != c.NextUInt();
+    }
+    EXPECT_TRUE(differs);
+
+    a.Seed(7);
+    b.Seed(7);
+    EXPECT_EQ(a.NextUInt64(), b.NextUInt64());
+}
+
+TEST(RandomStreamTest, NextFloat_StaysInRange)
+{
+    RandomStream stream(1);
+
+    double sum = 0.0;
+    constexpr int Count = 100000;
+    for (int i = 0; i < Count; i++)
+    {
+        const float value = stream.NextFloat();
+        ASSERT_GE(value, 0.0f);
+        ASSERT_LT(value, 1.0f);
+        sum += value;
+
+        const float ranged = stream.NextFloat(-2.0f, 3.0f);
+        ASSERT_GE(ranged, -2.0f);
+        ASSERT_LT(ranged, 3.0f);
+    }
+    EXPECT_NEAR(0.5, sum / Count, 0.01);
+}
+
+TEST(RandomStreamTest, Fill_MatchesScalarCalls)
+{
+    // Odd offsets and lengths exercise the scalar head and tail around the SIMD body
+    for (int skip = 0; skip < 4; skip++)
+    {
+        RandomStream bulk(99), scalar(99);
+        for (int i = 0; i < skip; i++)
+        {
+            bulk.NextUInt();
+            scalar.NextUInt();
+        }
+
+        std::vector<float> values(37);
+        bulk.Fill(values.data(), values.size());
+        for (float value : values)
+            EXPECT_EQ(scalar.NextFloat(), value);
+
+        bulk.Fill(values.data(), 11, 5.0f, 6.0f);
+        for (size_t i = 0; i < 11; i++)
+            EXPECT_FLOAT_EQ(scalar.NextFloat(5.0f, 6.0f), values[i]);
+
+        // Both continue in step afterwards
+        EXPECT_EQ(scalar.NextUInt(), bulk.NextUInt());
+    }
+}
+
+TEST(RandomStreamTest, DeriveSeed_GivesDistinctStreams)
+{
+    std::set<uint32_t> firsts;
+    for (uint64_t index = 0; index < 64; index++)
+        firsts.insert(RandomStream(RandomStream::DeriveSeed(5, index)).NextUInt());
+    EXPECT_EQ(64u, firsts.size());
+}
+
+// =============================================================================
+// Global Random Tests
+// =============================================================================
+
+TEST(RandomTest, InitSeedReplaysStreams)
+{
+    Random::Init(1234);
+    const float first = Random::Float();
+    const uint64_t streamSeed = Random::NextStreamSeed();
+
+    Random::Init(1234);
+    EXPECT_EQ(first, Random::Float());
+    EXPECT_EQ(streamSeed, Random::NextStreamSeed());
+    EXPECT_NE(streamSeed, Random::NextStreamSeed());
+}
+
+TEST(RandomTest, KeyedStreamSeedsIgnoreCallOrder)
+{
+    Random::Init(1234);
+    const uint64_t keyed = Random::GetStreamSeed(5);
+    const uint64_t counted = Random::NextStreamSeed();
+
+    Random::Init(1234);
+    Random::NextStreamSeed();
+    EXPECT_EQ(keyed, Random::GetStreamSeed(5));
+    EXPECT_NE(keyed, Random::GetStreamSeed(6));
+
+    // Keys and NextStreamSeed never hand out the same stream
+    EXPECT_NE(counted, Random::GetStreamSeed(0));
+
+    Random::Init(4321);
+    EXPECT_NE(keyed, Random::GetStreamSeed(5));
+}
+
+TEST(RandomTest, ThreadsDrawFromSeparateStreams)
+{
+    Random::Init(77);
+
+    constexpr int Count = 1000;
+    std::vector<float> a(Count), b(Count);
+    std::thread first([&]() { Random::Fill(a.data(), Count); });
+    std::thread second([&]() {
+        for (float& value : b)
+            value = Random::Float();
+    });
+    first.join();
+    second.join();
+
+    EXPECT_NE(a, b);
+    for (int i = 0; i < Count; i++)
+    {
+        EXPECT_GE(a[i], 0.0f);
+        EXPECT_LT(b[i], 1.0f);
+    }
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Core/SIMD.h"
+#include "GGEngine/Core/Math.h"
+#include <cmath>
+
+using namespace GGEngine;
+using namespace GGEngine::Simd;
+
+namespace {
+
+    void ToArray(Float4 value, float out[4])
+    {
+        Store(out, value);
+    }
+
+}
+
+// =============================================================================
+// Comparison Tests
+// =============================================================================
+
+TEST(SIMDTest, LessEqual_MoveMaskPicksLanes)
+{
+    const Float4 values = Set(-1.0f, 0.0f, 1.0f, 0.0f);
+    EXPECT_EQ(0b1011, MoveMask(LessEqual(values, Splat(0.0f))));
+    EXPECT_EQ(0b0000, MoveMask(LessEqual(values, Splat(-2.0f))));
+    EXPECT_EQ(0b1111, MoveMask(LessEqual(values, Splat(1.0f))));
+    // NaN compares false
+    EXPECT_EQ(0b0000, MoveMask(LessEqual(Splat(std::nanf("")), Splat(0.0f))));
+}
+
+// =============================================================================
+// Integer Tests
+// =============================================================================
+
+TEST(SIMDTest, IntegerBitOps_WrapAndShiftLogically)
+{
+    const uint32_t a[4] = { 0xFFFFFFFFu, 0x80000000u, 0x12345678u, 0u };
+    const uint32_t b[4] = { 1u, 0x80000000u, 0x0F0F0F0Fu, 0u };
+    const Int4 x = LoadInt(a);
+    const Int4 y = LoadInt(b);
+
+    uint32_t out[4];
+    StoreInt(out, x + y);
+    EXPECT_EQ(0u, out[0]);
+    EXPECT_EQ(0u, out[1]);
+
+    StoreInt(out, x ^ y);
+    EXPECT_EQ(0xFFFFFFFEu, out[0]);
+    EXPECT_EQ(0x12345678u ^ 0x0F0F0F0Fu, out[2]);
+
+    StoreInt(out, x | y);
+    EXPECT_EQ(0x1F3F5F7Fu, out[2]);
+
+    StoreInt(out, ShiftRight<28>(x));
+    EXPECT_EQ(0xFu, out[0]);
+    EXPECT_EQ(0x8u, out[1]);
+    EXPECT_EQ(0x1u, out[2]);
+    EXPECT_EQ(0u, out[3]);
+}
+
+// =============================================================================
+// Byte Tests
+// =============================================================================
+
+TEST(SIMDTest, LoadBytes_WidensEachByte)
+{
+    const uint8_t bytes[4] = { 0, 1, 128, 255 };
+    float values[4];
+    ToArray(LoadBytes(bytes), values);
+    EXPECT_EQ(0.0f, values[0]);
+    EXPECT_EQ(1.0f, values[1]);
+    EXPECT_EQ(128.0f, values[2]);
+    EXPECT_EQ(255.0f, values[3]);
+}
+
+TEST(SIMDTest, StoreBytes_RoundsToNearestEvenAndClamps)
+{
+    uint8_t bytes[4];
+    StoreBytes(bytes, Set(1.5f, 2.5f, 3.4f, 254.6f));
+    EXPECT_EQ(2, bytes[0]);
+    EXPECT_EQ(2, bytes[1]);
+    EXPECT_EQ(3, bytes[2]);
+    EXPECT_EQ(255, bytes[3]);
+
+    StoreBytes(bytes, Set(-3.0f, 300.0f, 0.0f, 255.0f));
+    EXPECT_EQ(0, bytes[0]);
+    EXPECT_EQ(255, bytes[1]);
+    EXPECT_EQ(0, bytes[2]);
+    EXPECT_EQ(255, bytes[3]);
+}
+
+// =============================================================================
+// Shuffle Tests
+// =============================================================================
+
+TEST(SIMDTest, Transpose_SwapsRowsAndColumns)
+{
+    Float4 a = Set(0.0f, 1.0f, 2.0f, 3.0f);
+    Float4 b = Set(4.0f, 5.0f, 6.0f, 7.0f);
+    Float4 c = Set(8.0f, 9.0f, 10.0f, 11.0f);
+    Float4 d = Set(12.0f, 13.0f, 14.0f, 15.0f);
+    Transpose(a, b, c, d);
+
+    float rows[4][4];
+    ToArray(a, rows[0]);
+    ToArray(b, rows[1]);
+    ToArray(c, rows[2]);
+    ToArray(d, rows[3]);
+    for (int row = 0; row < 4; row++)
+    {
+        for (int col = 0; col < 4; col++)
+            EXPECT_EQ(static_cast<float>(col * 4 + row), rows[row][col]);
+    }
+}
+
+TEST(SIMDTest, Deinterleave_SplitsPairs)
+{
+    const float pairs[8] = { 0.0f, 10.0f, 1.0f, 11.0f, 2.0f, 12.0f, 3.0f, 13.0f };
+    Float4 evens, odds;
+    Deinterleave(Load(pairs), Load(pairs + 4), evens, odds);
+
+    float x[4], y[4];
+    ToArray(evens, x);
+    ToArray(odds, y);
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(static_cast<float>(i), x[i]);
+        EXPECT_EQ(static_cast<float>(10 + i), y[i]);
+    }
+}
+
+// =============================================================================
+// Math Tests
+// =============================================================================
+
+TEST(SIMDTest, SinCos_MatchesStdAcrossQuadrants)
+{
+    float maxError = 0.0f;
+    for (int step = -4000; step < 4000; step += 4)
+    {
+        const float angles[4] = {
+            step * 0.01f, (step + 1) * 0.01f, (step + 2) * 0.01f, (step + 3) * 0.01f
+        };
+        Float4 sinValues, cosValues;
+        SinCos(Load(angles), sinValues, cosValues);
+
+        float s[4], c[4];
+        ToArray(sinValues, s);
+        ToArray(cosValues, c);
+        for (int i = 0; i < 4; i++)
+        {
+            maxError = std::max(maxError, std::abs(s[i] - std::sin(angles[i])));
+            maxError = std::max(maxError, std::abs(c[i] - std::cos(angles[i])));
+        }
+    }
+    EXPECT_LT(maxError, 1e-6f);
+}
+
+TEST(SIMDTest, SinCos_ExactAtZero)
+{
+    Float4 sinValues, cosValues;
+    SinCos(Splat(0.0f), sinValues, cosValues);
+
+    float s[4], c[4];
+    ToArray(sinValues, s);
+    ToArray(cosValues, c);
+    EXPECT_EQ(0.0f, s[0]);
+    EXPECT_EQ(1.0f, c[0]);
+}
+
+TEST(SIMDTest, SinCos_QuarterTurns)
+{
+    Float4 sinValues, cosValues;
+    SinCos(Set(Math::HalfPi, Math::Pi, -Math::HalfPi, Math::TwoPi), sinValues, cosValues);
+
+    float s[4], c[4];
+    ToArray(sinValues, s);
+    ToArray(cosValues, c);
+    EXPECT_NEAR(1.0f, s[0], 1e-6f);
+    EXPECT_NEAR(0.0f, c[0], 1e-6f);
+    EXPECT_NEAR(0.0f, s[1], 1e-6f);
+    EXPECT_NEAR(-1.0f, c[1], 1e-6f);
+    EXPECT_NEAR(-1.0f, s[2], 1e-6f);
+    EXPECT_NEAR(0.0f, c[2], 1e-6f);
+    EXPECT_NEAR(0.0f, s[3], 1e-6f);
+    EXPECT_NEAR(1.0f, c[3], 1e-6f);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ECS/ComponentStorage.h"
+#include "GGEngine/ECS/Archetype.h"
+#include "BenchmarkConfig.h"
+#include <vector>
+#include <string>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+namespace {
+
+    // Same layouts as TransformComponent / a velocity without the glm dependency
+    struct BenchTransform
+    {
+        float Position[3] = { 0.0f, 0.0f, 0.0f };
+        float Rotation = 0.0f;
+        float Scale[2] = { 1.0f, 1.0f };
+    };
+
+    struct BenchVelocity
+    {
+        float X = 1.0f;
+        float Y = 1.0f;
+    };
+
+    struct BenchTint
+    {
+        float Color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    };
+
+    // Per-type sparse-set storages, as a SparseSet Scene holds them
+    struct SparseSetWorld
+    {
+        ComponentStorage<BenchTransform> Transforms;
+        ComponentStorage<BenchVelocity> Velocities;
+        ComponentStorage<BenchTint> Tints;
+
+        void Create(Entity e)
+        {
+            Transforms.Add(e);
+            Velocities.Add(e);
+        }
+
+        void Destroy(Entity e)
+        {
+            Transforms.Remove(e);
+            Velocities.Remove(e);
+            Tints.Remove(e);
+        }
+
+        void AddTint(Entity e) { Tints.Add(e); }
+        void RemoveTint(Entity e) { Tints.Remove(e); }
+
+        // Integrate position for every (transform, velocity) pair, probing
+        // velocities from the transform driver like a view would
+        void Integrate()
+        {
+            BenchTransform* transforms = Transforms.Data();
+            for (size_t i = 0; i < Transforms.Size(); i++)
+            {
+                if (const BenchVelocity* v = Velocities.Get(Transforms.GetEntity(i)))
+                {
+                    transforms[i].Position[0] += v->X;
+                    transforms[i].Position[1] += v->Y;
+                }
+            }
+        }
+
+        size_t Size() const { return Transforms.Size(); }
+    };
+
+    struct ArchetypeWorld
+    {
+        ArchetypeStorage Storage;
+
+        void Create(Entity e)
+        {
+            Storage.Add<BenchTransform>(e);
+            Storage.Add<BenchVelocity>(e);
+        }
+
+        void Destroy(Entity e) { Storage.DestroyEntity(e); }
+        void AddTint(Entity e) { Storage.Add<BenchTint>(e); }
+        void RemoveTint(Entity e) { Storage.Remove<BenchTint>(e); }
+
+        void Integrate()
+        {
+            Storage.EachChunk<BenchTransform, const BenchVelocity>(
+                [](size_t count, const Entity*, BenchTransform* transforms, const BenchVelocity* velocities)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    transforms[i].Position[0] += velocities[i].X;
+                    transforms[i].Position[1] += velocities[i].Y;
+                }
+            });
+        }
+
+        size_t Size() const { return Storage.Count<BenchTransform>(); }
+    };
+
+    template<typename World>
+    void RunWorldBenchmarks(const char* label, size_t count)
+    {
+        const std::string prefix = std::string(label) + "/";
+
+        // Create: two components per entity
+        double createNs = MeasureBestNs([&]() {
+            World world;
+            for (size_t i = 0; i < count; i++)
+                world.Create(static_cast<Entity>(i));
+            DoNotOptimize(world.Size());
+        });
+        ReportBenchmark((prefix + "Create").c_str(), count, createNs);
+
+        // Destroy: fresh world per repetition so every destroy hits a live entity
+        // (includes the creates - subtract Create to isolate destroy cost)
+        double destroyNs = MeasureBestNs([&]() {
+            World world;
+            for (size_t i = 0; i < count; i++)
+                world.Create(static_cast<Entity>(i));
+            for (size_t i = 0; i < count; i++)
+                world.Destroy(static_cast<Entity>(i));
+            DoNotOptimize(world.Size());
+        });
+        ReportBenchmark((prefix + "Create+Destroy").c_str(), count, destroyNs);
+
+        World world;
+        for (size_t i = 0; i < count; i++)
+            world.Create(static_cast<Entity>(i));
+
+        // Add/remove a third component on every other entity (structural change)
+        double addRemoveNs = MeasureBestNs([&]() {
+            for (size_t i = 0; i < count; i += 2)
+                world.AddTint(static_cast<Entity>(i));
+            for (size_t i = 0; i < count; i += 2)
+                world.RemoveTint(static_cast<Entity>(i));
+            DoNotOptimize(world.Size());
+        });
+        ReportBenchmark((prefix + "AddRemove").c_str(), count, addRemoveNs);
+
+        // Mixed signatures so queries span several archetypes / a sparse join
+        for (size_t i = 0; i < count; i += 3)
+            world.AddTint(static_cast<Entity>(i));
+
+        double iterateNs = MeasureBestNs([&]() {
+            world.Integrate();
+            DoNotOptimize(world.Size());
+        });
+        ReportBenchmark((prefix + "Iterate(Transform,Velocity)").c_str(), count, iterateNs);
+    }
+
+}
+
+class ArchetypeBenchmark : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(ArchetypeBenchmark, SparseSetStorage)
+{
+    RunWorldBenchmarks<SparseSetWorld>("SparseSet", GetParam());
+}
+
+TEST_P(ArchetypeBenchmark, ArchetypeStorage)
+{
+    RunWorldBenchmarks<ArchetypeWorld>("Archetype", GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(EntityCounts, ArchetypeBenchmark,
+    ::testing::Values(size_t(10'000), size_t(100'000), size_t(1'000'000)));
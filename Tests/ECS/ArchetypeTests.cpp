@@ -0,0 +1,324 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ECS/Scene.h"
+#include "TestConfig.h"
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <utility>
+
+using namespace GGEngine;
+
+namespace {
+
+    struct Position
+    {
+        float X = 0.0f;
+        float Y = 0.0f;
+    };
+
+    struct Velocity
+    {
+        float X = 0.0f;
+        float Y = 0.0f;
+    };
+
+    // Non-trivial component to exercise move/destroy through chunk memory
+    struct Name
+    {
+        std::string Value;
+    };
+
+    // Large enough that a chunk holds only a few rows
+    struct Blob
+    {
+        char Bytes[4000] = {};
+    };
+
+}
+
+// =============================================================================
+// ArchetypeStorage
+// =============================================================================
+
+TEST(ArchetypeStorageTest, AddGetHas)
+{
+    ArchetypeStorage storage;
+    storage.Add<Position>(1, Position{ 1.0f, 2.0f });
+
+    ASSERT_TRUE(storage.Has<Position>(1));
+    EXPECT_FALSE(storage.Has<Velocity>(1));
+    EXPECT_FALSE(storage.Has<Position>(2));
+    EXPECT_FLOAT_EQ(2.0f, storage.Get<Position>(1)->Y);
+    EXPECT_EQ(nullptr, storage.Get<Velocity>(1));
+}
+
+TEST(ArchetypeStorageTest, AddingComponentPreservesExistingValues)
+{
+    ArchetypeStorage storage;
+    storage.Add<Name>(5, Name{ "player" });
+    storage.Add<Position>(5, Position{ 3.0f, 4.0f });
+    storage.Add<Velocity>(5, Velocity{ 1.0f, 0.0f });
+
+    EXPECT_EQ("player", storage.Get<Name>(5)->Value);
+    EXPECT_FLOAT_EQ(3.0f, storage.Get<Position>(5)->X);
+    EXPECT_FLOAT_EQ(1.0f, storage.Get<Velocity>(5)->X);
+}
+
+TEST(ArchetypeStorageTest, IdenticalSignaturesShareArchetype)
+{
+    ArchetypeStorage storage;
+    storage.Add<Position>(1);
+    storage.Add<Velocity>(1);
+    storage.Add<Velocity>(2);
+    storage.Add<Position>(2);
+
+    EXPECT_EQ(storage.GetArchetype(1), storage.GetArchetype(2));
+    EXPECT_EQ(2u, storage.GetArchetype(1)->Size());
+}
+
+TEST(ArchetypeStorageTest, RemoveMovesEntityAndFixesSwappedRow)
+{
+    ArchetypeStorage storage;
+    for (Entity e = 0; e < 4; e++)
+    {
+        storage.Add<Position>(e, Position{ static_cast<float>(e), 0.0f });
+        storage.Add<Name>(e, Name{ std::to_string(e) });
+    }
+
+    // Entity 0 leaves the shared archetype; entity 3 is swapped into its row
+    storage.Remove<Name>(0);
+
+    EXPECT_FALSE(storage.Has<Name>(0));
+    EXPECT_FLOAT_EQ(0.0f, storage.Get<Position>(0)->X);
+    for (Entity e = 1; e < 4; e++)
+    {
+        EXPECT_EQ(std::to_string(e), storage.Get<Name>(e)->Value);
+        EXPECT_FLOAT_EQ(static_cast<float>(e), storage.Get<Position>(e)->X);
+    }
+}
+
+TEST(ArchetypeStorageTest, RemovingLastComponentClearsArchetype)
+{
+    ArchetypeStorage storage;
+    storage.Add<Position>(1);
+    storage.Remove<Position>(1);
+
+    EXPECT_EQ(nullptr, storage.GetArchetype(1));
+    EXPECT_FALSE(storage.Has<Position>(1));
+}
+
+TEST(ArchetypeStorageTest, DestroyEntityRemovesAllComponents)
+{
+    ArchetypeStorage storage;
+    storage.Add<Position>(1);
+    storage.Add<Name>(1, Name{ "a" });
+    storage.Add<Position>(2);
+    storage.Add<Name>(2, Name{ "b" });
+
+    storage.DestroyEntity(1);
+
+    EXPECT_FALSE(storage.Has<Position>(1));
+    EXPECT_FALSE(storage.Has<Name>(1));
+    EXPECT_EQ("b", storage.Get<Name>(2)->Value);
+}
+
+TEST(ArchetypeStorageTest, EachMatchesArchetypesContainingAllComponents)
+{
+    ArchetypeStorage storage;
+    storage.Add<Position>(1);
+    storage.Add<Position>(2);
+    storage.Add<Velocity>(2, Velocity{ 1.0f, 1.0f });
+    storage.Add<Position>(3);
+    storage.Add<Velocity>(3, Velocity{ 2.0f, 2.0f });
+    storage.Add<Name>(3);
+    storage.Add<Velocity>(4);
+
+    storage.Each<Position, const Velocity>([](Position& position, const Velocity& velocity) {
+        position.X += velocity.X;
+    });
+
+    std::vector<Entity> visited;
+    storage.Each<const Position, const Velocity>([&](Entity entity, const Position&, const Velocity&) {
+        visited.push_back(entity);
+    });
+    std::sort(visited.begin(), visited.end());
+
+    EXPECT_EQ((std::vector<Entity>{ 2, 3 }), visited);
+    EXPECT_FLOAT_EQ(0.0f, storage.Get<Position>(1)->X);
+    EXPECT_FLOAT_EQ(1.0f, storage.Get<Position>(2)->X);
+    EXPECT_FLOAT_EQ(2.0f, storage.Get<Position>(3)->X);
+    EXPECT_EQ(2u, (storage.Count<Position, Velocity>()));
+}
+
+TEST(ArchetypeStorageTest, RowsSpanMultipleChunks)
+{
+    ArchetypeStorage storage;
+    const Entity count = 64;
+    for (Entity e = 0; e < count; e++)
+        storage.Add<Blob>(e).Bytes[0] = static_cast<char>(e);
+
+    ASSERT_LT(storage.GetArchetype(0)->GetChunkCapacity(), count);
+
+    size_t chunks = 0;
+    size_t rows = 0;
+    storage.EachChunk<Blob>([&](size_t n, const Entity*, Blob*) { chunks++; rows += n; });
+    EXPECT_GT(chunks, 1u);
+    EXPECT_EQ(static_cast<size_t>(count), rows);
+
+    // Remove from the front so rows migrate out of the last chunk
+    for (Entity e = 0; e < count / 2; e++)
+        storage.Remove<Blob>(e);
+
+    for (Entity e = count / 2; e < count; e++)
+        EXPECT_EQ(static_cast<char>(e), storage.Get<Blob>(e)->Bytes[0]);
+    EXPECT_EQ(static_cast<size_t>(count / 2), storage.Count<Blob>());
+}
+
+TEST(ArchetypeStorageTest, EachChangedChunkSkipsUntouchedChunks)
+{
+    ArchetypeStorage storage;
+    const Entity count = 64;
+    for (Entity e = 0; e < count; e++)
+    {
+        storage.Add<Blob>(e);
+        storage.Add<Position>(e);
+    }
+    const uint32_t capacity = storage.GetArchetype(0)->GetChunkCapacity();
+    ASSERT_LT(capacity * 2, count);
+
+    auto changedRows = [&](uint32_t since)
+    {
+        std::vector<Entity> rows;
+        storage.EachChangedChunk<const Position>(since, [&](size_t n, const Entity* entities, const Position*)
+        {
+            rows.insert(rows.end(), entities, entities + n);
+        });
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    };
+
+    uint32_t since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+    EXPECT_TRUE(changedRows(since).empty());
+
+    // Read-only access stamps nothing
+    std::as_const(storage).Get<Position>(0);
+    storage.EachChunk<const Position>([](size_t, const Entity*, const Position*) {});
+    EXPECT_TRUE(changedRows(since).empty());
+
+    // A mutable Get stamps its chunk's column only
+    storage.Get<Position>(capacity)->X = 1.0f;
+    std::vector<Entity> expected;
+    for (Entity e = capacity; e < capacity * 2; e++)
+        expected.push_back(e);
+    EXPECT_EQ(expected, changedRows(since));
+
+    since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+    storage.Get<Blob>(0);
+    EXPECT_TRUE(changedRows(since).empty());
+
+    // So does mutable iteration, and a row carries its stamp when it moves
+    storage.EachChunk<Position>([](size_t, const Entity*, Position*) {});
+    EXPECT_EQ(static_cast<size_t>(count), changedRows(since).size());
+
+    since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+    storage.Get<Position>(count - 1);
+    storage.Remove<Position>(0);          // count - 1 moves into row 0 of Blob+Position
+    std::vector<Entity> rows = changedRows(since);
+    EXPECT_TRUE(std::find(rows.begin(), rows.end(), count - 1) != rows.end());
+}
+
+// =============================================================================
+// Scene in archetype mode
+// =============================================================================
+
+class ArchetypeSceneTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_Scene = std::make_unique<Scene>("ArchetypeScene", SceneStorageMode::Archetype);
+    }
+
+    std::unique_ptr<Scene> m_Scene;
+};
+
+TEST_F(ArchetypeSceneTest, CreateEntityAddsDefaultComponents)
+{
+    EntityID e = m_Scene->CreateEntity("Player");
+
+    EXPECT_EQ(SceneStorageMode::Archetype, m_Scene->GetStorageMode());
+    ASSERT_TRUE(m_Scene->HasComponent<TagComponent>(e));
+    EXPECT_TRUE(m_Scene->HasComponent<TransformComponent>(e));
+    EXPECT_EQ("Player", m_Scene->GetComponent<TagComponent>(e)->Name);
+}
+
+TEST_F(ArchetypeSceneTest, ComponentLifecycleThroughSceneApi)
+{
+    EntityID e = m_Scene->CreateEntity("Sprite");
+    m_Scene->GetComponent<TransformComponent>(e)->Position[0] = 5.0f;
+
+    auto& sprite = m_Scene->AddComponent<SpriteRendererComponent>(e);
+    sprite.Color[0] = 0.25f;
+
+    EXPECT_FLOAT_EQ(5.0f, m_Scene->GetComponent<TransformComponent>(e)->Position[0]);
+    EXPECT_FLOAT_EQ(0.25f, m_Scene->GetComponent<SpriteRendererComponent>(e)->Color[0]);
+
+    m_Scene->RemoveComponent<SpriteRendererComponent>(e);
+    EXPECT_FALSE(m_Scene->HasComponent<SpriteRendererComponent>(e));
+    EXPECT_FLOAT_EQ(5.0f, m_Scene->GetComponent<TransformComponent>(e)->Position[0]);
+}
+
+TEST_F(ArchetypeSceneTest, DestroyAndLookup)
+{
+    EntityID a = m_Scene->CreateEntity("A");
+    EntityID b = m_Scene->CreateEntity("B");
+
+    EXPECT_EQ(b, m_Scene->FindEntityByName("B"));
+
+    m_Scene->DestroyEntity(a);
+    EXPECT_FALSE(m_Scene->IsEntityValid(a));
+    EXPECT_EQ(InvalidEntityID, m_Scene->FindEntityByName("A"));
+    EXPECT_EQ("B", m_Scene->GetComponent<TagComponent>(b)->Name);
+}
+
+TEST_F(ArchetypeSceneTest, EachMatchesSparseSetScene)
+{
+    Scene sparse("SparseScene");
+
+    for (Scene* scene : { m_Scene.get(), &sparse })
+    {
+        for (int i = 0; i < 30; i++)
+        {
+            EntityID e = scene->CreateEntity("Entity");
+            if (i % 3 == 0)
+                scene->AddComponent<SpriteRendererComponent>(e);
+        }
+    }
+
+    auto countSprites = [](Scene& scene) {
+        size_t count = 0;
+        scene.Each<const TransformComponent, const SpriteRendererComponent>(
+            [&](const TransformComponent&, const SpriteRendererComponent&) { count++; });
+        return count;
+    };
+
+    EXPECT_EQ(10u, countSprites(*m_Scene));
+    EXPECT_EQ(countSprites(sparse), countSprites(*m_Scene));
+}
+
+TEST_F(ArchetypeSceneTest, ClearRemovesAllComponents)
+{
+    EntityID e = m_Scene->CreateEntity("A");
+    m_Scene->AddComponent<SpriteRendererComponent>(e);
+
+    m_Scene->Clear();
+
+    size_t count = 0;
+    m_Scene->Each<TransformComponent>([&](TransformComponent&) { count++; });
+    EXPECT_EQ(0u, count);
+    EXPECT_EQ(0u, m_Scene->GetEntityCount());
+}
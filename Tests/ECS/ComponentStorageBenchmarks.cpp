@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ECS/ComponentStorage.h"
+#include "BenchmarkConfig.h"
+#include <unordered_map>
+#include <vector>
+#include <random>
+#include <numeric>
+#include <string>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+namespace {
+
+    // Same layout as TransformComponent without the glm dependency
+    struct BenchTransform
+    {
+        float Position[3] = { 0.0f, 0.0f, 0.0f };
+        float Rotation = 0.0f;
+        float Scale[2] = { 1.0f, 1.0f };
+    };
+
+    // The previous ComponentStorage lookup scheme (unordered_map Entity -> slot),
+    // kept here only as a baseline for comparison
+    template<typename T>
+    class MapIndexedStorage
+    {
+    public:
+        T& Add(Entity entity)
+        {
+            m_EntityToIndex[entity] = m_Components.size();
+            m_IndexToEntity.push_back(entity);
+            m_Components.push_back(T{});
+            return m_Components.back();
+        }
+
+        void Remove(Entity entity)
+        {
+            auto it = m_EntityToIndex.find(entity);
+            if (it == m_EntityToIndex.end()) return;
+
+            size_t indexToRemove = it->second;
+            size_t lastIndex = m_Components.size() - 1;
+            if (indexToRemove != lastIndex)
+            {
+                m_Components[indexToRemove] = std::move(m_Components[lastIndex]);
+                Entity lastEntity = m_IndexToEntity[lastIndex];
+                m_IndexToEntity[indexToRemove] = lastEntity;
+                m_EntityToIndex[lastEntity] = indexToRemove;
+            }
+
+            m_Components.pop_back();
+            m_IndexToEntity.pop_back();
+            m_EntityToIndex.erase(entity);
+        }
+
+        bool Has(Entity entity) const { return m_EntityToIndex.find(entity) != m_EntityToIndex.end(); }
+
+        T* Get(Entity entity)
+        {
+            auto it = m_EntityToIndex.find(entity);
+            if (it == m_EntityToIndex.end()) return nullptr;
+            return &m_Components[it->second];
+        }
+
+        size_t Size() const { return m_Components.size(); }
+
+    private:
+        std::vector<T> m_Components;
+        std::unordered_map<Entity, size_t> m_EntityToIndex;
+        std::vector<Entity> m_IndexToEntity;
+    };
+
+    std::vector<Entity> ShuffledEntities(size_t count)
+    {
+        std::vector<Entity> entities(count);
+        std::iota(entities.begin(), entities.end(), Entity(0));
+        std::shuffle(entities.begin(), entities.end(), std::mt19937(1234));
+        return entities;
+    }
+
+    template<typename Storage>
+    void RunStorageBenchmarks(const char* label, size_t count)
+    {
+        const std::vector<Entity> order = ShuffledEntities(count);
+        const std::string prefix = std::string(label) + "/";
+
+        // Add: fresh storage per repetition, entities inserted in shuffled order
+        double addNs = MeasureBestNs([&]() {
+            Storage storage;
+            for (Entity e : order)
+                storage.Add(e).Rotation = 1.0f;
+            DoNotOptimize(storage.Size());
+        });
+        ReportBenchmark((prefix + "Add").c_str(), count, addNs);
+
+        Storage storage;
+        for (Entity e : order)
+            storage.Add(e);
+
+        // Get: sequential entity order against a shuffled dense array, which is
+        // how SpriteRenderSystem probes transforms for each sprite
+        double getNs = MeasureBestNs([&]() {
+            float sum = 0.0f;
+            for (size_t i = 0; i < count; i++)
+                sum += storage.Get(static_cast<Entity>(i))->Scale[0];
+            DoNotOptimize(sum);
+        });
+        ReportBenchmark((prefix + "Get").c_str(), count, getNs);
+
+        // Has: half hits, half misses
+        double hasNs = MeasureBestNs([&]() {
+            size_t hits = 0;
+            for (size_t i = 0; i < count; i++)
+                hits += storage.Has(static_cast<Entity>(i * 2)) ? 1 : 0;
+            DoNotOptimize(hits);
+        });
+        ReportBenchmark((prefix + "Has").c_str(), count, hasNs);
+
+        // Remove: swap-remove every entity, in a different order than it was added
+        double removeNs = MeasureBestNs([&]() {
+            for (size_t i = count; i-- > 0;)
+                storage.Remove(static_cast<Entity>(i));
+            DoNotOptimize(storage.Size());
+
+            // Refill for the next repetition (not part of a real frame, but cheap
+            // relative to the removes and identical for both storages)
+            for (Entity e : order)
+                storage.Add(e);
+        });
+        ReportBenchmark((prefix + "Remove+Refill").c_str(), count, removeNs);
+    }
+
+}
+
+class ComponentStorageBenchmark : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(ComponentStorageBenchmark, PagedSparseIndex)
+{
+    RunStorageBenchmarks<ComponentStorage<BenchTransform>>("ComponentStorage(paged)", GetParam());
+}
+
+TEST_P(ComponentStorageBenchmark, UnorderedMapBaseline)
+{
+    RunStorageBenchmarks<MapIndexedStorage<BenchTransform>>("ComponentStorage(map)", GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(EntityCounts, ComponentStorageBenchmark,
+    ::testing::Values(size_t(10'000), size_t(100'000), size_t(1'000'000)));
@@ -4,6 +4,7 @@
 #include <thread>
 #include <vector>
 #include <algorithm>
+#include <utility>
 
 using namespace GGEngine;
 
@@ -278,6 +279,58 @@ TEST_F(ComponentStorageTest, GetEntity_ReturnsCorrectMapping)
     EXPECT_TRUE(std::find(entities.begin(), entities.end(), 300) != entities.end());
 }
 
+// =============================================================================
+// Sparse Index Tests
+// =============================================================================
+
+TEST_F(ComponentStorageTest, SparseIndex_EntitiesAcrossPages)
+{
+    const Entity far = SparseIndex::PageSize * 3 + 7;
+    storage.Add(1).value = 1;
+    storage.Add(far).value = 2;
+
+    EXPECT_EQ(1, storage.Get(1)->value);
+    EXPECT_EQ(2, storage.Get(far)->value);
+    EXPECT_FALSE(storage.Has(far - 1));
+    EXPECT_FALSE(storage.Has(SparseIndex::PageSize * 2));  // Page never allocated
+}
+
+TEST_F(ComponentStorageTest, SparseIndex_InvalidEntityIsNeverPresent)
+{
+    storage.Add(0);
+    EXPECT_FALSE(storage.Has(InvalidEntity));
+    EXPECT_EQ(nullptr, storage.Get(InvalidEntity));
+}
+
+TEST_F(ComponentStorageTest, SparseIndex_IndexOfTracksSwapRemove)
+{
+    storage.Add(3);
+    storage.Add(4);
+    storage.Add(5);
+
+    storage.Remove(3);  // 5 moves into slot 0
+
+    EXPECT_EQ(0u, storage.IndexOf(5));
+    EXPECT_EQ(1u, storage.IndexOf(4));
+    EXPECT_EQ(SparseIndex::InvalidSlot, storage.IndexOf(3));
+}
+
+TEST(SparseIndexTest, PagesAllocatedOnDemand)
+{
+    SparseIndex index;
+    EXPECT_EQ(0u, index.GetPageCount());
+
+    index.Set(SparseIndex::PageSize * 10, 0);
+    EXPECT_EQ(1u, index.GetPageCount());
+    EXPECT_EQ(0u, index.Find(SparseIndex::PageSize * 10));
+
+    index.Erase(SparseIndex::PageSize * 10);
+    EXPECT_FALSE(index.Contains(SparseIndex::PageSize * 10));
+
+    index.Clear();
+    EXPECT_EQ(0u, index.GetPageCount());
+}
+
 // =============================================================================
 // ReadLock Tests
 // =============================================================================
@@ -439,3 +492,154 @@ TEST_F(ComponentStorageTest, Iteration_WithEntityMapping)
     EXPECT_EQ(200, entityValues[20]);
     EXPECT_EQ(300, entityValues[30]);
 }
+
+// =============================================================================
+// Change Version Tests
+// =============================================================================
+
+TEST_F(ComponentStorageTest, Version_BumpsOnStructuralChangesAndWriteLock)
+{
+    uint64_t version = storage.GetVersion();
+
+    storage.Add(1);
+    EXPECT_GT(storage.GetVersion(), version);
+    version = storage.GetVersion();
+
+    // Reads don't count as changes
+    std::as_const(storage).Get(1);
+    storage.Has(1);
+    { auto lock = storage.LockRead(); }
+    EXPECT_EQ(version, storage.GetVersion());
+
+    { auto lock = storage.LockWrite(); }
+    EXPECT_GT(storage.GetVersion(), version);
+    version = storage.GetVersion();
+
+    storage.Remove(1);
+    EXPECT_GT(storage.GetVersion(), version);
+    version = storage.GetVersion();
+
+    storage.Remove(1);      // Not present: nothing changed
+    EXPECT_EQ(version, storage.GetVersion());
+
+    storage.Clear();
+    EXPECT_GT(storage.GetVersion(), version);
+}
+
+TEST_F(ComponentStorageTest, ChangeTicks_StampAddAndMutableAccess)
+{
+    storage.Add(1);
+    storage.Add(2);
+    const uint32_t since = ChangeTicks::Advance();
+
+    EXPECT_FALSE(storage.IsAddedSince(storage.IndexOf(1), since));
+    EXPECT_FALSE(storage.IsChangedSince(storage.IndexOf(1), since));
+
+    ChangeTicks::Advance();
+    std::as_const(storage).Get(1);
+    EXPECT_FALSE(storage.IsChangedSince(storage.IndexOf(1), since));
+
+    storage.Get(2)->value = 5;
+    storage.Add(3);
+    EXPECT_FALSE(storage.IsChangedSince(storage.IndexOf(1), since));
+    EXPECT_TRUE(storage.IsChangedSince(storage.IndexOf(2), since));
+    EXPECT_FALSE(storage.IsAddedSince(storage.IndexOf(2), since));
+    EXPECT_TRUE(storage.IsAddedSince(storage.IndexOf(3), since));
+    EXPECT_TRUE(storage.IsChangedSince(storage.IndexOf(3), since));
+}
+
+TEST_F(ComponentStorageTest, ChangeTicks_FollowRowsThroughRemoveAndSwap)
+{
+    storage.Add(1);
+    storage.Add(2);
+    storage.Add(3);
+    const uint32_t since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+    storage.MarkChanged(3);
+
+    // 3 moves into 1's slot
+    storage.Remove(1);
+    EXPECT_TRUE(storage.IsChangedSince(storage.IndexOf(3), since));
+    EXPECT_FALSE(storage.IsChangedSince(storage.IndexOf(2), since));
+
+    storage.Swap(0, 1);
+    EXPECT_TRUE(storage.IsChangedSince(storage.IndexOf(3), since));
+    EXPECT_FALSE(storage.IsChangedSince(storage.IndexOf(2), since));
+
+    // Taking data through a WriteLock marks every row
+    {
+        auto lock = storage.LockWrite();
+        lock.Data();
+    }
+    EXPECT_TRUE(storage.IsChangedSince(storage.IndexOf(2), since));
+}
+
+TEST_F(ComponentStorageTest, ChangeTicks_SameRowsFromSeveralThreads)
+{
+    for (Entity e = 0; e < 256; e++)
+        storage.Add(e);
+    const uint32_t since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+
+    // Parallel systems may fetch the same rows mutably
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([this]()
+        {
+            for (int round = 0; round < 100; round++)
+            {
+                for (Entity e = 0; e < 256; e++)
+                    storage.Get(e);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (size_t i = 0; i < storage.Size(); i++)
+        EXPECT_TRUE(storage.IsChangedSince(i, since));
+    for (size_t block = 0; block < storage.GetChangeBlockCount(); block++)
+        EXPECT_TRUE(storage.IsBlockChangedSince(block, since));
+}
+
+TEST_F(ComponentStorageTest, ChangeTicks_BlocksSummarizeTheirRows)
+{
+    using Storage = ComponentStorage<TestComponent>;
+    const Entity count = static_cast<Entity>(Storage::ChangeBlockRows * 3);
+    for (Entity e = 0; e < count; e++)
+        storage.Add(e);
+    ASSERT_EQ(3u, storage.GetChangeBlockCount());
+
+    const uint32_t since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+    EXPECT_FALSE(storage.IsBlockChangedSince(0, since));
+
+    // Only the touched block reports a change
+    storage.MarkChanged(static_cast<Entity>(Storage::ChangeBlockRows + 5));
+    EXPECT_FALSE(storage.IsBlockChangedSince(0, since));
+    EXPECT_TRUE(storage.IsBlockChangedSince(1, since));
+    EXPECT_FALSE(storage.IsBlockChangedSince(2, since));
+
+    // A changed row carries its stamp into the block it is moved to
+    storage.MarkChanged(count - 1);
+    storage.Remove(0);
+    EXPECT_TRUE(storage.IsBlockChangedSince(0, since));
+    EXPECT_TRUE(storage.IsChangedSince(storage.IndexOf(count - 1), since));
+
+    // Blocks follow the row count down and back up
+    for (Entity e = 1; e < Storage::ChangeBlockRows; e++)
+        storage.Remove(e);
+    EXPECT_EQ(2u, storage.GetChangeBlockCount());
+    storage.Add(count);
+    EXPECT_EQ(3u, storage.GetChangeBlockCount());
+    EXPECT_TRUE(storage.IsBlockChangedSince(2, since));
+}
+
+TEST_F(ComponentStorageTest, ChangeTicks_NewerHandlesWraparound)
+{
+    EXPECT_TRUE(ChangeTicks::IsNewer(5, 4));
+    EXPECT_FALSE(ChangeTicks::IsNewer(4, 4));
+    EXPECT_FALSE(ChangeTicks::IsNewer(3, 4));
+    EXPECT_TRUE(ChangeTicks::IsNewer(2, UINT32_MAX - 2));
+}
@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ECS/Scene.h"
+#include "TestConfig.h"
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+using namespace GGEngine;
+
+namespace {
+
+    struct Velocity
+    {
+        float X = 0.0f;
+        float Y = 0.0f;
+    };
+
+}
+
+class GroupTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_Scene = std::make_unique<Scene>("GroupScene");
+    }
+
+    // Every member must sit in [0, Size()) of both storages, at the same slot
+    void ExpectPacked(ComponentGroup<TransformComponent, Velocity>& group)
+    {
+        auto& transforms = m_Scene->GetStorage<TransformComponent>();
+        auto& velocities = m_Scene->GetStorage<Velocity>();
+
+        for (size_t i = 0; i < group.Size(); i++)
+        {
+            EXPECT_EQ(transforms.GetEntity(i), velocities.GetEntity(i));
+            EXPECT_TRUE(velocities.Has(transforms.GetEntity(i)));
+        }
+        for (size_t i = group.Size(); i < velocities.Size(); i++)
+        {
+            EXPECT_FALSE(transforms.Has(velocities.GetEntity(i)));
+        }
+    }
+
+    std::unique_ptr<Scene> m_Scene;
+};
+
+// =============================================================================
+// Packing
+// =============================================================================
+
+TEST_F(GroupTest, PacksExistingEntitiesOnCreation)
+{
+    std::vector<EntityID> movers;
+    for (int i = 0; i < 20; i++)
+    {
+        EntityID e = m_Scene->CreateEntity("Entity");
+        if (i % 2 == 0)
+        {
+            m_Scene->AddComponent<Velocity>(e, Velocity{ static_cast<float>(i), 0.0f });
+            movers.push_back(e);
+        }
+    }
+
+    auto& group = m_Scene->Group<TransformComponent, Velocity>();
+    EXPECT_EQ(movers.size(), group.Size());
+    ExpectPacked(group);
+
+    for (EntityID e : movers)
+        EXPECT_TRUE(group.Contains(e.Index));
+}
+
+TEST_F(GroupTest, AddingLastComponentJoinsGroup)
+{
+    auto& group = m_Scene->Group<TransformComponent, Velocity>();
+
+    m_Scene->CreateEntity("Static");
+    EntityID mover = m_Scene->CreateEntity("Mover");
+    EXPECT_EQ(0u, group.Size());
+
+    Velocity& velocity = m_Scene->AddComponent<Velocity>(mover, Velocity{ 4.0f, 5.0f });
+    EXPECT_FLOAT_EQ(4.0f, velocity.X);
+    EXPECT_EQ(1u, group.Size());
+    EXPECT_TRUE(group.Contains(mover.Index));
+    ExpectPacked(group);
+}
+
+TEST_F(GroupTest, AddReturnsReferenceToMovedComponent)
+{
+    auto& group = m_Scene->Group<TransformComponent, Velocity>();
+
+    // Velocity-only entity occupies slot 0 of the velocity storage
+    m_Scene->GetStorage<Velocity>().Add(1000);
+
+    EntityID mover = m_Scene->CreateEntity("Mover");
+    Velocity& velocity = m_Scene->AddComponent<Velocity>(mover);
+    velocity.X = 7.0f;
+
+    EXPECT_EQ(1u, group.Size());
+    EXPECT_FLOAT_EQ(7.0f, m_Scene->GetComponent<Velocity>(mover)->X);
+    EXPECT_FLOAT_EQ(7.0f, group.Data<Velocity>()[0].X);
+}
+
+TEST_F(GroupTest, RemovingComponentLeavesGroupPacked)
+{
+    auto& group = m_Scene->Group<TransformComponent, Velocity>();
+
+    std::vector<EntityID> movers;
+    for (int i = 0; i < 10; i++)
+    {
+        EntityID e = m_Scene->CreateEntity("Mover");
+        m_Scene->AddComponent<Velocity>(e);
+        movers.push_back(e);
+    }
+    m_Scene->CreateEntity("Static");
+
+    m_Scene->RemoveComponent<Velocity>(movers[3]);
+    m_Scene->DestroyEntity(movers[0]);
+
+    EXPECT_EQ(8u, group.Size());
+    EXPECT_FALSE(group.Contains(movers[3].Index));
+    EXPECT_FALSE(group.Contains(movers[0].Index));
+    ExpectPacked(group);
+}
+
+TEST_F(GroupTest, ClearEmptiesGroup)
+{
+    auto& group = m_Scene->Group<TransformComponent, Velocity>();
+    EntityID e = m_Scene->CreateEntity("Mover");
+    m_Scene->AddComponent<Velocity>(e);
+
+    m_Scene->Clear();
+    EXPECT_EQ(0u, group.Size());
+
+    EntityID again = m_Scene->CreateEntity("Mover");
+    m_Scene->AddComponent<Velocity>(again);
+    EXPECT_EQ(1u, group.Size());
+}
+
+// =============================================================================
+// Iteration
+// =============================================================================
+
+TEST_F(GroupTest, EachWalksParallelArrays)
+{
+    for (int i = 0; i < 10; i++)
+    {
+        EntityID e = m_Scene->CreateEntity("Mover");
+        m_Scene->AddComponent<Velocity>(e, Velocity{ 1.0f, 2.0f });
+    }
+
+    auto& group = m_Scene->Group<TransformComponent, Velocity>();
+    group.Each([](TransformComponent& transform, Velocity& velocity) {
+        transform.Position[0] += velocity.X;
+        transform.Position[1] += velocity.Y;
+    });
+
+    size_t visited = 0;
+    group.Each([&](Entity entity, TransformComponent& transform, Velocity&) {
+        EXPECT_EQ(transform.Position[0], m_Scene->GetStorage<TransformComponent>().Get(entity)->Position[0]);
+        EXPECT_FLOAT_EQ(1.0f, transform.Position[0]);
+        EXPECT_FLOAT_EQ(2.0f, transform.Position[1]);
+        visited++;
+    });
+    EXPECT_EQ(10u, visited);
+}
+
+TEST_F(GroupTest, MutableAccessMarksRowsChanged)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        EntityID e = m_Scene->CreateEntity("Mover");
+        m_Scene->AddComponent<Velocity>(e, Velocity{ 1.0f, 0.0f });
+    }
+    auto& group = m_Scene->Group<TransformComponent, Velocity>();
+
+    auto countChanged = [&](uint32_t since) {
+        int count = 0;
+        m_Scene->View<const TransformComponent>().Filter(Changed<TransformComponent>{ since })
+            .Each([&](const TransformComponent&) { count++; });
+        return count;
+    };
+
+    // Const iteration and reads leave rows unchanged
+    uint32_t since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+    std::as_const(group).Each([](const TransformComponent&, const Velocity&) {});
+    EXPECT_NE(nullptr, std::as_const(group).Data<TransformComponent>());
+    EXPECT_EQ(0, countChanged(since));
+
+    // Writes through a range mark exactly that range
+    group.EachInRange(2, 4, [](TransformComponent& transform, Velocity& velocity) {
+        transform.Position[0] += velocity.X;
+    });
+    EXPECT_EQ(2, countChanged(since));
+
+    since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+    group.Each([](TransformComponent& transform, Velocity&) { transform.Position[1] = 1.0f; });
+    EXPECT_EQ(6, countChanged(since));
+
+    since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+    group.Data<TransformComponent>()[0].Position[0] = 5.0f;
+    EXPECT_EQ(6, countChanged(since));
+}
+
+TEST_F(GroupTest, FindGroupReturnsExistingGroupOnly)
+{
+    EXPECT_EQ(nullptr, (m_Scene->FindGroup<TransformComponent, Velocity>()));
+
+    auto& group = m_Scene->Group<TransformComponent, Velocity>();
+    EXPECT_EQ(&group, (m_Scene->FindGroup<TransformComponent, Velocity>()));
+    EXPECT_EQ(&group, &(m_Scene->Group<TransformComponent, Velocity>()));
+}
+
+TEST_F(GroupTest, ViewStillMatchesGroupedStorages)
+{
+    for (int i = 0; i < 10; i++)
+    {
+        EntityID e = m_Scene->CreateEntity("Entity");
+        if (i % 3 == 0)
+            m_Scene->AddComponent<Velocity>(e);
+    }
+    m_Scene->Group<TransformComponent, Velocity>();
+
+    int count = 0;
+    m_Scene->View<TransformComponent, Velocity>().Each([&](TransformComponent&, Velocity&) { count++; });
+    EXPECT_EQ(4, count);
+}
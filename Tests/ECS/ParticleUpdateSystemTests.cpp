@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ECS/Systems/ParticleUpdateSystem.h"
+#include "GGEngine/ECS/SystemScheduler.h"
+#include "GGEngine/ECS/Scene.h"
+#include "GGEngine/Renderer/InstancedRenderer2D.h"
+#include "GGEngine/Core/TaskGraph.h"
+#include "GGEngine/ParticleSystem/Random.h"
+#include <cstring>
+
+#include <memory>
+#include <vector>
+
+using namespace GGEngine;
+
+namespace {
+
+    // Long-lived particles with no randomness, moving along the cone axis
+    ParticleEmitterComponent MakeEmitter(float rate, uint32_t burstCount = 0, float burstInterval = 1.0f)
+    {
+        ParticleEmitterComponent emitter;
+        emitter.Rate = rate;
+        emitter.BurstCount = burstCount;
+        emitter.BurstInterval = burstInterval;
+        emitter.ConeAngle = 0.0f;
+        emitter.SpeedVariation = 0.0f;
+        emitter.LifeTime = 100.0f;
+        emitter.LifeTimeVariation = 0.0f;
+        emitter.MaxParticles = 100;
+        return emitter;
+    }
+
+    std::vector<QuadInstanceData> Instances(const ParticleEmitterComponent& emitter)
+    {
+        std::vector<QuadInstanceData> out(emitter.Particles.GetActiveCount());
+        emitter.Particles.WriteInstances(out.data(), 0);
+        return out;
+    }
+
+}
+
+class ParticleUpdateSystemTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_Scene = std::make_unique<Scene>("ParticleTest");
+    }
+
+    ParticleEmitterComponent& AddEmitter(const ParticleEmitterComponent& emitter)
+    {
+        EntityID entity = m_Scene->CreateEntity("Emitter");
+        return m_Scene->AddComponent<ParticleEmitterComponent>(entity, emitter);
+    }
+
+    std::unique_ptr<Scene> m_Scene;
+    ParticleUpdateSystem m_System;
+};
+
+// =============================================================================
+// Emission Tests
+// =============================================================================
+
+TEST_F(ParticleUpdateSystemTest, Rate_CarriesFractionalParticles)
+{
+    ParticleEmitterComponent& emitter = AddEmitter(MakeEmitter(10.0f));
+
+    m_System.Execute(*m_Scene, 0.25f);
+    EXPECT_EQ(2u, emitter.Particles.GetActiveCount());
+
+    m_System.Execute(*m_Scene, 0.25f);
+    EXPECT_EQ(5u, emitter.Particles.GetActiveCount());
+
+    emitter.Emitting = false;
+    m_System.Execute(*m_Scene, 1.0f);
+    EXPECT_EQ(5u, emitter.Particles.GetActiveCount());
+}
+
+TEST_F(ParticleUpdateSystemTest, Burst_FiresOnIntervalAndCatchesUp)
+{
+    ParticleEmitterComponent& emitter = AddEmitter(MakeEmitter(0.0f, 5, 1.0f));
+
+    m_System.Execute(*m_Scene, 0.1f);     // First burst is immediate
+    EXPECT_EQ(5u, emitter.Particles.GetActiveCount());
+
+    m_System.Execute(*m_Scene, 0.5f);
+    EXPECT_EQ(5u, emitter.Particles.GetActiveCount());
+
+    m_System.Execute(*m_Scene, 0.5f);
+    EXPECT_EQ(10u, emitter.Particles.GetActiveCount());
+
+    m_System.Execute(*m_Scene, 2.5f);     // Two bursts were due
+    EXPECT_EQ(20u, emitter.Particles.GetActiveCount());
+}
+
+TEST_F(ParticleUpdateSystemTest, Spawn_FollowsTransformAndRotation)
+{
+    EntityID entity = m_Scene->CreateEntity("Emitter");
+    auto* transform = m_Scene->GetComponent<TransformComponent>(entity);
+    transform->Position[0] = 3.0f;
+    transform->Position[1] = 4.0f;
+    transform->Rotation = 90.0f;
+
+    ParticleEmitterComponent settings = MakeEmitter(0.0f, 1, 100.0f);
+    settings.Direction = 0.0f;
+    settings.Speed = 2.0f;
+    auto& emitter = m_Scene->AddComponent<ParticleEmitterComponent>(entity, settings);
+
+    m_System.Execute(*m_Scene, 0.1f);     // Spawned at the emitter
+    m_System.Execute(*m_Scene, 0.5f);     // Moved along +y
+
+    std::vector<QuadInstanceData> instances = Instances(emitter);
+    ASSERT_EQ(1u, instances.size());
+    EXPECT_NEAR(3.0f, instances[0].Position[0], 1e-4f);
+    EXPECT_NEAR(5.0f, instances[0].Position[1], 1e-4f);
+}
+
+TEST_F(ParticleUpdateSystemTest, MaxParticles_ResizesPool)
+{
+    ParticleEmitterComponent& emitter = AddEmitter(MakeEmitter(1000.0f));
+
+    m_System.Execute(*m_Scene, 1.0f);
+    EXPECT_EQ(100u, emitter.Particles.GetMaxParticles());
+    EXPECT_EQ(100u, emitter.Particles.GetActiveCount());
+
+    emitter.MaxParticles = 10;
+    m_System.Execute(*m_Scene, 1.0f);
+    EXPECT_EQ(10u, emitter.Particles.GetMaxParticles());
+    EXPECT_EQ(10u, emitter.Particles.GetActiveCount());
+}
+
+// =============================================================================
+// Scheduling Tests
+// =============================================================================
+
+TEST_F(ParticleUpdateSystemTest, Scheduler_UpdatesEveryEmitterInChunks)
+{
+    if (!TaskGraph::Get().IsInitialized())
+        TaskGraph::Get().Init(2);
+
+    constexpr uint32_t EmitterCount = 2000;
+    for (uint32_t i = 0; i < EmitterCount; i++)
+        AddEmitter(MakeEmitter(0.0f, 3));
+
+    SystemScheduler scheduler;
+    scheduler.RegisterSystem<ParticleUpdateSystem>();
+    scheduler.Execute(*m_Scene, 0.1f);
+
+    const auto& emitters = m_Scene->GetStorage<ParticleEmitterComponent>();
+    ASSERT_EQ(EmitterCount, emitters.Size());
+    for (size_t i = 0; i < emitters.Size(); i++)
+        EXPECT_EQ(3u, emitters.Data()[i].Particles.GetActiveCount());
+}
+
+TEST_F(ParticleUpdateSystemTest, ArchetypeScene_UpdatesEmitters)
+{
+    Scene scene("ArchetypeParticles", SceneStorageMode::Archetype);
+    for (int i = 0; i < 3; i++)
+    {
+        EntityID entity = scene.CreateEntity("Emitter");
+        scene.AddComponent<ParticleEmitterComponent>(entity, MakeEmitter(0.0f, 4));
+    }
+
+    m_System.Execute(scene, 0.1f);
+
+    uint32_t total = 0;
+    scene.Each<const ParticleEmitterComponent>([&](const ParticleEmitterComponent& emitter)
+    {
+        total += emitter.Particles.GetActiveCount();
+    });
+    EXPECT_EQ(12u, total);
+}
+
+TEST_F(ParticleUpdateSystemTest, EmittersWithoutTransform_SpawnAtOriginInBothStorageModes)
+{
+    if (!TaskGraph::Get().IsInitialized())
+        TaskGraph::Get().Init(2);
+
+    for (SceneStorageMode mode : { SceneStorageMode::SparseSet, SceneStorageMode::Archetype })
+    {
+        Scene scene("DetachedParticles", mode);
+        EntityID placed = scene.CreateEntity("Placed");
+        scene.GetComponent<TransformComponent>(placed)->Position[0] = 5.0f;
+        scene.AddComponent<ParticleEmitterComponent>(placed, MakeEmitter(0.0f, 1));
+
+        EntityID detached = scene.CreateEntity("Detached");
+        scene.RemoveComponent<TransformComponent>(detached);
+        scene.AddComponent<ParticleEmitterComponent>(detached, MakeEmitter(0.0f, 1));
+
+        m_System.Execute(scene, 0.1f);
+
+        const auto placedInstances = Instances(*scene.GetComponent<ParticleEmitterComponent>(placed));
+        const auto detachedInstances = Instances(*scene.GetComponent<ParticleEmitterComponent>(detached));
+        ASSERT_EQ(1u, placedInstances.size());
+        ASSERT_EQ(1u, detachedInstances.size());
+        EXPECT_FLOAT_EQ(5.0f, placedInstances[0].Position[0]);
+        EXPECT_FLOAT_EQ(0.0f, detachedInstances[0].Position[0]);
+        EXPECT_FLOAT_EQ(0.0f, detachedInstances[0].Position[1]);
+    }
+}
+
+TEST_F(ParticleUpdateSystemTest, FixedSeed_ReplaysRegardlessOfPoolCreationOrder)
+{
+    if (!TaskGraph::Get().IsInitialized())
+        TaskGraph::Get().Init(2);
+
+    // Pools are created on workers in no particular order; their particles
+    // must only depend on the seed and the entity
+    auto run = [](uint32_t unrelatedStreams)
+    {
+        Random::Init(42);
+        for (uint32_t i = 0; i < unrelatedStreams; i++)
+            Random::NextStreamSeed();
+
+        Scene scene("Replay");
+        for (int i = 0; i < 500; i++)
+        {
+            ParticleEmitterComponent emitter = MakeEmitter(0.0f, 4);
+            emitter.ConeAngle = 90.0f;
+            emitter.SpeedVariation = 1.0f;
+            scene.AddComponent<ParticleEmitterComponent>(scene.CreateEntity("Emitter"), emitter);
+        }
+
+        SystemScheduler scheduler;
+        scheduler.RegisterSystem<ParticleUpdateSystem>();
+        scheduler.Execute(scene, 0.1f);
+        scheduler.Execute(scene, 0.1f);
+
+        std::vector<std::vector<QuadInstanceData>> out;
+        scene.Each<const ParticleEmitterComponent>([&](Entity entity, const ParticleEmitterComponent& emitter)
+        {
+            if (out.size() <= entity)
+                out.resize(entity + 1);
+            out[entity] = Instances(emitter);
+        });
+        return out;
+    };
+
+    const auto first = run(0);
+    const auto second = run(7);
+    ASSERT_EQ(first.size(), second.size());
+    for (size_t i = 0; i < first.size(); i++)
+    {
+        ASSERT_EQ(first[i].size(), second[i].size());
+        EXPECT_EQ(0, std::memcmp(first[i].data(), second[i].data(), first[i].size() * sizeof(QuadInstanceData)));
+    }
+}
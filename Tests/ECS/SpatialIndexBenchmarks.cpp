@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ECS/SpatialIndex.h"
+#include "GGEngine/ECS/Scene.h"
+#include "BenchmarkConfig.h"
+#include <utility>
+#include <vector>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+namespace {
+
+    constexpr size_t EntityCount = 1000000;
+    constexpr size_t MovingPerFrame = EntityCount / 100;
+    constexpr float WorldSize = 4000.0f;
+
+    // Deterministic xorshift so runs are comparable
+    struct BenchRandom
+    {
+        uint32_t State = 2463534242u;
+
+        float Next()
+        {
+            State ^= State << 13;
+            State ^= State >> 17;
+            State ^= State << 5;
+            return static_cast<float>(State >> 8) / static_cast<float>(1 << 24);
+        }
+    };
+
+}
+
+// =============================================================================
+// Spatial index upkeep and queries, 1M entities with 1% moving per frame
+// =============================================================================
+// Compares Scene::UpdateSpatialIndex, which only re-indexes rows whose change
+// tick moved, with rebuilding the index from every transform, and measures a
+// screen-sized AABB query against a linear bounds test over all entities.
+
+class SpatialIndexBenchmark : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        for (size_t i = 0; i < EntityCount; i++)
+        {
+            EntityID entity = m_Scene.CreateEntity();
+            auto* transform = m_Scene.GetComponent<TransformComponent>(entity);
+            transform->Position[0] = m_Random.Next() * WorldSize;
+            transform->Position[1] = m_Random.Next() * WorldSize;
+        }
+        m_Scene.UpdateSpatialIndex();
+    }
+
+    // Nudge a different 1% of the transforms, stamping their rows like a system would
+    void MoveSome()
+    {
+        auto& storage = m_Scene.GetStorage<TransformComponent>();
+        for (size_t i = 0; i < MovingPerFrame; i++)
+        {
+            const Entity entity = storage.GetEntity((m_MoveCursor + i * 97) % storage.Size());
+            TransformComponent* transform = storage.Get(entity);
+            transform->Position[0] += m_Random.Next() * 2.0f - 1.0f;
+            transform->Position[1] += m_Random.Next() * 2.0f - 1.0f;
+        }
+        m_MoveCursor += MovingPerFrame;
+    }
+
+    Scene m_Scene{ "Bench" };
+    BenchRandom m_Random;
+    size_t m_MoveCursor = 0;
+};
+
+TEST_F(SpatialIndexBenchmark, UpdateOnePercentMoving)
+{
+    const size_t frames = 20;
+
+    ReportBenchmark("UpdateSpatialIndex 1M, 1% moving", frames, MeasureBestNs([&]() {
+        for (size_t f = 0; f < frames; f++)
+        {
+            MoveSome();
+            m_Scene.UpdateSpatialIndex();
+        }
+    }, 3));
+
+    // Reference: what a full rebuild from every transform costs per frame
+    const auto& storage = std::as_const(m_Scene).GetStorage<TransformComponent>();
+    SpatialIndex rebuilt;
+    ReportBenchmark("Full rebuild 1M", 1, MeasureBestNs([&]() {
+        rebuilt.Clear();
+        for (size_t i = 0; i < storage.Size(); i++)
+        {
+            const TransformComponent& t = storage.Data()[i];
+            rebuilt.Update(storage.GetEntity(i), Bounds2D::FromQuad(t.Position[0], t.Position[1],
+                                                                    t.Scale[0], t.Scale[1], 0.0f));
+        }
+    }, 3));
+
+    EXPECT_EQ(EntityCount, m_Scene.GetSpatialIndex().Size());
+    EXPECT_EQ(EntityCount, rebuilt.Size());
+}
+
+TEST_F(SpatialIndexBenchmark, QueryScreenArea)
+{
+    const SpatialIndex& index = m_Scene.GetSpatialIndex();
+    const auto& storage = std::as_const(m_Scene).GetStorage<TransformComponent>();
+    const Bounds2D screen{ 1000.0f, 1000.0f, 1064.0f, 1036.0f };
+    const size_t queries = 100;
+
+    std::vector<Entity> hits;
+    ReportBenchmark("QueryAABB 64x36 of 4000x4000", queries, MeasureBestNs([&]() {
+        for (size_t q = 0; q < queries; q++)
+        {
+            hits.clear();
+            index.QueryAABB(screen, hits);
+        }
+        DoNotOptimize(hits.size());
+    }));
+
+    size_t linearHits = 0;
+    ReportBenchmark("Linear bounds test (reference)", 1, MeasureBestNs([&]() {
+        linearHits = 0;
+        for (size_t i = 0; i < storage.Size(); i++)
+        {
+            const TransformComponent& t = storage.Data()[i];
+            if (Bounds2D::FromQuad(t.Position[0], t.Position[1], t.Scale[0], t.Scale[1], 0.0f).Overlaps(screen))
+                linearHits++;
+        }
+        DoNotOptimize(linearHits);
+    }));
+
+    EXPECT_EQ(linearHits, hits.size());
+}
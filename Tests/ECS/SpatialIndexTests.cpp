@@ -0,0 +1,325 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ECS/SpatialIndex.h"
+#include "GGEngine/ECS/Scene.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using namespace GGEngine;
+
+namespace {
+
+    Bounds2D UnitBox(float x, float y)
+    {
+        return Bounds2D::FromQuad(x, y, 1.0f, 1.0f, 0.0f);
+    }
+
+    std::vector<Entity> Sorted(std::vector<Entity> entities)
+    {
+        std::sort(entities.begin(), entities.end());
+        return entities;
+    }
+
+}
+
+class SpatialIndexTest : public ::testing::Test
+{
+protected:
+    SpatialIndex index{ 4.0f };
+
+    std::vector<Entity> QueryAABB(const Bounds2D& area)
+    {
+        std::vector<Entity> result;
+        index.QueryAABB(area, result);
+        return Sorted(result);
+    }
+};
+
+// =============================================================================
+// Updates
+// =============================================================================
+
+TEST_F(SpatialIndexTest, Update_InsertsAndMoves)
+{
+    index.Update(3, UnitBox(0.0f, 0.0f));
+    index.Update(9, UnitBox(10.0f, 0.0f));
+    EXPECT_EQ(2u, index.Size());
+    EXPECT_TRUE(index.Contains(3));
+    EXPECT_FALSE(index.Contains(4));
+
+    // Within its cell, then across several
+    index.Update(3, UnitBox(1.0f, 1.0f));
+    index.Update(9, UnitBox(-50.0f, 30.0f));
+    EXPECT_EQ(2u, index.Size());
+    EXPECT_FLOAT_EQ(-50.5f, index.GetBounds(9).MinX);
+
+    EXPECT_EQ(std::vector<Entity>{ 3 }, QueryAABB({ -1.0f, -1.0f, 2.0f, 2.0f }));
+    EXPECT_EQ(std::vector<Entity>{ 9 }, QueryAABB({ -51.0f, 29.0f, -49.0f, 31.0f }));
+    EXPECT_TRUE(QueryAABB({ 9.0f, -1.0f, 11.0f, 1.0f }).empty());
+}
+
+TEST_F(SpatialIndexTest, Remove_KeepsOtherEntities)
+{
+    for (Entity e = 0; e < 5; e++)
+        index.Update(e, UnitBox(0.5f, 0.5f));
+
+    EXPECT_TRUE(index.Remove(1));
+    EXPECT_FALSE(index.Remove(1));
+    EXPECT_FALSE(index.Remove(100));
+
+    EXPECT_EQ(4u, index.Size());
+    EXPECT_EQ((std::vector<Entity>{ 0, 2, 3, 4 }), QueryAABB({ 0.0f, 0.0f, 1.0f, 1.0f }));
+
+    index.Clear();
+    EXPECT_EQ(0u, index.Size());
+    EXPECT_TRUE(QueryAABB(Bounds2D::Infinite()).empty());
+}
+
+TEST_F(SpatialIndexTest, RemoveUnless_DropsRejectedEntities)
+{
+    for (Entity e = 0; e < 10; e++)
+        index.Update(e, UnitBox(static_cast<float>(e) * 3.0f, 0.0f));
+
+    index.RemoveUnless([](Entity e) { return e % 3 == 0; });
+
+    EXPECT_EQ((std::vector<Entity>{ 0, 3, 6, 9 }), QueryAABB(Bounds2D::Infinite()));
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+TEST_F(SpatialIndexTest, QueryAABB_FindsEntitiesReachingIntoNeighbourCells)
+{
+    // Centered in one cell but overlapping the next: must still be found from there
+    index.Update(1, Bounds2D::FromQuad(3.9f, 0.0f, 7.0f, 1.0f, 0.0f));
+
+    EXPECT_EQ(std::vector<Entity>{ 1 }, QueryAABB({ 7.0f, -0.1f, 7.1f, 0.1f }));
+    EXPECT_EQ(std::vector<Entity>{ 1 }, QueryAABB({ 0.5f, -0.1f, 0.6f, 0.1f }));
+    EXPECT_TRUE(QueryAABB({ 7.5f, -0.1f, 8.0f, 0.1f }).empty());
+}
+
+TEST_F(SpatialIndexTest, QueryAABB_OversizedEntitiesAlwaysConsidered)
+{
+    // Far larger than a cell
+    index.Update(1, Bounds2D::FromQuad(0.0f, 0.0f, 1000.0f, 2.0f, 0.0f));
+    index.Update(2, UnitBox(0.0f, 100.0f));
+
+    EXPECT_EQ(std::vector<Entity>{ 1 }, QueryAABB({ 480.0f, -0.5f, 481.0f, 0.5f }));
+    EXPECT_EQ((std::vector<Entity>{ 1, 2 }), QueryAABB({ -10.0f, -10.0f, 10.0f, 110.0f }));
+
+    // Shrinking moves it into the grid
+    index.Update(1, UnitBox(0.0f, 0.0f));
+    EXPECT_TRUE(QueryAABB({ 480.0f, -0.5f, 481.0f, 0.5f }).empty());
+    EXPECT_EQ(std::vector<Entity>{ 1 }, QueryAABB({ -0.1f, -0.1f, 0.1f, 0.1f }));
+}
+
+TEST_F(SpatialIndexTest, QueryAABB_HugeAndInvalidAreas)
+{
+    for (Entity e = 0; e < 100; e++)
+        index.Update(e, UnitBox(static_cast<float>(e % 10) * 50.0f - 250.0f, static_cast<float>(e / 10) * 50.0f));
+
+    EXPECT_EQ(100u, QueryAABB(Bounds2D::Infinite()).size());
+    EXPECT_EQ(100u, QueryAABB({ -1e30f, -1e30f, 1e30f, 1e30f }).size());
+    EXPECT_TRUE(QueryAABB({ 1e30f, 1e30f, 2e30f, 2e30f }).empty());
+    EXPECT_TRUE(QueryAABB({ 1.0f, 1.0f, 0.0f, 0.0f }).empty());
+}
+
+TEST_F(SpatialIndexTest, QueryAABB_MatchesBruteForce)
+{
+    std::vector<Bounds2D> bounds;
+    uint32_t seed = 12345;
+    auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / static_cast<float>(1 << 24);
+    };
+
+    for (Entity e = 0; e < 2000; e++)
+    {
+        bounds.push_back(Bounds2D::FromQuad(next() * 200.0f - 100.0f, next() * 200.0f - 100.0f,
+                                            next() * 10.0f, next() * 10.0f, next() * 6.0f));
+        index.Update(e, bounds.back());
+    }
+
+    for (int q = 0; q < 50; q++)
+    {
+        const float x = next() * 200.0f - 100.0f;
+        const float y = next() * 200.0f - 100.0f;
+        const Bounds2D area{ x, y, x + next() * 40.0f, y + next() * 40.0f };
+
+        std::vector<Entity> expected;
+        for (Entity e = 0; e < bounds.size(); e++)
+        {
+            if (bounds[e].Overlaps(area))
+                expected.push_back(e);
+        }
+        EXPECT_EQ(expected, QueryAABB(area)) << "query " << q;
+    }
+}
+
+TEST_F(SpatialIndexTest, QueryPoint_ReturnsContainingBounds)
+{
+    index.Update(1, Bounds2D{ 0.0f, 0.0f, 2.0f, 2.0f });
+    index.Update(2, Bounds2D{ 1.0f, 1.0f, 3.0f, 3.0f });
+
+    std::vector<Entity> hits;
+    index.QueryPoint(1.5f, 1.5f, hits);
+    EXPECT_EQ((std::vector<Entity>{ 1, 2 }), Sorted(hits));
+
+    hits.clear();
+    index.QueryPoint(2.5f, 0.5f, hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+TEST_F(SpatialIndexTest, QueryRadius_UsesDistanceToBounds)
+{
+    index.Update(1, UnitBox(3.0f, 0.0f));   // Nearest edge 2.5 away
+    index.Update(2, UnitBox(3.0f, 3.0f));   // Nearest corner (2.5, 2.5), ~3.54 away
+
+    std::vector<Entity> hits;
+    index.QueryRadius(0.0f, 0.0f, 3.0f, hits);
+    EXPECT_EQ(std::vector<Entity>{ 1 }, hits);
+
+    hits.clear();
+    index.QueryRadius(0.0f, 0.0f, 3.6f, hits);
+    EXPECT_EQ((std::vector<Entity>{ 1, 2 }), Sorted(hits));
+}
+
+// =============================================================================
+// Scene Integration
+// =============================================================================
+
+class SceneSpatialIndexTest : public ::testing::Test
+{
+protected:
+    Scene scene{ "SpatialScene" };
+
+    // What systems would see after this frame's Scene::OnUpdate
+    std::vector<Entity> QueryPoint(float x, float y)
+    {
+        scene.OnUpdate(0.0f);
+        std::vector<Entity> hits;
+        scene.GetSpatialIndex().QueryPoint(x, y, hits);
+        return Sorted(hits);
+    }
+
+    EntityID CreateAt(float x, float y)
+    {
+        EntityID entity = scene.CreateEntity();
+        auto* transform = scene.GetComponent<TransformComponent>(entity);
+        transform->Position[0] = x;
+        transform->Position[1] = y;
+        return entity;
+    }
+};
+
+TEST_F(SceneSpatialIndexTest, TracksTransforms)
+{
+    EntityID a = CreateAt(0.0f, 0.0f);
+    EntityID b = CreateAt(10.0f, 0.0f);
+
+    EXPECT_EQ(std::vector<Entity>{ a.Index }, QueryPoint(0.2f, 0.2f));
+    EXPECT_EQ(2u, scene.GetSpatialIndex().Size());
+    EXPECT_EQ(std::vector<Entity>{ b.Index }, QueryPoint(10.0f, 0.0f));
+
+    // Moving, scaling and rotating through GetComponent is picked up
+    auto* transform = scene.GetComponent<TransformComponent>(a);
+    transform->Position[0] = 20.0f;
+    transform->Scale[0] = 4.0f;
+    transform->Rotation = 90.0f;
+
+    EXPECT_TRUE(QueryPoint(0.0f, 0.0f).empty());
+    EXPECT_EQ(std::vector<Entity>{ a.Index }, QueryPoint(20.0f, 1.8f));
+    EXPECT_TRUE(QueryPoint(21.8f, 0.0f).empty());
+}
+
+TEST_F(SceneSpatialIndexTest, ReadOnlyAccessDoesNotReindex)
+{
+    EntityID a = CreateAt(0.0f, 0.0f);
+    scene.UpdateSpatialIndex();
+
+    // A write through a raw pointer without stamping the row isn't seen...
+    scene.GetStorage<TransformComponent>().Data()[0].Position[0] = 50.0f;
+    EXPECT_EQ(std::vector<Entity>{ a.Index }, QueryPoint(0.0f, 0.0f));
+
+    // ...until the row is marked
+    scene.GetStorage<TransformComponent>().MarkChanged(a.Index);
+    EXPECT_TRUE(QueryPoint(0.0f, 0.0f).empty());
+    EXPECT_EQ(std::vector<Entity>{ a.Index }, QueryPoint(50.0f, 0.0f));
+}
+
+TEST_F(SceneSpatialIndexTest, FollowsRemovals)
+{
+    EntityID a = CreateAt(0.0f, 0.0f);
+    EntityID b = CreateAt(0.0f, 0.0f);
+    EntityID c = CreateAt(0.0f, 0.0f);
+    scene.UpdateSpatialIndex();
+
+    scene.DestroyEntity(a);
+    scene.RemoveComponent<TransformComponent>(b);
+    EXPECT_EQ(std::vector<Entity>{ c.Index }, QueryPoint(0.0f, 0.0f));
+
+    // Removed on the storage directly
+    scene.GetStorage<TransformComponent>().Remove(c.Index);
+    EXPECT_TRUE(QueryPoint(0.0f, 0.0f).empty());
+
+    // A recycled index starts fresh
+    EntityID d = CreateAt(5.0f, 5.0f);
+    EXPECT_EQ(a.Index, d.Index);
+    EXPECT_EQ(std::vector<Entity>{ d.Index }, QueryPoint(5.0f, 5.0f));
+
+    scene.Clear();
+    scene.UpdateSpatialIndex();
+    EXPECT_EQ(0u, scene.GetSpatialIndex().Size());
+}
+
+TEST_F(SceneSpatialIndexTest, ReadingDoesNotUpdate)
+{
+    EntityID a = CreateAt(0.0f, 0.0f);
+    EXPECT_FALSE(scene.IsSpatialIndexCurrent());
+    scene.OnUpdate(0.0f);
+    EXPECT_TRUE(scene.IsSpatialIndexCurrent());
+
+    // Systems read the index as of the last OnUpdate; only that moves the tick
+    scene.GetComponent<TransformComponent>(a)->Position[0] = 30.0f;
+    EXPECT_FALSE(scene.IsSpatialIndexCurrent());
+    const uint32_t tick = ChangeTicks::Current();
+    std::vector<Entity> hits;
+    std::as_const(scene).GetSpatialIndex().QueryPoint(0.0f, 0.0f, hits);
+    EXPECT_EQ(std::vector<Entity>{ a.Index }, hits);
+    EXPECT_EQ(tick, ChangeTicks::Current());
+
+    EXPECT_EQ(std::vector<Entity>{ a.Index }, QueryPoint(30.0f, 0.0f));
+    EXPECT_TRUE(scene.IsSpatialIndexCurrent());
+}
+
+TEST_F(SceneSpatialIndexTest, ArchetypeScene)
+{
+    Scene archetypeScene("Archetypes", SceneStorageMode::Archetype);
+    EntityID a = archetypeScene.CreateEntity();
+    archetypeScene.GetComponent<TransformComponent>(a)->Position[1] = 7.0f;
+
+    std::vector<Entity> hits;
+    archetypeScene.UpdateSpatialIndex();
+    archetypeScene.GetSpatialIndex().QueryPoint(0.0f, 7.0f, hits);
+    EXPECT_EQ(std::vector<Entity>{ a.Index }, hits);
+
+    // Later passes only re-index chunks whose transforms were written
+    EntityID b = archetypeScene.CreateEntity();
+    archetypeScene.GetComponent<TransformComponent>(b)->Position[0] = 3.0f;
+    hits.clear();
+    archetypeScene.UpdateSpatialIndex();
+    archetypeScene.GetSpatialIndex().QueryPoint(3.0f, 0.0f, hits);
+    EXPECT_EQ(std::vector<Entity>{ b.Index }, hits);
+
+    archetypeScene.Each<TransformComponent>([](TransformComponent& transform) { transform.Position[1] += 10.0f; });
+    hits.clear();
+    archetypeScene.UpdateSpatialIndex();
+    archetypeScene.GetSpatialIndex().QueryPoint(3.0f, 10.0f, hits);
+    EXPECT_EQ(std::vector<Entity>{ b.Index }, hits);
+
+    archetypeScene.RemoveComponent<TransformComponent>(a);
+    archetypeScene.UpdateSpatialIndex();
+    EXPECT_EQ(1u, archetypeScene.GetSpatialIndex().Size());
+}
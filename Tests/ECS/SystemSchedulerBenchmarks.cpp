@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ECS/SystemScheduler.h"
+#include "GGEngine/ECS/Scene.h"
+#include "GGEngine/Core/TaskGraph.h"
+#include "GGEngine/Core/Profiler.h"
+#include "BenchmarkConfig.h"
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <utility>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+namespace {
+
+    // Stand-ins for component types; only their type_index matters to the scheduler
+    template<size_t N>
+    struct BenchSlot {};
+
+    std::atomic<uint32_t> s_Executed{0};
+
+    // System N writes slot N % 16 and reads slot (N * 7 + 3) % 16, which gives
+    // a mix of chains and independent branches like a real frame
+    template<size_t N>
+    class BenchSystem : public ISystem
+    {
+    public:
+        std::vector<ComponentRequirement> GetRequirements() const override
+        {
+            return {
+                Require<BenchSlot<N % 16>>(AccessMode::Write),
+                Require<BenchSlot<(N * 7 + 3) % 16>>(AccessMode::Read)
+            };
+        }
+
+        void Execute(Scene&, float) override
+        {
+            s_Executed.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        const char* GetName() const override { return "BenchSystem"; }
+    };
+
+    struct BenchPosition { float X = 0.0f, Y = 0.0f; };
+    struct BenchVelocity { float X = 1.0f, Y = 0.5f; };
+
+    // Integrates positions; Chunked selects ExecuteChunk or one Execute call
+    template<bool Chunked>
+    class BenchMovementSystem : public ISystem
+    {
+    public:
+        std::vector<ComponentRequirement> GetRequirements() const override
+        {
+            return { Require<BenchPosition>(AccessMode::Write), Require<BenchVelocity>(AccessMode::Read) };
+        }
+
+        void Execute(Scene& scene, float deltaTime) override
+        {
+            Integrate(scene, deltaTime, 0, scene.GetStorage<BenchPosition>().Size());
+        }
+
+        bool SupportsParallelChunks() const override { return Chunked; }
+
+        void ExecuteChunk(Scene& scene, float deltaTime, size_t startIndex, size_t count) override
+        {
+            Integrate(scene, deltaTime, startIndex, count);
+        }
+
+        const char* GetName() const override { return "BenchMovementSystem"; }
+
+    private:
+        // Every entity has both components, added in the same order
+        static void Integrate(Scene& scene, float deltaTime, size_t start, size_t count)
+        {
+            BenchPosition* positions = scene.GetStorage<BenchPosition>().Data();
+            const BenchVelocity* velocities = scene.GetStorage<BenchVelocity>().Data();
+            for (size_t i = start; i < start + count; i++)
+            {
+                positions[i].X += velocities[i].X * deltaTime;
+                positions[i].Y += velocities[i].Y * deltaTime;
+            }
+        }
+    };
+
+    template<size_t... I>
+    void RegisterBenchSystems(SystemScheduler& scheduler, std::index_sequence<I...>)
+    {
+        (scheduler.RegisterSystem<BenchSystem<I>>(), ...);
+    }
+
+}
+
+// =============================================================================
+// Per-frame scheduling overhead
+// =============================================================================
+// Systems do no work, so this measures what SystemScheduler::Execute costs per
+// frame: re-arming the plan, dispatching and joining. The plan is compiled on
+// the first frame; later frames should not touch the heap.
+
+class SystemSchedulerBenchmark : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!TaskGraph::Get().IsInitialized())
+            TaskGraph::Get().Init();
+    }
+
+    // Returns allocations per frame after warm-up; reports frame time
+    template<size_t SystemCount>
+    double Measure(const char* name)
+    {
+        SystemScheduler scheduler;
+        RegisterBenchSystems(scheduler, std::make_index_sequence<SystemCount>{});
+        Scene scene("Bench");
+
+        const size_t frames = 1000;
+        auto runFrames = [&]() {
+            for (size_t f = 0; f < frames; f++)
+            {
+                Profiler::BeginFrame();
+                scheduler.Execute(scene, 1.0f / 60.0f);
+            }
+        };
+
+        // Warm up: compiles the plan and grows task slots and queues
+        s_Executed = 0;
+        runFrames();
+        EXPECT_EQ(SystemCount * frames, s_Executed.load());
+
+        const size_t before = GetAllocationCount();
+        runFrames();
+        const double perFrame = static_cast<double>(GetAllocationCount() - before) / static_cast<double>(frames);
+
+        ReportBenchmark(name, frames, MeasureBestNs(runFrames));
+        std::printf("[ BENCH    ] %-48s %.3f allocations/frame\n", name, perFrame);
+        return perFrame;
+    }
+};
+
+TEST_F(SystemSchedulerBenchmark, Execute)
+{
+    EXPECT_EQ(0.0, Measure<16>("Execute(16 systems)"));
+    EXPECT_EQ(0.0, Measure<128>("Execute(128 systems)"));
+}
+
+// =============================================================================
+// Chunked system execution
+// =============================================================================
+// One movement-style system over 1M entities, run as a single Execute call
+// versus fanned out with ExecuteChunk. Scales with the worker count.
+
+TEST_F(SystemSchedulerBenchmark, ExecuteChunked)
+{
+    const size_t entities = 1000000;
+    Scene scene("Bench");
+    for (size_t i = 0; i < entities; i++)
+    {
+        EntityID entity = scene.CreateEntity();
+        scene.AddComponent<BenchPosition>(entity);
+        scene.AddComponent<BenchVelocity>(entity);
+    }
+
+    auto measure = [&](SystemScheduler& scheduler, const char* name) {
+        const size_t frames = 20;
+        auto runFrames = [&]() {
+            for (size_t f = 0; f < frames; f++)
+            {
+                Profiler::BeginFrame();
+                scheduler.Execute(scene, 1.0f / 60.0f);
+            }
+        };
+        runFrames();        // Warm up and settle the chunk size
+        ReportBenchmark(name, frames * entities, MeasureBestNs(runFrames));
+    };
+
+    SystemScheduler single;
+    single.RegisterSystem<BenchMovementSystem<false>>();
+    measure(single, "Movement 1M (Execute)");
+
+    SystemScheduler chunked;
+    chunked.RegisterSystem<BenchMovementSystem<true>>();
+    measure(chunked, "Movement 1M (ExecuteChunk)");
+
+    EXPECT_GT(scene.GetStorage<BenchPosition>().Data()[entities - 1].X, 0.0f);
+}
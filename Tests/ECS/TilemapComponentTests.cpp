@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ECS/Components/TilemapComponent.h"
+
+using namespace GGEngine;
+
+class TilemapComponentTest : public ::testing::Test {
+protected:
+    TilemapComponent tilemap;
+
+    void SetUp() override
+    {
+        tilemap.Width = 70;
+        tilemap.Height = 40;
+        tilemap.ResizeTiles();
+    }
+};
+
+// =============================================================================
+// Tile Access Tests
+// =============================================================================
+
+TEST_F(TilemapComponentTest, ResizeTiles_FillsWithEmpty)
+{
+    EXPECT_EQ(70u * 40u, tilemap.Tiles.size());
+    EXPECT_EQ(-1, tilemap.GetTile(69, 39));
+}
+
+TEST_F(TilemapComponentTest, SetTile_OutOfBoundsIgnored)
+{
+    tilemap.SetTile(70, 0, 5);
+    tilemap.SetTile(0, 40, 5);
+
+    EXPECT_EQ(-1, tilemap.GetTile(70, 0));
+    for (int32_t tile : tilemap.Tiles)
+        EXPECT_EQ(-1, tile);
+}
+
+// =============================================================================
+// Chunk Version Tests
+// =============================================================================
+
+TEST_F(TilemapComponentTest, Chunks_CoverPartialEdges)
+{
+    EXPECT_EQ(3u, tilemap.GetChunksX());
+    EXPECT_EQ(2u, tilemap.GetChunksY());
+}
+
+TEST_F(TilemapComponentTest, SetTile_BumpsOnlyItsChunk)
+{
+    const uint32_t before = tilemap.GetChunkVersion(2, 1);
+    const uint32_t other = tilemap.GetChunkVersion(0, 0);
+
+    tilemap.SetTile(69, 39, 3);
+
+    EXPECT_NE(before, tilemap.GetChunkVersion(2, 1));
+    EXPECT_EQ(other, tilemap.GetChunkVersion(0, 0));
+    EXPECT_EQ(other, tilemap.GetChunkVersion(1, 1));
+}
+
+TEST_F(TilemapComponentTest, MarkTilesChanged_BumpsEveryChunk)
+{
+    tilemap.Tiles[0] = 7;  // Direct write bypasses SetTile
+    const uint32_t first = tilemap.GetChunkVersion(0, 0);
+    const uint32_t last = tilemap.GetChunkVersion(2, 1);
+
+    tilemap.MarkTilesChanged();
+
+    EXPECT_NE(first, tilemap.GetChunkVersion(0, 0));
+    EXPECT_NE(last, tilemap.GetChunkVersion(2, 1));
+}
+
+TEST_F(TilemapComponentTest, Resize_InvalidatesChunks)
+{
+    const uint32_t before = tilemap.GetChunkVersion(0, 0);
+
+    tilemap.Width = 100;
+    tilemap.ResizeTiles();
+
+    EXPECT_EQ(4u, tilemap.GetChunksX());
+    EXPECT_NE(before, tilemap.GetChunkVersion(0, 0));
+    EXPECT_EQ(4u * 2u, tilemap.ChunkVersions.size());
+}
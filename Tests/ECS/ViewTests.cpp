@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ECS/Scene.h"
+#include "TestConfig.h"
+
+#include <vector>
+#include <algorithm>
+
+using namespace GGEngine;
+
+namespace {
+
+    struct Velocity
+    {
+        float X = 0.0f;
+        float Y = 0.0f;
+    };
+
+    struct Frozen {};
+
+}
+
+class ViewTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_Scene = std::make_unique<Scene>("ViewScene");
+    }
+
+    std::unique_ptr<Scene> m_Scene;
+};
+
+// =============================================================================
+// Matching
+// =============================================================================
+
+TEST_F(ViewTest, YieldsOnlyEntitiesWithAllComponents)
+{
+    EntityID a = m_Scene->CreateEntity("A");
+    EntityID b = m_Scene->CreateEntity("B");
+    EntityID c = m_Scene->CreateEntity("C");
+    m_Scene->AddComponent<Velocity>(a);
+    m_Scene->AddComponent<Velocity>(c);
+
+    std::vector<Entity> visited;
+    for (auto [entity, transform, velocity] : m_Scene->View<TransformComponent, Velocity>())
+    {
+        (void)transform; (void)velocity;
+        visited.push_back(entity);
+    }
+
+    std::sort(visited.begin(), visited.end());
+    ASSERT_EQ(2u, visited.size());
+    EXPECT_EQ(a.Index, visited[0]);
+    EXPECT_EQ(c.Index, visited[1]);
+    (void)b;
+}
+
+TEST_F(ViewTest, ExcludeSkipsEntitiesWithExcludedComponent)
+{
+    EntityID a = m_Scene->CreateEntity("A");
+    EntityID b = m_Scene->CreateEntity("B");
+    m_Scene->AddComponent<Velocity>(a);
+    m_Scene->AddComponent<Velocity>(b);
+    m_Scene->AddComponent<Frozen>(b);
+
+    std::vector<Entity> visited;
+    m_Scene->View<Velocity>(Exclude<Frozen>{}).Each([&](Entity entity, Velocity&) {
+        visited.push_back(entity);
+    });
+
+    ASSERT_EQ(1u, visited.size());
+    EXPECT_EQ(a.Index, visited[0]);
+}
+
+TEST_F(ViewTest, EmptyStorageYieldsNothing)
+{
+    m_Scene->CreateEntity("A");
+
+    int count = 0;
+    for (auto row : m_Scene->View<TransformComponent, Velocity>())
+    {
+        (void)row;
+        count++;
+    }
+    EXPECT_EQ(0, count);
+}
+
+// =============================================================================
+// Driver Selection and Access
+// =============================================================================
+
+TEST_F(ViewTest, SmallestStorageDrivesIteration)
+{
+    for (int i = 0; i < 100; i++)
+        m_Scene->CreateEntity("Entity");
+
+    EntityID mover = m_Scene->CreateEntity("Mover");
+    m_Scene->AddComponent<Velocity>(mover);
+
+    auto view = m_Scene->View<TransformComponent, Velocity>();
+    EXPECT_EQ(1u, view.SizeHint());
+}
+
+TEST_F(ViewTest, ComponentsAreMutableReferences)
+{
+    EntityID e = m_Scene->CreateEntity("Mover");
+    m_Scene->AddComponent<Velocity>(e, Velocity{ 2.0f, 3.0f });
+
+    m_Scene->View<TransformComponent, const Velocity>().Each(
+        [](TransformComponent& transform, const Velocity& velocity)
+    {
+        transform.Position[0] += velocity.X;
+        transform.Position[1] += velocity.Y;
+    });
+
+    auto* transform = m_Scene->GetComponent<TransformComponent>(e);
+    EXPECT_FLOAT_EQ(2.0f, transform->Position[0]);
+    EXPECT_FLOAT_EQ(3.0f, transform->Position[1]);
+}
+
+TEST_F(ViewTest, EachInRangeCoversViewExactlyOnce)
+{
+    for (int i = 0; i < 50; i++)
+    {
+        EntityID e = m_Scene->CreateEntity("Entity");
+        if (i % 3 != 0)
+            m_Scene->AddComponent<Velocity>(e);
+    }
+
+    auto view = m_Scene->View<Velocity, TransformComponent>();
+    int total = 0;
+    const size_t chunk = 7;
+    for (size_t start = 0; start < view.SizeHint(); start += chunk)
+    {
+        view.EachInRange(start, start + chunk, [&](Velocity&, TransformComponent&) { total++; });
+    }
+
+    int expected = 0;
+    view.Each([&](Velocity&, TransformComponent&) { expected++; });
+    EXPECT_EQ(expected, total);
+    EXPECT_EQ(33, total);
+}
+
+TEST_F(ViewTest, ContainsMatchesIterationFilter)
+{
+    EntityID a = m_Scene->CreateEntity("A");
+    EntityID b = m_Scene->CreateEntity("B");
+    m_Scene->AddComponent<Velocity>(a);
+    m_Scene->AddComponent<Velocity>(b);
+    m_Scene->AddComponent<Frozen>(b);
+
+    auto view = m_Scene->View<Velocity>(Exclude<Frozen>{});
+    EXPECT_TRUE(view.Contains(a.Index));
+    EXPECT_FALSE(view.Contains(b.Index));
+}
+
+// =============================================================================
+// Change Filters
+// =============================================================================
+
+TEST_F(ViewTest, ChangedFilterYieldsOnlyRowsWrittenSinceTick)
+{
+    EntityID a = m_Scene->CreateEntity("A");
+    EntityID b = m_Scene->CreateEntity("B");
+    m_Scene->AddComponent<Velocity>(a);
+    m_Scene->AddComponent<Velocity>(b);
+
+    const uint32_t since = ChangeTicks::Advance();
+
+    // Read-only access leaves rows unchanged
+    int count = 0;
+    m_Scene->View<const Velocity>().Each([&](const Velocity&) { count++; });
+    EXPECT_EQ(2, count);
+    count = 0;
+    m_Scene->View<const Velocity>().Filter(Changed<Velocity>{ since }).Each([&](const Velocity&) { count++; });
+    EXPECT_EQ(0, count);
+
+    ChangeTicks::Advance();
+    m_Scene->GetComponent<Velocity>(b)->X = 1.0f;
+
+    std::vector<Entity> visited;
+    m_Scene->View<const Velocity>().Filter(Changed<Velocity>{ since }).Each([&](Entity entity, const Velocity&) {
+        visited.push_back(entity);
+    });
+    ASSERT_EQ(1u, visited.size());
+    EXPECT_EQ(b.Index, visited[0]);
+}
+
+TEST_F(ViewTest, MutableViewAccessMarksRowsChanged)
+{
+    EntityID a = m_Scene->CreateEntity("A");
+    m_Scene->AddComponent<Velocity>(a);
+
+    const uint32_t since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+    m_Scene->View<Velocity>().Each([](Velocity& velocity) { velocity.X += 1.0f; });
+
+    int count = 0;
+    m_Scene->View<const Velocity>().Filter(Changed<Velocity>{ since }).Each([&](const Velocity&) { count++; });
+    EXPECT_EQ(1, count);
+}
+
+TEST_F(ViewTest, AddedFilterIgnoresLaterWrites)
+{
+    EntityID a = m_Scene->CreateEntity("A");
+    m_Scene->AddComponent<Velocity>(a);
+
+    const uint32_t since = ChangeTicks::Advance();
+    ChangeTicks::Advance();
+    EntityID b = m_Scene->CreateEntity("B");
+    m_Scene->AddComponent<Velocity>(b);
+    m_Scene->GetComponent<Velocity>(a)->X = 1.0f;
+
+    std::vector<Entity> added;
+    m_Scene->View<const Velocity>().Filter(Added<Velocity>{ since }).Each([&](Entity entity, const Velocity&) {
+        added.push_back(entity);
+    });
+    ASSERT_EQ(1u, added.size());
+    EXPECT_EQ(b.Index, added[0]);
+
+    // Filters combine with other included components
+    m_Scene->AddComponent<Frozen>(a);
+    int count = 0;
+    m_Scene->View<const Velocity, const Frozen>().Filter(Changed<Velocity>{ since }).Each([&](const Velocity&, const Frozen&) {
+        count++;
+    });
+    EXPECT_EQ(1, count);
+}
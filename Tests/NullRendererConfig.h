@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Platform/Null/NullRHI.h"
+#include "GGEngine/RHI/RHIDevice.h"
+#include "GGEngine/Asset/AssetManager.h"
+#include "GGEngine/Asset/ShaderLibrary.h"
+#include "GGEngine/Renderer/BindlessTextureManager.h"
+#include "GGEngine/Renderer/Renderer2D.h"
+#include "GGEngine/Renderer/SceneCamera.h"
+#include "GGEngine/Renderer/TextureStreamer.h"
+#include "GGEngine/Renderer/TransferQueue.h"
+
+#include <glm/glm.hpp>
+#include <filesystem>
+#include <fstream>
+
+namespace GGEngine::Testing {
+
+    // Brings up the renderer on the null RHI backend the way Application does,
+    // minus the window and ImGui. Only built with GGENGINE_NULL_RHI.
+    //
+    // The null device never runs shader bytecode, so the quad2d stages are
+    // placeholder files under a temporary asset root; this keeps the tests
+    // independent of glslc.
+    class NullRendererScope
+    {
+    public:
+        NullRendererScope()
+        {
+            RHIDevice::Get().Init(nullptr);
+            m_Baseline = NullDevice::Get().GetLiveResourceCount();
+
+            m_AssetRoot = std::filesystem::temp_directory_path() / "ggengine_null_rhi";
+            const auto shaderDir = m_AssetRoot / "assets/shaders/compiled";
+            std::filesystem::create_directories(shaderDir);
+            for (const char* stage : { "quad2d.vert.spv", "quad2d.frag.spv" })
+                std::ofstream(shaderDir / stage, std::ios::binary) << "SPIR";
+
+            AssetManager::Get().SetAssetRoot(m_AssetRoot);
+            BindlessTextureManager::Get().Init();
+            ShaderLibrary::Get().Load("quad2d", "assets/shaders/compiled/quad2d");
+            Renderer2D::Init();
+
+            m_Camera.SetOrthographic(10.0f, -1.0f, 1.0f);
+        }
+
+        ~NullRendererScope()
+        {
+            ShutdownRenderer();
+            RHIDevice::Get().Shutdown();
+
+            std::error_code error;
+            std::filesystem::remove_all(m_AssetRoot, error);
+        }
+
+        NullRendererScope(const NullRendererScope&) = delete;
+        NullRendererScope& operator=(const NullRendererScope&) = delete;
+
+        // Starts a frame the way Application::Run does and returns its command buffer
+        RHICommandBufferHandle BeginFrame()
+        {
+            auto& device = RHIDevice::Get();
+            device.BeginFrame();
+            TransferQueue::Get().EndFrame(device.GetCurrentFrameIndex());
+            TextureStreamer::Get().Update(device.GetCurrentFrameIndex());
+            TransferQueue::Get().FlushUploads(device.GetCurrentCommandBuffer());
+            device.BeginSwapchainRenderPass();
+            return device.GetCurrentCommandBuffer();
+        }
+
+        void EndFrame() { RHIDevice::Get().EndFrame(); }
+
+        void BeginScene() { Renderer2D::BeginScene(m_Camera, glm::mat4(1.0f)); }
+
+        // Shuts everything down except the device, so leaks can still be counted
+        void ShutdownRenderer()
+        {
+            if (!m_RendererAlive) return;
+            m_RendererAlive = false;
+
+            Renderer2D::Shutdown();
+            TransferQueue::Get().Shutdown();
+            ShaderLibrary::Get().Shutdown();
+            AssetManager::Get().Shutdown();
+            TextureStreamer::Get().Shutdown();
+            BindlessTextureManager::Get().Shutdown();
+        }
+
+        // Resources alive beyond those that existed right after RHIDevice::Init
+        size_t GetLiveResources() const { return NullDevice::Get().GetLiveResourceCount() - m_Baseline; }
+
+    private:
+        std::filesystem::path m_AssetRoot;
+        SceneCamera m_Camera;
+        size_t m_Baseline = 0;
+        bool m_RendererAlive = true;
+    };
+
+}
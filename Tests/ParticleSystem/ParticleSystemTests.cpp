@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+#include "GGEngine/ParticleSystem/ParticleSystem.h"
+#include "GGEngine/Renderer/InstancedRenderer2D.h"
+#include "GGEngine/Core/Math.h"
+#include "GGEngine/Core/TaskGraph.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace GGEngine;
+
+namespace {
+
+    // No randomized velocity or size, so results are exact
+    ParticleProps MakeProps(float x, float lifeTime = 1.0f)
+    {
+        ParticleProps props;
+        props.Position[0] = x;
+        props.Position[1] = 0.0f;
+        props.Velocity[0] = 1.0f;
+        props.Velocity[1] = 2.0f;
+        props.LifeTime = lifeTime;
+        return props;
+    }
+
+    std::vector<QuadInstanceData> Instances(const ParticleSystem& particles)
+    {
+        std::vector<QuadInstanceData> out(particles.GetActiveCount());
+        particles.WriteInstances(out.data(), 0);
+        return out;
+    }
+
+}
+
+// =============================================================================
+// Lifetime Tests
+// =============================================================================
+
+TEST(ParticleSystemTest, Emit_CountsLiveParticles)
+{
+    ParticleSystem particles(8);
+    EXPECT_EQ(0u, particles.GetActiveCount());
+
+    particles.Emit(MakeProps(0.0f));
+    particles.Emit(MakeProps(1.0f));
+    EXPECT_EQ(2u, particles.GetActiveCount());
+
+    particles.Clear();
+    EXPECT_EQ(0u, particles.GetActiveCount());
+}
+
+TEST(ParticleSystemTest, Update_IntegratesVelocity)
+{
+    ParticleSystem particles(8);
+    particles.Emit(MakeProps(3.0f, 10.0f));
+    particles.OnUpdate(Timestep(0.5f));
+
+    auto instances = Instances(particles);
+    ASSERT_EQ(1u, instances.size());
+    EXPECT_FLOAT_EQ(3.5f, instances[0].Position[0]);
+    EXPECT_FLOAT_EQ(1.0f, instances[0].Position[1]);
+    EXPECT_FLOAT_EQ(0.0f, instances[0].Position[2]);
+}
+
+TEST(ParticleSystemTest, Update_RemovesExpiredAndKeepsOthers)
+{
+    // Lifetimes alternate short/long across more than one SIMD step
+    ParticleSystem particles(16);
+    for (int i = 0; i < 11; i++)
+        particles.Emit(MakeProps(static_cast<float>(i), i % 2 == 0 ? 0.25f : 10.0f));
+
+    particles.OnUpdate(Timestep(0.5f));
+    ASSERT_EQ(5u, particles.GetActiveCount());
+
+    // Survivors are the odd ones, in some order
+    std::vector<int> seen(11, 0);
+    for (const auto& instance : Instances(particles))
+    {
+        const int x = static_cast<int>(instance.Position[0]);
+        ASSERT_GE(x, 0);
+        ASSERT_LT(x, 11);
+        seen[x]++;
+    }
+    for (int i = 0; i < 11; i++)
+        EXPECT_EQ(i % 2 == 1 ? 1 : 0, seen[i]) << "particle " << i;
+
+    particles.OnUpdate(Timestep(20.0f));
+    EXPECT_EQ(0u, particles.GetActiveCount());
+}
+
+TEST(ParticleSystemTest, Update_RemovesExpiredAcrossParallelChunks)
+{
+    if (!TaskGraph::Get().IsInitialized())
+        TaskGraph::Get().Init(2);
+
+    // Enough particles for several update chunks; every third one expires
+    // each frame, and the chunks' dead lists are reused by the next frame
+    constexpr int Count = 60000;
+    ParticleSystem particles(Count);
+    for (int i = 0; i < Count; i++)
+        particles.Emit(MakeProps(static_cast<float>(i), i % 3 == 0 ? 0.25f : (i % 3 == 1 ? 0.75f : 10.0f)));
+
+    particles.OnUpdate(Timestep(0.5f));
+    ASSERT_EQ(static_cast<uint32_t>(Count - Count / 3), particles.GetActiveCount());
+    particles.OnUpdate(Timestep(0.5f));
+    ASSERT_EQ(static_cast<uint32_t>(Count / 3), particles.GetActiveCount());
+
+    std::vector<int> seen(Count, 0);
+    for (const auto& instance : Instances(particles))
+    {
+        const int x = static_cast<int>(std::lround(instance.Position[0] - 1.0f));
+        ASSERT_GE(x, 0);
+        ASSERT_LT(x, Count);
+        seen[x]++;
+    }
+    for (int i = 0; i < Count; i++)
+        ASSERT_EQ(i % 3 == 2 ? 1 : 0, seen[i]) << "particle " << i;
+}
+
+TEST(ParticleSystemTest, FullPool_ReusesSlots)
+{
+    ParticleSystem particles(4);
+    for (int i = 0; i < 6; i++)
+        particles.Emit(MakeProps(static_cast<float>(i)));
+    EXPECT_EQ(4u, particles.GetActiveCount());
+    EXPECT_EQ(4u, particles.GetMaxParticles());
+
+    ParticleSystem empty(0);
+    empty.Emit(MakeProps(0.0f));
+    EXPECT_EQ(0u, empty.GetActiveCount());
+}
+
+// =============================================================================
+// Instance Tests
+// =============================================================================
+
+TEST(ParticleSystemTest, WriteInstances_InterpolatesOverLife)
+{
+    ParticleProps props = MakeProps(0.0f, 2.0f);
+    props.SizeBegin = 1.0f;
+    props.SizeEnd = 3.0f;
+    props.ColorBegin[0] = 1.0f;
+    props.ColorEnd[0] = 0.0f;
+    props.ColorBegin[3] = 1.0f;
+    props.ColorEnd[3] = 0.5f;
+
+    // Not a multiple of the SIMD width, with a guard instance past the end
+    ParticleSystem particles(8);
+    for (int i = 0; i < 5; i++)
+        particles.Emit(props);
+    particles.OnUpdate(Timestep(0.5f));
+
+    std::vector<QuadInstanceData> out(6);
+    std::memset(out.data(), 0xAB, out.size() * sizeof(QuadInstanceData));
+    QuadInstanceData guard = out[5];
+    particles.WriteInstances(out.data(), 7);
+
+    for (int i = 0; i < 5; i++)
+    {
+        // Three quarters of life left
+        EXPECT_FLOAT_EQ(1.5f, out[i].Scale[0]);
+        EXPECT_FLOAT_EQ(1.5f, out[i].Scale[1]);
+        EXPECT_FLOAT_EQ(0.75f, out[i].Color[0]);
+        EXPECT_FLOAT_EQ(0.875f, out[i].Color[3]);
+        EXPECT_FLOAT_EQ(0.0f, out[i].TexCoords[0]);
+        EXPECT_FLOAT_EQ(1.0f, out[i].TexCoords[3]);
+        EXPECT_EQ(7u, out[i].TexIndex);
+        EXPECT_FLOAT_EQ(1.0f, out[i].TilingFactor);
+    }
+    EXPECT_EQ(0, std::memcmp(&guard, &out[5], sizeof(QuadInstanceData)));
+}
+
+// =============================================================================
+// Spawn Tests
+// =============================================================================
+
+TEST(ParticleSystemTest, Spawn_VelocityStaysInCone)
+{
+    ParticleSpawnParams params;
+    params.Position[0] = 1.0f;
+    params.Position[1] = -1.0f;
+    params.Direction = Math::HalfPi;
+    params.Spread = Math::HalfPi;
+    params.Speed = 2.0f;
+    params.LifeTime = 10.0f;
+
+    // Not a multiple of the SIMD width
+    ParticleSystem particles(200);
+    particles.Spawn(params, 103);
+    ASSERT_EQ(103u, particles.GetActiveCount());
+
+    particles.OnUpdate(Timestep(0.5f));
+    for (const QuadInstanceData& instance : Instances(particles))
+    {
+        const float dx = instance.Position[0] - 1.0f;
+        const float dy = instance.Position[1] + 1.0f;
+        EXPECT_NEAR(1.0f, std::sqrt(dx * dx + dy * dy), 1e-4f);
+
+        // Within 45 degrees of straight up
+        EXPECT_GE(std::atan2(dy, dx), Math::Pi / 4.0f - 1e-4f);
+        EXPECT_LE(std::atan2(dy, dx), Math::Pi * 3.0f / 4.0f + 1e-4f);
+    }
+}
+
+TEST(ParticleSystemTest, Spawn_FullPoolReusesSlotsInOrder)
+{
+    auto spawnAt = [](ParticleSystem& particles, float x, uint32_t count) {
+        ParticleSpawnParams params;
+        params.Position[0] = x;
+        params.Speed = 0.0f;
+        params.LifeTime = 10.0f;
+        particles.Spawn(params, count);
+    };
+    auto countAt = [](const ParticleSystem& particles, float x) {
+        int count = 0;
+        for (const QuadInstanceData& instance : Instances(particles))
+            count += instance.Position[0] == x ? 1 : 0;
+        return count;
+    };
+
+    ParticleSystem particles(8);
+    spawnAt(particles, 0.0f, 5);
+    spawnAt(particles, 5.0f, 6);     // Three free slots, then slots 0-2 again
+    EXPECT_EQ(8u, particles.GetActiveCount());
+    EXPECT_EQ(2, countAt(particles, 0.0f));
+    EXPECT_EQ(6, countAt(particles, 5.0f));
+
+    spawnAt(particles, 9.0f, 7);     // Slots 3-7, then wraps to 0-1
+    EXPECT_EQ(7, countAt(particles, 9.0f));
+    EXPECT_EQ(1, countAt(particles, 5.0f));
+
+    spawnAt(particles, 2.0f, 100);   // Never more than the pool holds
+    EXPECT_EQ(8, countAt(particles, 2.0f));
+
+    ParticleSystem empty(0);
+    spawnAt(empty, 0.0f, 10);
+    EXPECT_EQ(0u, empty.GetActiveCount());
+}
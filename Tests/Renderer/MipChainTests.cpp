@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Asset/MipChain.h"
+#include <cstdint>
+#include <vector>
+
+using namespace GGEngine;
+
+namespace {
+
+    // Deterministic RGBA8 noise
+    std::vector<uint8_t> MakePixels(uint32_t width, uint32_t height)
+    {
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+        uint32_t state = 12345u;
+        for (uint8_t& byte : pixels)
+        {
+            state = state * 1664525u + 1013904223u;
+            byte = static_cast<uint8_t>(state >> 24);
+        }
+        return pixels;
+    }
+
+}
+
+// =============================================================================
+// Layout
+// =============================================================================
+
+TEST(MipChainTest, Layout_HalvesDownToOnePixel)
+{
+    const auto levels = GetMipChainLayout(8, 2);
+    ASSERT_EQ(4u, levels.size());
+
+    const uint32_t widths[] = { 8, 4, 2, 1 };
+    const uint32_t heights[] = { 2, 1, 1, 1 };
+    uint64_t offset = 0;
+    for (size_t i = 0; i < levels.size(); i++)
+    {
+        EXPECT_EQ(widths[i], levels[i].width);
+        EXPECT_EQ(heights[i], levels[i].height);
+        EXPECT_EQ(offset, levels[i].offset);
+        EXPECT_EQ(static_cast<uint64_t>(widths[i]) * heights[i] * 4, levels[i].size);
+        offset += levels[i].size;
+    }
+
+    EXPECT_EQ(offset, GetMipChainSize(levels));
+    EXPECT_EQ(3u * 4, GetMipChainSize(levels, 1) - levels[1].size);
+    EXPECT_TRUE(GetMipChainLayout(0, 4).empty());
+    EXPECT_EQ(1u, GetMipChainLayout(1, 1).size());
+}
+
+// =============================================================================
+// Downsampling
+// =============================================================================
+
+TEST(MipChainTest, Downsample_AveragesEachBlock)
+{
+    // One 2x2 block per channel pattern; 1 + 2 + 3 + 5 = 11 rounds 2.75 to 3
+    const uint8_t source[2 * 2 * 4] = {
+        1, 10, 0, 255,     2, 20, 0, 255,
+        3, 30, 1, 0,       5, 40, 1, 0,
+    };
+    uint8_t out[4] = {};
+    DownsampleRGBA8(source, 2, 2, out);
+    EXPECT_EQ(3, out[0]);
+    EXPECT_EQ(25, out[1]);
+    EXPECT_EQ(0, out[2]);     // 0.5 rounds to even
+    EXPECT_EQ(128, out[3]);   // 127.5 rounds to even
+}
+
+TEST(MipChainTest, Downsample_SingleColumnAveragesRowPairs)
+{
+    const uint8_t source[1 * 4 * 4] = {
+        0, 0, 0, 0,   100, 100, 100, 100,   10, 20, 30, 40,   30, 40, 50, 60,
+    };
+    uint8_t out[1 * 2 * 4] = {};
+    DownsampleRGBA8(source, 1, 4, out);
+    const uint8_t expected[] = { 50, 50, 50, 50, 20, 30, 40, 50 };
+    for (int i = 0; i < 8; i++)
+        EXPECT_EQ(expected[i], out[i]) << "byte " << i;
+}
+
+TEST(MipChainTest, Downsample_MatchesScalarOnOddSizes)
+{
+    const uint32_t sizes[][2] = { { 7, 5 }, { 1, 9 }, { 33, 1 }, { 513, 130 } };
+    for (const auto& size : sizes)
+    {
+        const uint32_t width = size[0];
+        const uint32_t height = size[1];
+        const std::vector<uint8_t> source = MakePixels(width, height);
+        const size_t outBytes = static_cast<size_t>(std::max(width / 2, 1u)) * std::max(height / 2, 1u) * 4;
+
+        std::vector<uint8_t> simd(outBytes), scalar(outBytes);
+        DownsampleRGBA8(source.data(), width, height, simd.data());
+        DownsampleRGBA8Scalar(source.data(), width, height, scalar.data());
+        EXPECT_EQ(scalar, simd) << width << "x" << height;
+    }
+}
+
+TEST(MipChainTest, GenerateMipChain_FillsEveryLevel)
+{
+    // A flat color stays flat all the way down
+    std::vector<uint8_t> pixels(6 * 3 * 4);
+    for (size_t i = 0; i < pixels.size(); i += 4)
+    {
+        pixels[i + 0] = 200;
+        pixels[i + 1] = 100;
+        pixels[i + 2] = 50;
+        pixels[i + 3] = 255;
+    }
+
+    const auto levels = GenerateMipChain(pixels, 6, 3);
+    ASSERT_EQ(3u, levels.size());
+    ASSERT_EQ(GetMipChainSize(levels), pixels.size());
+    for (size_t i = levels[1].offset; i < pixels.size(); i += 4)
+    {
+        EXPECT_EQ(200, pixels[i + 0]);
+        EXPECT_EQ(100, pixels[i + 1]);
+        EXPECT_EQ(50, pixels[i + 2]);
+        EXPECT_EQ(255, pixels[i + 3]);
+    }
+
+    // Too little data for the size given
+    std::vector<uint8_t> tooSmall(4);
+    EXPECT_TRUE(GenerateMipChain(tooSmall, 2, 2).empty());
+}
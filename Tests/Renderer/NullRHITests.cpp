@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include "Platform/Null/NullRHI.h"
+#include "GGEngine/RHI/RHIDevice.h"
+#include "GGEngine/RHI/RHICommandBuffer.h"
+#include "GGEngine/Renderer/TransferQueue.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace GGEngine;
+
+namespace {
+
+    RHIBufferHandle CreateBuffer(uint64_t size, bool cpuVisible)
+    {
+        RHIBufferSpecification spec;
+        spec.size = size;
+        spec.usage = BufferUsage::Vertex;
+        spec.cpuVisible = cpuVisible;
+        return RHIDevice::Get().CreateBuffer(spec);
+    }
+
+    std::vector<uint8_t> Bytes(std::initializer_list<uint8_t> values)
+    {
+        return std::vector<uint8_t>(values);
+    }
+
+}
+
+class NullRHITest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        RHIDevice::Get().Init(nullptr);
+        baseline = NullDevice::Get().GetLiveResourceCount();
+    }
+
+    void TearDown() override
+    {
+        TransferQueue::Get().Shutdown();
+        RHIDevice::Get().Shutdown();
+    }
+
+    size_t baseline = 0;
+};
+
+// =============================================================================
+// Resources
+// =============================================================================
+
+TEST_F(NullRHITest, Buffer_MapAndUploadRoundTrip)
+{
+    auto& device = RHIDevice::Get();
+    RHIBufferHandle buffer = CreateBuffer(8, true);
+    ASSERT_TRUE(buffer.IsValid());
+
+    auto* mapped = static_cast<uint8_t*>(device.MapBuffer(buffer));
+    ASSERT_NE(nullptr, mapped);
+    mapped[0] = 1;
+    mapped[7] = 8;
+    device.UnmapBuffer(buffer);
+
+    const uint8_t middle[] = { 4, 5 };
+    device.UploadBufferData(buffer, middle, sizeof(middle), 3);
+
+    EXPECT_EQ(Bytes({ 1, 0, 0, 4, 5, 0, 0, 8 }), NullDevice::Get().ReadBuffer(buffer));
+
+    device.DestroyBuffer(buffer);
+    EXPECT_EQ(baseline, NullDevice::Get().GetLiveResourceCount());
+}
+
+TEST_F(NullRHITest, MapBuffer_RejectsGpuOnlyBuffer)
+{
+    RHIBufferHandle buffer = CreateBuffer(16, false);
+    EXPECT_EQ(nullptr, RHIDevice::Get().MapBuffer(buffer));
+
+    // Uploads still work, as they do through staging on a GPU
+    const uint8_t value = 9;
+    RHIDevice::Get().UploadBufferData(buffer, &value, 1, 15);
+    EXPECT_EQ(9, NullDevice::Get().ReadBuffer(buffer)[15]);
+
+    RHIDevice::Get().DestroyBuffer(buffer);
+}
+
+TEST_F(NullRHITest, TryCreate_RejectsEmptyResources)
+{
+    auto& device = RHIDevice::Get();
+    EXPECT_TRUE(device.TryCreateBuffer(RHIBufferSpecification{}).IsErr());
+
+    RHITextureSpecification spec;
+    spec.width = 0;
+    EXPECT_TRUE(device.TryCreateTexture(spec).IsErr());
+    EXPECT_EQ(baseline, NullDevice::Get().GetLiveResourceCount());
+}
+
+TEST_F(NullRHITest, Pipeline_LayoutIsTracked)
+{
+    auto& device = RHIDevice::Get();
+    const std::vector<char> code = { 1, 2, 3, 4 };
+
+    RHIGraphicsPipelineSpecification spec;
+    spec.shaderModules.push_back(device.CreateShaderModule(ShaderStage::Vertex, code));
+    RHIGraphicsPipelineResult pipeline = device.CreateGraphicsPipeline(spec);
+    ASSERT_TRUE(pipeline.IsValid());
+    EXPECT_EQ(pipeline.layout, device.GetPipelineLayout(pipeline.pipeline));
+
+    device.DestroyPipeline(pipeline.pipeline);
+    device.DestroyPipelineLayout(pipeline.layout);
+    device.DestroyShaderModule(spec.shaderModules[0]);
+    EXPECT_EQ(baseline, NullDevice::Get().GetLiveResourceCount());
+}
+
+// =============================================================================
+// Command Log
+// =============================================================================
+
+TEST_F(NullRHITest, Frame_RecordsIntoItsOwnCommandBuffer)
+{
+    auto& device = RHIDevice::Get();
+
+    device.BeginFrame();
+    RHICommandBufferHandle first = device.GetCurrentCommandBuffer();
+    device.BeginSwapchainRenderPass();
+    RHICmd::DrawIndexed(first, 12, 1, 6);
+    device.EndFrame();
+
+    device.BeginFrame();
+    RHICommandBufferHandle second = device.GetCurrentCommandBuffer();
+    EXPECT_NE(first, second);
+    RHICmd::Draw(second, 3);
+    device.EndFrame();
+
+    auto commands = NullDevice::Get().GetCommands(first);
+    ASSERT_EQ(3u, commands.size());
+    EXPECT_EQ(NullCommandType::BeginRenderPass, commands[0].type);
+    EXPECT_EQ(device.GetSwapchainRenderPass().id, commands[0].resource);
+    EXPECT_EQ(NullDevice::DefaultSwapchainWidth, commands[0].width);
+    EXPECT_EQ(NullCommandType::DrawIndexed, commands[1].type);
+    EXPECT_EQ(12u, commands[1].elementCount);
+    EXPECT_EQ(6u, commands[1].firstElement);
+    EXPECT_EQ(NullCommandType::EndRenderPass, commands[2].type);
+
+    EXPECT_EQ(1u, NullDevice::Get().CountCommands(second, NullCommandType::Draw));
+    EXPECT_EQ(2u, NullDevice::Get().GetFrameCount());
+
+    // Beginning the first frame again starts its log over
+    device.BeginFrame();
+    EXPECT_TRUE(NullDevice::Get().GetCommands(first).empty());
+}
+
+TEST_F(NullRHITest, ImmediateSubmit_ExecutesCopies)
+{
+    RHIBufferHandle src = CreateBuffer(4, true);
+    RHIBufferHandle dst = CreateBuffer(6, false);
+    const uint8_t data[] = { 1, 2, 3, 4 };
+    RHIDevice::Get().UploadBufferData(src, data, sizeof(data));
+
+    RHICommandBufferHandle used;
+    RHIDevice::Get().ImmediateSubmit([&](RHICommandBufferHandle cmd) {
+        used = cmd;
+        RHICmd::CopyBuffer(cmd, src, dst, 1, 2, 3);
+    });
+
+    EXPECT_EQ(Bytes({ 0, 0, 2, 3, 4, 0 }), NullDevice::Get().ReadBuffer(dst));
+    EXPECT_EQ(1u, NullDevice::Get().CountCommands(used, NullCommandType::CopyBuffer));
+
+    RHIDevice::Get().DestroyBuffer(src);
+    RHIDevice::Get().DestroyBuffer(dst);
+}
+
+// =============================================================================
+// TransferQueue
+// =============================================================================
+
+TEST_F(NullRHITest, TransferQueue_FlushCopiesBetweenBarriers)
+{
+    auto& device = RHIDevice::Get();
+    auto& queue = TransferQueue::Get();
+
+    RHITextureSpecification textureSpec;
+    textureSpec.width = 2;
+    textureSpec.height = 1;
+    RHITextureHandle texture = device.CreateTexture(textureSpec);
+    RHIBufferHandle buffer = CreateBuffer(8, false);
+
+    const uint8_t pixels[] = { 10, 20, 30, 40, 50, 60, 70, 80 };
+    const uint8_t values[] = { 7, 7 };
+    int completed = 0;
+    queue.QueueTextureUpload(texture, pixels, sizeof(pixels), 2, 1, [&]() { completed++; });
+    queue.QueueBufferUpload(buffer, values, sizeof(values), 4, [&]() { completed++; });
+    EXPECT_EQ(2u, queue.GetPendingCount());
+
+    device.BeginFrame();
+    const uint32_t frameIndex = device.GetCurrentFrameIndex();
+    RHICommandBufferHandle cmd = device.GetCurrentCommandBuffer();
+    queue.FlushUploads(cmd);
+    EXPECT_EQ(0u, queue.GetPendingCount());
+
+    auto commands = NullDevice::Get().GetCommands(cmd);
+    ASSERT_EQ(6u, commands.size());
+    EXPECT_EQ(NullCommandType::TransitionImageLayout, commands[0].type);
+    EXPECT_EQ(NullCommandType::CopyBufferToTexture, commands[1].type);
+    EXPECT_EQ(NullCommandType::TransitionImageLayout, commands[2].type);
+    EXPECT_EQ(ImageLayout::ShaderReadOnly, commands[2].newLayout);
+
+    // Buffer copies wait for earlier draws and are visible to later ones
+    EXPECT_EQ(NullCommandType::BufferBarrier, commands[3].type);
+    EXPECT_EQ(MemoryAccess::DrawRead, commands[3].srcAccess);
+    EXPECT_EQ(MemoryAccess::TransferWrite, commands[3].dstAccess);
+    EXPECT_EQ(NullCommandType::CopyBuffer, commands[4].type);
+    EXPECT_EQ(4u, commands[4].dstOffset);
+    EXPECT_EQ(NullCommandType::BufferBarrier, commands[5].type);
+    EXPECT_EQ(MemoryAccess::DrawRead, commands[5].dstAccess);
+
+    EXPECT_EQ(Bytes({ 10, 20, 30, 40, 50, 60, 70, 80 }), NullDevice::Get().ReadTexture(texture));
+    EXPECT_EQ(ImageLayout::ShaderReadOnly, NullDevice::Get().GetTextureLayout(texture));
+    EXPECT_EQ(Bytes({ 0, 0, 0, 0, 7, 7, 0, 0 }), NullDevice::Get().ReadBuffer(buffer));
+
+    // Callbacks fire and staging buffers go once the frame comes around again
+    EXPECT_EQ(0, completed);
+    device.EndFrame();
+    queue.EndFrame(frameIndex);
+    EXPECT_EQ(2, completed);
+
+    device.DestroyTexture(texture);
+    device.DestroyBuffer(buffer);
+    EXPECT_EQ(baseline, NullDevice::Get().GetLiveResourceCount());
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Renderer/QuadGeometry.h"
+#include "GGEngine/Renderer/Renderer2D.h"
+#include "GGEngine/Core/SIMD.h"
+#include "BenchmarkConfig.h"
+#include <cstdio>
+#include <vector>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+// =============================================================================
+// Renderer2D vertex generation, scalar vs SIMD
+// =============================================================================
+// GenerateQuadVertices is what Renderer2D::DrawQuads runs on the CPU for each
+// batch; it needs no device, so this measures it directly. Reported rates are
+// quads per second (Mops/s = million quads per second).
+
+namespace {
+
+    constexpr size_t QuadCount = 100000;
+
+    std::vector<QuadSpec> MakeSpecs(bool rotated)
+    {
+        static const float uvs[4][2] = { { 0.0f, 0.5f }, { 0.5f, 0.5f }, { 0.5f, 1.0f }, { 0.0f, 1.0f } };
+
+        std::vector<QuadSpec> specs(QuadCount);
+        for (size_t i = 0; i < QuadCount; i++)
+        {
+            const float f = static_cast<float>(i);
+            specs[i].SetPosition(f * 0.01f, f * -0.02f, 0.0f)
+                    .SetSize(1.0f, 1.0f)
+                    .SetRotation(rotated ? f * 0.001f : 0.0f)
+                    .SetColor(1.0f, 0.5f, 0.25f, 1.0f)
+                    .SetTexCoords(uvs);
+        }
+        return specs;
+    }
+
+    void Compare(const char* label, bool rotated)
+    {
+        const std::vector<QuadSpec> specs = MakeSpecs(rotated);
+        std::vector<QuadVertex> vertices(QuadCount * 4);
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "%s scalar", label);
+        ReportBenchmark(name, QuadCount, MeasureBestNs([&]() {
+            GenerateQuadVerticesScalar(specs.data(), specs.size(), 0, vertices.data());
+            DoNotOptimize(vertices.data());
+        }));
+
+        std::snprintf(name, sizeof(name), "%s %s", label, Simd::GetBackendName());
+        ReportBenchmark(name, QuadCount, MeasureBestNs([&]() {
+            GenerateQuadVertices(specs.data(), specs.size(), 0, vertices.data());
+            DoNotOptimize(vertices.data());
+        }));
+    }
+
+}
+
+TEST(QuadGeometryBenchmark, Unrotated)
+{
+    Compare("Quad vertices, unrotated", false);
+}
+
+TEST(QuadGeometryBenchmark, Rotated)
+{
+    Compare("Quad vertices, rotated", true);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Renderer/QuadGeometry.h"
+#include "GGEngine/Renderer/Renderer2D.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstring>
+#include <vector>
+
+using namespace GGEngine;
+
+namespace {
+
+    constexpr uint32_t WhiteTexture = 0;
+
+    // Deterministic specs covering rotation, custom UVs, tint and tiling
+    std::vector<QuadSpec> MakeSpecs(size_t count)
+    {
+        static const float uvs[4][2] = { { 0.25f, 0.5f }, { 0.5f, 0.5f }, { 0.5f, 0.75f }, { 0.25f, 0.75f } };
+
+        std::vector<QuadSpec> specs(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const float f = static_cast<float>(i);
+            QuadSpec& spec = specs[i];
+            spec.SetPosition(f * 1.5f - 20.0f, f * -0.75f + 3.0f, f * 0.01f);
+            spec.SetSize(1.0f + (i % 3), 0.5f + (i % 5) * 0.25f);
+            spec.SetRotation(i % 4 == 0 ? 0.0f : f * 0.37f - 3.0f);
+            spec.SetColor(0.1f * (i % 10), 0.5f, 1.0f - 0.05f * (i % 20), 0.75f);
+            spec.tilingFactor = 1.0f + (i % 2);
+            if (i % 3 == 1)
+                spec.SetTexCoords(uvs);
+        }
+        return specs;
+    }
+
+    void ExpectVerticesNear(const std::vector<QuadVertex>& expected, const std::vector<QuadVertex>& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t v = 0; v < expected.size(); v++)
+        {
+            for (int i = 0; i < 3; i++)
+                EXPECT_NEAR(expected[v].position[i], actual[v].position[i], 1e-4f) << "vertex " << v;
+            for (int i = 0; i < 2; i++)
+                EXPECT_EQ(expected[v].texCoord[i], actual[v].texCoord[i]) << "vertex " << v;
+            for (int i = 0; i < 4; i++)
+                EXPECT_EQ(expected[v].color[i], actual[v].color[i]) << "vertex " << v;
+            EXPECT_EQ(expected[v].tilingFactor, actual[v].tilingFactor) << "vertex " << v;
+            EXPECT_EQ(expected[v].texIndex, actual[v].texIndex) << "vertex " << v;
+        }
+    }
+
+}
+
+// =============================================================================
+// SIMD vs Scalar
+// =============================================================================
+
+TEST(QuadGeometryTest, MatchesScalar)
+{
+    // Not a multiple of 4, so the scalar tail runs too
+    const std::vector<QuadSpec> specs = MakeSpecs(103);
+
+    std::vector<QuadVertex> scalar(specs.size() * 4);
+    std::vector<QuadVertex> simd(specs.size() * 4);
+    GenerateQuadVerticesScalar(specs.data(), specs.size(), WhiteTexture, scalar.data());
+    GenerateQuadVertices(specs.data(), specs.size(), WhiteTexture, simd.data());
+
+    ExpectVerticesNear(scalar, simd);
+}
+
+TEST(QuadGeometryTest, UnrotatedIsExact)
+{
+    std::vector<QuadSpec> specs = MakeSpecs(16);
+    for (QuadSpec& spec : specs)
+        spec.rotation = 0.0f;
+
+    std::vector<QuadVertex> scalar(specs.size() * 4);
+    std::vector<QuadVertex> simd(specs.size() * 4);
+    GenerateQuadVerticesScalar(specs.data(), specs.size(), WhiteTexture, scalar.data());
+    GenerateQuadVertices(specs.data(), specs.size(), WhiteTexture, simd.data());
+
+    EXPECT_EQ(0, std::memcmp(scalar.data(), simd.data(), scalar.size() * sizeof(QuadVertex)));
+}
+
+TEST(QuadGeometryTest, TransformSpecsInGroup)
+{
+    std::vector<QuadSpec> specs = MakeSpecs(8);
+    const glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(5.0f, -2.0f, 0.5f));
+    specs[2].SetTransform(&transform);
+
+    std::vector<QuadVertex> scalar(specs.size() * 4);
+    std::vector<QuadVertex> simd(specs.size() * 4);
+    GenerateQuadVerticesScalar(specs.data(), specs.size(), WhiteTexture, scalar.data());
+    GenerateQuadVertices(specs.data(), specs.size(), WhiteTexture, simd.data());
+
+    ExpectVerticesNear(scalar, simd);
+    EXPECT_NEAR(4.5f, simd[8].position[0], 1e-6f);
+    EXPECT_NEAR(-2.5f, simd[8].position[1], 1e-6f);
+}
+
+TEST(QuadGeometryTest, CornerOrderAndDefaults)
+{
+    QuadSpec spec;
+    spec.SetPosition(1.0f, 2.0f, 3.0f).SetSize(2.0f, 4.0f);
+    std::vector<QuadSpec> specs(4, spec);
+
+    std::vector<QuadVertex> vertices(16);
+    GenerateQuadVertices(specs.data(), specs.size(), 7, vertices.data());
+
+    // BL, BR, TR, TL with full-texture UVs
+    const float expected[4][4] = {
+        { 0.0f, 0.0f, 0.0f, 0.0f },
+        { 2.0f, 0.0f, 1.0f, 0.0f },
+        { 2.0f, 4.0f, 1.0f, 1.0f },
+        { 0.0f, 4.0f, 0.0f, 1.0f }
+    };
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(expected[i][0], vertices[12 + i].position[0]);
+        EXPECT_EQ(expected[i][1], vertices[12 + i].position[1]);
+        EXPECT_EQ(3.0f, vertices[12 + i].position[2]);
+        EXPECT_EQ(expected[i][2], vertices[12 + i].texCoord[0]);
+        EXPECT_EQ(expected[i][3], vertices[12 + i].texCoord[1]);
+        EXPECT_EQ(7u, vertices[12 + i].texIndex);
+    }
+}
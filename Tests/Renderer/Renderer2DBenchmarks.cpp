@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "NullRendererConfig.h"
+#include "BenchmarkConfig.h"
+
+#include <vector>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+// =============================================================================
+// Renderer2D frames on the null RHI backend
+// =============================================================================
+// A whole frame of Renderer2D work: BeginScene, quad submission, batching,
+// the vertex upload and the recorded draws. Nothing waits on a GPU, so this
+// is the CPU cost the renderer adds per frame. Reported rates are quads per
+// second.
+
+namespace {
+
+    constexpr size_t QuadCount = 100000;
+
+    std::vector<QuadSpec> MakeSpecs()
+    {
+        std::vector<QuadSpec> specs(QuadCount);
+        for (size_t i = 0; i < QuadCount; i++)
+        {
+            const float f = static_cast<float>(i);
+            specs[i].SetPosition(f * 0.01f, f * -0.02f, 0.0f)
+                    .SetSize(1.0f, 1.0f)
+                    .SetColor(1.0f, 0.5f, 0.25f, 1.0f);
+        }
+        return specs;
+    }
+
+}
+
+TEST(Renderer2DBenchmark, DrawQuadFrame)
+{
+    NullRendererScope renderer;
+    const std::vector<QuadSpec> specs = MakeSpecs();
+
+    ReportBenchmark("Renderer2D frame, DrawQuad", QuadCount, MeasureBestNs([&]() {
+        renderer.BeginFrame();
+        renderer.BeginScene();
+        for (const QuadSpec& spec : specs)
+            Renderer2D::DrawQuad(spec);
+        Renderer2D::EndScene();
+        renderer.EndFrame();
+    }));
+}
+
+TEST(Renderer2DBenchmark, DrawQuadsFrame)
+{
+    NullRendererScope renderer;
+    const std::vector<QuadSpec> specs = MakeSpecs();
+
+    ReportBenchmark("Renderer2D frame, DrawQuads", QuadCount, MeasureBestNs([&]() {
+        renderer.BeginFrame();
+        renderer.BeginScene();
+        Renderer2D::DrawQuads(specs.data(), specs.size());
+        Renderer2D::EndScene();
+        renderer.EndFrame();
+    }));
+}
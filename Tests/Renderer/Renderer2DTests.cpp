@@ -0,0 +1,346 @@
+#include <gtest/gtest.h>
+#include "NullRendererConfig.h"
+#include "GGEngine/Renderer/QuadGeometry.h"
+#include "GGEngine/Core/TaskGraph.h"
+
+#include <cstring>
+#include <functional>
+#include <utility>
+#include <vector>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+namespace {
+
+    // Vertices in the buffer the last draw of cmd read from
+    std::vector<QuadVertex> ReadDrawnVertices(RHICommandBufferHandle cmd)
+    {
+        uint64_t vertexBuffer = 0;
+        for (const auto& command : NullDevice::Get().GetCommands(cmd))
+        {
+            if (command.type == NullCommandType::BindVertexBuffer)
+                vertexBuffer = command.resource;
+        }
+
+        const std::vector<uint8_t> bytes = NullDevice::Get().ReadBuffer(RHIBufferHandle{ vertexBuffer });
+        std::vector<QuadVertex> vertices(bytes.size() / sizeof(QuadVertex));
+        if (!vertices.empty())
+            std::memcpy(vertices.data(), bytes.data(), vertices.size() * sizeof(QuadVertex));
+        return vertices;
+    }
+
+    // Draws (index count, vertex offset) and drawn vertices of one recorded scene
+    struct RecordedScene
+    {
+        std::vector<std::pair<uint32_t, int32_t>> draws;
+        std::vector<QuadVertex> vertices;
+        uint32_t quadCount = 0;
+    };
+
+    RecordedScene RecordScene(NullRendererScope& renderer, const std::function<void()>& draw)
+    {
+        RHICommandBufferHandle cmd = renderer.BeginFrame();
+        Renderer2D::ResetStats();
+        renderer.BeginScene();
+        draw();
+        Renderer2D::EndScene();
+        renderer.EndFrame();
+
+        RecordedScene scene;
+        for (const auto& command : NullDevice::Get().GetCommands(cmd))
+        {
+            if (command.type == NullCommandType::DrawIndexed)
+                scene.draws.emplace_back(command.elementCount, command.vertexOffset);
+        }
+        scene.vertices = ReadDrawnVertices(cmd);
+        scene.quadCount = Renderer2D::GetStats().QuadCount;
+        scene.vertices.resize(static_cast<size_t>(scene.quadCount) * 4);
+        return scene;
+    }
+
+    std::vector<QuadSpec> MakeDistinctQuads(size_t count)
+    {
+        std::vector<QuadSpec> specs(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const float f = static_cast<float>(i);
+            specs[i].SetPosition(f * 0.5f, f * -0.25f).SetSize(1.0f + f * 0.01f, 1.0f)
+                    .SetColor(f / count, 1.0f - f / count, 0.5f);
+        }
+        return specs;
+    }
+
+    // Each context draws its contiguous slice of specs from a TaskGraph worker
+    void SubmitInParallel(const std::vector<QuadSpec>& specs, const std::vector<size_t>& sliceEnds)
+    {
+        const uint32_t contextCount = static_cast<uint32_t>(sliceEnds.size());
+        Renderer2D::BeginParallelSubmit(contextCount);
+        TaskGraph::Get().ParallelFor(0, contextCount, 1, [&](size_t first, size_t last)
+        {
+            for (size_t i = first; i < last; i++)
+            {
+                const size_t begin = i == 0 ? 0 : sliceEnds[i - 1];
+                QuadSubmitContext& context = Renderer2D::GetSubmitContext(static_cast<uint32_t>(i));
+                // Half one quad at a time, half in bulk
+                const size_t middle = begin + (sliceEnds[i] - begin) / 2;
+                for (size_t quad = begin; quad < middle; quad++)
+                    context.DrawQuad(specs[quad]);
+                context.DrawQuads(specs.data() + middle, sliceEnds[i] - middle);
+            }
+        });
+        Renderer2D::EndParallelSubmit();
+    }
+
+    bool SameVertices(const std::vector<QuadVertex>& a, const std::vector<QuadVertex>& b)
+    {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(QuadVertex)) == 0;
+    }
+
+}
+
+class Renderer2DTest : public ::testing::Test
+{
+protected:
+    NullRendererScope renderer;
+};
+
+// =============================================================================
+// Batching
+// =============================================================================
+
+TEST_F(Renderer2DTest, EndScene_DrawsQuadsInOneBatch)
+{
+    RHICommandBufferHandle cmd = renderer.BeginFrame();
+    Renderer2D::ResetStats();
+    renderer.BeginScene();
+    for (int i = 0; i < 3; i++)
+        Renderer2D::DrawQuad(QuadSpec().SetPosition(static_cast<float>(i) * 2.0f, 1.0f).SetSize(1.0f, 1.0f));
+    Renderer2D::EndScene();
+    renderer.EndFrame();
+
+    const auto commands = NullDevice::Get().GetCommands(cmd);
+    ASSERT_EQ(1u, NullDevice::Get().CountCommands(cmd, NullCommandType::DrawIndexed));
+    for (const auto& command : commands)
+    {
+        if (command.type == NullCommandType::DrawIndexed)
+            EXPECT_EQ(18u, command.elementCount);
+    }
+    EXPECT_EQ(1u, NullDevice::Get().CountCommands(cmd, NullCommandType::BindPipeline));
+    EXPECT_EQ(NullCommandType::EndRenderPass, commands.back().type);
+
+    // The vertices reached the buffer the draw used
+    const auto vertices = ReadDrawnVertices(cmd);
+    ASSERT_GE(vertices.size(), 12u);
+    for (int i = 0; i < 3; i++)
+    {
+        float centerX = 0.0f;
+        for (int corner = 0; corner < 4; corner++)
+            centerX += vertices[i * 4 + corner].position[0] * 0.25f;
+        EXPECT_FLOAT_EQ(static_cast<float>(i) * 2.0f, centerX);
+        EXPECT_FLOAT_EQ(0.5f, vertices[i * 4].position[1]);
+    }
+
+    const auto stats = Renderer2D::GetStats();
+    EXPECT_EQ(1u, stats.DrawCalls);
+    EXPECT_EQ(3u, stats.QuadCount);
+}
+
+TEST_F(Renderer2DTest, Frames_AlternateVertexBuffers)
+{
+    RHICommandBufferHandle cmds[2];
+    for (auto& cmd : cmds)
+    {
+        cmd = renderer.BeginFrame();
+        renderer.BeginScene();
+        Renderer2D::DrawQuad(QuadSpec());
+        Renderer2D::EndScene();
+        renderer.EndFrame();
+    }
+
+    // Each frame in flight draws from its own buffer, so the GPU never reads
+    // vertices the CPU is rewriting
+    uint64_t bound[2] = {};
+    for (int i = 0; i < 2; i++)
+    {
+        for (const auto& command : NullDevice::Get().GetCommands(cmds[i]))
+        {
+            if (command.type == NullCommandType::BindVertexBuffer)
+                bound[i] = command.resource;
+        }
+    }
+    EXPECT_NE(0u, bound[0]);
+    EXPECT_NE(bound[0], bound[1]);
+}
+
+// =============================================================================
+// Parallel submission
+// =============================================================================
+
+class Renderer2DParallelTest : public Renderer2DTest
+{
+protected:
+    void SetUp() override
+    {
+        if (!TaskGraph::Get().IsInitialized())
+            TaskGraph::Get().Init(2);
+    }
+};
+
+TEST_F(Renderer2DParallelTest, MergedContexts_MatchSerialSubmission)
+{
+    const std::vector<QuadSpec> specs = MakeDistinctQuads(5000);
+    const std::vector<size_t> sliceEnds = { 700, 700, 3100, 3101, 5000 };  // Includes an empty context
+    const QuadSpec before = QuadSpec().SetPosition(-3.0f, -3.0f).SetColor(1.0f, 0.0f, 0.0f);
+    const QuadSpec after = QuadSpec().SetPosition(3.0f, 3.0f).SetColor(0.0f, 0.0f, 1.0f);
+
+    const RecordedScene serial = RecordScene(renderer, [&]()
+    {
+        Renderer2D::DrawQuad(before);
+        Renderer2D::DrawQuads(specs.data(), specs.size());
+        Renderer2D::DrawQuad(after);
+    });
+    ASSERT_EQ(5002u, serial.quadCount);
+
+    // Twice, so the second frame reuses the arenas the first one grew
+    for (int frame = 0; frame < 2; frame++)
+    {
+        const RecordedScene parallel = RecordScene(renderer, [&]()
+        {
+            Renderer2D::DrawQuad(before);
+            SubmitInParallel(specs, sliceEnds);
+            Renderer2D::DrawQuad(after);
+        });
+
+        EXPECT_EQ(serial.quadCount, parallel.quadCount);
+        EXPECT_EQ(serial.draws, parallel.draws);
+        EXPECT_TRUE(SameVertices(serial.vertices, parallel.vertices)) << "frame " << frame;
+    }
+}
+
+TEST_F(Renderer2DParallelTest, MergedContexts_OverflowingTheBufferKeepLeadingQuads)
+{
+    // The contexts hold more quads than this frame's vertex buffer has room
+    // for; like serial submission, the merge keeps the leading quads in one
+    // batch and asks for growth
+    const uint32_t capacity = Renderer2D::GetStats().MaxQuadCapacity;
+    ASSERT_GT(capacity, 0u);
+    const std::vector<QuadSpec> specs = MakeDistinctQuads(capacity + 50);
+    const std::vector<size_t> sliceEnds = { capacity - 20, capacity + 10, capacity + 50 };
+
+    const RecordedScene overflowing = RecordScene(renderer, [&]()
+    {
+        SubmitInParallel(specs, sliceEnds);
+    });
+    ASSERT_EQ(capacity, overflowing.quadCount);
+
+    // Untextured specs all sample the white texture
+    std::vector<QuadVertex> expected(specs.size() * 4);
+    GenerateQuadVertices(specs.data(), specs.size(), overflowing.vertices[0].texIndex, expected.data());
+    ASSERT_EQ(1u, overflowing.draws.size());
+    EXPECT_EQ(capacity * 6, overflowing.draws[0].first);
+    EXPECT_TRUE(SameVertices(std::vector<QuadVertex>(expected.begin(), expected.begin() + capacity * 4),
+                             overflowing.vertices));
+
+    // The next frame has grown and takes everything in one batch
+    const RecordedScene grown = RecordScene(renderer, [&]()
+    {
+        SubmitInParallel(specs, sliceEnds);
+    });
+    EXPECT_EQ(capacity + 50, grown.quadCount);
+    ASSERT_EQ(1u, grown.draws.size());
+    EXPECT_EQ((capacity + 50) * 6, grown.draws[0].first);
+    EXPECT_TRUE(SameVertices(expected, grown.vertices));
+}
+
+// =============================================================================
+// Lifetime
+// =============================================================================
+
+TEST_F(Renderer2DTest, Reinit_StartsFromEmptyBuffers)
+{
+    std::vector<QuadSpec> specs(1000);
+    for (int round = 0; round < 2; round++)
+    {
+        RHICommandBufferHandle cmd = renderer.BeginFrame();
+        Renderer2D::ResetStats();
+        renderer.BeginScene();
+        Renderer2D::DrawQuads(specs.data(), specs.size());
+        Renderer2D::EndScene();
+        renderer.EndFrame();
+
+        EXPECT_EQ(1000u, Renderer2D::GetStats().QuadCount);
+        for (const auto& command : NullDevice::Get().GetCommands(cmd))
+        {
+            if (command.type == NullCommandType::DrawIndexed)
+                EXPECT_EQ(0, command.vertexOffset);
+        }
+
+        // Come back to the same frame index, so nothing from the old
+        // session's frame may carry over
+        renderer.BeginFrame();
+        renderer.EndFrame();
+        Renderer2D::Shutdown();
+        Renderer2D::Init();
+    }
+}
+
+TEST_F(Renderer2DTest, QuadMesh_FreesBuffersOnceFramesInFlightAreDone)
+{
+    auto drawFrame = [&](QuadMesh* mesh)
+    {
+        renderer.BeginFrame();
+        renderer.BeginScene();
+        if (mesh)
+            Renderer2D::DrawMesh(*mesh);
+        Renderer2D::EndScene();
+        renderer.EndFrame();
+    };
+
+    auto mesh = CreateScope<QuadMesh>();
+    for (int i = 0; i < 10; i++)
+        mesh->AddQuad(QuadSpec());
+    ASSERT_TRUE(mesh->Upload());
+
+    // Let the upload and its staging settle
+    for (int i = 0; i < 4; i++)
+        drawFrame(mesh.get());
+    const size_t live = renderer.GetLiveResources();
+
+    // Growth retires the old buffer; it is freed when this frame index comes around again
+    for (uint32_t i = 0; i < 300; i++)
+        mesh->AddQuad(QuadSpec());
+    ASSERT_TRUE(mesh->Upload());
+    drawFrame(mesh.get());          // Queued upload flushes
+    drawFrame(mesh.get());          // Old buffer retired
+    for (int i = 0; i < 4; i++)
+        drawFrame(mesh.get());
+    EXPECT_EQ(live, renderer.GetLiveResources());
+
+    // A destroyed mesh's buffer outlives the frames that may still draw it
+    renderer.BeginFrame();
+    renderer.BeginScene();
+    Renderer2D::DrawMesh(*mesh);
+    mesh.reset();
+    Renderer2D::EndScene();
+    renderer.EndFrame();
+    EXPECT_EQ(live, renderer.GetLiveResources());
+
+    drawFrame(nullptr);
+    EXPECT_EQ(live, renderer.GetLiveResources());
+    drawFrame(nullptr);
+    EXPECT_EQ(live - 1, renderer.GetLiveResources());
+}
+
+TEST_F(Renderer2DTest, Shutdown_ReleasesAllResources)
+{
+    renderer.BeginFrame();
+    renderer.BeginScene();
+    Renderer2D::DrawQuad(QuadSpec());
+    Renderer2D::EndScene();
+    renderer.EndFrame();
+
+    EXPECT_GT(renderer.GetLiveResources(), 0u);
+    renderer.ShutdownRenderer();
+    EXPECT_EQ(0u, renderer.GetLiveResources());
+}
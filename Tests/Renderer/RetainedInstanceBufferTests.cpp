@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Renderer/RetainedInstanceBuffer.h"
+
+#include <vector>
+
+using namespace GGEngine;
+
+namespace {
+
+    QuadInstanceData MakeInstance(float x)
+    {
+        QuadInstanceData instance{};
+        instance.SetTransform(x, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f);
+        return instance;
+    }
+
+    std::vector<RetainedInstanceBuffer::DirtyRange> TakeRanges(RetainedInstanceBuffer& buffer)
+    {
+        return buffer.TakeDirtyRanges();
+    }
+
+}
+
+class RetainedInstanceBufferTest : public ::testing::Test
+{
+protected:
+    RetainedInstanceBuffer buffer;
+};
+
+// =============================================================================
+// Slots
+// =============================================================================
+
+TEST_F(RetainedInstanceBufferTest, Set_AssignsStableSlots)
+{
+    buffer.Set(RetainedInstanceBuffer::MakeKey(7, 0), MakeInstance(7.0f));
+    buffer.Set(RetainedInstanceBuffer::MakeKey(3, 0), MakeInstance(3.0f));
+    buffer.Set(RetainedInstanceBuffer::MakeKey(7, 0), MakeInstance(8.0f));
+
+    ASSERT_EQ(2u, buffer.Size());
+    EXPECT_EQ(0u, buffer.FindSlot(RetainedInstanceBuffer::MakeKey(7, 0)));
+    EXPECT_EQ(1u, buffer.FindSlot(RetainedInstanceBuffer::MakeKey(3, 0)));
+    EXPECT_FLOAT_EQ(8.0f, buffer.Data()[0].Position[0]);
+    EXPECT_FALSE(buffer.Contains(RetainedInstanceBuffer::MakeKey(5, 0)));
+}
+
+TEST_F(RetainedInstanceBufferTest, Set_NewGenerationTakesOverSlot)
+{
+    buffer.Set(RetainedInstanceBuffer::MakeKey(4, 0), MakeInstance(1.0f));
+    buffer.Set(RetainedInstanceBuffer::MakeKey(4, 1), MakeInstance(2.0f));
+
+    EXPECT_EQ(1u, buffer.Size());
+    EXPECT_FALSE(buffer.Contains(RetainedInstanceBuffer::MakeKey(4, 0)));
+    EXPECT_EQ(0u, buffer.FindSlot(RetainedInstanceBuffer::MakeKey(4, 1)));
+    EXPECT_FLOAT_EQ(2.0f, buffer.Data()[0].Position[0]);
+}
+
+TEST_F(RetainedInstanceBufferTest, Remove_CompactsWithLastSlot)
+{
+    for (uint32_t i = 0; i < 4; i++)
+        buffer.Set(RetainedInstanceBuffer::MakeKey(i, 0), MakeInstance(static_cast<float>(i)));
+    TakeRanges(buffer);
+
+    EXPECT_TRUE(buffer.Remove(RetainedInstanceBuffer::MakeKey(1, 0)));
+    EXPECT_FALSE(buffer.Remove(RetainedInstanceBuffer::MakeKey(1, 0)));
+
+    ASSERT_EQ(3u, buffer.Size());
+    EXPECT_EQ(1u, buffer.FindSlot(RetainedInstanceBuffer::MakeKey(3, 0)));
+    EXPECT_FLOAT_EQ(3.0f, buffer.Data()[1].Position[0]);
+
+    // Only the filled hole needs uploading
+    auto ranges = TakeRanges(buffer);
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(1u, ranges[0].First);
+    EXPECT_EQ(1u, ranges[0].Count);
+}
+
+TEST_F(RetainedInstanceBufferTest, RemoveUnless_DropsRejectedKeys)
+{
+    for (uint32_t i = 0; i < 10; i++)
+        buffer.Set(RetainedInstanceBuffer::MakeKey(i, 0), MakeInstance(static_cast<float>(i)));
+
+    buffer.RemoveUnless([](uint64_t key) { return (key & 1) == 0; });
+
+    ASSERT_EQ(5u, buffer.Size());
+    for (uint32_t i = 0; i < 10; i++)
+        EXPECT_EQ(i % 2 == 0, buffer.Contains(RetainedInstanceBuffer::MakeKey(i, 0))) << i;
+    for (uint32_t slot = 0; slot < buffer.Size(); slot++)
+        EXPECT_FLOAT_EQ(static_cast<float>(buffer.GetKey(slot)), buffer.Data()[slot].Position[0]);
+}
+
+// =============================================================================
+// Dirty Ranges
+// =============================================================================
+
+TEST_F(RetainedInstanceBufferTest, DirtyRanges_OnlyCoverWrittenSlots)
+{
+    for (uint32_t i = 0; i < 1000; i++)
+        buffer.Set(RetainedInstanceBuffer::MakeKey(i, 0), MakeInstance(0.0f));
+
+    auto initial = TakeRanges(buffer);
+    ASSERT_EQ(1u, initial.size());
+    EXPECT_EQ(0u, initial[0].First);
+    EXPECT_EQ(1000u, initial[0].Count);
+
+    // Nothing written since
+    EXPECT_FALSE(buffer.HasDirtySlots());
+    EXPECT_TRUE(TakeRanges(buffer).empty());
+
+    buffer.Edit(RetainedInstanceBuffer::MakeKey(900, 0))->Position[1] = 1.0f;
+    buffer.Set(RetainedInstanceBuffer::MakeKey(100, 0), MakeInstance(1.0f));
+    buffer.Set(RetainedInstanceBuffer::MakeKey(100, 0), MakeInstance(2.0f));
+    EXPECT_EQ(2u, buffer.GetDirtySlotCount());
+
+    auto ranges = TakeRanges(buffer);
+    ASSERT_EQ(2u, ranges.size());
+    EXPECT_EQ(100u, ranges[0].First);
+    EXPECT_EQ(1u, ranges[0].Count);
+    EXPECT_EQ(900u, ranges[1].First);
+    EXPECT_EQ(1u, ranges[1].Count);
+}
+
+TEST_F(RetainedInstanceBufferTest, DirtyRanges_MergeNearbySlots)
+{
+    for (uint32_t i = 0; i < 200; i++)
+        buffer.Set(RetainedInstanceBuffer::MakeKey(i, 0), MakeInstance(0.0f));
+    TakeRanges(buffer);
+
+    buffer.Edit(RetainedInstanceBuffer::MakeKey(10, 0));
+    buffer.Edit(RetainedInstanceBuffer::MakeKey(10 + RetainedInstanceBuffer::MergeGap, 0));
+    buffer.Edit(RetainedInstanceBuffer::MakeKey(150, 0));
+
+    auto ranges = TakeRanges(buffer);
+    ASSERT_EQ(2u, ranges.size());
+    EXPECT_EQ(10u, ranges[0].First);
+    EXPECT_EQ(RetainedInstanceBuffer::MergeGap + 1, ranges[0].Count);
+    EXPECT_EQ(150u, ranges[1].First);
+}
+
+TEST_F(RetainedInstanceBufferTest, DirtyRanges_CollapseWhenScattered)
+{
+    const uint32_t stride = RetainedInstanceBuffer::MergeGap * 2;
+    const uint32_t count = static_cast<uint32_t>(RetainedInstanceBuffer::MaxUploadRanges + 2) * stride;
+    for (uint32_t i = 0; i < count; i++)
+        buffer.Set(RetainedInstanceBuffer::MakeKey(i, 0), MakeInstance(0.0f));
+    TakeRanges(buffer);
+
+    for (uint32_t i = stride; i < count; i += stride)
+        buffer.Edit(RetainedInstanceBuffer::MakeKey(i, 0));
+
+    auto ranges = TakeRanges(buffer);
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(stride, ranges[0].First);
+    EXPECT_EQ(count - 2 * stride + 1, ranges[0].Count);
+}
+
+TEST_F(RetainedInstanceBufferTest, DirtyRanges_IgnoreRemovedTail)
+{
+    for (uint32_t i = 0; i < 8; i++)
+        buffer.Set(RetainedInstanceBuffer::MakeKey(i, 0), MakeInstance(0.0f));
+
+    // Slots 6 and 7 were dirty but no longer exist
+    buffer.Remove(RetainedInstanceBuffer::MakeKey(7, 0));
+    buffer.Remove(RetainedInstanceBuffer::MakeKey(6, 0));
+
+    auto ranges = TakeRanges(buffer);
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(0u, ranges[0].First);
+    EXPECT_EQ(6u, ranges[0].Count);
+
+    // A popped slot reallocated in the same frame is listed once
+    buffer.Remove(RetainedInstanceBuffer::MakeKey(5, 0));
+    buffer.Set(RetainedInstanceBuffer::MakeKey(9, 0), MakeInstance(0.0f));
+    ranges = TakeRanges(buffer);
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(5u, ranges[0].First);
+    EXPECT_EQ(1u, ranges[0].Count);
+}
+
+TEST_F(RetainedInstanceBufferTest, MarkAllDirty_CoversEverySlot)
+{
+    for (uint32_t i = 0; i < 50; i++)
+        buffer.Set(RetainedInstanceBuffer::MakeKey(i, 0), MakeInstance(0.0f));
+    TakeRanges(buffer);
+
+    buffer.MarkAllDirty();
+    auto ranges = TakeRanges(buffer);
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(0u, ranges[0].First);
+    EXPECT_EQ(50u, ranges[0].Count);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "NullRendererConfig.h"
+#include "GGEngine/ECS/Scene.h"
+#include "GGEngine/ECS/Components/TransformComponent.h"
+#include "GGEngine/ECS/Components/SpriteRendererComponent.h"
+#include "GGEngine/ECS/Systems/SpriteRenderSystem.h"
+#include "GGEngine/Renderer/QuadGeometry.h"
+#include "GGEngine/Core/TaskGraph.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+namespace {
+
+    // What one SpriteRenderSystem frame recorded
+    struct RenderedFrame
+    {
+        Renderer2D::Statistics stats;
+        std::vector<QuadVertex> vertices;
+    };
+
+    // Three sprites in view, one far outside it
+    void PopulateScene(Scene& scene)
+    {
+        const float positions[][2] = { { -2.0f, 0.0f }, { 0.0f, 1.0f }, { 2.0f, -1.0f }, { 100.0f, 0.0f } };
+        for (size_t i = 0; i < 4; i++)
+        {
+            EntityID entity = scene.CreateEntity("Sprite");
+            TransformComponent* transform = scene.GetComponent<TransformComponent>(entity);
+            transform->Position[0] = positions[i][0];
+            transform->Position[1] = positions[i][1];
+
+            SpriteRendererComponent sprite;
+            sprite.Color[0] = static_cast<float>(i) * 0.25f;
+            scene.AddComponent<SpriteRendererComponent>(entity, sprite);
+        }
+    }
+
+    RenderedFrame RenderFrame(NullRendererScope& renderer, SpriteRenderSystem& system, Scene& scene)
+    {
+        auto& device = RHIDevice::Get();
+        SceneCamera camera;
+        camera.SetOrthographic(10.0f, -1.0f, 1.0f);
+        const glm::mat4 cameraTransform(1.0f);
+
+        RenderContext context;
+        context.CommandBuffer = renderer.BeginFrame();
+        context.RenderPass = device.GetSwapchainRenderPass();
+        context.ViewportWidth = device.GetSwapchainWidth();
+        context.ViewportHeight = device.GetSwapchainHeight();
+        context.RuntimeCamera = &camera;
+        context.CameraTransform = &cameraTransform;
+        camera.SetViewportSize(context.ViewportWidth, context.ViewportHeight);
+
+        system.SetRenderContext(context);
+        system.Execute(scene, 0.0f);
+        renderer.EndFrame();
+
+        RenderedFrame frame;
+        frame.stats = Renderer2D::GetStats();
+
+        uint64_t vertexBuffer = 0;
+        for (const auto& command : NullDevice::Get().GetCommands(context.CommandBuffer))
+        {
+            if (command.type == NullCommandType::BindVertexBuffer)
+                vertexBuffer = command.resource;
+        }
+        const std::vector<uint8_t> bytes = NullDevice::Get().ReadBuffer(RHIBufferHandle{ vertexBuffer });
+        frame.vertices.resize(static_cast<size_t>(frame.stats.QuadCount) * 4);
+        if (bytes.size() >= frame.vertices.size() * sizeof(QuadVertex))
+            std::memcpy(frame.vertices.data(), bytes.data(), frame.vertices.size() * sizeof(QuadVertex));
+        return frame;
+    }
+
+}
+
+class SpriteRenderSystemTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!TaskGraph::Get().IsInitialized())
+            TaskGraph::Get().Init(2);
+    }
+
+    NullRendererScope renderer;
+};
+
+// =============================================================================
+// Storage modes
+// =============================================================================
+
+TEST_F(SpriteRenderSystemTest, Batched_ArchetypeSceneDrawsLikeSparseSetScene)
+{
+    Scene sparse("SparseSprites", SceneStorageMode::SparseSet);
+    PopulateScene(sparse);
+    SpriteRenderSystem sparseSystem;
+    sparseSystem.OnRegister(sparse);
+    const RenderedFrame expected = RenderFrame(renderer, sparseSystem, sparse);
+
+    Scene archetype("ArchetypeSprites", SceneStorageMode::Archetype);
+    PopulateScene(archetype);
+    SpriteRenderSystem archetypeSystem;
+    archetypeSystem.OnRegister(archetype);
+    const RenderedFrame actual = RenderFrame(renderer, archetypeSystem, archetype);
+
+    EXPECT_EQ(3u, expected.stats.QuadCount);
+    EXPECT_EQ(1u, expected.stats.CulledCount);
+
+    // Archetype sprites are read from their chunks, not an empty sparse storage
+    EXPECT_EQ(expected.stats.QuadCount, actual.stats.QuadCount);
+    EXPECT_EQ(expected.stats.VisibleCount, actual.stats.VisibleCount);
+    EXPECT_EQ(expected.stats.CulledCount, actual.stats.CulledCount);
+    ASSERT_EQ(expected.vertices.size(), actual.vertices.size());
+    EXPECT_EQ(0, std::memcmp(expected.vertices.data(), actual.vertices.data(),
+                             expected.vertices.size() * sizeof(QuadVertex)));
+}
@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Asset/TextureContainer.h"
+#include "GGEngine/Utils/MappedFile.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace GGEngine;
+
+namespace {
+
+    // An uncompressed 32-bit TGA, which stb_image decodes like any source image
+    std::vector<uint8_t> MakeTGA(uint16_t width, uint16_t height, uint8_t seed)
+    {
+        std::vector<uint8_t> file(18 + static_cast<size_t>(width) * height * 4);
+        file[2] = 2;                        // Uncompressed true color
+        std::memcpy(&file[12], &width, 2);
+        std::memcpy(&file[14], &height, 2);
+        file[16] = 32;
+        file[17] = 8;                       // 8 alpha bits
+        for (size_t i = 18; i < file.size(); i++)
+            file[i] = static_cast<uint8_t>(seed + i * 13);
+        return file;
+    }
+
+    void WriteFile(const std::filesystem::path& path, const std::vector<uint8_t>& bytes)
+    {
+        std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(bytes.data()),
+                                                    static_cast<std::streamsize>(bytes.size()));
+    }
+
+    std::vector<uint8_t> ChainBytes(const TextureCPUData& data)
+    {
+        const uint8_t* pixels = data.GetPixels();
+        return std::vector<uint8_t>(pixels, pixels + GetMipChainSize(data.mips));
+    }
+
+}
+
+class TextureContainerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_Dir = std::filesystem::temp_directory_path() / "ggengine_texture_container";
+        std::filesystem::remove_all(m_Dir);
+        std::filesystem::create_directories(m_Dir);
+    }
+
+    void TearDown() override
+    {
+        std::error_code error;
+        std::filesystem::remove_all(m_Dir, error);
+    }
+
+    // Decoded the way an uncooked texture loads
+    TextureCPUData Decode(const std::vector<uint8_t>& encoded)
+    {
+        auto decoded = Texture::DecodeCPU(encoded.data(), encoded.size(), "test.tga");
+        EXPECT_TRUE(decoded.IsOk());
+        return std::move(decoded).Value();
+    }
+
+    std::filesystem::path m_Dir;
+};
+
+// =============================================================================
+// Container file
+// =============================================================================
+
+TEST_F(TextureContainerTest, WriteRead_RoundTripsTheChainWithoutCopying)
+{
+    const TextureCPUData source = Decode(MakeTGA(13, 6, 1));
+    const auto path = m_Dir / "round_trip.ggtex";
+    ASSERT_TRUE(WriteTextureContainer(path, source, 42).IsOk());
+
+    auto read = ReadTextureContainer(path);
+    ASSERT_TRUE(read.IsOk()) << read.Error();
+    const TextureCPUData& data = read.Value();
+
+    EXPECT_EQ(13u, data.width);
+    EXPECT_EQ(6u, data.height);
+    EXPECT_EQ(TextureFormat::R8G8B8A8_UNORM, data.format);
+    ASSERT_EQ(source.mips.size(), data.mips.size());
+    for (size_t i = 0; i < source.mips.size(); i++)
+    {
+        EXPECT_EQ(source.mips[i].width, data.mips[i].width);
+        EXPECT_EQ(source.mips[i].offset, data.mips[i].offset);
+        EXPECT_EQ(source.mips[i].size, data.mips[i].size);
+    }
+    EXPECT_EQ(ChainBytes(source), ChainBytes(data));
+
+    // Level 0 is read straight out of the mapping, aligned for the copy to staging
+    EXPECT_TRUE(data.pixels.empty());
+    ASSERT_TRUE(data.file && data.file->IsOpen());
+    EXPECT_GE(data.GetPixels(), data.file->GetData() + sizeof(TextureContainerHeader));
+    EXPECT_LT(data.GetPixels(), data.file->GetData() + data.file->GetSize());
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(data.GetPixels()) % TextureContainerAlignment);
+
+    auto header = ReadTextureContainerHeader(path);
+    ASSERT_TRUE(header.IsOk());
+    EXPECT_EQ(42u, header.Value().contentHash);
+}
+
+TEST_F(TextureContainerTest, Write_FailureLeavesNoTemporaryFile)
+{
+    // A non-empty directory in the way makes the final rename fail
+    const auto path = m_Dir / "blocked.ggtex";
+    std::filesystem::create_directories(path / "occupied");
+
+    EXPECT_TRUE(WriteTextureContainer(path, Decode(MakeTGA(4, 4, 2)), 7).IsErr());
+
+    auto temporary = path;
+    temporary += ".tmp";
+    EXPECT_FALSE(std::filesystem::exists(temporary));
+    EXPECT_TRUE(std::filesystem::is_directory(path / "occupied"));
+}
+
+TEST_F(TextureContainerTest, Read_RejectsCorruptFiles)
+{
+    const auto path = m_Dir / "corrupt.ggtex";
+    ASSERT_TRUE(WriteTextureContainer(path, Decode(MakeTGA(8, 8, 2)), 0).IsOk());
+
+    std::vector<uint8_t> bytes(std::filesystem::file_size(path));
+    std::ifstream(path, std::ios::binary).read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+
+    // Truncated payload
+    WriteFile(path, std::vector<uint8_t>(bytes.begin(), bytes.end() - 1));
+    EXPECT_TRUE(ReadTextureContainer(path).IsErr());
+
+    // Truncated header
+    WriteFile(path, std::vector<uint8_t>(bytes.begin(), bytes.begin() + 20));
+    EXPECT_TRUE(ReadTextureContainer(path).IsErr());
+    EXPECT_TRUE(ReadTextureContainerHeader(path).IsErr());
+
+    // Not a container
+    std::vector<uint8_t> badMagic = bytes;
+    badMagic[0] ^= 0xFF;
+    WriteFile(path, badMagic);
+    EXPECT_TRUE(ReadTextureContainer(path).IsErr());
+
+    // Mip table pointing past the payload (level 1's offset)
+    std::vector<uint8_t> badTable = bytes;
+    badTable[sizeof(TextureContainerHeader) + sizeof(TextureMipLevel) + 8] = 0xFF;
+    WriteFile(path, badTable);
+    EXPECT_TRUE(ReadTextureContainer(path).IsErr());
+
+    // Block-compressed level sizes can't be checked yet
+    std::vector<uint8_t> compressed = bytes;
+    const uint32_t bc1 = static_cast<uint32_t>(TextureFormat::BC1_RGBA_UNORM);
+    std::memcpy(&compressed[offsetof(TextureContainerHeader, format)], &bc1, sizeof(bc1));
+    WriteFile(path, compressed);
+    EXPECT_TRUE(ReadTextureContainerHeader(path).IsOk());
+    EXPECT_TRUE(ReadTextureContainer(path).IsErr());
+
+    WriteFile(path, bytes);
+    EXPECT_TRUE(ReadTextureContainer(path).IsOk());
+}
+
+// =============================================================================
+// Cooking and loading
+// =============================================================================
+
+TEST_F(TextureContainerTest, Cook_SkipsUnchangedSources)
+{
+    const auto source = m_Dir / "sprite.tga";
+    const auto cooked = GetCookedTexturePath(source);
+    EXPECT_EQ("sprite.tga.ggtex", cooked.filename().string());
+    WriteFile(source, MakeTGA(16, 4, 3));
+
+    auto first = CookTexture(source, cooked);
+    ASSERT_TRUE(first.IsOk()) << first.Error();
+    EXPECT_TRUE(first.Value());
+
+    // An unchanged cook leaves the container alone, timestamp included
+    const auto cookedTime = std::filesystem::last_write_time(cooked) - std::chrono::seconds(10);
+    std::filesystem::last_write_time(cooked, cookedTime);
+    auto again = CookTexture(source, cooked);
+    ASSERT_TRUE(again.IsOk());
+    EXPECT_FALSE(again.Value());
+    EXPECT_EQ(cookedTime, std::filesystem::last_write_time(cooked));
+    EXPECT_TRUE(CookTexture(source, cooked, true).Value());
+
+    // New bytes cook again
+    WriteFile(source, MakeTGA(16, 4, 4));
+    EXPECT_TRUE(CookTexture(source, cooked).Value());
+
+    auto read = ReadTextureContainer(cooked);
+    ASSERT_TRUE(read.IsOk());
+    EXPECT_EQ(ChainBytes(Decode(MakeTGA(16, 4, 4))), ChainBytes(read.Value()));
+
+    EXPECT_TRUE(CookTexture(m_Dir / "missing.tga", m_Dir / "missing.tga.ggtex").IsErr());
+}
+
+TEST_F(TextureContainerTest, LoadCPU_PrefersUpToDateCookedContainer)
+{
+    const auto source = m_Dir / "tile.tga";
+    const std::vector<uint8_t> encoded = MakeTGA(10, 10, 5);
+    WriteFile(source, encoded);
+
+    // Uncooked: decoded with stb_image
+    auto decoded = Texture::LoadCPU(source.string());
+    ASSERT_TRUE(decoded.IsOk()) << decoded.Error();
+    EXPECT_EQ(nullptr, decoded.Value().mappedPixels);
+
+    ASSERT_TRUE(CookTexture(source, GetCookedTexturePath(source)).IsOk());
+    auto mapped = Texture::LoadCPU(source.string());
+    ASSERT_TRUE(mapped.IsOk());
+    EXPECT_NE(nullptr, mapped.Value().mappedPixels);
+    EXPECT_EQ(source.string(), mapped.Value().sourcePath);
+    EXPECT_EQ(ChainBytes(decoded.Value()), ChainBytes(mapped.Value()));
+
+    // The container itself loads directly
+    auto direct = Texture::LoadCPU(GetCookedTexturePath(source).string());
+    ASSERT_TRUE(direct.IsOk());
+    EXPECT_NE(nullptr, direct.Value().mappedPixels);
+
+    // A source edited after cooking wins over its stale container
+    std::filesystem::last_write_time(source, std::filesystem::last_write_time(GetCookedTexturePath(source)) +
+                                             std::chrono::seconds(10));
+    auto stale = Texture::LoadCPU(source.string());
+    ASSERT_TRUE(stale.IsOk());
+    EXPECT_EQ(nullptr, stale.Value().mappedPixels);
+
+    // A container that fails to read falls back to the source
+    WriteFile(GetCookedTexturePath(source), { 1, 2, 3 });
+    std::filesystem::last_write_time(GetCookedTexturePath(source), std::filesystem::last_write_time(source) +
+                                                                   std::chrono::seconds(10));
+    auto fallback = Texture::LoadCPU(source.string());
+    ASSERT_TRUE(fallback.IsOk());
+    EXPECT_EQ(nullptr, fallback.Value().mappedPixels);
+}
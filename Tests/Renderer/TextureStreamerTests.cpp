@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+#include "NullRendererConfig.h"
+#include "GGEngine/Asset/Texture.h"
+#include "GGEngine/Asset/TextureContainer.h"
+#include "GGEngine/Renderer/TextureStreamer.h"
+
+#include <filesystem>
+#include <vector>
+
+using namespace GGEngine;
+using namespace GGEngine::Testing;
+
+namespace {
+
+    constexpr uint32_t TextureSize = 256;   // Levels 256..1; level 2 (64) is the tail
+    constexpr uint32_t TailMip = 2;
+
+    // A TextureCPUData as Texture::LoadCPU would produce, with every pixel of
+    // level 0 set to seed so levels can be told apart between textures
+    TextureCPUData MakeCPUData(uint8_t seed)
+    {
+        TextureCPUData data;
+        data.width = TextureSize;
+        data.height = TextureSize;
+        data.sourcePath = "streamed_" + std::to_string(seed);
+        data.pixels.resize(static_cast<size_t>(TextureSize) * TextureSize * 4);
+        for (size_t i = 0; i < data.pixels.size(); i++)
+            data.pixels[i] = static_cast<uint8_t>(seed + (i / 4 % TextureSize));
+        data.mips = GenerateMipChain(data.pixels, data.width, data.height);
+        return data;
+    }
+
+    std::vector<uint8_t> LevelBytes(const TextureCPUData& data, uint32_t mip)
+    {
+        const TextureMipLevel& level = data.mips[mip];
+        return std::vector<uint8_t>(data.pixels.begin() + level.offset,
+                                    data.pixels.begin() + level.offset + level.size);
+    }
+
+}
+
+class TextureStreamerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        TextureStreamer::Get().Init();
+    }
+
+    void TearDown() override
+    {
+        TextureStreamer::Get().Shutdown();
+    }
+
+    // One frame the way Application::Run drives it
+    void RunFrame()
+    {
+        renderer.BeginFrame();
+        renderer.EndFrame();
+    }
+
+    NullRendererScope renderer;
+};
+
+// =============================================================================
+// Loading
+// =============================================================================
+
+TEST_F(TextureStreamerTest, UploadGPU_StartsWithTheTailResident)
+{
+    const TextureCPUData source = MakeCPUData(0);
+    Texture texture;
+    ASSERT_TRUE(texture.UploadGPU(MakeCPUData(0)).IsOk());
+
+    EXPECT_TRUE(texture.IsStreamed());
+    EXPECT_EQ(9u, texture.GetMipCount());
+    EXPECT_EQ(TailMip, texture.GetResidentMip());
+    EXPECT_EQ(TextureSize, texture.GetWidth());
+    EXPECT_EQ(64u, RHIDevice::Get().GetTextureWidth(texture.GetHandle()));
+
+    // The tail goes up with the next frame's transfers
+    RunFrame();
+    EXPECT_EQ(LevelBytes(source, TailMip), NullDevice::Get().ReadTexture(texture.GetHandle(), 0));
+    EXPECT_EQ(LevelBytes(source, 8), NullDevice::Get().ReadTexture(texture.GetHandle(), 6));
+}
+
+TEST_F(TextureStreamerTest, UploadGPU_WithoutStreamerUploadsWholeChain)
+{
+    TextureStreamer::Get().Shutdown();
+
+    const TextureCPUData source = MakeCPUData(0);
+    Texture texture;
+    ASSERT_TRUE(texture.UploadGPU(MakeCPUData(0)).IsOk());
+    EXPECT_FALSE(texture.IsStreamed());
+    EXPECT_EQ(0u, texture.GetResidentMip());
+
+    RunFrame();
+    EXPECT_EQ(LevelBytes(source, 0), NullDevice::Get().ReadTexture(texture.GetHandle(), 0));
+    EXPECT_EQ(LevelBytes(source, 3), NullDevice::Get().ReadTexture(texture.GetHandle(), 3));
+}
+
+TEST_F(TextureStreamerTest, UploadGPU_StreamsStraightFromAMappedContainer)
+{
+    const TextureCPUData source = MakeCPUData(0);
+    const auto path = std::filesystem::temp_directory_path() / "ggengine_streamed.ggtex";
+    ASSERT_TRUE(WriteTextureContainer(path, source, 0).IsOk());
+
+    Texture texture;
+    {
+        auto mapped = ReadTextureContainer(path);
+        ASSERT_TRUE(mapped.IsOk()) << mapped.Error();
+        ASSERT_TRUE(texture.UploadGPU(std::move(mapped).Value()).IsOk());
+    }
+    RunFrame();
+    EXPECT_EQ(LevelBytes(source, TailMip), NullDevice::Get().ReadTexture(texture.GetHandle(), 0));
+
+    // The mapping stays open as the stream source
+    texture.ReportUsage(1.0f);
+    RunFrame();
+    EXPECT_EQ(0u, texture.GetResidentMip());
+    EXPECT_EQ(LevelBytes(source, 0), NullDevice::Get().ReadTexture(texture.GetHandle(), 0));
+
+    texture.Unload();
+    std::filesystem::remove(path);
+}
+
+// =============================================================================
+// Streaming
+// =============================================================================
+
+TEST_F(TextureStreamerTest, ReportUsage_StreamsInUnderTheSameBindlessSlot)
+{
+    const TextureCPUData source = MakeCPUData(0);
+    Texture texture;
+    ASSERT_TRUE(texture.UploadGPU(MakeCPUData(0)).IsOk());
+    RunFrame();
+
+    const BindlessTextureIndex slot = texture.GetBindlessIndex();
+    const RHITextureHandle tail = texture.GetHandle();
+    ASSERT_NE(InvalidBindlessIndex, slot);
+
+    // 2.5 texels per pixel needs level 1; the finest report of the frame wins
+    texture.ReportUsage(6.0f);
+    texture.ReportUsage(2.5f);
+    RunFrame();
+
+    EXPECT_EQ(1u, texture.GetResidentMip());
+    EXPECT_EQ(slot, texture.GetBindlessIndex());
+    EXPECT_NE(tail, texture.GetHandle());
+    EXPECT_EQ(LevelBytes(source, 1), NullDevice::Get().ReadTexture(texture.GetHandle(), 0));
+    EXPECT_EQ(1u, TextureStreamer::Get().GetStats().StreamIns);
+
+    // Magnified draws want level 0; without reports nothing changes
+    texture.ReportUsage(0.5f);
+    RunFrame();
+    EXPECT_EQ(0u, texture.GetResidentMip());
+    RunFrame();
+    EXPECT_EQ(0u, texture.GetResidentMip());
+    EXPECT_EQ(0u, TextureStreamer::Get().GetStats().VisibleTextures);
+}
+
+TEST_F(TextureStreamerTest, ReplacedImages_OutliveFramesInFlight)
+{
+    Texture texture;
+    ASSERT_TRUE(texture.UploadGPU(MakeCPUData(0)).IsOk());
+    RunFrame();
+
+    const RHITextureHandle tail = texture.GetHandle();
+    texture.ReportUsage(1.0f);
+    RunFrame();
+
+    // The previous frame may still sample the old image
+    EXPECT_EQ(LevelBytes(MakeCPUData(0), TailMip), NullDevice::Get().ReadTexture(tail, 0));
+    RunFrame();
+    EXPECT_FALSE(NullDevice::Get().ReadTexture(tail, 0).empty());
+    RunFrame();
+    EXPECT_TRUE(NullDevice::Get().ReadTexture(tail, 0).empty());
+
+    texture.Unload();
+    TextureStreamer::Get().Shutdown();
+    renderer.ShutdownRenderer();
+    EXPECT_EQ(0u, renderer.GetLiveResources());
+}
+
+TEST_F(TextureStreamerTest, OverBudget_DropsLevelsOfTheLargestVisibleTextures)
+{
+    Texture a, b;
+    ASSERT_TRUE(a.UploadGPU(MakeCPUData(0)).IsOk());
+    ASSERT_TRUE(b.UploadGPU(MakeCPUData(100)).IsOk());
+
+    // Room for both down from level 1, not for either at level 0
+    const uint64_t fromLevel1 = GetMipChainSize(MakeCPUData(0).mips, 1);
+    TextureStreamer::Get().SetBudget(2 * fromLevel1 + 1000);
+
+    a.ReportUsage(1.0f);
+    b.ReportUsage(1.0f);
+    RunFrame();
+
+    EXPECT_EQ(1u, a.GetResidentMip());
+    EXPECT_EQ(1u, b.GetResidentMip());
+    EXPECT_EQ(2 * fromLevel1, TextureStreamer::Get().GetStats().ResidentBytes);
+    EXPECT_LE(TextureStreamer::Get().GetStats().ResidentBytes, TextureStreamer::Get().GetBudget());
+}
+
+TEST_F(TextureStreamerTest, OverBudget_EvictsUnseenTexturesFirst)
+{
+    Texture a, b;
+    ASSERT_TRUE(a.UploadGPU(MakeCPUData(0)).IsOk());
+    ASSERT_TRUE(b.UploadGPU(MakeCPUData(100)).IsOk());
+
+    a.ReportUsage(1.0f);
+    b.ReportUsage(1.0f);
+    RunFrame();
+    ASSERT_EQ(0u, a.GetResidentMip());
+    ASSERT_EQ(0u, b.GetResidentMip());
+
+    // Only b is still drawn; a gives its memory back down to the tail
+    TextureStreamer::Get().SetBudget(GetMipChainSize(MakeCPUData(0).mips, 0) + 100000);
+    b.ReportUsage(1.0f);
+    RunFrame();
+
+    EXPECT_EQ(TailMip, a.GetResidentMip());
+    EXPECT_EQ(0u, b.GetResidentMip());
+    EXPECT_EQ(1u, TextureStreamer::Get().GetStats().StreamOuts);
+}
+
+TEST_F(TextureStreamerTest, UploadLimit_SpreadsStreamInsOverFrames)
+{
+    Texture a, b;
+    ASSERT_TRUE(a.UploadGPU(MakeCPUData(0)).IsOk());
+    ASSERT_TRUE(b.UploadGPU(MakeCPUData(100)).IsOk());
+    TextureStreamer::Get().SetUploadLimit(1);
+
+    a.ReportUsage(1.0f);
+    b.ReportUsage(1.0f);
+    RunFrame();
+    EXPECT_EQ(1u, TextureStreamer::Get().GetStats().StreamIns);
+    EXPECT_EQ(1u, (a.GetResidentMip() == 0) + (b.GetResidentMip() == 0));
+
+    a.ReportUsage(1.0f);
+    b.ReportUsage(1.0f);
+    RunFrame();
+    EXPECT_EQ(0u, a.GetResidentMip());
+    EXPECT_EQ(0u, b.GetResidentMip());
+}
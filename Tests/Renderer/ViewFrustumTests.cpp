@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include "GGEngine/Renderer/ViewFrustum.h"
+#include "GGEngine/Core/Math.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
+
+using namespace GGEngine;
+
+namespace {
+
+    // 20 x 10 world units around the camera, like an orthographic SceneCamera
+    glm::mat4 OrthoViewProjection(float cameraX = 0.0f, float cameraY = 0.0f, float rotation = 0.0f)
+    {
+        glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(cameraX, cameraY, 0.0f));
+        transform = glm::rotate(transform, rotation, glm::vec3(0.0f, 0.0f, 1.0f));
+        return glm::ortho(-10.0f, 10.0f, -5.0f, 5.0f, -1.0f, 1.0f) * glm::inverse(transform);
+    }
+
+}
+
+class ViewFrustumTest : public ::testing::Test {};
+
+// =============================================================================
+// Quad Tests
+// =============================================================================
+
+TEST_F(ViewFrustumTest, Quad_InsideAndOutside)
+{
+    ViewFrustum frustum(OrthoViewProjection());
+
+    EXPECT_TRUE(frustum.IsQuadVisible(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f));
+    EXPECT_TRUE(frustum.IsQuadVisible(-9.9f, 4.9f, 0.0f, 1.0f, 1.0f, 0.0f));
+    EXPECT_FALSE(frustum.IsQuadVisible(20.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f));
+    EXPECT_FALSE(frustum.IsQuadVisible(0.0f, -7.0f, 0.0f, 1.0f, 1.0f, 0.0f));
+}
+
+TEST_F(ViewFrustumTest, Quad_StraddlingEdgeIsVisible)
+{
+    ViewFrustum frustum(OrthoViewProjection());
+
+    EXPECT_TRUE(frustum.IsQuadVisible(10.4f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f));
+    EXPECT_TRUE(frustum.IsQuadVisible(0.0f, 5.4f, 0.0f, 1.0f, 1.0f, 0.0f));
+    // Negative scale (flipped sprite) still has extent
+    EXPECT_TRUE(frustum.IsQuadVisible(10.4f, 0.0f, 0.0f, -1.0f, 1.0f, 0.0f));
+}
+
+TEST_F(ViewFrustumTest, Quad_RotationChangesExtent)
+{
+    ViewFrustum frustum(OrthoViewProjection());
+
+    // A long thin quad reaching back into view only while horizontal
+    EXPECT_TRUE(frustum.IsQuadVisible(10.6f, 0.0f, 0.0f, 2.0f, 0.1f, 0.0f));
+    EXPECT_FALSE(frustum.IsQuadVisible(10.6f, 0.0f, 0.0f, 2.0f, 0.1f, Math::HalfPi));
+}
+
+TEST_F(ViewFrustumTest, Quad_FollowsCamera)
+{
+    ViewFrustum frustum(OrthoViewProjection(100.0f, 50.0f));
+
+    EXPECT_TRUE(frustum.IsQuadVisible(100.0f, 50.0f, 0.0f, 1.0f, 1.0f, 0.0f));
+    EXPECT_FALSE(frustum.IsQuadVisible(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f));
+}
+
+TEST_F(ViewFrustumTest, Quad_OutsideDepthRange)
+{
+    ViewFrustum frustum(OrthoViewProjection());
+
+    EXPECT_FALSE(frustum.IsQuadVisible(0.0f, 0.0f, 5.0f, 1.0f, 1.0f, 0.0f));
+    EXPECT_TRUE(frustum.GetVisibleBounds(5.0f).IsEmpty());
+}
+
+TEST_F(ViewFrustumTest, Default_AcceptsEverything)
+{
+    ViewFrustum frustum;
+
+    EXPECT_TRUE(frustum.IsQuadVisible(1e6f, -1e6f, 1e3f, 1.0f, 1.0f, 0.0f));
+    EXPECT_TRUE(frustum.IsVisible(Bounds2D::Infinite(), 0.0f));
+
+    TileRect tiles = frustum.GetVisibleTiles(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 64, 32);
+    EXPECT_EQ(0u, tiles.MinX);
+    EXPECT_EQ(64u, tiles.MaxX);
+    EXPECT_EQ(0u, tiles.MinY);
+    EXPECT_EQ(32u, tiles.MaxY);
+}
+
+// =============================================================================
+// Visible Bounds Tests
+// =============================================================================
+
+TEST_F(ViewFrustumTest, VisibleBounds_Orthographic)
+{
+    Bounds2D bounds = ViewFrustum(OrthoViewProjection(3.0f, -2.0f)).GetVisibleBounds(0.0f);
+
+    EXPECT_NEAR(-7.0f, bounds.MinX, 1e-4f);
+    EXPECT_NEAR(-7.0f, bounds.MinY, 1e-4f);
+    EXPECT_NEAR(13.0f, bounds.MaxX, 1e-4f);
+    EXPECT_NEAR(3.0f, bounds.MaxY, 1e-4f);
+}
+
+TEST_F(ViewFrustumTest, VisibleBounds_RotatedCameraIsConservative)
+{
+    Bounds2D bounds = ViewFrustum(OrthoViewProjection(0.0f, 0.0f, Math::Pi / 4.0f)).GetVisibleBounds(0.0f);
+
+    // AABB of the 20 x 10 view rotated by 45 degrees
+    const float half = (10.0f + 5.0f) * std::sqrt(0.5f);
+    EXPECT_NEAR(-half, bounds.MinX, 1e-3f);
+    EXPECT_NEAR(half, bounds.MaxX, 1e-3f);
+    EXPECT_NEAR(-half, bounds.MinY, 1e-3f);
+    EXPECT_NEAR(half, bounds.MaxY, 1e-3f);
+}
+
+TEST_F(ViewFrustumTest, VisibleBounds_Perspective)
+{
+    // Looking down -z from z = 10 with a 90 degree vertical FOV: at z = 0 the
+    // view is 20 units tall and 40 wide
+    glm::mat4 view = glm::inverse(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, 10.0f)));
+    ViewFrustum frustum(glm::perspective(Math::HalfPi, 2.0f, 0.1f, 100.0f) * view);
+
+    Bounds2D bounds = frustum.GetVisibleBounds(0.0f);
+    EXPECT_NEAR(-20.0f, bounds.MinX, 1e-3f);
+    EXPECT_NEAR(20.0f, bounds.MaxX, 1e-3f);
+    EXPECT_NEAR(-10.0f, bounds.MinY, 1e-3f);
+    EXPECT_NEAR(10.0f, bounds.MaxY, 1e-3f);
+
+    EXPECT_TRUE(frustum.IsQuadVisible(19.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f));
+    EXPECT_FALSE(frustum.IsQuadVisible(22.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f));
+    // Behind the camera
+    EXPECT_FALSE(frustum.IsQuadVisible(0.0f, 0.0f, 20.0f, 1.0f, 1.0f, 0.0f));
+}
+
+TEST_F(ViewFrustumTest, DepthIndependentBounds_OnlyForTopDownViews)
+{
+    Bounds2D bounds;
+    ASSERT_TRUE(ViewFrustum(OrthoViewProjection(3.0f, -2.0f)).GetDepthIndependentBounds(bounds));
+    EXPECT_NEAR(-7.0f, bounds.MinX, 1e-4f);
+    EXPECT_NEAR(3.0f, bounds.MaxY, 1e-4f);
+
+    glm::mat4 view = glm::inverse(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, 10.0f)));
+    EXPECT_FALSE(ViewFrustum(glm::perspective(Math::HalfPi, 2.0f, 0.1f, 100.0f) * view).GetDepthIndependentBounds(bounds));
+}
+
+// =============================================================================
+// Tile Rectangle Tests
+// =============================================================================
+
+TEST_F(ViewFrustumTest, Tiles_ClippedToView)
+{
+    ViewFrustum frustum(OrthoViewProjection());
+
+    // 100 x 100 grid of unit tiles, offset so no tile edge lies on the view edge
+    TileRect tiles = frustum.GetVisibleTiles(-50.5f, -50.5f, 0.0f, 1.0f, 1.0f, 100, 100);
+    EXPECT_EQ(40u, tiles.MinX);
+    EXPECT_EQ(61u, tiles.MaxX);
+    EXPECT_EQ(45u, tiles.MinY);
+    EXPECT_EQ(56u, tiles.MaxY);
+    EXPECT_EQ(21u * 11u, tiles.GetCount());
+}
+
+TEST_F(ViewFrustumTest, Tiles_ClampedToGrid)
+{
+    ViewFrustum frustum(OrthoViewProjection());
+
+    // Grid starts inside the view and extends past its right edge
+    TileRect tiles = frustum.GetVisibleTiles(0.5f, -2.0f, 0.0f, 2.0f, 2.0f, 100, 2);
+    EXPECT_EQ(0u, tiles.MinX);
+    EXPECT_EQ(5u, tiles.MaxX);
+    EXPECT_EQ(0u, tiles.MinY);
+    EXPECT_EQ(2u, tiles.MaxY);
+}
+
+TEST_F(ViewFrustumTest, Tiles_OffscreenIsEmpty)
+{
+    ViewFrustum frustum(OrthoViewProjection());
+
+    EXPECT_TRUE(frustum.GetVisibleTiles(100.0f, 100.0f, 0.0f, 1.0f, 1.0f, 50, 50).IsEmpty());
+    EXPECT_TRUE(frustum.GetVisibleTiles(-200.0f, 0.0f, 0.0f, 1.0f, 1.0f, 50, 50).IsEmpty());
+    EXPECT_EQ(0u, frustum.GetVisibleTiles(0.0f, 0.0f, 5.0f, 1.0f, 1.0f, 50, 50).GetCount());
+}
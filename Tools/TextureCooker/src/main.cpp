@@ -0,0 +1,110 @@
+// Offline cook step for textures: writes a .ggtex container (see
+// GGEngine/Asset/TextureContainer.h) next to each source image, which
+// Texture::LoadCPU then maps instead of decoding the image.
+//
+//   TextureCooker [--force] <file or directory>...
+//
+// Directories are searched recursively. Sources whose bytes match their
+// existing container are skipped unless --force is given.
+
+#include "GGEngine/Core/Log.h"
+#include "GGEngine/Core/TaskGraph.h"
+#include "GGEngine/Asset/TextureContainer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+
+    bool IsSourceImage(const std::filesystem::path& path)
+    {
+        std::string ext = path.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+        return ext == ".png" || ext == ".jpg" || ext == ".jpeg" ||
+               ext == ".bmp" || ext == ".tga" || ext == ".gif";
+    }
+
+    void PrintUsage()
+    {
+        std::printf("Usage: TextureCooker [--force] <file or directory>...\n");
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    GGEngine::Log::Init();
+
+    bool force = false;
+    std::vector<std::filesystem::path> sources;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--force")
+        {
+            force = true;
+            continue;
+        }
+        if (arg == "--help" || arg == "-h")
+        {
+            PrintUsage();
+            return 0;
+        }
+
+        std::error_code error;
+        if (std::filesystem::is_directory(arg, error))
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(arg, error))
+            {
+                if (entry.is_regular_file(error) && IsSourceImage(entry.path()))
+                    sources.push_back(entry.path());
+            }
+        }
+        else if (std::filesystem::is_regular_file(arg, error))
+        {
+            sources.push_back(arg);
+        }
+        else
+        {
+            std::fprintf(stderr, "Not found: %s\n", arg.c_str());
+            return 1;
+        }
+    }
+
+    if (sources.empty())
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    // Mip generation splits each level across workers
+    GGEngine::TaskGraph::Get().Init();
+
+    uint32_t cooked = 0, upToDate = 0, failed = 0;
+    for (const auto& source : sources)
+    {
+        auto result = GGEngine::CookTexture(source, GGEngine::GetCookedTexturePath(source), force);
+        if (result.IsErr())
+        {
+            std::fprintf(stderr, "FAILED  %s: %s\n", source.string().c_str(), result.Error().c_str());
+            failed++;
+        }
+        else if (result.Value())
+        {
+            std::printf("cooked  %s\n", source.string().c_str());
+            cooked++;
+        }
+        else
+        {
+            upToDate++;
+        }
+    }
+
+    GGEngine::TaskGraph::Get().Shutdown();
+
+    std::printf("%u cooked, %u up to date, %u failed\n", cooked, upToDate, failed);
+    return failed > 0 ? 1 : 0;
+}